@@ -0,0 +1,51 @@
+/*
+ * benchmark.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "benchmark.h"
+#include <string.h>
+
+static void destructor(napi_env env, void *data, void *hint) {
+  Constructors *constructors = (Constructors *)data;
+
+  for (int i = 0; i < OBJECT_FACTORY_MAX; ++i)
+    if (constructors->objectFactories[i])
+      CHECK(napi_delete_reference(env, constructors->objectFactories[i]));
+
+  if (constructors->lazySlab.buffer)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.buffer));
+
+  if (constructors->lazySlab.view)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.view));
+
+  if (constructors->lazySlab.factory)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.factory));
+
+  free(constructors);
+}
+
+static napi_value init(napi_env env, napi_value exports) {
+  Constructors *constructors = (Constructors *)malloc(sizeof(Constructors));
+  napi_property_descriptor props[] = {
+      DECLARE_NAPI_METHOD(runQueue),
+      DECLARE_NAPI_METHOD(runDispatch),
+      DECLARE_NAPI_METHOD(runObject),
+  };
+
+  // The converters keep their object factories in the instance data.
+  memset(constructors, 0, sizeof(Constructors));
+  CHECK(napi_set_instance_data(env, constructors, destructor, nullptr));
+
+  CHECK(napi_define_properties(env, exports, arraysize(props), props));
+
+  return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, init)
@@ -0,0 +1,21 @@
+/*
+ * benchmark.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include "napi_ctp.h"
+
+napi_value runQueue(napi_env env, napi_callback_info info);
+napi_value runDispatch(napi_env env, napi_callback_info info);
+napi_value runObject(napi_env env, napi_callback_info info);
+
+#endif /* __BENCHMARK_H__ */
@@ -0,0 +1,118 @@
+/*
+ * dispatch.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "benchmark.h"
+#include "mdspi.h"
+#include "traderspi.h"
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef const char *(*EventNameFunc)(int event);
+typedef napi_status (*DispatchHandler)(const Message *message);
+
+static volatile uintptr_t dispatched = 0;
+
+static napi_status handler(const Message *message) {
+  dispatched = dispatched + message->data;
+  return napi_ok;
+}
+
+/* The lookups every message went through before the event tables were flattened. */
+static uint64_t dispatchByMap(EventNameFunc eventName, int base, int count, uint32_t total) {
+  std::map<int, std::string> names;
+  std::map<std::string, Listener> listeners;
+  std::map<int, DispatchHandler> handlers;
+  uint64_t start;
+
+  for (int i = 0; i < count; ++i) {
+    Listener listener = {};
+
+    listener.tsfn = nullptr;
+
+    names[base + i] = eventName(base + i);
+    listeners[eventName(base + i)] = listener;
+    handlers[base + i] = handler;
+  }
+
+  start = uv_hrtime();
+
+  for (uint32_t i = 0; i < total; ++i) {
+    Message message = {base + (int)(i % count), (uintptr_t)i};
+    auto name = names.find(message.event);
+
+    if (name == names.end())
+      continue;
+
+    auto listener = listeners.find(name->second);
+
+    if (listener == listeners.end())
+      continue;
+
+    auto func = handlers.find(message.event);
+
+    if (func != handlers.end())
+      func->second(&message);
+  }
+
+  return uv_hrtime() - start;
+}
+
+static uint64_t dispatchByIndex(int base, int count, uint32_t total) {
+  std::vector<std::atomic<Listener *>> listeners(count);
+  std::vector<DispatchHandler> handlers(count, handler);
+  Listener listener = {};
+  uint64_t start;
+
+  listener.tsfn = nullptr;
+
+  for (int i = 0; i < count; ++i)
+    listeners[i].store(&listener, std::memory_order_relaxed);
+
+  start = uv_hrtime();
+
+  for (uint32_t i = 0; i < total; ++i) {
+    Message message = {base + (int)(i % count), (uintptr_t)i};
+    int index = message.event - base;
+
+    if (index < 0 || index >= count)
+      continue;
+
+    if (!listeners[index].load(std::memory_order_acquire))
+      continue;
+
+    handlers[index](&message);
+  }
+
+  return uv_hrtime() - start;
+}
+
+napi_value runDispatch(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value argv[3], result;
+  uint32_t kind, family, count;
+  uint64_t elapsed;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+  CHECK(napi_get_value_uint32(env, argv[0], &kind));
+  CHECK(napi_get_value_uint32(env, argv[1], &family));
+  CHECK(napi_get_value_uint32(env, argv[2], &count));
+
+  if (family == 0)
+    elapsed = kind == 0 ? dispatchByMap(MdSpi::eventName, EM_BASE, EM_COUNT, count) : dispatchByIndex(EM_BASE, EM_COUNT, count);
+  else
+    elapsed = kind == 0 ? dispatchByMap(TraderSpi::eventName, ET_BASE, ET_COUNT, count) : dispatchByIndex(ET_BASE, ET_COUNT, count);
+
+  CHECK(napi_create_double(env, (double)elapsed / 1e9, &result));
+
+  return result;
+}
@@ -0,0 +1,29 @@
+/*
+ * dispatch.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ *
+ * Build with: npx node-gyp rebuild --napi_ctp_benchmark=true
+ */
+
+const bench = require("../build/Release/napi_ctp_benchmark.node");
+
+const count = 10000000;
+const kinds = ["std::map", "flat table"];
+const families = ["Market Data (14 events)", "Trader (131 events)"];
+
+families.forEach((family, familyIndex) => {
+  console.log(family);
+
+  kinds.forEach((kind, index) => {
+    const elapsed = bench.runDispatch(index, familyIndex, count);
+    const nanos = ((elapsed * 1e9) / count).toFixed(1);
+
+    console.log(`  ${kind.padEnd(12)} ${nanos.padStart(8)} ns/msg`);
+  });
+});
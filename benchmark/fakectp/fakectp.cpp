@@ -0,0 +1,139 @@
+/*
+ * fakectp.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "fakectp.h"
+#include <stdlib.h>
+
+static uint64_t getEnv(const char *name, uint64_t value) {
+  const char *env = getenv(name);
+  return env && *env ? strtoull(env, nullptr, 10) : value;
+}
+
+void loadFakeConfig(FakeConfig *config) {
+  config->ticks = getEnv("FAKECTP_TICKS", 100000);
+  config->rate = (uint32_t)getEnv("FAKECTP_RATE", 0);
+  config->rows = (uint32_t)getEnv("FAKECTP_ROWS", 100);
+  config->delay = (uint32_t)getEnv("FAKECTP_DELAY", 10);
+  config->fill = getEnv("FAKECTP_FILL", 1) != 0;
+}
+
+FakeWorker::FakeWorker() : _sequence(0), _count(0), _rate(0), _stopping(false) {
+  _thread = std::thread(&FakeWorker::run, this);
+}
+
+FakeWorker::~FakeWorker() {
+  stop();
+}
+
+void FakeWorker::post(Task task) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _tasks.push_back(std::move(task));
+  _cond.notify_one();
+}
+
+void FakeWorker::postDelayed(uint32_t millisec, Task task) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _delayed.emplace_back(Clock::now() + std::chrono::milliseconds(millisec), std::move(task));
+  _cond.notify_one();
+}
+
+void FakeWorker::startTicker(Ticker ticker, uint64_t count, uint32_t rate) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _ticker = std::move(ticker);
+  _sequence = 0;
+  _count = count;
+  _rate = rate;
+  _started = Clock::now();
+  _cond.notify_one();
+}
+
+void FakeWorker::stopTicker() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _ticker = nullptr;
+}
+
+void FakeWorker::stop() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _stopping = true;
+    _cond.notify_one();
+  }
+
+  if (_thread.joinable())
+    _thread.join();
+}
+
+void FakeWorker::run() {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  while (!_stopping) {
+    Clock::time_point now = Clock::now(), wakeup = Clock::time_point::max();
+
+    if (!_tasks.empty()) {
+      Task task = std::move(_tasks.front());
+
+      _tasks.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+      continue;
+    }
+
+    auto due = _delayed.begin();
+
+    for (auto it = _delayed.begin(); it != _delayed.end(); ++it)
+      if (it->first < due->first)
+        due = it;
+
+    if (due != _delayed.end()) {
+      if (due->first <= now) {
+        Task task = std::move(due->second);
+
+        _delayed.erase(due);
+        lock.unlock();
+        task();
+        lock.lock();
+        continue;
+      }
+
+      wakeup = due->first;
+    }
+
+    if (_ticker && (_count == 0 || _sequence < _count)) {
+      Clock::time_point next = _started;
+
+      if (_rate > 0)
+        next += std::chrono::nanoseconds(_sequence * 1000000000ull / _rate);
+
+      if (next <= now) {
+        Ticker ticker = _ticker;
+        uint64_t sequence = _sequence++;
+
+        lock.unlock();
+        ticker(sequence);
+        lock.lock();
+        continue;
+      }
+
+      if (next < wakeup)
+        wakeup = next;
+    }
+
+    if (wakeup == Clock::time_point::max())
+      _cond.wait(lock);
+    else
+      _cond.wait_until(lock, wakeup);
+  }
+}
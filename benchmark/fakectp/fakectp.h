@@ -0,0 +1,94 @@
+/*
+ * fakectp.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __FAKECTP_H__
+#define __FAKECTP_H__
+
+#include "ThostFtdcUserApiStruct.h"
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#define FAKECTP_TRADING_DAY "20231020"
+#define FAKECTP_EXCHANGE "SHFE"
+
+/*
+ * Tunables, read from the environment when an API object is created:
+ *
+ *   FAKECTP_TICKS   depth market data ticks in total, 0 for endless
+ *   FAKECTP_RATE    ticks per second, 0 for as fast as the consumer takes them
+ *   FAKECTP_ROWS    rows returned by the multi-row queries
+ *   FAKECTP_FILL    1 to fill every order at once, 0 to leave them queueing
+ *   FAKECTP_DELAY   milliseconds before OnFrontConnected
+ */
+typedef struct FakeConfig {
+  uint64_t ticks;
+  uint32_t rate;
+  uint32_t rows;
+  uint32_t delay;
+  bool fill;
+} FakeConfig;
+
+void loadFakeConfig(FakeConfig *config);
+
+/*
+ * The single callback thread of a fake API object. Like the real library,
+ * every SPI callback runs here and never on the thread calling Req*.
+ * Requests are answered in order; a ticker, when set, runs in between.
+ */
+class FakeWorker {
+public:
+  typedef std::function<void()> Task;
+  typedef std::function<void(uint64_t sequence)> Ticker;
+
+  FakeWorker();
+  ~FakeWorker();
+
+  void post(Task task);
+  void postDelayed(uint32_t millisec, Task task);
+  void startTicker(Ticker ticker, uint64_t count, uint32_t rate);
+  void stopTicker();
+  void stop();
+
+private:
+  void run();
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  std::thread _thread;
+  std::mutex _mutex;
+  std::condition_variable _cond;
+  std::deque<Task> _tasks;
+  std::deque<std::pair<Clock::time_point, Task>> _delayed;
+  Ticker _ticker;
+  uint64_t _sequence;
+  uint64_t _count;
+  uint32_t _rate;
+  Clock::time_point _started;
+  bool _stopping;
+};
+
+// Copies a C string into a fixed size CTP field.
+template <size_t N> static inline void fakeCopy(char (&field)[N], const char *value) {
+  size_t i = 0;
+
+  for (; i + 1 < N && value[i]; ++i)
+    field[i] = value[i];
+
+  field[i] = 0;
+}
+
+#endif /* __FAKECTP_H__ */
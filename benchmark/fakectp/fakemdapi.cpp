@@ -0,0 +1,219 @@
+/*
+ * fakemdapi.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "ThostFtdcMdApi.h"
+#include "fakectp.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*
+ * Market data stand-in: answers login and subscriptions, then ticks round
+ * robin over the subscribed instruments until FAKECTP_TICKS have been sent.
+ */
+class FakeMdApi final : public CThostFtdcMdApi {
+public:
+  FakeMdApi() : _spi(nullptr), _ticking(false) {
+    loadFakeConfig(&_config);
+    memset(&_rspInfo, 0, sizeof(_rspInfo));
+  }
+
+  void Release() {
+    _worker.stop();
+    delete this;
+  }
+
+  void Init() {
+    _worker.postDelayed(_config.delay, [this]() {
+      if (_spi)
+        _spi->OnFrontConnected();
+    });
+  }
+
+  int Join() {
+    return 0;
+  }
+
+  const char *GetTradingDay() {
+    return FAKECTP_TRADING_DAY;
+  }
+
+  void RegisterFront(char *pszFrontAddress) {}
+  void RegisterNameServer(char *pszNsAddress) {}
+  void RegisterFensUserInfo(CThostFtdcFensUserInfoField *pFensUserInfo) {}
+
+  void RegisterSpi(CThostFtdcMdSpi *pSpi) {
+    _spi = pSpi;
+  }
+
+  int SubscribeMarketData(char *ppInstrumentID[], int nCount) {
+    std::vector<std::string> instruments(ppInstrumentID, ppInstrumentID + nCount);
+
+    _worker.post([this, instruments]() {
+      CThostFtdcSpecificInstrumentField specific;
+
+      for (size_t i = 0; i < instruments.size(); ++i) {
+        if (std::find(_instruments.begin(), _instruments.end(), instruments[i]) == _instruments.end())
+          _instruments.push_back(instruments[i]);
+
+        memset(&specific, 0, sizeof(specific));
+        fakeCopy(specific.InstrumentID, instruments[i].c_str());
+
+        if (_spi)
+          _spi->OnRspSubMarketData(&specific, &_rspInfo, 0, i + 1 == instruments.size());
+      }
+
+      if (!_ticking && !_instruments.empty()) {
+        _ticking = true;
+        _worker.startTicker([this](uint64_t sequence) { tick(sequence); }, _config.ticks, _config.rate);
+      }
+    });
+
+    return 0;
+  }
+
+  int UnSubscribeMarketData(char *ppInstrumentID[], int nCount) {
+    std::vector<std::string> instruments(ppInstrumentID, ppInstrumentID + nCount);
+
+    _worker.post([this, instruments]() {
+      CThostFtdcSpecificInstrumentField specific;
+
+      for (size_t i = 0; i < instruments.size(); ++i) {
+        _instruments.erase(std::remove(_instruments.begin(), _instruments.end(), instruments[i]), _instruments.end());
+
+        memset(&specific, 0, sizeof(specific));
+        fakeCopy(specific.InstrumentID, instruments[i].c_str());
+
+        if (_spi)
+          _spi->OnRspUnSubMarketData(&specific, &_rspInfo, 0, i + 1 == instruments.size());
+      }
+    });
+
+    return 0;
+  }
+
+  int SubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+    return 0;
+  }
+
+  int UnSubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+    return 0;
+  }
+
+  int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID) {
+    CThostFtdcReqUserLoginField request = *pReqUserLoginField;
+
+    _worker.post([this, request, nRequestID]() {
+      CThostFtdcRspUserLoginField login;
+
+      memset(&login, 0, sizeof(login));
+      fakeCopy(login.TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(login.LoginTime, "09:00:00");
+      fakeCopy(login.BrokerID, request.BrokerID);
+      fakeCopy(login.UserID, request.UserID);
+
+      if (_spi)
+        _spi->OnRspUserLogin(&login, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID) {
+    CThostFtdcUserLogoutField request = *pUserLogout;
+
+    _worker.post([this, request, nRequestID]() mutable {
+      if (_spi)
+        _spi->OnRspUserLogout(&request, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  int ReqQryMulticastInstrument(CThostFtdcQryMulticastInstrumentField *pQryMulticastInstrument, int nRequestID) {
+    _worker.post([this, nRequestID]() {
+      if (_spi)
+        _spi->OnRspQryMulticastInstrument(nullptr, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+private:
+  ~FakeMdApi() {}
+
+  void tick(uint64_t sequence) {
+    CThostFtdcDepthMarketDataField &depth = _depth;
+    uint64_t round;
+    int seconds;
+    double price;
+
+    if (_instruments.empty() || !_spi)
+      return;
+
+    round = sequence / _instruments.size();
+    seconds = 9 * 3600 + (int)(round / 2 % (6 * 3600));
+    price = 4000 + (double)(sequence % 17);
+
+    memset(&depth, 0, sizeof(depth));
+    fakeCopy(depth.TradingDay, FAKECTP_TRADING_DAY);
+    fakeCopy(depth.ActionDay, FAKECTP_TRADING_DAY);
+    fakeCopy(depth.ExchangeID, FAKECTP_EXCHANGE);
+    fakeCopy(depth.InstrumentID, _instruments[sequence % _instruments.size()].c_str());
+    snprintf(depth.UpdateTime, sizeof(depth.UpdateTime), "%02d:%02d:%02d", seconds / 3600, seconds / 60 % 60, seconds % 60);
+
+    depth.UpdateMillisec = (int)(round % 2) * 500;
+    depth.LastPrice = price;
+    depth.PreSettlementPrice = 4000;
+    depth.PreClosePrice = 4000;
+    depth.OpenPrice = 4000;
+    depth.HighestPrice = 4016;
+    depth.LowestPrice = 4000;
+    depth.Volume = (int)round;
+    depth.Turnover = round * price * 10;
+    depth.OpenInterest = 100000 + (double)(round % 1000);
+    depth.UpperLimitPrice = 4400;
+    depth.LowerLimitPrice = 3600;
+    depth.AveragePrice = price * 10;
+
+    depth.BidPrice1 = price - 1, depth.BidVolume1 = 10;
+    depth.AskPrice1 = price + 1, depth.AskVolume1 = 11;
+    depth.BidPrice2 = price - 2, depth.BidVolume2 = 20;
+    depth.AskPrice2 = price + 2, depth.AskVolume2 = 21;
+    depth.BidPrice3 = price - 3, depth.BidVolume3 = 30;
+    depth.AskPrice3 = price + 3, depth.AskVolume3 = 31;
+    depth.BidPrice4 = price - 4, depth.BidVolume4 = 40;
+    depth.AskPrice4 = price + 4, depth.AskVolume4 = 41;
+    depth.BidPrice5 = price - 5, depth.BidVolume5 = 50;
+    depth.AskPrice5 = price + 5, depth.AskVolume5 = 51;
+
+    _spi->OnRtnDepthMarketData(&depth);
+  }
+
+private:
+  FakeConfig _config;
+  FakeWorker _worker;
+  CThostFtdcMdSpi *_spi;
+  CThostFtdcRspInfoField _rspInfo;
+  CThostFtdcDepthMarketDataField _depth;
+  std::vector<std::string> _instruments;
+  bool _ticking;
+};
+
+CThostFtdcMdApi *CThostFtdcMdApi::CreateFtdcMdApi(const char *pszFlowPath, const bool bIsUsingUdp, const bool bIsMulticast) {
+  return new FakeMdApi();
+}
+
+const char *CThostFtdcMdApi::GetApiVersion() {
+  return "napi-ctp fakectp " FAKECTP_TRADING_DAY;
+}
@@ -0,0 +1,731 @@
+/*
+ * faketraderapi.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "ThostFtdcTraderApi.h"
+#include "fakectp.h"
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#define FAKECTP_FRONT_ID 1
+#define FAKECTP_SESSION_ID 20231020
+
+/* "螺纹钢" in GBK, the encoding every CTP string comes in. */
+#define FAKECTP_INSTRUMENT_NAME "\xC2\xDD\xCE\xC6\xB8\xD6"
+
+/*
+ * Trader stand-in: orders are accepted and, unless FAKECTP_FILL=0, filled
+ * at their limit price; queueing orders can be cancelled. The common
+ * queries return FAKECTP_ROWS rows, every other request is answered with
+ * its own fields echoed back or with an empty last response.
+ */
+class FakeTraderApi final : public CThostFtdcTraderApi {
+public:
+  FakeTraderApi() : _spi(nullptr), _orderSysID(0), _tradeID(0) {
+    loadFakeConfig(&_config);
+    memset(&_rspInfo, 0, sizeof(_rspInfo));
+  }
+
+  void Release() {
+    _worker.stop();
+    delete this;
+  }
+
+  void Init() {
+    _worker.postDelayed(_config.delay, [this]() {
+      if (_spi)
+        _spi->OnFrontConnected();
+    });
+  }
+
+  int Join() {
+    return 0;
+  }
+
+  const char *GetTradingDay() {
+    return FAKECTP_TRADING_DAY;
+  }
+
+  void RegisterFront(char *pszFrontAddress) {}
+  void RegisterNameServer(char *pszNsAddress) {}
+  void RegisterFensUserInfo(CThostFtdcFensUserInfoField *pFensUserInfo) {}
+
+  void RegisterSpi(CThostFtdcTraderSpi *pSpi) {
+    _spi = pSpi;
+  }
+
+  void SubscribePrivateTopic(THOST_TE_RESUME_TYPE nResumeType) {}
+  void SubscribePublicTopic(THOST_TE_RESUME_TYPE nResumeType) {}
+
+  int RegisterUserSystemInfo(CThostFtdcUserSystemInfoField *pUserSystemInfo) {
+    return 0;
+  }
+
+  int SubmitUserSystemInfo(CThostFtdcUserSystemInfoField *pUserSystemInfo) {
+    return 0;
+  }
+
+  int ReqAuthenticate(CThostFtdcReqAuthenticateField *pReqAuthenticateField, int nRequestID) {
+    CThostFtdcReqAuthenticateField request = *pReqAuthenticateField;
+
+    _worker.post([this, request, nRequestID]() {
+      CThostFtdcRspAuthenticateField authenticate;
+
+      memset(&authenticate, 0, sizeof(authenticate));
+      fakeCopy(authenticate.BrokerID, request.BrokerID);
+      fakeCopy(authenticate.UserID, request.UserID);
+      fakeCopy(authenticate.UserProductInfo, request.UserProductInfo);
+      fakeCopy(authenticate.AppID, request.AppID);
+
+      if (_spi)
+        _spi->OnRspAuthenticate(&authenticate, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID) {
+    return login(pReqUserLoginField->BrokerID, pReqUserLoginField->UserID, nRequestID);
+  }
+
+  int ReqUserLoginWithCaptcha(CThostFtdcReqUserLoginWithCaptchaField *pReqUserLoginWithCaptcha, int nRequestID) {
+    return login(pReqUserLoginWithCaptcha->BrokerID, pReqUserLoginWithCaptcha->UserID, nRequestID);
+  }
+
+  int ReqUserLoginWithText(CThostFtdcReqUserLoginWithTextField *pReqUserLoginWithText, int nRequestID) {
+    return login(pReqUserLoginWithText->BrokerID, pReqUserLoginWithText->UserID, nRequestID);
+  }
+
+  int ReqUserLoginWithOTP(CThostFtdcReqUserLoginWithOTPField *pReqUserLoginWithOTP, int nRequestID) {
+    return login(pReqUserLoginWithOTP->BrokerID, pReqUserLoginWithOTP->UserID, nRequestID);
+  }
+
+  int ReqOrderInsert(CThostFtdcInputOrderField *pInputOrder, int nRequestID) {
+    CThostFtdcInputOrderField input = *pInputOrder;
+
+    _worker.post([this, input, nRequestID]() { insertOrder(input, nRequestID); });
+    return 0;
+  }
+
+  int ReqOrderAction(CThostFtdcInputOrderActionField *pInputOrderAction, int nRequestID) {
+    CThostFtdcInputOrderActionField action = *pInputOrderAction;
+
+    _worker.post([this, action, nRequestID]() mutable { cancelOrder(action, nRequestID); });
+    return 0;
+  }
+
+  int ReqQryOrder(CThostFtdcQryOrderField *pQryOrder, int nRequestID) {
+    return rows(nRequestID, &CThostFtdcTraderSpi::OnRspQryOrder, [](CThostFtdcOrderField *order, uint32_t row) {
+      snprintf(order->InstrumentID, sizeof(order->InstrumentID), "rb%04u", row);
+      snprintf(order->OrderRef, sizeof(order->OrderRef), "%12u", row + 1);
+      snprintf(order->OrderSysID, sizeof(order->OrderSysID), "%12u", row + 1);
+      fakeCopy(order->ExchangeID, FAKECTP_EXCHANGE);
+      fakeCopy(order->TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(order->InsertDate, FAKECTP_TRADING_DAY);
+      fakeCopy(order->InsertTime, "09:00:00");
+      order->Direction = THOST_FTDC_D_Buy;
+      order->CombOffsetFlag[0] = THOST_FTDC_OF_Open;
+      order->CombHedgeFlag[0] = THOST_FTDC_HF_Speculation;
+      order->OrderPriceType = THOST_FTDC_OPT_LimitPrice;
+      order->LimitPrice = 4000 + row;
+      order->VolumeTotalOriginal = 1;
+      order->VolumeTraded = 1;
+      order->OrderStatus = THOST_FTDC_OST_AllTraded;
+      order->OrderSubmitStatus = THOST_FTDC_OSS_Accepted;
+      order->FrontID = FAKECTP_FRONT_ID;
+      order->SessionID = FAKECTP_SESSION_ID;
+    });
+  }
+
+  int ReqQryTrade(CThostFtdcQryTradeField *pQryTrade, int nRequestID) {
+    return rows(nRequestID, &CThostFtdcTraderSpi::OnRspQryTrade, [](CThostFtdcTradeField *trade, uint32_t row) {
+      snprintf(trade->InstrumentID, sizeof(trade->InstrumentID), "rb%04u", row);
+      snprintf(trade->OrderRef, sizeof(trade->OrderRef), "%12u", row + 1);
+      snprintf(trade->OrderSysID, sizeof(trade->OrderSysID), "%12u", row + 1);
+      snprintf(trade->TradeID, sizeof(trade->TradeID), "%12u", row + 1);
+      fakeCopy(trade->ExchangeID, FAKECTP_EXCHANGE);
+      fakeCopy(trade->TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(trade->TradeDate, FAKECTP_TRADING_DAY);
+      fakeCopy(trade->TradeTime, "09:00:00");
+      trade->Direction = THOST_FTDC_D_Buy;
+      trade->OffsetFlag = THOST_FTDC_OF_Open;
+      trade->HedgeFlag = THOST_FTDC_HF_Speculation;
+      trade->Price = 4000 + row;
+      trade->Volume = 1;
+    });
+  }
+
+  int ReqQryInvestorPosition(CThostFtdcQryInvestorPositionField *pQryInvestorPosition, int nRequestID) {
+    return rows(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestorPosition, [](CThostFtdcInvestorPositionField *position, uint32_t row) {
+      snprintf(position->InstrumentID, sizeof(position->InstrumentID), "rb%04u", row);
+      fakeCopy(position->ExchangeID, FAKECTP_EXCHANGE);
+      fakeCopy(position->TradingDay, FAKECTP_TRADING_DAY);
+      position->PosiDirection = THOST_FTDC_PD_Long;
+      position->HedgeFlag = THOST_FTDC_HF_Speculation;
+      position->PositionDate = THOST_FTDC_PSD_Today;
+      position->Position = 1 + row % 10;
+      position->TodayPosition = position->Position;
+      position->OpenVolume = position->Position;
+      position->PositionCost = position->Position * 40000.0;
+      position->OpenCost = position->PositionCost;
+      position->UseMargin = position->PositionCost * 0.1;
+    });
+  }
+
+  int ReqQryTradingAccount(CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID) {
+    CThostFtdcQryTradingAccountField request = *pQryTradingAccount;
+
+    _worker.post([this, request, nRequestID]() {
+      CThostFtdcTradingAccountField account;
+
+      memset(&account, 0, sizeof(account));
+      fakeCopy(account.BrokerID, request.BrokerID);
+      fakeCopy(account.AccountID, request.InvestorID);
+      fakeCopy(account.TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(account.CurrencyID, "CNY");
+      account.PreBalance = 1000000;
+      account.Balance = 1000000;
+      account.Available = 1000000;
+      account.WithdrawQuota = 1000000;
+
+      if (_spi)
+        _spi->OnRspQryTradingAccount(&account, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  int ReqQryInstrument(CThostFtdcQryInstrumentField *pQryInstrument, int nRequestID) {
+    return rows(nRequestID, &CThostFtdcTraderSpi::OnRspQryInstrument, [](CThostFtdcInstrumentField *instrument, uint32_t row) {
+      snprintf(instrument->InstrumentID, sizeof(instrument->InstrumentID), "rb%04u", row);
+      snprintf(instrument->InstrumentName, sizeof(instrument->InstrumentName), FAKECTP_INSTRUMENT_NAME "%04u", row);
+      fakeCopy(instrument->ExchangeID, FAKECTP_EXCHANGE);
+      fakeCopy(instrument->ProductID, "rb");
+      fakeCopy(instrument->CreateDate, "20230101");
+      fakeCopy(instrument->OpenDate, "20230101");
+      fakeCopy(instrument->ExpireDate, "20241231");
+      instrument->ProductClass = THOST_FTDC_PC_Futures;
+      instrument->DeliveryYear = 2024;
+      instrument->DeliveryMonth = 1 + row % 12;
+      instrument->MaxMarketOrderVolume = 30;
+      instrument->MinMarketOrderVolume = 1;
+      instrument->MaxLimitOrderVolume = 500;
+      instrument->MinLimitOrderVolume = 1;
+      instrument->VolumeMultiple = 10;
+      instrument->PriceTick = 1;
+      instrument->IsTrading = 1;
+      instrument->InstLifePhase = THOST_FTDC_IP_Started;
+      instrument->PositionType = THOST_FTDC_PT_Gross;
+      instrument->LongMarginRatio = 0.1;
+      instrument->ShortMarginRatio = 0.1;
+    });
+  }
+
+  int ReqQryDepthMarketData(CThostFtdcQryDepthMarketDataField *pQryDepthMarketData, int nRequestID) {
+    return rows(nRequestID, &CThostFtdcTraderSpi::OnRspQryDepthMarketData, [](CThostFtdcDepthMarketDataField *depth, uint32_t row) {
+      snprintf(depth->InstrumentID, sizeof(depth->InstrumentID), "rb%04u", row);
+      fakeCopy(depth->ExchangeID, FAKECTP_EXCHANGE);
+      fakeCopy(depth->TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(depth->ActionDay, FAKECTP_TRADING_DAY);
+      fakeCopy(depth->UpdateTime, "09:00:00");
+      depth->LastPrice = 4000 + row;
+      depth->PreSettlementPrice = 4000;
+      depth->UpperLimitPrice = 4400;
+      depth->LowerLimitPrice = 3600;
+      depth->BidPrice1 = depth->LastPrice - 1;
+      depth->BidVolume1 = 10;
+      depth->AskPrice1 = depth->LastPrice + 1;
+      depth->AskVolume1 = 10;
+    });
+  }
+
+  int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID) {
+    return echo(pUserLogout, nRequestID, &CThostFtdcTraderSpi::OnRspUserLogout);
+  }
+
+  int ReqUserPasswordUpdate(CThostFtdcUserPasswordUpdateField *pUserPasswordUpdate, int nRequestID) {
+    return echo(pUserPasswordUpdate, nRequestID, &CThostFtdcTraderSpi::OnRspUserPasswordUpdate);
+  }
+
+  int ReqTradingAccountPasswordUpdate(CThostFtdcTradingAccountPasswordUpdateField *pTradingAccountPasswordUpdate, int nRequestID) {
+    return echo(pTradingAccountPasswordUpdate, nRequestID, &CThostFtdcTraderSpi::OnRspTradingAccountPasswordUpdate);
+  }
+
+  int ReqParkedOrderInsert(CThostFtdcParkedOrderField *pParkedOrder, int nRequestID) {
+    return echo(pParkedOrder, nRequestID, &CThostFtdcTraderSpi::OnRspParkedOrderInsert);
+  }
+
+  int ReqParkedOrderAction(CThostFtdcParkedOrderActionField *pParkedOrderAction, int nRequestID) {
+    return echo(pParkedOrderAction, nRequestID, &CThostFtdcTraderSpi::OnRspParkedOrderAction);
+  }
+
+  int ReqQryMaxOrderVolume(CThostFtdcQryMaxOrderVolumeField *pQryMaxOrderVolume, int nRequestID) {
+    return echo(pQryMaxOrderVolume, nRequestID, &CThostFtdcTraderSpi::OnRspQryMaxOrderVolume);
+  }
+
+  int ReqSettlementInfoConfirm(CThostFtdcSettlementInfoConfirmField *pSettlementInfoConfirm, int nRequestID) {
+    return echo(pSettlementInfoConfirm, nRequestID, &CThostFtdcTraderSpi::OnRspSettlementInfoConfirm);
+  }
+
+  int ReqRemoveParkedOrder(CThostFtdcRemoveParkedOrderField *pRemoveParkedOrder, int nRequestID) {
+    return echo(pRemoveParkedOrder, nRequestID, &CThostFtdcTraderSpi::OnRspRemoveParkedOrder);
+  }
+
+  int ReqRemoveParkedOrderAction(CThostFtdcRemoveParkedOrderActionField *pRemoveParkedOrderAction, int nRequestID) {
+    return echo(pRemoveParkedOrderAction, nRequestID, &CThostFtdcTraderSpi::OnRspRemoveParkedOrderAction);
+  }
+
+  int ReqExecOrderInsert(CThostFtdcInputExecOrderField *pInputExecOrder, int nRequestID) {
+    return echo(pInputExecOrder, nRequestID, &CThostFtdcTraderSpi::OnRspExecOrderInsert);
+  }
+
+  int ReqExecOrderAction(CThostFtdcInputExecOrderActionField *pInputExecOrderAction, int nRequestID) {
+    return echo(pInputExecOrderAction, nRequestID, &CThostFtdcTraderSpi::OnRspExecOrderAction);
+  }
+
+  int ReqForQuoteInsert(CThostFtdcInputForQuoteField *pInputForQuote, int nRequestID) {
+    return echo(pInputForQuote, nRequestID, &CThostFtdcTraderSpi::OnRspForQuoteInsert);
+  }
+
+  int ReqQuoteInsert(CThostFtdcInputQuoteField *pInputQuote, int nRequestID) {
+    return echo(pInputQuote, nRequestID, &CThostFtdcTraderSpi::OnRspQuoteInsert);
+  }
+
+  int ReqQuoteAction(CThostFtdcInputQuoteActionField *pInputQuoteAction, int nRequestID) {
+    return echo(pInputQuoteAction, nRequestID, &CThostFtdcTraderSpi::OnRspQuoteAction);
+  }
+
+  int ReqBatchOrderAction(CThostFtdcInputBatchOrderActionField *pInputBatchOrderAction, int nRequestID) {
+    return echo(pInputBatchOrderAction, nRequestID, &CThostFtdcTraderSpi::OnRspBatchOrderAction);
+  }
+
+  int ReqOptionSelfCloseInsert(CThostFtdcInputOptionSelfCloseField *pInputOptionSelfClose, int nRequestID) {
+    return echo(pInputOptionSelfClose, nRequestID, &CThostFtdcTraderSpi::OnRspOptionSelfCloseInsert);
+  }
+
+  int ReqOptionSelfCloseAction(CThostFtdcInputOptionSelfCloseActionField *pInputOptionSelfCloseAction, int nRequestID) {
+    return echo(pInputOptionSelfCloseAction, nRequestID, &CThostFtdcTraderSpi::OnRspOptionSelfCloseAction);
+  }
+
+  int ReqCombActionInsert(CThostFtdcInputCombActionField *pInputCombAction, int nRequestID) {
+    return echo(pInputCombAction, nRequestID, &CThostFtdcTraderSpi::OnRspCombActionInsert);
+  }
+
+  int ReqQueryCFMMCTradingAccountToken(CThostFtdcQueryCFMMCTradingAccountTokenField *pQueryCFMMCTradingAccountToken, int nRequestID) {
+    return echo(pQueryCFMMCTradingAccountToken, nRequestID, &CThostFtdcTraderSpi::OnRspQueryCFMMCTradingAccountToken);
+  }
+
+  int ReqFromBankToFutureByFuture(CThostFtdcReqTransferField *pReqTransfer, int nRequestID) {
+    return echo(pReqTransfer, nRequestID, &CThostFtdcTraderSpi::OnRspFromBankToFutureByFuture);
+  }
+
+  int ReqFromFutureToBankByFuture(CThostFtdcReqTransferField *pReqTransfer, int nRequestID) {
+    return echo(pReqTransfer, nRequestID, &CThostFtdcTraderSpi::OnRspFromFutureToBankByFuture);
+  }
+
+  int ReqQueryBankAccountMoneyByFuture(CThostFtdcReqQueryAccountField *pReqQueryAccount, int nRequestID) {
+    return echo(pReqQueryAccount, nRequestID, &CThostFtdcTraderSpi::OnRspQueryBankAccountMoneyByFuture);
+  }
+
+  int ReqUserAuthMethod(CThostFtdcReqUserAuthMethodField *pReqUserAuthMethod, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspUserAuthMethod);
+  }
+
+  int ReqGenUserCaptcha(CThostFtdcReqGenUserCaptchaField *pReqGenUserCaptcha, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspGenUserCaptcha);
+  }
+
+  int ReqGenUserText(CThostFtdcReqGenUserTextField *pReqGenUserText, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspGenUserText);
+  }
+
+  int ReqQryInvestor(CThostFtdcQryInvestorField *pQryInvestor, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestor);
+  }
+
+  int ReqQryTradingCode(CThostFtdcQryTradingCodeField *pQryTradingCode, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryTradingCode);
+  }
+
+  int ReqQryInstrumentMarginRate(CThostFtdcQryInstrumentMarginRateField *pQryInstrumentMarginRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInstrumentMarginRate);
+  }
+
+  int ReqQryInstrumentCommissionRate(CThostFtdcQryInstrumentCommissionRateField *pQryInstrumentCommissionRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInstrumentCommissionRate);
+  }
+
+  int ReqQryExchange(CThostFtdcQryExchangeField *pQryExchange, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryExchange);
+  }
+
+  int ReqQryProduct(CThostFtdcQryProductField *pQryProduct, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryProduct);
+  }
+
+  int ReqQryTraderOffer(CThostFtdcQryTraderOfferField *pQryTraderOffer, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryTraderOffer);
+  }
+
+  int ReqQrySettlementInfo(CThostFtdcQrySettlementInfoField *pQrySettlementInfo, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySettlementInfo);
+  }
+
+  int ReqQryTransferBank(CThostFtdcQryTransferBankField *pQryTransferBank, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryTransferBank);
+  }
+
+  int ReqQryInvestorPositionDetail(CThostFtdcQryInvestorPositionDetailField *pQryInvestorPositionDetail, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestorPositionDetail);
+  }
+
+  int ReqQryNotice(CThostFtdcQryNoticeField *pQryNotice, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryNotice);
+  }
+
+  int ReqQrySettlementInfoConfirm(CThostFtdcQrySettlementInfoConfirmField *pQrySettlementInfoConfirm, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySettlementInfoConfirm);
+  }
+
+  int ReqQryInvestorPositionCombineDetail(CThostFtdcQryInvestorPositionCombineDetailField *pQryInvestorPositionCombineDetail, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestorPositionCombineDetail);
+  }
+
+  int ReqQryCFMMCTradingAccountKey(CThostFtdcQryCFMMCTradingAccountKeyField *pQryCFMMCTradingAccountKey, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryCFMMCTradingAccountKey);
+  }
+
+  int ReqQryEWarrantOffset(CThostFtdcQryEWarrantOffsetField *pQryEWarrantOffset, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryEWarrantOffset);
+  }
+
+  int ReqQryInvestorProductGroupMargin(CThostFtdcQryInvestorProductGroupMarginField *pQryInvestorProductGroupMargin, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestorProductGroupMargin);
+  }
+
+  int ReqQryExchangeMarginRate(CThostFtdcQryExchangeMarginRateField *pQryExchangeMarginRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryExchangeMarginRate);
+  }
+
+  int ReqQryExchangeMarginRateAdjust(CThostFtdcQryExchangeMarginRateAdjustField *pQryExchangeMarginRateAdjust, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryExchangeMarginRateAdjust);
+  }
+
+  int ReqQryExchangeRate(CThostFtdcQryExchangeRateField *pQryExchangeRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryExchangeRate);
+  }
+
+  int ReqQrySecAgentACIDMap(CThostFtdcQrySecAgentACIDMapField *pQrySecAgentACIDMap, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySecAgentACIDMap);
+  }
+
+  int ReqQryProductExchRate(CThostFtdcQryProductExchRateField *pQryProductExchRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryProductExchRate);
+  }
+
+  int ReqQryProductGroup(CThostFtdcQryProductGroupField *pQryProductGroup, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryProductGroup);
+  }
+
+  int ReqQryMMInstrumentCommissionRate(CThostFtdcQryMMInstrumentCommissionRateField *pQryMMInstrumentCommissionRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryMMInstrumentCommissionRate);
+  }
+
+  int ReqQryMMOptionInstrCommRate(CThostFtdcQryMMOptionInstrCommRateField *pQryMMOptionInstrCommRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryMMOptionInstrCommRate);
+  }
+
+  int ReqQryInstrumentOrderCommRate(CThostFtdcQryInstrumentOrderCommRateField *pQryInstrumentOrderCommRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInstrumentOrderCommRate);
+  }
+
+  int ReqQrySecAgentTradingAccount(CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySecAgentTradingAccount);
+  }
+
+  int ReqQrySecAgentCheckMode(CThostFtdcQrySecAgentCheckModeField *pQrySecAgentCheckMode, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySecAgentCheckMode);
+  }
+
+  int ReqQrySecAgentTradeInfo(CThostFtdcQrySecAgentTradeInfoField *pQrySecAgentTradeInfo, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQrySecAgentTradeInfo);
+  }
+
+  int ReqQryOptionInstrTradeCost(CThostFtdcQryOptionInstrTradeCostField *pQryOptionInstrTradeCost, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryOptionInstrTradeCost);
+  }
+
+  int ReqQryOptionInstrCommRate(CThostFtdcQryOptionInstrCommRateField *pQryOptionInstrCommRate, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryOptionInstrCommRate);
+  }
+
+  int ReqQryExecOrder(CThostFtdcQryExecOrderField *pQryExecOrder, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryExecOrder);
+  }
+
+  int ReqQryForQuote(CThostFtdcQryForQuoteField *pQryForQuote, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryForQuote);
+  }
+
+  int ReqQryQuote(CThostFtdcQryQuoteField *pQryQuote, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryQuote);
+  }
+
+  int ReqQryOptionSelfClose(CThostFtdcQryOptionSelfCloseField *pQryOptionSelfClose, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryOptionSelfClose);
+  }
+
+  int ReqQryInvestUnit(CThostFtdcQryInvestUnitField *pQryInvestUnit, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryInvestUnit);
+  }
+
+  int ReqQryCombInstrumentGuard(CThostFtdcQryCombInstrumentGuardField *pQryCombInstrumentGuard, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryCombInstrumentGuard);
+  }
+
+  int ReqQryCombAction(CThostFtdcQryCombActionField *pQryCombAction, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryCombAction);
+  }
+
+  int ReqQryTransferSerial(CThostFtdcQryTransferSerialField *pQryTransferSerial, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryTransferSerial);
+  }
+
+  int ReqQryAccountregister(CThostFtdcQryAccountregisterField *pQryAccountregister, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryAccountregister);
+  }
+
+  int ReqQryContractBank(CThostFtdcQryContractBankField *pQryContractBank, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryContractBank);
+  }
+
+  int ReqQryParkedOrder(CThostFtdcQryParkedOrderField *pQryParkedOrder, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryParkedOrder);
+  }
+
+  int ReqQryParkedOrderAction(CThostFtdcQryParkedOrderActionField *pQryParkedOrderAction, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryParkedOrderAction);
+  }
+
+  int ReqQryTradingNotice(CThostFtdcQryTradingNoticeField *pQryTradingNotice, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryTradingNotice);
+  }
+
+  int ReqQryBrokerTradingParams(CThostFtdcQryBrokerTradingParamsField *pQryBrokerTradingParams, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryBrokerTradingParams);
+  }
+
+  int ReqQryBrokerTradingAlgos(CThostFtdcQryBrokerTradingAlgosField *pQryBrokerTradingAlgos, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryBrokerTradingAlgos);
+  }
+
+  int ReqQryClassifiedInstrument(CThostFtdcQryClassifiedInstrumentField *pQryClassifiedInstrument, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryClassifiedInstrument);
+  }
+
+  int ReqQryCombPromotionParam(CThostFtdcQryCombPromotionParamField *pQryCombPromotionParam, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryCombPromotionParam);
+  }
+
+  int ReqQryRiskSettleInvstPosition(CThostFtdcQryRiskSettleInvstPositionField *pQryRiskSettleInvstPosition, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryRiskSettleInvstPosition);
+  }
+
+  int ReqQryRiskSettleProductStatus(CThostFtdcQryRiskSettleProductStatusField *pQryRiskSettleProductStatus, int nRequestID) {
+    return reply(nRequestID, &CThostFtdcTraderSpi::OnRspQryRiskSettleProductStatus);
+  }
+
+private:
+  ~FakeTraderApi() {}
+
+  // Answers with the request's own fields.
+  template <typename T> int echo(T *request, int nRequestID, void (CThostFtdcTraderSpi::*callback)(T *, CThostFtdcRspInfoField *, int, bool)) {
+    T copy = *request;
+
+    _worker.post([this, copy, nRequestID, callback]() mutable {
+      if (_spi)
+        (_spi->*callback)(&copy, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  // Answers with an empty result, as CTP does when nothing matches.
+  template <typename T> int reply(int nRequestID, void (CThostFtdcTraderSpi::*callback)(T *, CThostFtdcRspInfoField *, int, bool)) {
+    _worker.post([this, nRequestID, callback]() {
+      if (_spi)
+        (_spi->*callback)(nullptr, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  // Answers with FAKECTP_ROWS responses, bIsLast set on the final one.
+  template <typename T, typename F> int rows(int nRequestID, void (CThostFtdcTraderSpi::*callback)(T *, CThostFtdcRspInfoField *, int, bool), F fill) {
+    _worker.post([this, nRequestID, callback, fill]() {
+      uint32_t count = _config.rows;
+      T record;
+
+      if (count == 0 && _spi)
+        (_spi->*callback)(nullptr, &_rspInfo, nRequestID, true);
+
+      for (uint32_t row = 0; row < count && _spi; ++row) {
+        memset(&record, 0, sizeof(record));
+        fill(&record, row);
+        (_spi->*callback)(&record, &_rspInfo, nRequestID, row + 1 == count);
+      }
+    });
+
+    return 0;
+  }
+
+  int login(const char *brokerID, const char *userID, int nRequestID) {
+    std::string broker(brokerID), user(userID);
+
+    _worker.post([this, broker, user, nRequestID]() {
+      CThostFtdcRspUserLoginField login;
+
+      memset(&login, 0, sizeof(login));
+      fakeCopy(login.TradingDay, FAKECTP_TRADING_DAY);
+      fakeCopy(login.LoginTime, "09:00:00");
+      fakeCopy(login.BrokerID, broker.c_str());
+      fakeCopy(login.UserID, user.c_str());
+      fakeCopy(login.SystemName, "FakeCTP");
+      fakeCopy(login.MaxOrderRef, "0");
+      login.FrontID = FAKECTP_FRONT_ID;
+      login.SessionID = FAKECTP_SESSION_ID;
+
+      if (_spi)
+        _spi->OnRspUserLogin(&login, &_rspInfo, nRequestID, true);
+    });
+
+    return 0;
+  }
+
+  void insertOrder(const CThostFtdcInputOrderField &input, int nRequestID) {
+    CThostFtdcOrderField order;
+    CThostFtdcTradeField trade;
+
+    if (!_spi)
+      return;
+
+    memset(&order, 0, sizeof(order));
+    fakeCopy(order.BrokerID, input.BrokerID);
+    fakeCopy(order.InvestorID, input.InvestorID);
+    fakeCopy(order.InstrumentID, input.InstrumentID);
+    fakeCopy(order.ExchangeID, input.ExchangeID[0] ? input.ExchangeID : FAKECTP_EXCHANGE);
+    fakeCopy(order.OrderRef, input.OrderRef);
+    fakeCopy(order.UserID, input.UserID);
+    fakeCopy(order.CombOffsetFlag, input.CombOffsetFlag);
+    fakeCopy(order.CombHedgeFlag, input.CombHedgeFlag);
+    fakeCopy(order.TradingDay, FAKECTP_TRADING_DAY);
+    fakeCopy(order.InsertDate, FAKECTP_TRADING_DAY);
+    fakeCopy(order.InsertTime, "09:00:00");
+    snprintf(order.OrderSysID, sizeof(order.OrderSysID), "%12u", ++_orderSysID);
+    order.OrderPriceType = input.OrderPriceType;
+    order.Direction = input.Direction;
+    order.LimitPrice = input.LimitPrice;
+    order.VolumeTotalOriginal = input.VolumeTotalOriginal;
+    order.VolumeTotal = input.VolumeTotalOriginal;
+    order.TimeCondition = input.TimeCondition;
+    order.VolumeCondition = input.VolumeCondition;
+    order.ContingentCondition = input.ContingentCondition;
+    order.RequestID = nRequestID;
+    order.FrontID = FAKECTP_FRONT_ID;
+    order.SessionID = FAKECTP_SESSION_ID;
+    order.OrderSubmitStatus = THOST_FTDC_OSS_Accepted;
+    order.OrderStatus = THOST_FTDC_OST_NoTradeQueueing;
+
+    _spi->OnRtnOrder(&order);
+
+    if (!_config.fill) {
+      _queueing[order.OrderSysID] = order;
+      return;
+    }
+
+    memset(&trade, 0, sizeof(trade));
+    fakeCopy(trade.BrokerID, order.BrokerID);
+    fakeCopy(trade.InvestorID, order.InvestorID);
+    fakeCopy(trade.InstrumentID, order.InstrumentID);
+    fakeCopy(trade.ExchangeID, order.ExchangeID);
+    fakeCopy(trade.OrderRef, order.OrderRef);
+    fakeCopy(trade.OrderSysID, order.OrderSysID);
+    fakeCopy(trade.UserID, order.UserID);
+    fakeCopy(trade.TradingDay, FAKECTP_TRADING_DAY);
+    fakeCopy(trade.TradeDate, FAKECTP_TRADING_DAY);
+    fakeCopy(trade.TradeTime, "09:00:00");
+    snprintf(trade.TradeID, sizeof(trade.TradeID), "%12u", ++_tradeID);
+    trade.Direction = order.Direction;
+    trade.OffsetFlag = order.CombOffsetFlag[0];
+    trade.HedgeFlag = order.CombHedgeFlag[0];
+    trade.Price = order.LimitPrice;
+    trade.Volume = order.VolumeTotalOriginal;
+    trade.TradeType = THOST_FTDC_TRDT_Common;
+
+    order.VolumeTraded = order.VolumeTotalOriginal;
+    order.VolumeTotal = 0;
+    order.OrderStatus = THOST_FTDC_OST_AllTraded;
+
+    _spi->OnRtnOrder(&order);
+    _spi->OnRtnTrade(&trade);
+  }
+
+  void cancelOrder(CThostFtdcInputOrderActionField &action, int nRequestID) {
+    CThostFtdcRspInfoField rspInfo;
+    auto it = _queueing.begin();
+
+    if (!_spi)
+      return;
+
+    for (; it != _queueing.end(); ++it) {
+      const CThostFtdcOrderField &order = it->second;
+
+      if (action.OrderSysID[0] ? strcmp(order.OrderSysID, action.OrderSysID) == 0 : strcmp(order.OrderRef, action.OrderRef) == 0 && order.FrontID == action.FrontID && order.SessionID == action.SessionID)
+        break;
+    }
+
+    if (it == _queueing.end()) {
+      memset(&rspInfo, 0, sizeof(rspInfo));
+      rspInfo.ErrorID = 25;
+      fakeCopy(rspInfo.ErrorMsg, "CTP:order not found");
+
+      _spi->OnRspOrderAction(&action, &rspInfo, nRequestID, true);
+      return;
+    }
+
+    CThostFtdcOrderField order = it->second;
+
+    _queueing.erase(it);
+
+    order.OrderStatus = THOST_FTDC_OST_Canceled;
+    fakeCopy(order.CancelTime, "09:00:00");
+
+    _spi->OnRtnOrder(&order);
+  }
+
+private:
+  FakeConfig _config;
+  FakeWorker _worker;
+  CThostFtdcTraderSpi *_spi;
+  CThostFtdcRspInfoField _rspInfo;
+  std::map<std::string, CThostFtdcOrderField> _queueing;
+  uint32_t _orderSysID;
+  uint32_t _tradeID;
+};
+
+CThostFtdcTraderApi *CThostFtdcTraderApi::CreateFtdcTraderApi(const char *pszFlowPath) {
+  return new FakeTraderApi();
+}
+
+const char *CThostFtdcTraderApi::GetApiVersion() {
+  return "napi-ctp fakectp " FAKECTP_TRADING_DAY;
+}
@@ -0,0 +1,140 @@
+/*
+ * message_queue.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "benchmark.h"
+#include "message_queue.h"
+
+/* The mutex/condvar queue that MessageQueue replaced, kept as a baseline. */
+class LockedMessageQueue {
+public:
+  LockedMessageQueue() : _waiting(0) {
+    uv_cond_init(&_cond);
+    uv_mutex_init_recursive(&_mutex);
+  }
+
+  ~LockedMessageQueue() {
+    uv_cond_destroy(&_cond);
+    uv_mutex_destroy(&_mutex);
+  }
+
+  void push(const Message &message) {
+    uv_mutex_lock(&_mutex);
+
+    _queue.push(message);
+
+    if (_waiting > 0)
+      uv_cond_signal(&_cond);
+
+    uv_mutex_unlock(&_mutex);
+  }
+
+  int pop(Message *message, unsigned int millisec) {
+    int ret;
+
+    uv_mutex_lock(&_mutex);
+
+    while (_queue.empty()) {
+      _waiting += 1;
+      ret = uv_cond_timedwait(&_cond, &_mutex, (uint64_t)millisec * 1000 * 1000);
+      _waiting -= 1;
+
+      if (ret != 0) {
+        uv_mutex_unlock(&_mutex);
+        return ret == UV_ETIMEDOUT ? QUEUE_TIMEOUT : QUEUE_FAILED;
+      }
+    }
+
+    *message = _queue.front();
+    _queue.pop();
+
+    uv_mutex_unlock(&_mutex);
+
+    return QUEUE_SUCCESS;
+  }
+
+private:
+  uv_cond_t _cond;
+  uv_mutex_t _mutex;
+  int _waiting;
+  std::queue<Message> _queue;
+};
+
+template <typename Queue> struct Producer {
+  Queue *queue;
+  uint32_t count;
+  uint32_t interval;
+};
+
+template <typename Queue> static void produce(void *data) {
+  Producer<Queue> *producer = (Producer<Queue> *)data;
+
+  for (uint32_t i = 1; i <= producer->count; ++i) {
+    Message message;
+
+    // Stamped once for both queues, as the CTP callback stamps what it pushes.
+    message.timestamp = uv_hrtime();
+    producer->queue->push(message);
+
+    if (producer->interval > 0 && i % producer->interval == 0)
+      uv_sleep(1);
+  }
+}
+
+template <typename Queue> static uint64_t consume(Queue *queue, uint32_t count, uint32_t interval, uint64_t *latency) {
+  Producer<Queue> producer = {queue, count, interval};
+  Message message;
+  uv_thread_t thread;
+  uint64_t start = uv_hrtime();
+
+  *latency = 0;
+  uv_thread_create(&thread, produce<Queue>, &producer);
+
+  for (uint32_t i = 0; i < count;) {
+    if (QUEUE_SUCCESS != queue->pop(&message, UINT_MAX))
+      continue;
+
+    *latency += uv_hrtime() - message.timestamp;
+    i += 1;
+  }
+
+  uv_thread_join(&thread);
+
+  return uv_hrtime() - start;
+}
+
+napi_value runQueue(napi_env env, napi_callback_info info) {
+  size_t argc = 4;
+  napi_value argv[4], result;
+  uint32_t kind, count, capacity, interval;
+  uint64_t elapsed, latency;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+  CHECK(napi_get_value_uint32(env, argv[0], &kind));
+  CHECK(napi_get_value_uint32(env, argv[1], &count));
+  CHECK(napi_get_value_uint32(env, argv[2], &capacity));
+  CHECK(napi_get_value_uint32(env, argv[3], &interval));
+
+  if (kind == 0) {
+    LockedMessageQueue *queue = new LockedMessageQueue();
+    elapsed = consume(queue, count, interval, &latency);
+    delete queue;
+  } else {
+    MessageQueue *queue = new MessageQueue(capacity);
+    elapsed = consume(queue, count, interval, &latency);
+    delete queue;
+  }
+
+  CHECK(napi_create_object(env, &result));
+  CHECK(objectSetDouble(env, result, "elapsed", (double)elapsed / 1e9));
+  CHECK(objectSetDouble(env, result, "latency", count > 0 ? (double)latency / count : 0));
+
+  return result;
+}
@@ -0,0 +1,32 @@
+/*
+ * message_queue.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ *
+ * Build with: npx node-gyp rebuild --napi_ctp_benchmark=true
+ */
+
+const bench = require("../build/Release/napi_ctp_benchmark.node");
+
+const capacity = 65536;
+const kinds = ["mutex queue", "spsc ring"];
+
+const run = (title, count, interval) => {
+  console.log(title);
+
+  kinds.forEach((kind, index) => {
+    const { elapsed, latency } = bench.runQueue(index, count, capacity, interval);
+    const rate = Math.round(count / elapsed).toLocaleString();
+    const micros = (latency / 1000).toFixed(2);
+
+    console.log(`  ${kind.padEnd(12)} ${rate.padStart(12)} msg/s  ${micros.padStart(10)} us avg latency`);
+  });
+};
+
+run("Burst (producer never sleeps)", 2000000, 0);
+run("Paced (1ms pause every 100 messages)", 200000, 100);
@@ -0,0 +1,205 @@
+/*
+ * object.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "benchmark.h"
+#include "ctpmsg.h"
+#include <string.h>
+#include <uv.h>
+
+/* The per-field napi_set_named_property converters, kept as a baseline. */
+static napi_status legacyDepthMarketData(napi_env env, const Message *message, napi_value *result) {
+  auto pDepthMarketData = MessageData<CThostFtdcDepthMarketDataField>(message);
+
+  CHECK(napi_create_object(env, result));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, TradingDay));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, reserve1));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, ExchangeID));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, reserve2));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, LastPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, PreSettlementPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, PreClosePrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, PreOpenInterest));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, OpenPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, HighestPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, LowestPrice));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, Volume));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, Turnover));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, OpenInterest));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, ClosePrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, SettlementPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, UpperLimitPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, LowerLimitPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, PreDelta));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, CurrDelta));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, UpdateTime));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, UpdateMillisec));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BidPrice1));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, BidVolume1));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AskPrice1));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, AskVolume1));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BidPrice2));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, BidVolume2));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AskPrice2));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, AskVolume2));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BidPrice3));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, BidVolume3));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AskPrice3));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, AskVolume3));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BidPrice4));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, BidVolume4));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AskPrice4));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, AskVolume4));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BidPrice5));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, BidVolume5));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AskPrice5));
+  CHECK(SetObjectInt32(env, *result, pDepthMarketData, AskVolume5));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, AveragePrice));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, ActionDay));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, InstrumentID));
+  CHECK(SetObjectString(env, *result, pDepthMarketData, ExchangeInstID));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BandingUpperPrice));
+  CHECK(SetObjectDouble(env, *result, pDepthMarketData, BandingLowerPrice));
+
+  return napi_ok;
+}
+
+static napi_status legacyOrder(napi_env env, const Message *message, napi_value *result) {
+  auto pOrder = MessageData<CThostFtdcOrderField>(message);
+
+  CHECK(napi_create_object(env, result));
+  CHECK(SetObjectString(env, *result, pOrder, BrokerID));
+  CHECK(SetObjectString(env, *result, pOrder, InvestorID));
+  CHECK(SetObjectString(env, *result, pOrder, reserve1));
+  CHECK(SetObjectString(env, *result, pOrder, OrderRef));
+  CHECK(SetObjectString(env, *result, pOrder, UserID));
+  CHECK(SetObjectChar(env, *result, pOrder, OrderPriceType));
+  CHECK(SetObjectChar(env, *result, pOrder, Direction));
+  CHECK(SetObjectString(env, *result, pOrder, CombOffsetFlag));
+  CHECK(SetObjectString(env, *result, pOrder, CombHedgeFlag));
+  CHECK(SetObjectDouble(env, *result, pOrder, LimitPrice));
+  CHECK(SetObjectInt32(env, *result, pOrder, VolumeTotalOriginal));
+  CHECK(SetObjectChar(env, *result, pOrder, TimeCondition));
+  CHECK(SetObjectString(env, *result, pOrder, GTDDate));
+  CHECK(SetObjectChar(env, *result, pOrder, VolumeCondition));
+  CHECK(SetObjectInt32(env, *result, pOrder, MinVolume));
+  CHECK(SetObjectChar(env, *result, pOrder, ContingentCondition));
+  CHECK(SetObjectInt32(env, *result, pOrder, StopPrice));
+  CHECK(SetObjectChar(env, *result, pOrder, ForceCloseReason));
+  CHECK(SetObjectInt32(env, *result, pOrder, IsAutoSuspend));
+  CHECK(SetObjectString(env, *result, pOrder, BusinessUnit));
+  CHECK(SetObjectInt32(env, *result, pOrder, RequestID));
+  CHECK(SetObjectString(env, *result, pOrder, OrderLocalID));
+  CHECK(SetObjectString(env, *result, pOrder, ExchangeID));
+  CHECK(SetObjectString(env, *result, pOrder, ParticipantID));
+  CHECK(SetObjectString(env, *result, pOrder, ClientID));
+  CHECK(SetObjectString(env, *result, pOrder, reserve2));
+  CHECK(SetObjectString(env, *result, pOrder, TraderID));
+  CHECK(SetObjectInt32(env, *result, pOrder, InstallID));
+  CHECK(SetObjectChar(env, *result, pOrder, OrderSubmitStatus));
+  CHECK(SetObjectInt32(env, *result, pOrder, NotifySequence));
+  CHECK(SetObjectString(env, *result, pOrder, TradingDay));
+  CHECK(SetObjectInt32(env, *result, pOrder, SettlementID));
+  CHECK(SetObjectString(env, *result, pOrder, OrderSysID));
+  CHECK(SetObjectChar(env, *result, pOrder, OrderSource));
+  CHECK(SetObjectChar(env, *result, pOrder, OrderStatus));
+  CHECK(SetObjectChar(env, *result, pOrder, OrderType));
+  CHECK(SetObjectInt32(env, *result, pOrder, VolumeTraded));
+  CHECK(SetObjectInt32(env, *result, pOrder, VolumeTotal));
+  CHECK(SetObjectString(env, *result, pOrder, InsertDate));
+  CHECK(SetObjectString(env, *result, pOrder, InsertTime));
+  CHECK(SetObjectString(env, *result, pOrder, ActiveTime));
+  CHECK(SetObjectString(env, *result, pOrder, SuspendTime));
+  CHECK(SetObjectString(env, *result, pOrder, UpdateTime));
+  CHECK(SetObjectString(env, *result, pOrder, CancelTime));
+  CHECK(SetObjectString(env, *result, pOrder, ActiveTraderID));
+  CHECK(SetObjectString(env, *result, pOrder, ClearingPartID));
+  CHECK(SetObjectInt32(env, *result, pOrder, SequenceNo));
+  CHECK(SetObjectInt32(env, *result, pOrder, FrontID));
+  CHECK(SetObjectInt32(env, *result, pOrder, SessionID));
+  CHECK(SetObjectString(env, *result, pOrder, UserProductInfo));
+  CHECK(SetObjectString(env, *result, pOrder, StatusMsg));
+  CHECK(SetObjectInt32(env, *result, pOrder, UserForceClose));
+  CHECK(SetObjectString(env, *result, pOrder, ActiveUserID));
+  CHECK(SetObjectInt32(env, *result, pOrder, BrokerOrderSeq));
+  CHECK(SetObjectString(env, *result, pOrder, RelativeOrderSysID));
+  CHECK(SetObjectInt32(env, *result, pOrder, ZCETotalTradedVolume));
+  CHECK(SetObjectInt32(env, *result, pOrder, IsSwapOrder));
+  CHECK(SetObjectString(env, *result, pOrder, BranchID));
+  CHECK(SetObjectString(env, *result, pOrder, InvestUnitID));
+  CHECK(SetObjectString(env, *result, pOrder, AccountID));
+  CHECK(SetObjectString(env, *result, pOrder, CurrencyID));
+  CHECK(SetObjectString(env, *result, pOrder, reserve3));
+  CHECK(SetObjectString(env, *result, pOrder, MacAddress));
+  CHECK(SetObjectString(env, *result, pOrder, InstrumentID));
+  CHECK(SetObjectString(env, *result, pOrder, ExchangeInstID));
+  CHECK(SetObjectString(env, *result, pOrder, IPAddress));
+
+  return napi_ok;
+}
+
+static uint64_t convert(napi_env env, MessageHandler handler, const Message *message, uint32_t count) {
+  napi_handle_scope scope;
+  napi_value object;
+  uint64_t start = uv_hrtime();
+
+  for (uint32_t i = 0; i < count; ++i) {
+    CHECK(napi_open_handle_scope(env, &scope));
+    CHECK(handler(env, message, &object));
+    CHECK(napi_close_handle_scope(env, scope));
+  }
+
+  return uv_hrtime() - start;
+}
+
+napi_value runObject(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value argv[3], result;
+  uint32_t kind, type, count;
+  CThostFtdcDepthMarketDataField depthMarketData;
+  CThostFtdcOrderField order;
+  Message message;
+  uint64_t elapsed;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+  CHECK(napi_get_value_uint32(env, argv[0], &kind));
+  CHECK(napi_get_value_uint32(env, argv[1], &type));
+  CHECK(napi_get_value_uint32(env, argv[2], &count));
+
+  memset(&depthMarketData, 0, sizeof(depthMarketData));
+  strcpy(depthMarketData.TradingDay, "20231020");
+  strcpy(depthMarketData.ExchangeID, "SHFE");
+  strcpy(depthMarketData.InstrumentID, "rb2401");
+  strcpy(depthMarketData.UpdateTime, "09:30:00");
+  depthMarketData.LastPrice = 3650;
+  depthMarketData.Volume = 123456;
+
+  memset(&order, 0, sizeof(order));
+  strcpy(order.BrokerID, "9999");
+  strcpy(order.InvestorID, "000001");
+  strcpy(order.InstrumentID, "rb2401");
+  strcpy(order.OrderRef, "1");
+  strcpy(order.StatusMsg, "\xC8\xAB\xB2\xBF\xB3\xC9\xBD\xBB");
+  order.LimitPrice = 3650;
+  order.VolumeTotalOriginal = 2;
+  order.OrderStatus = '0';
+
+  if (type == 0) {
+    message.data = (uintptr_t)&depthMarketData;
+    elapsed = convert(env, kind == 0 ? legacyDepthMarketData : rtnDepthMarketData, &message, count);
+  } else {
+    message.data = (uintptr_t)&order;
+    elapsed = convert(env, kind == 0 ? legacyOrder : rtnOrder, &message, count);
+  }
+
+  CHECK(napi_create_double(env, (double)elapsed / 1e9, &result));
+
+  return result;
+}
@@ -0,0 +1,29 @@
+/*
+ * object.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ *
+ * Build with: npx node-gyp rebuild --napi_ctp_benchmark=true
+ */
+
+const bench = require("../build/Release/napi_ctp_benchmark.node");
+
+const count = 200000;
+const kinds = ["set_named_property", "object factory"];
+const types = ["rtnDepthMarketData", "rtnOrder"];
+
+types.forEach((type, typeIndex) => {
+  console.log(type);
+
+  kinds.forEach((kind, index) => {
+    const elapsed = bench.runObject(index, typeIndex, count);
+    const rate = Math.round(count / elapsed).toLocaleString();
+
+    console.log(`  ${kind.padEnd(20)} ${rate.padStart(12)} objects/s`);
+  });
+});
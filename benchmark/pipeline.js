@@ -0,0 +1,245 @@
+/*
+ * pipeline.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ *
+ * Build with: npx node-gyp rebuild --napi_ctp_fake=true
+ *
+ * End to end numbers of the addon against the fake CTP backend in
+ * benchmark/fakectp. Every scenario runs in its own process so the RSS
+ * and GC figures do not carry over, GC counts every pause, scavenges are
+ * the young generation ones. Tunables: FAKECTP_TICKS, FAKECTP_RATE,
+ * FAKECTP_ROWS, BENCH_INSTRUMENTS and BENCH_ORDERS.
+ */
+
+const { fork } = require("node:child_process");
+const fs = require("node:fs");
+const os = require("node:os");
+const path = require("node:path");
+const { PerformanceObserver, constants } = require("node:perf_hooks");
+
+const ticks = parseInt(process.env.FAKECTP_TICKS || "1000000");
+const instruments = parseInt(process.env.BENCH_INSTRUMENTS || "100");
+const orders = parseInt(process.env.BENCH_ORDERS || "100000");
+const rows = parseInt(process.env.FAKECTP_ROWS || "10000");
+const idle = 200;
+
+const scenarios = {
+  single: { kind: "md", options: undefined },
+  batch: { kind: "md", options: { batchSize: 64 } },
+  columnar: { kind: "md", options: { columnar: true } },
+  conflate: { kind: "md", options: { conflate: true } },
+  lazy: { kind: "md", options: { lazy: true } },
+  raw: { kind: "md", options: { raw: true } },
+  reuse: { kind: "md", options: { reuse: true } },
+  orders: { kind: "trader" },
+  query: { kind: "query" },
+};
+
+const flowPath = () => {
+  const dir = fs.mkdtempSync(path.join(os.tmpdir(), "napi-ctp-"));
+  return dir + path.sep;
+};
+
+const p99 = (stats, event) => {
+  const stages = stats[event];
+  return stages ? (stages.total.p99 / 1000).toFixed(1) : "-";
+};
+
+const gc = { time: 0, scavenges: 0 };
+
+const observeGC = () => {
+  const observer = new PerformanceObserver((list) => {
+    for (const entry of list.getEntries()) {
+      gc.time += entry.duration;
+      if (entry.detail.kind === constants.NODE_PERFORMANCE_GC_MINOR) ++gc.scavenges;
+    }
+  });
+
+  observer.observe({ entryTypes: ["gc"] });
+};
+
+const report = (result) => {
+  // GC entries are queued, let the observer drain them first.
+  setImmediate(() => {
+    process.send(
+      Object.assign(result, {
+        rss: process.memoryUsage().rss,
+        maxRss: process.resourceUsage().maxRSS * 1024,
+        gcTime: gc.time,
+        scavenges: gc.scavenges,
+      }),
+    );
+    process.exit(0);
+  });
+};
+
+const runMarketData = (ctp, name, options) => {
+  const md = ctp.createMarketData(flowPath(), "tcp://127.0.0.1:0");
+  const ids = Array.from({ length: instruments }, (_, i) => `rb${String(i).padStart(4, "0")}`);
+  let delivered = 0;
+  let checked = -1;
+  let started = 0n;
+  let last = 0n;
+
+  const finish = () => {
+    const elapsed = Number(last - started) / 1e9;
+    const stats = md.getLatencyStats();
+
+    report({
+      name,
+      rate: ticks / elapsed,
+      unit: "ticks/s",
+      delivered,
+      p99: p99(stats, "rtn-depth-market-data"),
+    });
+  };
+
+  // A timer per tick would be garbage of its own, an interval notices when delivery stops.
+  const onDepth = (message) => {
+    delivered += Array.isArray(message) ? message.length : message.count || 1;
+    last = process.hrtime.bigint();
+  };
+
+  const poll = setInterval(() => {
+    if (delivered === 0 || delivered !== checked) {
+      checked = delivered;
+      return;
+    }
+
+    clearInterval(poll);
+    finish();
+  }, idle);
+
+  md.on("front-connected", () => md.reqUserLogin({ BrokerID: "9999", UserID: "bench" }));
+  md.on("rsp-user-login", () => {
+    started = process.hrtime.bigint();
+    md.subscribeMarketData(ids);
+  });
+
+  if (options) md.on("rtn-depth-market-data", onDepth, options);
+  else md.on("rtn-depth-market-data", onDepth);
+};
+
+const runOrders = (ctp, name) => {
+  const trader = ctp.createTrader(flowPath(), "tcp://127.0.0.1:0");
+  const chunk = 1000;
+  let sent = 0;
+  let traded = 0;
+  let started = 0n;
+
+  const send = () => {
+    const end = Math.min(sent + chunk, orders);
+
+    for (; sent < end; ++sent) {
+      trader.reqOrderInsert({
+        BrokerID: "9999",
+        InvestorID: "bench",
+        InstrumentID: `rb${String(sent % instruments).padStart(4, "0")}`,
+        ExchangeID: "SHFE",
+        OrderRef: String(sent + 1),
+        OrderPriceType: "2",
+        Direction: "0",
+        CombOffsetFlag: "0",
+        CombHedgeFlag: "1",
+        LimitPrice: 4000,
+        VolumeTotalOriginal: 1,
+        TimeCondition: "3",
+        VolumeCondition: "1",
+        ContingentCondition: "1",
+        ForceCloseReason: "0",
+      });
+    }
+
+    if (sent < orders) setImmediate(send);
+  };
+
+  trader.on("front-connected", () => trader.reqUserLogin({ BrokerID: "9999", UserID: "bench" }));
+  trader.on("rsp-user-login", () => {
+    started = process.hrtime.bigint();
+    send();
+  });
+  trader.on("rtn-order", () => {});
+  trader.on("rtn-trade", () => {
+    if (++traded < orders) return;
+
+    const elapsed = Number(process.hrtime.bigint() - started) / 1e9;
+    const stats = trader.getLatencyStats();
+
+    report({ name, rate: orders / elapsed, unit: "orders/s", delivered: traded, p99: p99(stats, "rtn-trade") });
+  });
+};
+
+const runQuery = (ctp, name) => {
+  const trader = ctp.createTrader(flowPath(), "tcp://127.0.0.1:0");
+  let received = 0;
+  let started = 0n;
+
+  trader.on("front-connected", () => trader.reqUserLogin({ BrokerID: "9999", UserID: "bench" }));
+  trader.on("rsp-user-login", () => {
+    started = process.hrtime.bigint();
+    trader.reqQryInstrument({});
+  });
+  trader.on("rsp-qry-instrument", () => {
+    if (++received < rows) return;
+
+    const elapsed = Number(process.hrtime.bigint() - started) / 1e9;
+    const stats = trader.getLatencyStats();
+
+    report({ name, rate: rows / elapsed, unit: "rows/s", delivered: received, p99: p99(stats, "rsp-qry-instrument") });
+  });
+};
+
+const child = (name) => {
+  const ctp = require("../build/Release/napi_ctp.node");
+  const scenario = scenarios[name];
+
+  setTimeout(() => {
+    console.error(`${name}: timed out`);
+    process.exit(1);
+  }, 120000).unref();
+
+  observeGC();
+
+  if (scenario.kind === "md") runMarketData(ctp, name, scenario.options);
+  else if (scenario.kind === "trader") runOrders(ctp, name);
+  else runQuery(ctp, name);
+};
+
+const parent = async () => {
+  const mb = (bytes) => (bytes / 1048576).toFixed(1);
+
+  console.log(`ticks ${ticks}, instruments ${instruments}, orders ${orders}, rows ${rows}`);
+  console.log(
+    `  ${"scenario".padEnd(10)} ${"rate".padStart(14)} ${"".padEnd(8)} ${"delivered".padStart(10)} ${"p99 us".padStart(10)} ${"rss MB".padStart(8)} ${"max MB".padStart(8)} ${"gc ms".padStart(8)} ${"scavenges".padStart(10)}`,
+  );
+
+  for (const name of Object.keys(scenarios)) {
+    const env = Object.assign({}, process.env, { FAKECTP_TICKS: String(ticks), FAKECTP_ROWS: String(rows) });
+    const result = await new Promise((resolve) => {
+      const worker = fork(__filename, [name], { env });
+
+      worker.on("message", resolve);
+      worker.on("exit", (code) => code !== 0 && resolve(null));
+    });
+
+    if (!result) {
+      console.log(`  ${name.padEnd(10)} failed`);
+      continue;
+    }
+
+    const rate = Math.round(result.rate).toLocaleString();
+
+    console.log(
+      `  ${name.padEnd(10)} ${rate.padStart(14)} ${result.unit.padEnd(8)} ${String(result.delivered).padStart(10)} ${result.p99.padStart(10)} ${mb(result.rss).padStart(8)} ${mb(result.maxRss).padStart(8)} ${result.gcTime.toFixed(1).padStart(8)} ${String(result.scavenges).padStart(10)}`,
+    );
+  }
+};
+
+if (process.argv[2]) child(process.argv[2]);
+else parent();
@@ -1,17 +1,35 @@
 {
+  "variables": {
+    "napi_ctp_benchmark%": "false",
+    "napi_ctp_fake%": "false"
+  },
   "targets": [
     {
       "target_name": "napi_ctp",
       "sources": [
         "./src/binding.cpp",
+        "./src/ctpfields.cpp",
+        "./src/ctplazy.cpp",
         "./src/ctpmsg.cpp",
+        "./src/ctpreuse.cpp",
         "./src/mdapi.cpp",
+        "./src/mdbars.cpp",
+        "./src/mdcolumns.cpp",
+        "./src/mdconflation.cpp",
+        "./src/mdjournal.cpp",
         "./src/mdspi.cpp",
         "./src/mdmsg.cpp",
+        "./src/mdreplay.cpp",
+        "./src/mdsnapshot.cpp",
         "./src/guard.cpp",
+        "./src/latency.cpp",
+        "./src/message_pool.cpp",
         "./src/message_queue.cpp",
         "./src/napi_ctp.cpp",
         "./src/traderapi.cpp",
+        "./src/traderquery.cpp",
+        "./src/tradercatalog.cpp",
+        "./src/traderprepare.cpp",
         "./src/traderspi.cpp",
         "./src/tradermsg.cpp"
       ],
@@ -49,13 +67,89 @@
             }
           ]
         }],
-        ['OS=="linux"', {
+        ['OS=="linux" and napi_ctp_fake!="true"', {
           "libraries": [
             "<(module_root_dir)/tradeapi/linux/thostmduserapi_se.so",
             "<(module_root_dir)/tradeapi/linux/thosttraderapi_se.so"
           ]
+        }],
+        ['OS=="linux" and napi_ctp_fake=="true"', {
+          "dependencies": [
+            "thostmduserapi_se",
+            "thosttraderapi_se"
+          ]
         }]
       ]
     }
+  ],
+  "conditions": [
+    ['OS=="linux" and napi_ctp_fake=="true"', {
+      "targets": [
+        {
+          "target_name": "thostmduserapi_se",
+          "type": "shared_library",
+          "product_prefix": "",
+          "sources": [
+            "./benchmark/fakectp/fakectp.cpp",
+            "./benchmark/fakectp/fakemdapi.cpp"
+          ],
+          "include_dirs": [
+            "./tradeapi"
+          ],
+          "cflags_cc": [
+            "-fvisibility=default"
+          ],
+          "ldflags": [
+            "-pthread"
+          ]
+        },
+        {
+          "target_name": "thosttraderapi_se",
+          "type": "shared_library",
+          "product_prefix": "",
+          "sources": [
+            "./benchmark/fakectp/fakectp.cpp",
+            "./benchmark/fakectp/faketraderapi.cpp"
+          ],
+          "include_dirs": [
+            "./tradeapi"
+          ],
+          "cflags_cc": [
+            "-fvisibility=default"
+          ],
+          "ldflags": [
+            "-pthread"
+          ]
+        }
+      ]
+    }],
+    ['napi_ctp_benchmark=="true"', {
+      "targets": [
+        {
+          "target_name": "napi_ctp_benchmark",
+          "sources": [
+            "./benchmark/benchmark.cpp",
+            "./benchmark/dispatch.cpp",
+            "./benchmark/message_queue.cpp",
+            "./benchmark/object.cpp",
+            "./src/ctpfields.cpp",
+            "./src/ctplazy.cpp",
+            "./src/ctpmsg.cpp",
+            "./src/mdbars.cpp",
+            "./src/mdjournal.cpp",
+            "./src/mdsnapshot.cpp",
+            "./src/mdspi.cpp",
+            "./src/message_pool.cpp",
+            "./src/message_queue.cpp",
+            "./src/napi_ctp.cpp",
+            "./src/traderspi.cpp"
+          ],
+          "include_dirs": [
+            "./src",
+            "./tradeapi"
+          ]
+        }
+      ]
+    }]
   ]
 }
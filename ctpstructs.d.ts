@@ -0,0 +1,2624 @@
+/*
+ * ctpstructs.d.ts
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+// Generated by tools/ctpstructs.js, do not edit. The layouts of the CTP
+// structs raw events deliver, and the struct of every such event.
+
+/** 原始投递的结构体布局, 偏移及长度以字节计 */
+export interface StructLayouts {
+  CThostFtdcRspUserLoginField: {
+    size: 196;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      LoginTime: { offset: 9; type: "string"; size: 9 };
+      BrokerID: { offset: 18; type: "string"; size: 11 };
+      UserID: { offset: 29; type: "string"; size: 16 };
+      SystemName: { offset: 45; type: "string"; size: 41 };
+      FrontID: { offset: 88; type: "int32"; size: 4 };
+      SessionID: { offset: 92; type: "int32"; size: 4 };
+      MaxOrderRef: { offset: 96; type: "string"; size: 13 };
+      SHFETime: { offset: 109; type: "string"; size: 9 };
+      DCETime: { offset: 118; type: "string"; size: 9 };
+      CZCETime: { offset: 127; type: "string"; size: 9 };
+      FFEXTime: { offset: 136; type: "string"; size: 9 };
+      INETime: { offset: 145; type: "string"; size: 9 };
+      SysVersion: { offset: 154; type: "string"; size: 41 };
+    };
+  };
+  CThostFtdcUserLogoutField: {
+    size: 27;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      UserID: { offset: 11; type: "string"; size: 16 };
+    };
+  };
+  CThostFtdcRspAuthenticateField: {
+    size: 72;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      UserID: { offset: 11; type: "string"; size: 16 };
+      UserProductInfo: { offset: 27; type: "string"; size: 11 };
+      AppID: { offset: 38; type: "string"; size: 33 };
+      AppType: { offset: 71; type: "char"; size: 1 };
+    };
+  };
+  CThostFtdcRspInfoField: {
+    size: 88;
+    fields: {
+      ErrorID: { offset: 0; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 4; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcExchangeField: {
+    size: 71;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      ExchangeName: { offset: 9; type: "string"; size: 61 };
+      ExchangeProperty: { offset: 70; type: "char"; size: 1 };
+    };
+  };
+  CThostFtdcProductField: {
+    size: 312;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      ProductName: { offset: 31; type: "string"; size: 21 };
+      ExchangeID: { offset: 52; type: "string"; size: 9 };
+      ProductClass: { offset: 61; type: "char"; size: 1 };
+      VolumeMultiple: { offset: 64; type: "int32"; size: 4 };
+      PriceTick: { offset: 72; type: "double"; size: 8 };
+      MaxMarketOrderVolume: { offset: 80; type: "int32"; size: 4 };
+      MinMarketOrderVolume: { offset: 84; type: "int32"; size: 4 };
+      MaxLimitOrderVolume: { offset: 88; type: "int32"; size: 4 };
+      MinLimitOrderVolume: { offset: 92; type: "int32"; size: 4 };
+      PositionType: { offset: 96; type: "char"; size: 1 };
+      PositionDateType: { offset: 97; type: "char"; size: 1 };
+      CloseDealType: { offset: 98; type: "char"; size: 1 };
+      TradeCurrencyID: { offset: 99; type: "string"; size: 4 };
+      MortgageFundUseRange: { offset: 103; type: "char"; size: 1 };
+      reserve2: { offset: 104; type: "string"; size: 31 };
+      UnderlyingMultiple: { offset: 136; type: "double"; size: 8 };
+      ProductID: { offset: 144; type: "string"; size: 81 };
+      ExchangeProductID: { offset: 225; type: "string"; size: 81 };
+      OpenLimitControlLevel: { offset: 306; type: "char"; size: 1 };
+      OrderFreqControlLevel: { offset: 307; type: "char"; size: 1 };
+    };
+  };
+  CThostFtdcInstrumentField: {
+    size: 616;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      ExchangeID: { offset: 31; type: "string"; size: 9 };
+      InstrumentName: { offset: 40; type: "string"; size: 21 };
+      reserve2: { offset: 61; type: "string"; size: 31 };
+      reserve3: { offset: 92; type: "string"; size: 31 };
+      ProductClass: { offset: 123; type: "char"; size: 1 };
+      DeliveryYear: { offset: 124; type: "int32"; size: 4 };
+      DeliveryMonth: { offset: 128; type: "int32"; size: 4 };
+      MaxMarketOrderVolume: { offset: 132; type: "int32"; size: 4 };
+      MinMarketOrderVolume: { offset: 136; type: "int32"; size: 4 };
+      MaxLimitOrderVolume: { offset: 140; type: "int32"; size: 4 };
+      MinLimitOrderVolume: { offset: 144; type: "int32"; size: 4 };
+      VolumeMultiple: { offset: 148; type: "int32"; size: 4 };
+      PriceTick: { offset: 152; type: "double"; size: 8 };
+      CreateDate: { offset: 160; type: "string"; size: 9 };
+      OpenDate: { offset: 169; type: "string"; size: 9 };
+      ExpireDate: { offset: 178; type: "string"; size: 9 };
+      StartDelivDate: { offset: 187; type: "string"; size: 9 };
+      EndDelivDate: { offset: 196; type: "string"; size: 9 };
+      InstLifePhase: { offset: 205; type: "char"; size: 1 };
+      IsTrading: { offset: 208; type: "int32"; size: 4 };
+      PositionType: { offset: 212; type: "char"; size: 1 };
+      PositionDateType: { offset: 213; type: "char"; size: 1 };
+      LongMarginRatio: { offset: 216; type: "double"; size: 8 };
+      ShortMarginRatio: { offset: 224; type: "double"; size: 8 };
+      MaxMarginSideAlgorithm: { offset: 232; type: "char"; size: 1 };
+      reserve4: { offset: 233; type: "string"; size: 31 };
+      StrikePrice: { offset: 264; type: "double"; size: 8 };
+      OptionsType: { offset: 272; type: "char"; size: 1 };
+      UnderlyingMultiple: { offset: 280; type: "double"; size: 8 };
+      CombinationType: { offset: 288; type: "char"; size: 1 };
+      InstrumentID: { offset: 289; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 370; type: "string"; size: 81 };
+      ProductID: { offset: 451; type: "string"; size: 81 };
+      UnderlyingInstrID: { offset: 532; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInvestorField: {
+    size: 396;
+    fields: {
+      InvestorID: { offset: 0; type: "string"; size: 13 };
+      BrokerID: { offset: 13; type: "string"; size: 11 };
+      InvestorGroupID: { offset: 24; type: "string"; size: 13 };
+      InvestorName: { offset: 37; type: "string"; size: 81 };
+      IdentifiedCardType: { offset: 118; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 119; type: "string"; size: 51 };
+      IsActive: { offset: 172; type: "int32"; size: 4 };
+      Telephone: { offset: 176; type: "string"; size: 41 };
+      Address: { offset: 217; type: "string"; size: 101 };
+      OpenDate: { offset: 318; type: "string"; size: 9 };
+      Mobile: { offset: 327; type: "string"; size: 41 };
+      CommModelID: { offset: 368; type: "string"; size: 13 };
+      MarginModelID: { offset: 381; type: "string"; size: 13 };
+      IsOrderFreq: { offset: 394; type: "char"; size: 1 };
+      IsOpenVolLimit: { offset: 395; type: "char"; size: 1 };
+    };
+  };
+  CThostFtdcTradingCodeField: {
+    size: 76;
+    fields: {
+      InvestorID: { offset: 0; type: "string"; size: 13 };
+      BrokerID: { offset: 13; type: "string"; size: 11 };
+      ExchangeID: { offset: 24; type: "string"; size: 9 };
+      ClientID: { offset: 33; type: "string"; size: 11 };
+      IsActive: { offset: 44; type: "int32"; size: 4 };
+      ClientIDType: { offset: 48; type: "char"; size: 1 };
+      BranchID: { offset: 49; type: "string"; size: 9 };
+      BizType: { offset: 58; type: "char"; size: 1 };
+      InvestUnitID: { offset: 59; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcTradingAccountField: {
+    size: 400;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      AccountID: { offset: 11; type: "string"; size: 13 };
+      PreMortgage: { offset: 24; type: "double"; size: 8 };
+      PreCredit: { offset: 32; type: "double"; size: 8 };
+      PreDeposit: { offset: 40; type: "double"; size: 8 };
+      PreBalance: { offset: 48; type: "double"; size: 8 };
+      PreMargin: { offset: 56; type: "double"; size: 8 };
+      InterestBase: { offset: 64; type: "double"; size: 8 };
+      Interest: { offset: 72; type: "double"; size: 8 };
+      Deposit: { offset: 80; type: "double"; size: 8 };
+      Withdraw: { offset: 88; type: "double"; size: 8 };
+      FrozenMargin: { offset: 96; type: "double"; size: 8 };
+      FrozenCash: { offset: 104; type: "double"; size: 8 };
+      FrozenCommission: { offset: 112; type: "double"; size: 8 };
+      CurrMargin: { offset: 120; type: "double"; size: 8 };
+      CashIn: { offset: 128; type: "double"; size: 8 };
+      Commission: { offset: 136; type: "double"; size: 8 };
+      CloseProfit: { offset: 144; type: "double"; size: 8 };
+      PositionProfit: { offset: 152; type: "double"; size: 8 };
+      Balance: { offset: 160; type: "double"; size: 8 };
+      Available: { offset: 168; type: "double"; size: 8 };
+      WithdrawQuota: { offset: 176; type: "double"; size: 8 };
+      Reserve: { offset: 184; type: "double"; size: 8 };
+      TradingDay: { offset: 192; type: "string"; size: 9 };
+      SettlementID: { offset: 204; type: "int32"; size: 4 };
+      Credit: { offset: 208; type: "double"; size: 8 };
+      Mortgage: { offset: 216; type: "double"; size: 8 };
+      ExchangeMargin: { offset: 224; type: "double"; size: 8 };
+      DeliveryMargin: { offset: 232; type: "double"; size: 8 };
+      ExchangeDeliveryMargin: { offset: 240; type: "double"; size: 8 };
+      ReserveBalance: { offset: 248; type: "double"; size: 8 };
+      CurrencyID: { offset: 256; type: "string"; size: 4 };
+      PreFundMortgageIn: { offset: 264; type: "double"; size: 8 };
+      PreFundMortgageOut: { offset: 272; type: "double"; size: 8 };
+      FundMortgageIn: { offset: 280; type: "double"; size: 8 };
+      FundMortgageOut: { offset: 288; type: "double"; size: 8 };
+      FundMortgageAvailable: { offset: 296; type: "double"; size: 8 };
+      MortgageableFund: { offset: 304; type: "double"; size: 8 };
+      SpecProductMargin: { offset: 312; type: "double"; size: 8 };
+      SpecProductFrozenMargin: { offset: 320; type: "double"; size: 8 };
+      SpecProductCommission: { offset: 328; type: "double"; size: 8 };
+      SpecProductFrozenCommission: { offset: 336; type: "double"; size: 8 };
+      SpecProductPositionProfit: { offset: 344; type: "double"; size: 8 };
+      SpecProductCloseProfit: { offset: 352; type: "double"; size: 8 };
+      SpecProductPositionProfitByAlg: { offset: 360; type: "double"; size: 8 };
+      SpecProductExchangeMargin: { offset: 368; type: "double"; size: 8 };
+      BizType: { offset: 376; type: "char"; size: 1 };
+      FrozenSwap: { offset: 384; type: "double"; size: 8 };
+      RemainSwap: { offset: 392; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcInvestorPositionField: {
+    size: 472;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      BrokerID: { offset: 31; type: "string"; size: 11 };
+      InvestorID: { offset: 42; type: "string"; size: 13 };
+      PosiDirection: { offset: 55; type: "char"; size: 1 };
+      HedgeFlag: { offset: 56; type: "char"; size: 1 };
+      PositionDate: { offset: 57; type: "char"; size: 1 };
+      YdPosition: { offset: 60; type: "int32"; size: 4 };
+      Position: { offset: 64; type: "int32"; size: 4 };
+      LongFrozen: { offset: 68; type: "int32"; size: 4 };
+      ShortFrozen: { offset: 72; type: "int32"; size: 4 };
+      LongFrozenAmount: { offset: 80; type: "double"; size: 8 };
+      ShortFrozenAmount: { offset: 88; type: "double"; size: 8 };
+      OpenVolume: { offset: 96; type: "int32"; size: 4 };
+      CloseVolume: { offset: 100; type: "int32"; size: 4 };
+      OpenAmount: { offset: 104; type: "double"; size: 8 };
+      CloseAmount: { offset: 112; type: "double"; size: 8 };
+      PositionCost: { offset: 120; type: "double"; size: 8 };
+      PreMargin: { offset: 128; type: "double"; size: 8 };
+      UseMargin: { offset: 136; type: "double"; size: 8 };
+      FrozenMargin: { offset: 144; type: "double"; size: 8 };
+      FrozenCash: { offset: 152; type: "double"; size: 8 };
+      FrozenCommission: { offset: 160; type: "double"; size: 8 };
+      CashIn: { offset: 168; type: "double"; size: 8 };
+      Commission: { offset: 176; type: "double"; size: 8 };
+      CloseProfit: { offset: 184; type: "double"; size: 8 };
+      PositionProfit: { offset: 192; type: "double"; size: 8 };
+      PreSettlementPrice: { offset: 200; type: "double"; size: 8 };
+      SettlementPrice: { offset: 208; type: "double"; size: 8 };
+      TradingDay: { offset: 216; type: "string"; size: 9 };
+      SettlementID: { offset: 228; type: "int32"; size: 4 };
+      OpenCost: { offset: 232; type: "double"; size: 8 };
+      ExchangeMargin: { offset: 240; type: "double"; size: 8 };
+      CombPosition: { offset: 248; type: "int32"; size: 4 };
+      CombLongFrozen: { offset: 252; type: "int32"; size: 4 };
+      CombShortFrozen: { offset: 256; type: "int32"; size: 4 };
+      CloseProfitByDate: { offset: 264; type: "double"; size: 8 };
+      CloseProfitByTrade: { offset: 272; type: "double"; size: 8 };
+      TodayPosition: { offset: 280; type: "int32"; size: 4 };
+      MarginRateByMoney: { offset: 288; type: "double"; size: 8 };
+      MarginRateByVolume: { offset: 296; type: "double"; size: 8 };
+      StrikeFrozen: { offset: 304; type: "int32"; size: 4 };
+      StrikeFrozenAmount: { offset: 312; type: "double"; size: 8 };
+      AbandonFrozen: { offset: 320; type: "int32"; size: 4 };
+      ExchangeID: { offset: 324; type: "string"; size: 9 };
+      YdStrikeFrozen: { offset: 336; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 340; type: "string"; size: 17 };
+      PositionCostOffset: { offset: 360; type: "double"; size: 8 };
+      TasPosition: { offset: 368; type: "int32"; size: 4 };
+      TasPositionCost: { offset: 376; type: "double"; size: 8 };
+      InstrumentID: { offset: 384; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInstrumentMarginRateField: {
+    size: 208;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      HedgeFlag: { offset: 56; type: "char"; size: 1 };
+      LongMarginRatioByMoney: { offset: 64; type: "double"; size: 8 };
+      LongMarginRatioByVolume: { offset: 72; type: "double"; size: 8 };
+      ShortMarginRatioByMoney: { offset: 80; type: "double"; size: 8 };
+      ShortMarginRatioByVolume: { offset: 88; type: "double"; size: 8 };
+      IsRelative: { offset: 96; type: "int32"; size: 4 };
+      ExchangeID: { offset: 100; type: "string"; size: 9 };
+      InvestUnitID: { offset: 109; type: "string"; size: 17 };
+      InstrumentID: { offset: 126; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInstrumentCommissionRateField: {
+    size: 216;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      OpenRatioByMoney: { offset: 56; type: "double"; size: 8 };
+      OpenRatioByVolume: { offset: 64; type: "double"; size: 8 };
+      CloseRatioByMoney: { offset: 72; type: "double"; size: 8 };
+      CloseRatioByVolume: { offset: 80; type: "double"; size: 8 };
+      CloseTodayRatioByMoney: { offset: 88; type: "double"; size: 8 };
+      CloseTodayRatioByVolume: { offset: 96; type: "double"; size: 8 };
+      ExchangeID: { offset: 104; type: "string"; size: 9 };
+      BizType: { offset: 113; type: "char"; size: 1 };
+      InvestUnitID: { offset: 114; type: "string"; size: 17 };
+      InstrumentID: { offset: 131; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcDepthMarketDataField: {
+    size: 584;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      reserve1: { offset: 9; type: "string"; size: 31 };
+      ExchangeID: { offset: 40; type: "string"; size: 9 };
+      reserve2: { offset: 49; type: "string"; size: 31 };
+      LastPrice: { offset: 80; type: "double"; size: 8 };
+      PreSettlementPrice: { offset: 88; type: "double"; size: 8 };
+      PreClosePrice: { offset: 96; type: "double"; size: 8 };
+      PreOpenInterest: { offset: 104; type: "double"; size: 8 };
+      OpenPrice: { offset: 112; type: "double"; size: 8 };
+      HighestPrice: { offset: 120; type: "double"; size: 8 };
+      LowestPrice: { offset: 128; type: "double"; size: 8 };
+      Volume: { offset: 136; type: "int32"; size: 4 };
+      Turnover: { offset: 144; type: "double"; size: 8 };
+      OpenInterest: { offset: 152; type: "double"; size: 8 };
+      ClosePrice: { offset: 160; type: "double"; size: 8 };
+      SettlementPrice: { offset: 168; type: "double"; size: 8 };
+      UpperLimitPrice: { offset: 176; type: "double"; size: 8 };
+      LowerLimitPrice: { offset: 184; type: "double"; size: 8 };
+      PreDelta: { offset: 192; type: "double"; size: 8 };
+      CurrDelta: { offset: 200; type: "double"; size: 8 };
+      UpdateTime: { offset: 208; type: "string"; size: 9 };
+      UpdateMillisec: { offset: 220; type: "int32"; size: 4 };
+      BidPrice1: { offset: 224; type: "double"; size: 8 };
+      BidVolume1: { offset: 232; type: "int32"; size: 4 };
+      AskPrice1: { offset: 240; type: "double"; size: 8 };
+      AskVolume1: { offset: 248; type: "int32"; size: 4 };
+      BidPrice2: { offset: 256; type: "double"; size: 8 };
+      BidVolume2: { offset: 264; type: "int32"; size: 4 };
+      AskPrice2: { offset: 272; type: "double"; size: 8 };
+      AskVolume2: { offset: 280; type: "int32"; size: 4 };
+      BidPrice3: { offset: 288; type: "double"; size: 8 };
+      BidVolume3: { offset: 296; type: "int32"; size: 4 };
+      AskPrice3: { offset: 304; type: "double"; size: 8 };
+      AskVolume3: { offset: 312; type: "int32"; size: 4 };
+      BidPrice4: { offset: 320; type: "double"; size: 8 };
+      BidVolume4: { offset: 328; type: "int32"; size: 4 };
+      AskPrice4: { offset: 336; type: "double"; size: 8 };
+      AskVolume4: { offset: 344; type: "int32"; size: 4 };
+      BidPrice5: { offset: 352; type: "double"; size: 8 };
+      BidVolume5: { offset: 360; type: "int32"; size: 4 };
+      AskPrice5: { offset: 368; type: "double"; size: 8 };
+      AskVolume5: { offset: 376; type: "int32"; size: 4 };
+      AveragePrice: { offset: 384; type: "double"; size: 8 };
+      ActionDay: { offset: 392; type: "string"; size: 9 };
+      InstrumentID: { offset: 401; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 482; type: "string"; size: 81 };
+      BandingUpperPrice: { offset: 568; type: "double"; size: 8 };
+      BandingLowerPrice: { offset: 576; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcTraderOfferField: {
+    size: 224;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      TraderID: { offset: 9; type: "string"; size: 21 };
+      ParticipantID: { offset: 30; type: "string"; size: 11 };
+      Password: { offset: 41; type: "string"; size: 41 };
+      InstallID: { offset: 84; type: "int32"; size: 4 };
+      OrderLocalID: { offset: 88; type: "string"; size: 13 };
+      TraderConnectStatus: { offset: 101; type: "char"; size: 1 };
+      ConnectRequestDate: { offset: 102; type: "string"; size: 9 };
+      ConnectRequestTime: { offset: 111; type: "string"; size: 9 };
+      LastReportDate: { offset: 120; type: "string"; size: 9 };
+      LastReportTime: { offset: 129; type: "string"; size: 9 };
+      ConnectDate: { offset: 138; type: "string"; size: 9 };
+      ConnectTime: { offset: 147; type: "string"; size: 9 };
+      StartDate: { offset: 156; type: "string"; size: 9 };
+      StartTime: { offset: 165; type: "string"; size: 9 };
+      TradingDay: { offset: 174; type: "string"; size: 9 };
+      BrokerID: { offset: 183; type: "string"; size: 11 };
+      MaxTradeID: { offset: 194; type: "string"; size: 21 };
+      MaxOrderMessageReference: { offset: 215; type: "string"; size: 7 };
+      OrderCancelAlg: { offset: 222; type: "char"; size: 1 };
+    };
+  };
+  CThostFtdcSettlementInfoField: {
+    size: 564;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      SettlementID: { offset: 12; type: "int32"; size: 4 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      InvestorID: { offset: 27; type: "string"; size: 13 };
+      SequenceNo: { offset: 40; type: "int32"; size: 4 };
+      Content: { offset: 44; type: "string"; size: 501 };
+      AccountID: { offset: 545; type: "string"; size: 13 };
+      CurrencyID: { offset: 558; type: "string"; size: 4 };
+    };
+  };
+  CThostFtdcExchangeMarginRateField: {
+    size: 176;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      reserve1: { offset: 11; type: "string"; size: 31 };
+      HedgeFlag: { offset: 42; type: "char"; size: 1 };
+      LongMarginRatioByMoney: { offset: 48; type: "double"; size: 8 };
+      LongMarginRatioByVolume: { offset: 56; type: "double"; size: 8 };
+      ShortMarginRatioByMoney: { offset: 64; type: "double"; size: 8 };
+      ShortMarginRatioByVolume: { offset: 72; type: "double"; size: 8 };
+      ExchangeID: { offset: 80; type: "string"; size: 9 };
+      InstrumentID: { offset: 89; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcExchangeMarginRateAdjustField: {
+    size: 232;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      reserve1: { offset: 11; type: "string"; size: 31 };
+      HedgeFlag: { offset: 42; type: "char"; size: 1 };
+      LongMarginRatioByMoney: { offset: 48; type: "double"; size: 8 };
+      LongMarginRatioByVolume: { offset: 56; type: "double"; size: 8 };
+      ShortMarginRatioByMoney: { offset: 64; type: "double"; size: 8 };
+      ShortMarginRatioByVolume: { offset: 72; type: "double"; size: 8 };
+      ExchLongMarginRatioByMoney: { offset: 80; type: "double"; size: 8 };
+      ExchLongMarginRatioByVolume: { offset: 88; type: "double"; size: 8 };
+      ExchShortMarginRatioByMoney: { offset: 96; type: "double"; size: 8 };
+      ExchShortMarginRatioByVolume: { offset: 104; type: "double"; size: 8 };
+      NoLongMarginRatioByMoney: { offset: 112; type: "double"; size: 8 };
+      NoLongMarginRatioByVolume: { offset: 120; type: "double"; size: 8 };
+      NoShortMarginRatioByMoney: { offset: 128; type: "double"; size: 8 };
+      NoShortMarginRatioByVolume: { offset: 136; type: "double"; size: 8 };
+      InstrumentID: { offset: 144; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcExchangeRateField: {
+    size: 40;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      FromCurrencyID: { offset: 11; type: "string"; size: 4 };
+      FromCurrencyUnit: { offset: 16; type: "double"; size: 8 };
+      ToCurrencyID: { offset: 24; type: "string"; size: 4 };
+      ExchangeRate: { offset: 32; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcUserPasswordUpdateField: {
+    size: 109;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      UserID: { offset: 11; type: "string"; size: 16 };
+      OldPassword: { offset: 27; type: "string"; size: 41 };
+      NewPassword: { offset: 68; type: "string"; size: 41 };
+    };
+  };
+  CThostFtdcInputOrderField: {
+    size: 392;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      OrderPriceType: { offset: 84; type: "char"; size: 1 };
+      Direction: { offset: 85; type: "char"; size: 1 };
+      CombOffsetFlag: { offset: 86; type: "string"; size: 5 };
+      CombHedgeFlag: { offset: 91; type: "string"; size: 5 };
+      LimitPrice: { offset: 96; type: "double"; size: 8 };
+      VolumeTotalOriginal: { offset: 104; type: "int32"; size: 4 };
+      TimeCondition: { offset: 108; type: "char"; size: 1 };
+      GTDDate: { offset: 109; type: "string"; size: 9 };
+      VolumeCondition: { offset: 118; type: "char"; size: 1 };
+      MinVolume: { offset: 120; type: "int32"; size: 4 };
+      ContingentCondition: { offset: 124; type: "char"; size: 1 };
+      StopPrice: { offset: 128; type: "double"; size: 8 };
+      ForceCloseReason: { offset: 136; type: "char"; size: 1 };
+      IsAutoSuspend: { offset: 140; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 144; type: "string"; size: 21 };
+      RequestID: { offset: 168; type: "int32"; size: 4 };
+      UserForceClose: { offset: 172; type: "int32"; size: 4 };
+      IsSwapOrder: { offset: 176; type: "int32"; size: 4 };
+      ExchangeID: { offset: 180; type: "string"; size: 9 };
+      InvestUnitID: { offset: 189; type: "string"; size: 17 };
+      AccountID: { offset: 206; type: "string"; size: 13 };
+      CurrencyID: { offset: 219; type: "string"; size: 4 };
+      ClientID: { offset: 223; type: "string"; size: 11 };
+      reserve2: { offset: 234; type: "string"; size: 16 };
+      MacAddress: { offset: 250; type: "string"; size: 21 };
+      InstrumentID: { offset: 271; type: "string"; size: 81 };
+      IPAddress: { offset: 352; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcOrderField: {
+    size: 856;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      OrderPriceType: { offset: 84; type: "char"; size: 1 };
+      Direction: { offset: 85; type: "char"; size: 1 };
+      CombOffsetFlag: { offset: 86; type: "string"; size: 5 };
+      CombHedgeFlag: { offset: 91; type: "string"; size: 5 };
+      LimitPrice: { offset: 96; type: "double"; size: 8 };
+      VolumeTotalOriginal: { offset: 104; type: "int32"; size: 4 };
+      TimeCondition: { offset: 108; type: "char"; size: 1 };
+      GTDDate: { offset: 109; type: "string"; size: 9 };
+      VolumeCondition: { offset: 118; type: "char"; size: 1 };
+      MinVolume: { offset: 120; type: "int32"; size: 4 };
+      ContingentCondition: { offset: 124; type: "char"; size: 1 };
+      StopPrice: { offset: 128; type: "double"; size: 8 };
+      ForceCloseReason: { offset: 136; type: "char"; size: 1 };
+      IsAutoSuspend: { offset: 140; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 144; type: "string"; size: 21 };
+      RequestID: { offset: 168; type: "int32"; size: 4 };
+      OrderLocalID: { offset: 172; type: "string"; size: 13 };
+      ExchangeID: { offset: 185; type: "string"; size: 9 };
+      ParticipantID: { offset: 194; type: "string"; size: 11 };
+      ClientID: { offset: 205; type: "string"; size: 11 };
+      reserve2: { offset: 216; type: "string"; size: 31 };
+      TraderID: { offset: 247; type: "string"; size: 21 };
+      InstallID: { offset: 268; type: "int32"; size: 4 };
+      OrderSubmitStatus: { offset: 272; type: "char"; size: 1 };
+      NotifySequence: { offset: 276; type: "int32"; size: 4 };
+      TradingDay: { offset: 280; type: "string"; size: 9 };
+      SettlementID: { offset: 292; type: "int32"; size: 4 };
+      OrderSysID: { offset: 296; type: "string"; size: 21 };
+      OrderSource: { offset: 317; type: "char"; size: 1 };
+      OrderStatus: { offset: 318; type: "char"; size: 1 };
+      OrderType: { offset: 319; type: "char"; size: 1 };
+      VolumeTraded: { offset: 320; type: "int32"; size: 4 };
+      VolumeTotal: { offset: 324; type: "int32"; size: 4 };
+      InsertDate: { offset: 328; type: "string"; size: 9 };
+      InsertTime: { offset: 337; type: "string"; size: 9 };
+      ActiveTime: { offset: 346; type: "string"; size: 9 };
+      SuspendTime: { offset: 355; type: "string"; size: 9 };
+      UpdateTime: { offset: 364; type: "string"; size: 9 };
+      CancelTime: { offset: 373; type: "string"; size: 9 };
+      ActiveTraderID: { offset: 382; type: "string"; size: 21 };
+      ClearingPartID: { offset: 403; type: "string"; size: 11 };
+      SequenceNo: { offset: 416; type: "int32"; size: 4 };
+      FrontID: { offset: 420; type: "int32"; size: 4 };
+      SessionID: { offset: 424; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 428; type: "string"; size: 11 };
+      StatusMsg: { offset: 439; type: "string"; size: 81 };
+      UserForceClose: { offset: 520; type: "int32"; size: 4 };
+      ActiveUserID: { offset: 524; type: "string"; size: 16 };
+      BrokerOrderSeq: { offset: 540; type: "int32"; size: 4 };
+      RelativeOrderSysID: { offset: 544; type: "string"; size: 21 };
+      ZCETotalTradedVolume: { offset: 568; type: "int32"; size: 4 };
+      IsSwapOrder: { offset: 572; type: "int32"; size: 4 };
+      BranchID: { offset: 576; type: "string"; size: 9 };
+      InvestUnitID: { offset: 585; type: "string"; size: 17 };
+      AccountID: { offset: 602; type: "string"; size: 13 };
+      CurrencyID: { offset: 615; type: "string"; size: 4 };
+      reserve3: { offset: 619; type: "string"; size: 16 };
+      MacAddress: { offset: 635; type: "string"; size: 21 };
+      InstrumentID: { offset: 656; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 737; type: "string"; size: 81 };
+      IPAddress: { offset: 818; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInputOrderActionField: {
+    size: 320;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      OrderRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      OrderSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      LimitPrice: { offset: 88; type: "double"; size: 8 };
+      VolumeChange: { offset: 96; type: "int32"; size: 4 };
+      UserID: { offset: 100; type: "string"; size: 16 };
+      reserve1: { offset: 116; type: "string"; size: 31 };
+      InvestUnitID: { offset: 147; type: "string"; size: 17 };
+      reserve2: { offset: 164; type: "string"; size: 16 };
+      MacAddress: { offset: 180; type: "string"; size: 21 };
+      InstrumentID: { offset: 201; type: "string"; size: 81 };
+      IPAddress: { offset: 282; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcOrderActionField: {
+    size: 520;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      OrderRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      OrderSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      LimitPrice: { offset: 88; type: "double"; size: 8 };
+      VolumeChange: { offset: 96; type: "int32"; size: 4 };
+      ActionDate: { offset: 100; type: "string"; size: 9 };
+      ActionTime: { offset: 109; type: "string"; size: 9 };
+      TraderID: { offset: 118; type: "string"; size: 21 };
+      InstallID: { offset: 140; type: "int32"; size: 4 };
+      OrderLocalID: { offset: 144; type: "string"; size: 13 };
+      ActionLocalID: { offset: 157; type: "string"; size: 13 };
+      ParticipantID: { offset: 170; type: "string"; size: 11 };
+      ClientID: { offset: 181; type: "string"; size: 11 };
+      BusinessUnit: { offset: 192; type: "string"; size: 21 };
+      OrderActionStatus: { offset: 213; type: "char"; size: 1 };
+      UserID: { offset: 214; type: "string"; size: 16 };
+      StatusMsg: { offset: 230; type: "string"; size: 81 };
+      reserve1: { offset: 311; type: "string"; size: 31 };
+      BranchID: { offset: 342; type: "string"; size: 9 };
+      InvestUnitID: { offset: 351; type: "string"; size: 17 };
+      reserve2: { offset: 368; type: "string"; size: 16 };
+      MacAddress: { offset: 384; type: "string"; size: 21 };
+      InstrumentID: { offset: 405; type: "string"; size: 81 };
+      IPAddress: { offset: 486; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcTradeField: {
+    size: 496;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      ExchangeID: { offset: 84; type: "string"; size: 9 };
+      TradeID: { offset: 93; type: "string"; size: 21 };
+      Direction: { offset: 114; type: "char"; size: 1 };
+      OrderSysID: { offset: 115; type: "string"; size: 21 };
+      ParticipantID: { offset: 136; type: "string"; size: 11 };
+      ClientID: { offset: 147; type: "string"; size: 11 };
+      TradingRole: { offset: 158; type: "char"; size: 1 };
+      reserve2: { offset: 159; type: "string"; size: 31 };
+      OffsetFlag: { offset: 190; type: "char"; size: 1 };
+      HedgeFlag: { offset: 191; type: "char"; size: 1 };
+      Price: { offset: 192; type: "double"; size: 8 };
+      Volume: { offset: 200; type: "int32"; size: 4 };
+      TradeDate: { offset: 204; type: "string"; size: 9 };
+      TradeTime: { offset: 213; type: "string"; size: 9 };
+      TradeType: { offset: 222; type: "char"; size: 1 };
+      PriceSource: { offset: 223; type: "char"; size: 1 };
+      TraderID: { offset: 224; type: "string"; size: 21 };
+      OrderLocalID: { offset: 245; type: "string"; size: 13 };
+      ClearingPartID: { offset: 258; type: "string"; size: 11 };
+      BusinessUnit: { offset: 269; type: "string"; size: 21 };
+      SequenceNo: { offset: 292; type: "int32"; size: 4 };
+      TradingDay: { offset: 296; type: "string"; size: 9 };
+      SettlementID: { offset: 308; type: "int32"; size: 4 };
+      BrokerOrderSeq: { offset: 312; type: "int32"; size: 4 };
+      TradeSource: { offset: 316; type: "char"; size: 1 };
+      InvestUnitID: { offset: 317; type: "string"; size: 17 };
+      InstrumentID: { offset: 334; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 415; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcQryMaxOrderVolumeField: {
+    size: 172;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      Direction: { offset: 55; type: "char"; size: 1 };
+      OffsetFlag: { offset: 56; type: "char"; size: 1 };
+      HedgeFlag: { offset: 57; type: "char"; size: 1 };
+      MaxVolume: { offset: 60; type: "int32"; size: 4 };
+      ExchangeID: { offset: 64; type: "string"; size: 9 };
+      InvestUnitID: { offset: 73; type: "string"; size: 17 };
+      InstrumentID: { offset: 90; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcSettlementInfoConfirmField: {
+    size: 68;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      ConfirmDate: { offset: 24; type: "string"; size: 9 };
+      ConfirmTime: { offset: 33; type: "string"; size: 9 };
+      SettlementID: { offset: 44; type: "int32"; size: 4 };
+      AccountID: { offset: 48; type: "string"; size: 13 };
+      CurrencyID: { offset: 61; type: "string"; size: 4 };
+    };
+  };
+  CThostFtdcOptionInstrCommRateField: {
+    size: 232;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      OpenRatioByMoney: { offset: 56; type: "double"; size: 8 };
+      OpenRatioByVolume: { offset: 64; type: "double"; size: 8 };
+      CloseRatioByMoney: { offset: 72; type: "double"; size: 8 };
+      CloseRatioByVolume: { offset: 80; type: "double"; size: 8 };
+      CloseTodayRatioByMoney: { offset: 88; type: "double"; size: 8 };
+      CloseTodayRatioByVolume: { offset: 96; type: "double"; size: 8 };
+      StrikeRatioByMoney: { offset: 104; type: "double"; size: 8 };
+      StrikeRatioByVolume: { offset: 112; type: "double"; size: 8 };
+      ExchangeID: { offset: 120; type: "string"; size: 9 };
+      InvestUnitID: { offset: 129; type: "string"; size: 17 };
+      InstrumentID: { offset: 146; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcOptionInstrTradeCostField: {
+    size: 208;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      HedgeFlag: { offset: 55; type: "char"; size: 1 };
+      FixedMargin: { offset: 56; type: "double"; size: 8 };
+      MiniMargin: { offset: 64; type: "double"; size: 8 };
+      Royalty: { offset: 72; type: "double"; size: 8 };
+      ExchFixedMargin: { offset: 80; type: "double"; size: 8 };
+      ExchMiniMargin: { offset: 88; type: "double"; size: 8 };
+      ExchangeID: { offset: 96; type: "string"; size: 9 };
+      InvestUnitID: { offset: 105; type: "string"; size: 17 };
+      InstrumentID: { offset: 122; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInputExecOrderField: {
+    size: 324;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      ExecOrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Volume: { offset: 84; type: "int32"; size: 4 };
+      RequestID: { offset: 88; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 92; type: "string"; size: 21 };
+      OffsetFlag: { offset: 113; type: "char"; size: 1 };
+      HedgeFlag: { offset: 114; type: "char"; size: 1 };
+      ActionType: { offset: 115; type: "char"; size: 1 };
+      PosiDirection: { offset: 116; type: "char"; size: 1 };
+      ReservePositionFlag: { offset: 117; type: "char"; size: 1 };
+      CloseFlag: { offset: 118; type: "char"; size: 1 };
+      ExchangeID: { offset: 119; type: "string"; size: 9 };
+      InvestUnitID: { offset: 128; type: "string"; size: 17 };
+      AccountID: { offset: 145; type: "string"; size: 13 };
+      CurrencyID: { offset: 158; type: "string"; size: 4 };
+      ClientID: { offset: 162; type: "string"; size: 11 };
+      reserve2: { offset: 173; type: "string"; size: 16 };
+      MacAddress: { offset: 189; type: "string"; size: 21 };
+      InstrumentID: { offset: 210; type: "string"; size: 81 };
+      IPAddress: { offset: 291; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInputExecOrderActionField: {
+    size: 304;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      ExecOrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      ExecOrderRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      ExecOrderSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      UserID: { offset: 87; type: "string"; size: 16 };
+      reserve1: { offset: 103; type: "string"; size: 31 };
+      InvestUnitID: { offset: 134; type: "string"; size: 17 };
+      reserve2: { offset: 151; type: "string"; size: 16 };
+      MacAddress: { offset: 167; type: "string"; size: 21 };
+      InstrumentID: { offset: 188; type: "string"; size: 81 };
+      IPAddress: { offset: 269; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcExecOrderField: {
+    size: 704;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      ExecOrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Volume: { offset: 84; type: "int32"; size: 4 };
+      RequestID: { offset: 88; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 92; type: "string"; size: 21 };
+      OffsetFlag: { offset: 113; type: "char"; size: 1 };
+      HedgeFlag: { offset: 114; type: "char"; size: 1 };
+      ActionType: { offset: 115; type: "char"; size: 1 };
+      PosiDirection: { offset: 116; type: "char"; size: 1 };
+      ReservePositionFlag: { offset: 117; type: "char"; size: 1 };
+      CloseFlag: { offset: 118; type: "char"; size: 1 };
+      ExecOrderLocalID: { offset: 119; type: "string"; size: 13 };
+      ExchangeID: { offset: 132; type: "string"; size: 9 };
+      ParticipantID: { offset: 141; type: "string"; size: 11 };
+      ClientID: { offset: 152; type: "string"; size: 11 };
+      reserve2: { offset: 163; type: "string"; size: 31 };
+      TraderID: { offset: 194; type: "string"; size: 21 };
+      InstallID: { offset: 216; type: "int32"; size: 4 };
+      OrderSubmitStatus: { offset: 220; type: "char"; size: 1 };
+      NotifySequence: { offset: 224; type: "int32"; size: 4 };
+      TradingDay: { offset: 228; type: "string"; size: 9 };
+      SettlementID: { offset: 240; type: "int32"; size: 4 };
+      ExecOrderSysID: { offset: 244; type: "string"; size: 21 };
+      InsertDate: { offset: 265; type: "string"; size: 9 };
+      InsertTime: { offset: 274; type: "string"; size: 9 };
+      CancelTime: { offset: 283; type: "string"; size: 9 };
+      ExecResult: { offset: 292; type: "char"; size: 1 };
+      ClearingPartID: { offset: 293; type: "string"; size: 11 };
+      SequenceNo: { offset: 304; type: "int32"; size: 4 };
+      FrontID: { offset: 308; type: "int32"; size: 4 };
+      SessionID: { offset: 312; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 316; type: "string"; size: 11 };
+      StatusMsg: { offset: 327; type: "string"; size: 81 };
+      ActiveUserID: { offset: 408; type: "string"; size: 16 };
+      BrokerExecOrderSeq: { offset: 424; type: "int32"; size: 4 };
+      BranchID: { offset: 428; type: "string"; size: 9 };
+      InvestUnitID: { offset: 437; type: "string"; size: 17 };
+      AccountID: { offset: 454; type: "string"; size: 13 };
+      CurrencyID: { offset: 467; type: "string"; size: 4 };
+      reserve3: { offset: 471; type: "string"; size: 16 };
+      MacAddress: { offset: 487; type: "string"; size: 21 };
+      InstrumentID: { offset: 508; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 589; type: "string"; size: 81 };
+      IPAddress: { offset: 670; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcExecOrderActionField: {
+    size: 508;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      ExecOrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      ExecOrderRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      ExecOrderSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      ActionDate: { offset: 87; type: "string"; size: 9 };
+      ActionTime: { offset: 96; type: "string"; size: 9 };
+      TraderID: { offset: 105; type: "string"; size: 21 };
+      InstallID: { offset: 128; type: "int32"; size: 4 };
+      ExecOrderLocalID: { offset: 132; type: "string"; size: 13 };
+      ActionLocalID: { offset: 145; type: "string"; size: 13 };
+      ParticipantID: { offset: 158; type: "string"; size: 11 };
+      ClientID: { offset: 169; type: "string"; size: 11 };
+      BusinessUnit: { offset: 180; type: "string"; size: 21 };
+      OrderActionStatus: { offset: 201; type: "char"; size: 1 };
+      UserID: { offset: 202; type: "string"; size: 16 };
+      ActionType: { offset: 218; type: "char"; size: 1 };
+      StatusMsg: { offset: 219; type: "string"; size: 81 };
+      reserve1: { offset: 300; type: "string"; size: 31 };
+      BranchID: { offset: 331; type: "string"; size: 9 };
+      InvestUnitID: { offset: 340; type: "string"; size: 17 };
+      reserve2: { offset: 357; type: "string"; size: 16 };
+      MacAddress: { offset: 373; type: "string"; size: 21 };
+      InstrumentID: { offset: 394; type: "string"; size: 81 };
+      IPAddress: { offset: 475; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInputForQuoteField: {
+    size: 261;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      ForQuoteRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      ExchangeID: { offset: 84; type: "string"; size: 9 };
+      InvestUnitID: { offset: 93; type: "string"; size: 17 };
+      reserve2: { offset: 110; type: "string"; size: 16 };
+      MacAddress: { offset: 126; type: "string"; size: 21 };
+      InstrumentID: { offset: 147; type: "string"; size: 81 };
+      IPAddress: { offset: 228; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcForQuoteField: {
+    size: 568;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      ForQuoteRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      ForQuoteLocalID: { offset: 84; type: "string"; size: 13 };
+      ExchangeID: { offset: 97; type: "string"; size: 9 };
+      ParticipantID: { offset: 106; type: "string"; size: 11 };
+      ClientID: { offset: 117; type: "string"; size: 11 };
+      reserve2: { offset: 128; type: "string"; size: 31 };
+      TraderID: { offset: 159; type: "string"; size: 21 };
+      InstallID: { offset: 180; type: "int32"; size: 4 };
+      InsertDate: { offset: 184; type: "string"; size: 9 };
+      InsertTime: { offset: 193; type: "string"; size: 9 };
+      ForQuoteStatus: { offset: 202; type: "char"; size: 1 };
+      FrontID: { offset: 204; type: "int32"; size: 4 };
+      SessionID: { offset: 208; type: "int32"; size: 4 };
+      StatusMsg: { offset: 212; type: "string"; size: 81 };
+      ActiveUserID: { offset: 293; type: "string"; size: 16 };
+      BrokerForQutoSeq: { offset: 312; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 316; type: "string"; size: 17 };
+      reserve3: { offset: 333; type: "string"; size: 16 };
+      MacAddress: { offset: 349; type: "string"; size: 21 };
+      InstrumentID: { offset: 370; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 451; type: "string"; size: 81 };
+      IPAddress: { offset: 532; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInputQuoteField: {
+    size: 400;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      QuoteRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      AskPrice: { offset: 88; type: "double"; size: 8 };
+      BidPrice: { offset: 96; type: "double"; size: 8 };
+      AskVolume: { offset: 104; type: "int32"; size: 4 };
+      BidVolume: { offset: 108; type: "int32"; size: 4 };
+      RequestID: { offset: 112; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 116; type: "string"; size: 21 };
+      AskOffsetFlag: { offset: 137; type: "char"; size: 1 };
+      BidOffsetFlag: { offset: 138; type: "char"; size: 1 };
+      AskHedgeFlag: { offset: 139; type: "char"; size: 1 };
+      BidHedgeFlag: { offset: 140; type: "char"; size: 1 };
+      AskOrderRef: { offset: 141; type: "string"; size: 13 };
+      BidOrderRef: { offset: 154; type: "string"; size: 13 };
+      ForQuoteSysID: { offset: 167; type: "string"; size: 21 };
+      ExchangeID: { offset: 188; type: "string"; size: 9 };
+      InvestUnitID: { offset: 197; type: "string"; size: 17 };
+      ClientID: { offset: 214; type: "string"; size: 11 };
+      reserve2: { offset: 225; type: "string"; size: 16 };
+      MacAddress: { offset: 241; type: "string"; size: 21 };
+      InstrumentID: { offset: 262; type: "string"; size: 81 };
+      IPAddress: { offset: 343; type: "string"; size: 33 };
+      ReplaceSysID: { offset: 376; type: "string"; size: 21 };
+    };
+  };
+  CThostFtdcInputQuoteActionField: {
+    size: 316;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      QuoteActionRef: { offset: 24; type: "int32"; size: 4 };
+      QuoteRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      QuoteSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      UserID: { offset: 87; type: "string"; size: 16 };
+      reserve1: { offset: 103; type: "string"; size: 31 };
+      InvestUnitID: { offset: 134; type: "string"; size: 17 };
+      ClientID: { offset: 151; type: "string"; size: 11 };
+      reserve2: { offset: 162; type: "string"; size: 16 };
+      MacAddress: { offset: 178; type: "string"; size: 21 };
+      InstrumentID: { offset: 199; type: "string"; size: 81 };
+      IPAddress: { offset: 280; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcQuoteField: {
+    size: 840;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      QuoteRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      AskPrice: { offset: 88; type: "double"; size: 8 };
+      BidPrice: { offset: 96; type: "double"; size: 8 };
+      AskVolume: { offset: 104; type: "int32"; size: 4 };
+      BidVolume: { offset: 108; type: "int32"; size: 4 };
+      RequestID: { offset: 112; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 116; type: "string"; size: 21 };
+      AskOffsetFlag: { offset: 137; type: "char"; size: 1 };
+      BidOffsetFlag: { offset: 138; type: "char"; size: 1 };
+      AskHedgeFlag: { offset: 139; type: "char"; size: 1 };
+      BidHedgeFlag: { offset: 140; type: "char"; size: 1 };
+      QuoteLocalID: { offset: 141; type: "string"; size: 13 };
+      ExchangeID: { offset: 154; type: "string"; size: 9 };
+      ParticipantID: { offset: 163; type: "string"; size: 11 };
+      ClientID: { offset: 174; type: "string"; size: 11 };
+      reserve2: { offset: 185; type: "string"; size: 31 };
+      TraderID: { offset: 216; type: "string"; size: 21 };
+      InstallID: { offset: 240; type: "int32"; size: 4 };
+      NotifySequence: { offset: 244; type: "int32"; size: 4 };
+      OrderSubmitStatus: { offset: 248; type: "char"; size: 1 };
+      TradingDay: { offset: 249; type: "string"; size: 9 };
+      SettlementID: { offset: 260; type: "int32"; size: 4 };
+      QuoteSysID: { offset: 264; type: "string"; size: 21 };
+      InsertDate: { offset: 285; type: "string"; size: 9 };
+      InsertTime: { offset: 294; type: "string"; size: 9 };
+      CancelTime: { offset: 303; type: "string"; size: 9 };
+      QuoteStatus: { offset: 312; type: "char"; size: 1 };
+      ClearingPartID: { offset: 313; type: "string"; size: 11 };
+      SequenceNo: { offset: 324; type: "int32"; size: 4 };
+      AskOrderSysID: { offset: 328; type: "string"; size: 21 };
+      BidOrderSysID: { offset: 349; type: "string"; size: 21 };
+      FrontID: { offset: 372; type: "int32"; size: 4 };
+      SessionID: { offset: 376; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 380; type: "string"; size: 11 };
+      StatusMsg: { offset: 391; type: "string"; size: 81 };
+      ActiveUserID: { offset: 472; type: "string"; size: 16 };
+      BrokerQuoteSeq: { offset: 488; type: "int32"; size: 4 };
+      AskOrderRef: { offset: 492; type: "string"; size: 13 };
+      BidOrderRef: { offset: 505; type: "string"; size: 13 };
+      ForQuoteSysID: { offset: 518; type: "string"; size: 21 };
+      BranchID: { offset: 539; type: "string"; size: 9 };
+      InvestUnitID: { offset: 548; type: "string"; size: 17 };
+      AccountID: { offset: 565; type: "string"; size: 13 };
+      CurrencyID: { offset: 578; type: "string"; size: 4 };
+      reserve3: { offset: 582; type: "string"; size: 16 };
+      MacAddress: { offset: 598; type: "string"; size: 21 };
+      InstrumentID: { offset: 619; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 700; type: "string"; size: 81 };
+      IPAddress: { offset: 781; type: "string"; size: 33 };
+      ReplaceSysID: { offset: 814; type: "string"; size: 21 };
+    };
+  };
+  CThostFtdcQuoteActionField: {
+    size: 508;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      QuoteActionRef: { offset: 24; type: "int32"; size: 4 };
+      QuoteRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      QuoteSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      ActionDate: { offset: 87; type: "string"; size: 9 };
+      ActionTime: { offset: 96; type: "string"; size: 9 };
+      TraderID: { offset: 105; type: "string"; size: 21 };
+      InstallID: { offset: 128; type: "int32"; size: 4 };
+      QuoteLocalID: { offset: 132; type: "string"; size: 13 };
+      ActionLocalID: { offset: 145; type: "string"; size: 13 };
+      ParticipantID: { offset: 158; type: "string"; size: 11 };
+      ClientID: { offset: 169; type: "string"; size: 11 };
+      BusinessUnit: { offset: 180; type: "string"; size: 21 };
+      OrderActionStatus: { offset: 201; type: "char"; size: 1 };
+      UserID: { offset: 202; type: "string"; size: 16 };
+      StatusMsg: { offset: 218; type: "string"; size: 81 };
+      reserve1: { offset: 299; type: "string"; size: 31 };
+      BranchID: { offset: 330; type: "string"; size: 9 };
+      InvestUnitID: { offset: 339; type: "string"; size: 17 };
+      reserve2: { offset: 356; type: "string"; size: 16 };
+      MacAddress: { offset: 372; type: "string"; size: 21 };
+      InstrumentID: { offset: 393; type: "string"; size: 81 };
+      IPAddress: { offset: 474; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcForQuoteRspField: {
+    size: 169;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      reserve1: { offset: 9; type: "string"; size: 31 };
+      ForQuoteSysID: { offset: 40; type: "string"; size: 21 };
+      ForQuoteTime: { offset: 61; type: "string"; size: 9 };
+      ActionDay: { offset: 70; type: "string"; size: 9 };
+      ExchangeID: { offset: 79; type: "string"; size: 9 };
+      InstrumentID: { offset: 88; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInputBatchOrderActionField: {
+    size: 152;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      RequestID: { offset: 28; type: "int32"; size: 4 };
+      FrontID: { offset: 32; type: "int32"; size: 4 };
+      SessionID: { offset: 36; type: "int32"; size: 4 };
+      ExchangeID: { offset: 40; type: "string"; size: 9 };
+      UserID: { offset: 49; type: "string"; size: 16 };
+      InvestUnitID: { offset: 65; type: "string"; size: 17 };
+      reserve1: { offset: 82; type: "string"; size: 16 };
+      MacAddress: { offset: 98; type: "string"; size: 21 };
+      IPAddress: { offset: 119; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcBatchOrderActionField: {
+    size: 336;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      RequestID: { offset: 28; type: "int32"; size: 4 };
+      FrontID: { offset: 32; type: "int32"; size: 4 };
+      SessionID: { offset: 36; type: "int32"; size: 4 };
+      ExchangeID: { offset: 40; type: "string"; size: 9 };
+      ActionDate: { offset: 49; type: "string"; size: 9 };
+      ActionTime: { offset: 58; type: "string"; size: 9 };
+      TraderID: { offset: 67; type: "string"; size: 21 };
+      InstallID: { offset: 88; type: "int32"; size: 4 };
+      ActionLocalID: { offset: 92; type: "string"; size: 13 };
+      ParticipantID: { offset: 105; type: "string"; size: 11 };
+      ClientID: { offset: 116; type: "string"; size: 11 };
+      BusinessUnit: { offset: 127; type: "string"; size: 21 };
+      OrderActionStatus: { offset: 148; type: "char"; size: 1 };
+      UserID: { offset: 149; type: "string"; size: 16 };
+      StatusMsg: { offset: 165; type: "string"; size: 81 };
+      InvestUnitID: { offset: 246; type: "string"; size: 17 };
+      reserve1: { offset: 263; type: "string"; size: 16 };
+      MacAddress: { offset: 279; type: "string"; size: 21 };
+      IPAddress: { offset: 300; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcCombInstrumentGuardField: {
+    size: 152;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      reserve1: { offset: 11; type: "string"; size: 31 };
+      GuarantRatio: { offset: 48; type: "double"; size: 8 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      InstrumentID: { offset: 65; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInputCombActionField: {
+    size: 284;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      CombActionRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Direction: { offset: 84; type: "char"; size: 1 };
+      Volume: { offset: 88; type: "int32"; size: 4 };
+      CombDirection: { offset: 92; type: "char"; size: 1 };
+      HedgeFlag: { offset: 93; type: "char"; size: 1 };
+      ExchangeID: { offset: 94; type: "string"; size: 9 };
+      reserve2: { offset: 103; type: "string"; size: 16 };
+      MacAddress: { offset: 119; type: "string"; size: 21 };
+      InvestUnitID: { offset: 140; type: "string"; size: 17 };
+      FrontID: { offset: 160; type: "int32"; size: 4 };
+      SessionID: { offset: 164; type: "int32"; size: 4 };
+      InstrumentID: { offset: 168; type: "string"; size: 81 };
+      IPAddress: { offset: 249; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcCombActionField: {
+    size: 604;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      CombActionRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Direction: { offset: 84; type: "char"; size: 1 };
+      Volume: { offset: 88; type: "int32"; size: 4 };
+      CombDirection: { offset: 92; type: "char"; size: 1 };
+      HedgeFlag: { offset: 93; type: "char"; size: 1 };
+      ActionLocalID: { offset: 94; type: "string"; size: 13 };
+      ExchangeID: { offset: 107; type: "string"; size: 9 };
+      ParticipantID: { offset: 116; type: "string"; size: 11 };
+      ClientID: { offset: 127; type: "string"; size: 11 };
+      reserve2: { offset: 138; type: "string"; size: 31 };
+      TraderID: { offset: 169; type: "string"; size: 21 };
+      InstallID: { offset: 192; type: "int32"; size: 4 };
+      ActionStatus: { offset: 196; type: "char"; size: 1 };
+      NotifySequence: { offset: 200; type: "int32"; size: 4 };
+      TradingDay: { offset: 204; type: "string"; size: 9 };
+      SettlementID: { offset: 216; type: "int32"; size: 4 };
+      SequenceNo: { offset: 220; type: "int32"; size: 4 };
+      FrontID: { offset: 224; type: "int32"; size: 4 };
+      SessionID: { offset: 228; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 232; type: "string"; size: 11 };
+      StatusMsg: { offset: 243; type: "string"; size: 81 };
+      reserve3: { offset: 324; type: "string"; size: 16 };
+      MacAddress: { offset: 340; type: "string"; size: 21 };
+      ComTradeID: { offset: 361; type: "string"; size: 21 };
+      BranchID: { offset: 382; type: "string"; size: 9 };
+      InvestUnitID: { offset: 391; type: "string"; size: 17 };
+      InstrumentID: { offset: 408; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 489; type: "string"; size: 81 };
+      IPAddress: { offset: 570; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcProductExchRateField: {
+    size: 144;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      QuoteCurrencyID: { offset: 31; type: "string"; size: 4 };
+      ExchangeRate: { offset: 40; type: "double"; size: 8 };
+      ExchangeID: { offset: 48; type: "string"; size: 9 };
+      ProductID: { offset: 57; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcMMOptionInstrCommRateField: {
+    size: 208;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      OpenRatioByMoney: { offset: 56; type: "double"; size: 8 };
+      OpenRatioByVolume: { offset: 64; type: "double"; size: 8 };
+      CloseRatioByMoney: { offset: 72; type: "double"; size: 8 };
+      CloseRatioByVolume: { offset: 80; type: "double"; size: 8 };
+      CloseTodayRatioByMoney: { offset: 88; type: "double"; size: 8 };
+      CloseTodayRatioByVolume: { offset: 96; type: "double"; size: 8 };
+      StrikeRatioByMoney: { offset: 104; type: "double"; size: 8 };
+      StrikeRatioByVolume: { offset: 112; type: "double"; size: 8 };
+      InstrumentID: { offset: 120; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcMMInstrumentCommissionRateField: {
+    size: 192;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      OpenRatioByMoney: { offset: 56; type: "double"; size: 8 };
+      OpenRatioByVolume: { offset: 64; type: "double"; size: 8 };
+      CloseRatioByMoney: { offset: 72; type: "double"; size: 8 };
+      CloseRatioByVolume: { offset: 80; type: "double"; size: 8 };
+      CloseTodayRatioByMoney: { offset: 88; type: "double"; size: 8 };
+      CloseTodayRatioByVolume: { offset: 96; type: "double"; size: 8 };
+      InstrumentID: { offset: 104; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInstrumentOrderCommRateField: {
+    size: 208;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InvestorRange: { offset: 31; type: "char"; size: 1 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      HedgeFlag: { offset: 56; type: "char"; size: 1 };
+      OrderCommByVolume: { offset: 64; type: "double"; size: 8 };
+      OrderActionCommByVolume: { offset: 72; type: "double"; size: 8 };
+      ExchangeID: { offset: 80; type: "string"; size: 9 };
+      InvestUnitID: { offset: 89; type: "string"; size: 17 };
+      InstrumentID: { offset: 106; type: "string"; size: 81 };
+      OrderCommByTrade: { offset: 192; type: "double"; size: 8 };
+      OrderActionCommByTrade: { offset: 200; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcInputOptionSelfCloseField: {
+    size: 320;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OptionSelfCloseRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Volume: { offset: 84; type: "int32"; size: 4 };
+      RequestID: { offset: 88; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 92; type: "string"; size: 21 };
+      HedgeFlag: { offset: 113; type: "char"; size: 1 };
+      OptSelfCloseFlag: { offset: 114; type: "char"; size: 1 };
+      ExchangeID: { offset: 115; type: "string"; size: 9 };
+      InvestUnitID: { offset: 124; type: "string"; size: 17 };
+      AccountID: { offset: 141; type: "string"; size: 13 };
+      CurrencyID: { offset: 154; type: "string"; size: 4 };
+      ClientID: { offset: 158; type: "string"; size: 11 };
+      reserve2: { offset: 169; type: "string"; size: 16 };
+      MacAddress: { offset: 185; type: "string"; size: 21 };
+      InstrumentID: { offset: 206; type: "string"; size: 81 };
+      IPAddress: { offset: 287; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInputOptionSelfCloseActionField: {
+    size: 304;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OptionSelfCloseActionRef: { offset: 24; type: "int32"; size: 4 };
+      OptionSelfCloseRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      OptionSelfCloseSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      UserID: { offset: 87; type: "string"; size: 16 };
+      reserve1: { offset: 103; type: "string"; size: 31 };
+      InvestUnitID: { offset: 134; type: "string"; size: 17 };
+      reserve2: { offset: 151; type: "string"; size: 16 };
+      MacAddress: { offset: 167; type: "string"; size: 21 };
+      InstrumentID: { offset: 188; type: "string"; size: 81 };
+      IPAddress: { offset: 269; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcOptionSelfCloseField: {
+    size: 700;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OptionSelfCloseRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      Volume: { offset: 84; type: "int32"; size: 4 };
+      RequestID: { offset: 88; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 92; type: "string"; size: 21 };
+      HedgeFlag: { offset: 113; type: "char"; size: 1 };
+      OptSelfCloseFlag: { offset: 114; type: "char"; size: 1 };
+      OptionSelfCloseLocalID: { offset: 115; type: "string"; size: 13 };
+      ExchangeID: { offset: 128; type: "string"; size: 9 };
+      ParticipantID: { offset: 137; type: "string"; size: 11 };
+      ClientID: { offset: 148; type: "string"; size: 11 };
+      reserve2: { offset: 159; type: "string"; size: 31 };
+      TraderID: { offset: 190; type: "string"; size: 21 };
+      InstallID: { offset: 212; type: "int32"; size: 4 };
+      OrderSubmitStatus: { offset: 216; type: "char"; size: 1 };
+      NotifySequence: { offset: 220; type: "int32"; size: 4 };
+      TradingDay: { offset: 224; type: "string"; size: 9 };
+      SettlementID: { offset: 236; type: "int32"; size: 4 };
+      OptionSelfCloseSysID: { offset: 240; type: "string"; size: 21 };
+      InsertDate: { offset: 261; type: "string"; size: 9 };
+      InsertTime: { offset: 270; type: "string"; size: 9 };
+      CancelTime: { offset: 279; type: "string"; size: 9 };
+      ExecResult: { offset: 288; type: "char"; size: 1 };
+      ClearingPartID: { offset: 289; type: "string"; size: 11 };
+      SequenceNo: { offset: 300; type: "int32"; size: 4 };
+      FrontID: { offset: 304; type: "int32"; size: 4 };
+      SessionID: { offset: 308; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 312; type: "string"; size: 11 };
+      StatusMsg: { offset: 323; type: "string"; size: 81 };
+      ActiveUserID: { offset: 404; type: "string"; size: 16 };
+      BrokerOptionSelfCloseSeq: { offset: 420; type: "int32"; size: 4 };
+      BranchID: { offset: 424; type: "string"; size: 9 };
+      InvestUnitID: { offset: 433; type: "string"; size: 17 };
+      AccountID: { offset: 450; type: "string"; size: 13 };
+      CurrencyID: { offset: 463; type: "string"; size: 4 };
+      reserve3: { offset: 467; type: "string"; size: 16 };
+      MacAddress: { offset: 483; type: "string"; size: 21 };
+      InstrumentID: { offset: 504; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 585; type: "string"; size: 81 };
+      IPAddress: { offset: 666; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcOptionSelfCloseActionField: {
+    size: 508;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OptionSelfCloseActionRef: { offset: 24; type: "int32"; size: 4 };
+      OptionSelfCloseRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      OptionSelfCloseSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      ActionDate: { offset: 87; type: "string"; size: 9 };
+      ActionTime: { offset: 96; type: "string"; size: 9 };
+      TraderID: { offset: 105; type: "string"; size: 21 };
+      InstallID: { offset: 128; type: "int32"; size: 4 };
+      OptionSelfCloseLocalID: { offset: 132; type: "string"; size: 13 };
+      ActionLocalID: { offset: 145; type: "string"; size: 13 };
+      ParticipantID: { offset: 158; type: "string"; size: 11 };
+      ClientID: { offset: 169; type: "string"; size: 11 };
+      BusinessUnit: { offset: 180; type: "string"; size: 21 };
+      OrderActionStatus: { offset: 201; type: "char"; size: 1 };
+      UserID: { offset: 202; type: "string"; size: 16 };
+      StatusMsg: { offset: 218; type: "string"; size: 81 };
+      reserve1: { offset: 299; type: "string"; size: 31 };
+      BranchID: { offset: 330; type: "string"; size: 9 };
+      InvestUnitID: { offset: 339; type: "string"; size: 17 };
+      reserve2: { offset: 356; type: "string"; size: 16 };
+      MacAddress: { offset: 372; type: "string"; size: 21 };
+      InstrumentID: { offset: 393; type: "string"; size: 81 };
+      IPAddress: { offset: 474; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcInvestUnitField: {
+    size: 178;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      InvestUnitID: { offset: 24; type: "string"; size: 17 };
+      InvestorUnitName: { offset: 41; type: "string"; size: 81 };
+      InvestorGroupID: { offset: 122; type: "string"; size: 13 };
+      CommModelID: { offset: 135; type: "string"; size: 13 };
+      MarginModelID: { offset: 148; type: "string"; size: 13 };
+      AccountID: { offset: 161; type: "string"; size: 13 };
+      CurrencyID: { offset: 174; type: "string"; size: 4 };
+    };
+  };
+  CThostFtdcSecAgentCheckModeField: {
+    size: 48;
+    fields: {
+      InvestorID: { offset: 0; type: "string"; size: 13 };
+      BrokerID: { offset: 13; type: "string"; size: 11 };
+      CurrencyID: { offset: 24; type: "string"; size: 4 };
+      BrokerSecAgentID: { offset: 28; type: "string"; size: 13 };
+      CheckSelfAccount: { offset: 44; type: "int32"; size: 4 };
+    };
+  };
+  CThostFtdcSecAgentTradeInfoField: {
+    size: 198;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      BrokerSecAgentID: { offset: 11; type: "string"; size: 13 };
+      InvestorID: { offset: 24; type: "string"; size: 13 };
+      LongCustomerName: { offset: 37; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcSpecificInstrumentField: {
+    size: 112;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      InstrumentID: { offset: 31; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInstrumentStatusField: {
+    size: 260;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      reserve1: { offset: 9; type: "string"; size: 31 };
+      SettlementGroupID: { offset: 40; type: "string"; size: 9 };
+      reserve2: { offset: 49; type: "string"; size: 31 };
+      InstrumentStatus: { offset: 80; type: "char"; size: 1 };
+      TradingSegmentSN: { offset: 84; type: "int32"; size: 4 };
+      EnterTime: { offset: 88; type: "string"; size: 9 };
+      EnterReason: { offset: 97; type: "char"; size: 1 };
+      ExchangeInstID: { offset: 98; type: "string"; size: 81 };
+      InstrumentID: { offset: 179; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcTransferBankField: {
+    size: 116;
+    fields: {
+      BankID: { offset: 0; type: "string"; size: 4 };
+      BankBrchID: { offset: 4; type: "string"; size: 5 };
+      BankName: { offset: 9; type: "string"; size: 101 };
+      IsActive: { offset: 112; type: "int32"; size: 4 };
+    };
+  };
+  CThostFtdcInvestorPositionDetailField: {
+    size: 448;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      BrokerID: { offset: 31; type: "string"; size: 11 };
+      InvestorID: { offset: 42; type: "string"; size: 13 };
+      HedgeFlag: { offset: 55; type: "char"; size: 1 };
+      Direction: { offset: 56; type: "char"; size: 1 };
+      OpenDate: { offset: 57; type: "string"; size: 9 };
+      TradeID: { offset: 66; type: "string"; size: 21 };
+      Volume: { offset: 88; type: "int32"; size: 4 };
+      OpenPrice: { offset: 96; type: "double"; size: 8 };
+      TradingDay: { offset: 104; type: "string"; size: 9 };
+      SettlementID: { offset: 116; type: "int32"; size: 4 };
+      TradeType: { offset: 120; type: "char"; size: 1 };
+      reserve2: { offset: 121; type: "string"; size: 31 };
+      ExchangeID: { offset: 152; type: "string"; size: 9 };
+      CloseProfitByDate: { offset: 168; type: "double"; size: 8 };
+      CloseProfitByTrade: { offset: 176; type: "double"; size: 8 };
+      PositionProfitByDate: { offset: 184; type: "double"; size: 8 };
+      PositionProfitByTrade: { offset: 192; type: "double"; size: 8 };
+      Margin: { offset: 200; type: "double"; size: 8 };
+      ExchMargin: { offset: 208; type: "double"; size: 8 };
+      MarginRateByMoney: { offset: 216; type: "double"; size: 8 };
+      MarginRateByVolume: { offset: 224; type: "double"; size: 8 };
+      LastSettlementPrice: { offset: 232; type: "double"; size: 8 };
+      SettlementPrice: { offset: 240; type: "double"; size: 8 };
+      CloseVolume: { offset: 248; type: "int32"; size: 4 };
+      CloseAmount: { offset: 256; type: "double"; size: 8 };
+      TimeFirstVolume: { offset: 264; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 268; type: "string"; size: 17 };
+      SpecPosiType: { offset: 285; type: "char"; size: 1 };
+      InstrumentID: { offset: 286; type: "string"; size: 81 };
+      CombInstrumentID: { offset: 367; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcNoticeField: {
+    size: 514;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      Content: { offset: 11; type: "string"; size: 501 };
+      SequenceLabel: { offset: 512; type: "string"; size: 2 };
+    };
+  };
+  CThostFtdcTradingAccountPasswordUpdateField: {
+    size: 110;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      AccountID: { offset: 11; type: "string"; size: 13 };
+      OldPassword: { offset: 24; type: "string"; size: 41 };
+      NewPassword: { offset: 65; type: "string"; size: 41 };
+      CurrencyID: { offset: 106; type: "string"; size: 4 };
+    };
+  };
+  CThostFtdcContractBankField: {
+    size: 121;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      BankID: { offset: 11; type: "string"; size: 4 };
+      BankBrchID: { offset: 15; type: "string"; size: 5 };
+      BankName: { offset: 20; type: "string"; size: 101 };
+    };
+  };
+  CThostFtdcInvestorPositionCombineDetailField: {
+    size: 392;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      OpenDate: { offset: 9; type: "string"; size: 9 };
+      ExchangeID: { offset: 18; type: "string"; size: 9 };
+      SettlementID: { offset: 28; type: "int32"; size: 4 };
+      BrokerID: { offset: 32; type: "string"; size: 11 };
+      InvestorID: { offset: 43; type: "string"; size: 13 };
+      ComTradeID: { offset: 56; type: "string"; size: 21 };
+      TradeID: { offset: 77; type: "string"; size: 21 };
+      reserve1: { offset: 98; type: "string"; size: 31 };
+      HedgeFlag: { offset: 129; type: "char"; size: 1 };
+      Direction: { offset: 130; type: "char"; size: 1 };
+      TotalAmt: { offset: 132; type: "int32"; size: 4 };
+      Margin: { offset: 136; type: "double"; size: 8 };
+      ExchMargin: { offset: 144; type: "double"; size: 8 };
+      MarginRateByMoney: { offset: 152; type: "double"; size: 8 };
+      MarginRateByVolume: { offset: 160; type: "double"; size: 8 };
+      LegID: { offset: 168; type: "int32"; size: 4 };
+      LegMultiple: { offset: 172; type: "int32"; size: 4 };
+      reserve2: { offset: 176; type: "string"; size: 31 };
+      TradeGroupID: { offset: 208; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 212; type: "string"; size: 17 };
+      InstrumentID: { offset: 229; type: "string"; size: 81 };
+      CombInstrumentID: { offset: 310; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcParkedOrderField: {
+    size: 488;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      OrderPriceType: { offset: 84; type: "char"; size: 1 };
+      Direction: { offset: 85; type: "char"; size: 1 };
+      CombOffsetFlag: { offset: 86; type: "string"; size: 5 };
+      CombHedgeFlag: { offset: 91; type: "string"; size: 5 };
+      LimitPrice: { offset: 96; type: "double"; size: 8 };
+      VolumeTotalOriginal: { offset: 104; type: "int32"; size: 4 };
+      TimeCondition: { offset: 108; type: "char"; size: 1 };
+      GTDDate: { offset: 109; type: "string"; size: 9 };
+      VolumeCondition: { offset: 118; type: "char"; size: 1 };
+      MinVolume: { offset: 120; type: "int32"; size: 4 };
+      ContingentCondition: { offset: 124; type: "char"; size: 1 };
+      StopPrice: { offset: 128; type: "double"; size: 8 };
+      ForceCloseReason: { offset: 136; type: "char"; size: 1 };
+      IsAutoSuspend: { offset: 140; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 144; type: "string"; size: 21 };
+      RequestID: { offset: 168; type: "int32"; size: 4 };
+      UserForceClose: { offset: 172; type: "int32"; size: 4 };
+      ExchangeID: { offset: 176; type: "string"; size: 9 };
+      ParkedOrderID: { offset: 185; type: "string"; size: 13 };
+      UserType: { offset: 198; type: "char"; size: 1 };
+      Status: { offset: 199; type: "char"; size: 1 };
+      ErrorID: { offset: 200; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 204; type: "string"; size: 81 };
+      IsSwapOrder: { offset: 288; type: "int32"; size: 4 };
+      AccountID: { offset: 292; type: "string"; size: 13 };
+      CurrencyID: { offset: 305; type: "string"; size: 4 };
+      ClientID: { offset: 309; type: "string"; size: 11 };
+      InvestUnitID: { offset: 320; type: "string"; size: 17 };
+      reserve2: { offset: 337; type: "string"; size: 16 };
+      MacAddress: { offset: 353; type: "string"; size: 21 };
+      InstrumentID: { offset: 374; type: "string"; size: 81 };
+      IPAddress: { offset: 455; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcParkedOrderActionField: {
+    size: 424;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      OrderActionRef: { offset: 24; type: "int32"; size: 4 };
+      OrderRef: { offset: 28; type: "string"; size: 13 };
+      RequestID: { offset: 44; type: "int32"; size: 4 };
+      FrontID: { offset: 48; type: "int32"; size: 4 };
+      SessionID: { offset: 52; type: "int32"; size: 4 };
+      ExchangeID: { offset: 56; type: "string"; size: 9 };
+      OrderSysID: { offset: 65; type: "string"; size: 21 };
+      ActionFlag: { offset: 86; type: "char"; size: 1 };
+      LimitPrice: { offset: 88; type: "double"; size: 8 };
+      VolumeChange: { offset: 96; type: "int32"; size: 4 };
+      UserID: { offset: 100; type: "string"; size: 16 };
+      reserve1: { offset: 116; type: "string"; size: 31 };
+      ParkedOrderActionID: { offset: 147; type: "string"; size: 13 };
+      UserType: { offset: 160; type: "char"; size: 1 };
+      Status: { offset: 161; type: "char"; size: 1 };
+      ErrorID: { offset: 164; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 168; type: "string"; size: 81 };
+      InvestUnitID: { offset: 249; type: "string"; size: 17 };
+      reserve2: { offset: 266; type: "string"; size: 16 };
+      MacAddress: { offset: 282; type: "string"; size: 21 };
+      InstrumentID: { offset: 303; type: "string"; size: 81 };
+      IPAddress: { offset: 384; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcRemoveParkedOrderField: {
+    size: 54;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      ParkedOrderID: { offset: 24; type: "string"; size: 13 };
+      InvestUnitID: { offset: 37; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcRemoveParkedOrderActionField: {
+    size: 54;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      ParkedOrderActionID: { offset: 24; type: "string"; size: 13 };
+      InvestUnitID: { offset: 37; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcTradingNoticeInfoField: {
+    size: 560;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      SendTime: { offset: 24; type: "string"; size: 9 };
+      FieldContent: { offset: 33; type: "string"; size: 501 };
+      SequenceSeries: { offset: 534; type: "int16"; size: 2 };
+      SequenceNo: { offset: 536; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 540; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcTradingNoticeField: {
+    size: 580;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorRange: { offset: 11; type: "char"; size: 1 };
+      InvestorID: { offset: 12; type: "string"; size: 13 };
+      SequenceSeries: { offset: 26; type: "int16"; size: 2 };
+      UserID: { offset: 28; type: "string"; size: 16 };
+      SendTime: { offset: 44; type: "string"; size: 9 };
+      SequenceNo: { offset: 56; type: "int32"; size: 4 };
+      FieldContent: { offset: 60; type: "string"; size: 501 };
+      InvestUnitID: { offset: 561; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcErrorConditionalOrderField: {
+    size: 944;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      reserve1: { offset: 24; type: "string"; size: 31 };
+      OrderRef: { offset: 55; type: "string"; size: 13 };
+      UserID: { offset: 68; type: "string"; size: 16 };
+      OrderPriceType: { offset: 84; type: "char"; size: 1 };
+      Direction: { offset: 85; type: "char"; size: 1 };
+      CombOffsetFlag: { offset: 86; type: "string"; size: 5 };
+      CombHedgeFlag: { offset: 91; type: "string"; size: 5 };
+      LimitPrice: { offset: 96; type: "double"; size: 8 };
+      VolumeTotalOriginal: { offset: 104; type: "int32"; size: 4 };
+      TimeCondition: { offset: 108; type: "char"; size: 1 };
+      GTDDate: { offset: 109; type: "string"; size: 9 };
+      VolumeCondition: { offset: 118; type: "char"; size: 1 };
+      MinVolume: { offset: 120; type: "int32"; size: 4 };
+      ContingentCondition: { offset: 124; type: "char"; size: 1 };
+      StopPrice: { offset: 128; type: "double"; size: 8 };
+      ForceCloseReason: { offset: 136; type: "char"; size: 1 };
+      IsAutoSuspend: { offset: 140; type: "int32"; size: 4 };
+      BusinessUnit: { offset: 144; type: "string"; size: 21 };
+      RequestID: { offset: 168; type: "int32"; size: 4 };
+      OrderLocalID: { offset: 172; type: "string"; size: 13 };
+      ExchangeID: { offset: 185; type: "string"; size: 9 };
+      ParticipantID: { offset: 194; type: "string"; size: 11 };
+      ClientID: { offset: 205; type: "string"; size: 11 };
+      reserve2: { offset: 216; type: "string"; size: 31 };
+      TraderID: { offset: 247; type: "string"; size: 21 };
+      InstallID: { offset: 268; type: "int32"; size: 4 };
+      OrderSubmitStatus: { offset: 272; type: "char"; size: 1 };
+      NotifySequence: { offset: 276; type: "int32"; size: 4 };
+      TradingDay: { offset: 280; type: "string"; size: 9 };
+      SettlementID: { offset: 292; type: "int32"; size: 4 };
+      OrderSysID: { offset: 296; type: "string"; size: 21 };
+      OrderSource: { offset: 317; type: "char"; size: 1 };
+      OrderStatus: { offset: 318; type: "char"; size: 1 };
+      OrderType: { offset: 319; type: "char"; size: 1 };
+      VolumeTraded: { offset: 320; type: "int32"; size: 4 };
+      VolumeTotal: { offset: 324; type: "int32"; size: 4 };
+      InsertDate: { offset: 328; type: "string"; size: 9 };
+      InsertTime: { offset: 337; type: "string"; size: 9 };
+      ActiveTime: { offset: 346; type: "string"; size: 9 };
+      SuspendTime: { offset: 355; type: "string"; size: 9 };
+      UpdateTime: { offset: 364; type: "string"; size: 9 };
+      CancelTime: { offset: 373; type: "string"; size: 9 };
+      ActiveTraderID: { offset: 382; type: "string"; size: 21 };
+      ClearingPartID: { offset: 403; type: "string"; size: 11 };
+      SequenceNo: { offset: 416; type: "int32"; size: 4 };
+      FrontID: { offset: 420; type: "int32"; size: 4 };
+      SessionID: { offset: 424; type: "int32"; size: 4 };
+      UserProductInfo: { offset: 428; type: "string"; size: 11 };
+      StatusMsg: { offset: 439; type: "string"; size: 81 };
+      UserForceClose: { offset: 520; type: "int32"; size: 4 };
+      ActiveUserID: { offset: 524; type: "string"; size: 16 };
+      BrokerOrderSeq: { offset: 540; type: "int32"; size: 4 };
+      RelativeOrderSysID: { offset: 544; type: "string"; size: 21 };
+      ZCETotalTradedVolume: { offset: 568; type: "int32"; size: 4 };
+      ErrorID: { offset: 572; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 576; type: "string"; size: 81 };
+      IsSwapOrder: { offset: 660; type: "int32"; size: 4 };
+      BranchID: { offset: 664; type: "string"; size: 9 };
+      InvestUnitID: { offset: 673; type: "string"; size: 17 };
+      AccountID: { offset: 690; type: "string"; size: 13 };
+      CurrencyID: { offset: 703; type: "string"; size: 4 };
+      reserve3: { offset: 707; type: "string"; size: 16 };
+      MacAddress: { offset: 723; type: "string"; size: 21 };
+      InstrumentID: { offset: 744; type: "string"; size: 81 };
+      ExchangeInstID: { offset: 825; type: "string"; size: 81 };
+      IPAddress: { offset: 906; type: "string"; size: 33 };
+    };
+  };
+  CThostFtdcBrokerTradingParamsField: {
+    size: 45;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      MarginPriceType: { offset: 24; type: "char"; size: 1 };
+      Algorithm: { offset: 25; type: "char"; size: 1 };
+      AvailIncludeCloseProfit: { offset: 26; type: "char"; size: 1 };
+      CurrencyID: { offset: 27; type: "string"; size: 4 };
+      OptionRoyaltyPriceType: { offset: 31; type: "char"; size: 1 };
+      AccountID: { offset: 32; type: "string"; size: 13 };
+    };
+  };
+  CThostFtdcBrokerTradingAlgosField: {
+    size: 135;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      ExchangeID: { offset: 11; type: "string"; size: 9 };
+      reserve1: { offset: 20; type: "string"; size: 31 };
+      HandlePositionAlgoID: { offset: 51; type: "char"; size: 1 };
+      FindMarginRateAlgoID: { offset: 52; type: "char"; size: 1 };
+      HandleTradingAccountAlgoID: { offset: 53; type: "char"; size: 1 };
+      InstrumentID: { offset: 54; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcCFMMCTradingAccountKeyField: {
+    size: 64;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      ParticipantID: { offset: 11; type: "string"; size: 11 };
+      AccountID: { offset: 22; type: "string"; size: 13 };
+      KeyID: { offset: 36; type: "int32"; size: 4 };
+      CurrentKey: { offset: 40; type: "string"; size: 21 };
+    };
+  };
+  CThostFtdcEWarrantOffsetField: {
+    size: 180;
+    fields: {
+      TradingDay: { offset: 0; type: "string"; size: 9 };
+      BrokerID: { offset: 9; type: "string"; size: 11 };
+      InvestorID: { offset: 20; type: "string"; size: 13 };
+      ExchangeID: { offset: 33; type: "string"; size: 9 };
+      reserve1: { offset: 42; type: "string"; size: 31 };
+      Direction: { offset: 73; type: "char"; size: 1 };
+      HedgeFlag: { offset: 74; type: "char"; size: 1 };
+      Volume: { offset: 76; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 80; type: "string"; size: 17 };
+      InstrumentID: { offset: 97; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcInvestorProductGroupMarginField: {
+    size: 352;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      BrokerID: { offset: 31; type: "string"; size: 11 };
+      InvestorID: { offset: 42; type: "string"; size: 13 };
+      TradingDay: { offset: 55; type: "string"; size: 9 };
+      SettlementID: { offset: 64; type: "int32"; size: 4 };
+      FrozenMargin: { offset: 72; type: "double"; size: 8 };
+      LongFrozenMargin: { offset: 80; type: "double"; size: 8 };
+      ShortFrozenMargin: { offset: 88; type: "double"; size: 8 };
+      UseMargin: { offset: 96; type: "double"; size: 8 };
+      LongUseMargin: { offset: 104; type: "double"; size: 8 };
+      ShortUseMargin: { offset: 112; type: "double"; size: 8 };
+      ExchMargin: { offset: 120; type: "double"; size: 8 };
+      LongExchMargin: { offset: 128; type: "double"; size: 8 };
+      ShortExchMargin: { offset: 136; type: "double"; size: 8 };
+      CloseProfit: { offset: 144; type: "double"; size: 8 };
+      FrozenCommission: { offset: 152; type: "double"; size: 8 };
+      Commission: { offset: 160; type: "double"; size: 8 };
+      FrozenCash: { offset: 168; type: "double"; size: 8 };
+      CashIn: { offset: 176; type: "double"; size: 8 };
+      PositionProfit: { offset: 184; type: "double"; size: 8 };
+      OffsetAmount: { offset: 192; type: "double"; size: 8 };
+      LongOffsetAmount: { offset: 200; type: "double"; size: 8 };
+      ShortOffsetAmount: { offset: 208; type: "double"; size: 8 };
+      ExchOffsetAmount: { offset: 216; type: "double"; size: 8 };
+      LongExchOffsetAmount: { offset: 224; type: "double"; size: 8 };
+      ShortExchOffsetAmount: { offset: 232; type: "double"; size: 8 };
+      HedgeFlag: { offset: 240; type: "char"; size: 1 };
+      ExchangeID: { offset: 241; type: "string"; size: 9 };
+      InvestUnitID: { offset: 250; type: "string"; size: 17 };
+      ProductGroupID: { offset: 267; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcQueryCFMMCTradingAccountTokenField: {
+    size: 41;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      InvestorID: { offset: 11; type: "string"; size: 13 };
+      InvestUnitID: { offset: 24; type: "string"; size: 17 };
+    };
+  };
+  CThostFtdcCFMMCTradingAccountTokenField: {
+    size: 64;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      ParticipantID: { offset: 11; type: "string"; size: 11 };
+      AccountID: { offset: 22; type: "string"; size: 13 };
+      KeyID: { offset: 36; type: "int32"; size: 4 };
+      Token: { offset: 40; type: "string"; size: 21 };
+    };
+  };
+  CThostFtdcProductGroupField: {
+    size: 233;
+    fields: {
+      reserve1: { offset: 0; type: "string"; size: 31 };
+      ExchangeID: { offset: 31; type: "string"; size: 9 };
+      reserve2: { offset: 40; type: "string"; size: 31 };
+      ProductID: { offset: 71; type: "string"; size: 81 };
+      ProductGroupID: { offset: 152; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcBulletinField: {
+    size: 876;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      TradingDay: { offset: 9; type: "string"; size: 9 };
+      BulletinID: { offset: 20; type: "int32"; size: 4 };
+      SequenceNo: { offset: 24; type: "int32"; size: 4 };
+      NewsType: { offset: 28; type: "string"; size: 3 };
+      NewsUrgency: { offset: 31; type: "char"; size: 1 };
+      SendTime: { offset: 32; type: "string"; size: 9 };
+      Abstract: { offset: 41; type: "string"; size: 81 };
+      ComeFrom: { offset: 122; type: "string"; size: 21 };
+      Content: { offset: 143; type: "string"; size: 501 };
+      URLLink: { offset: 644; type: "string"; size: 201 };
+      MarketID: { offset: 845; type: "string"; size: 31 };
+    };
+  };
+  CThostFtdcMulticastInstrumentField: {
+    size: 152;
+    fields: {
+      TopicID: { offset: 0; type: "int32"; size: 4 };
+      reserve1: { offset: 4; type: "string"; size: 31 };
+      InstrumentNo: { offset: 36; type: "int32"; size: 4 };
+      CodePrice: { offset: 40; type: "double"; size: 8 };
+      VolumeMultiple: { offset: 48; type: "int32"; size: 4 };
+      PriceTick: { offset: 56; type: "double"; size: 8 };
+      InstrumentID: { offset: 64; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcReqTransferField: {
+    size: 864;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      CustType: { offset: 215; type: "char"; size: 1 };
+      BankAccount: { offset: 216; type: "string"; size: 41 };
+      BankPassWord: { offset: 257; type: "string"; size: 41 };
+      AccountID: { offset: 298; type: "string"; size: 13 };
+      Password: { offset: 311; type: "string"; size: 41 };
+      InstallID: { offset: 352; type: "int32"; size: 4 };
+      FutureSerial: { offset: 356; type: "int32"; size: 4 };
+      UserID: { offset: 360; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 376; type: "char"; size: 1 };
+      CurrencyID: { offset: 377; type: "string"; size: 4 };
+      TradeAmount: { offset: 384; type: "double"; size: 8 };
+      FutureFetchAmount: { offset: 392; type: "double"; size: 8 };
+      FeePayFlag: { offset: 400; type: "char"; size: 1 };
+      CustFee: { offset: 408; type: "double"; size: 8 };
+      BrokerFee: { offset: 416; type: "double"; size: 8 };
+      Message: { offset: 424; type: "string"; size: 129 };
+      Digest: { offset: 553; type: "string"; size: 36 };
+      BankAccType: { offset: 589; type: "char"; size: 1 };
+      DeviceID: { offset: 590; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 593; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 594; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 627; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 668; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 669; type: "char"; size: 1 };
+      OperNo: { offset: 670; type: "string"; size: 17 };
+      RequestID: { offset: 688; type: "int32"; size: 4 };
+      TID: { offset: 692; type: "int32"; size: 4 };
+      TransferStatus: { offset: 696; type: "char"; size: 1 };
+      LongCustomerName: { offset: 697; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcRspTransferField: {
+    size: 952;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      CustType: { offset: 215; type: "char"; size: 1 };
+      BankAccount: { offset: 216; type: "string"; size: 41 };
+      BankPassWord: { offset: 257; type: "string"; size: 41 };
+      AccountID: { offset: 298; type: "string"; size: 13 };
+      Password: { offset: 311; type: "string"; size: 41 };
+      InstallID: { offset: 352; type: "int32"; size: 4 };
+      FutureSerial: { offset: 356; type: "int32"; size: 4 };
+      UserID: { offset: 360; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 376; type: "char"; size: 1 };
+      CurrencyID: { offset: 377; type: "string"; size: 4 };
+      TradeAmount: { offset: 384; type: "double"; size: 8 };
+      FutureFetchAmount: { offset: 392; type: "double"; size: 8 };
+      FeePayFlag: { offset: 400; type: "char"; size: 1 };
+      CustFee: { offset: 408; type: "double"; size: 8 };
+      BrokerFee: { offset: 416; type: "double"; size: 8 };
+      Message: { offset: 424; type: "string"; size: 129 };
+      Digest: { offset: 553; type: "string"; size: 36 };
+      BankAccType: { offset: 589; type: "char"; size: 1 };
+      DeviceID: { offset: 590; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 593; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 594; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 627; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 668; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 669; type: "char"; size: 1 };
+      OperNo: { offset: 670; type: "string"; size: 17 };
+      RequestID: { offset: 688; type: "int32"; size: 4 };
+      TID: { offset: 692; type: "int32"; size: 4 };
+      TransferStatus: { offset: 696; type: "char"; size: 1 };
+      ErrorID: { offset: 700; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 704; type: "string"; size: 81 };
+      LongCustomerName: { offset: 785; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcReqRepealField: {
+    size: 904;
+    fields: {
+      RepealTimeInterval: { offset: 0; type: "int32"; size: 4 };
+      RepealedTimes: { offset: 4; type: "int32"; size: 4 };
+      BankRepealFlag: { offset: 8; type: "char"; size: 1 };
+      BrokerRepealFlag: { offset: 9; type: "char"; size: 1 };
+      PlateRepealSerial: { offset: 12; type: "int32"; size: 4 };
+      BankRepealSerial: { offset: 16; type: "string"; size: 13 };
+      FutureRepealSerial: { offset: 32; type: "int32"; size: 4 };
+      TradeCode: { offset: 36; type: "string"; size: 7 };
+      BankID: { offset: 43; type: "string"; size: 4 };
+      BankBranchID: { offset: 47; type: "string"; size: 5 };
+      BrokerID: { offset: 52; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 63; type: "string"; size: 31 };
+      TradeDate: { offset: 94; type: "string"; size: 9 };
+      TradeTime: { offset: 103; type: "string"; size: 9 };
+      BankSerial: { offset: 112; type: "string"; size: 13 };
+      TradingDay: { offset: 125; type: "string"; size: 9 };
+      PlateSerial: { offset: 136; type: "int32"; size: 4 };
+      LastFragment: { offset: 140; type: "char"; size: 1 };
+      SessionID: { offset: 144; type: "int32"; size: 4 };
+      CustomerName: { offset: 148; type: "string"; size: 51 };
+      IdCardType: { offset: 199; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 200; type: "string"; size: 51 };
+      CustType: { offset: 251; type: "char"; size: 1 };
+      BankAccount: { offset: 252; type: "string"; size: 41 };
+      BankPassWord: { offset: 293; type: "string"; size: 41 };
+      AccountID: { offset: 334; type: "string"; size: 13 };
+      Password: { offset: 347; type: "string"; size: 41 };
+      InstallID: { offset: 388; type: "int32"; size: 4 };
+      FutureSerial: { offset: 392; type: "int32"; size: 4 };
+      UserID: { offset: 396; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 412; type: "char"; size: 1 };
+      CurrencyID: { offset: 413; type: "string"; size: 4 };
+      TradeAmount: { offset: 424; type: "double"; size: 8 };
+      FutureFetchAmount: { offset: 432; type: "double"; size: 8 };
+      FeePayFlag: { offset: 440; type: "char"; size: 1 };
+      CustFee: { offset: 448; type: "double"; size: 8 };
+      BrokerFee: { offset: 456; type: "double"; size: 8 };
+      Message: { offset: 464; type: "string"; size: 129 };
+      Digest: { offset: 593; type: "string"; size: 36 };
+      BankAccType: { offset: 629; type: "char"; size: 1 };
+      DeviceID: { offset: 630; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 633; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 634; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 667; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 708; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 709; type: "char"; size: 1 };
+      OperNo: { offset: 710; type: "string"; size: 17 };
+      RequestID: { offset: 728; type: "int32"; size: 4 };
+      TID: { offset: 732; type: "int32"; size: 4 };
+      TransferStatus: { offset: 736; type: "char"; size: 1 };
+      LongCustomerName: { offset: 737; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcRspRepealField: {
+    size: 992;
+    fields: {
+      RepealTimeInterval: { offset: 0; type: "int32"; size: 4 };
+      RepealedTimes: { offset: 4; type: "int32"; size: 4 };
+      BankRepealFlag: { offset: 8; type: "char"; size: 1 };
+      BrokerRepealFlag: { offset: 9; type: "char"; size: 1 };
+      PlateRepealSerial: { offset: 12; type: "int32"; size: 4 };
+      BankRepealSerial: { offset: 16; type: "string"; size: 13 };
+      FutureRepealSerial: { offset: 32; type: "int32"; size: 4 };
+      TradeCode: { offset: 36; type: "string"; size: 7 };
+      BankID: { offset: 43; type: "string"; size: 4 };
+      BankBranchID: { offset: 47; type: "string"; size: 5 };
+      BrokerID: { offset: 52; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 63; type: "string"; size: 31 };
+      TradeDate: { offset: 94; type: "string"; size: 9 };
+      TradeTime: { offset: 103; type: "string"; size: 9 };
+      BankSerial: { offset: 112; type: "string"; size: 13 };
+      TradingDay: { offset: 125; type: "string"; size: 9 };
+      PlateSerial: { offset: 136; type: "int32"; size: 4 };
+      LastFragment: { offset: 140; type: "char"; size: 1 };
+      SessionID: { offset: 144; type: "int32"; size: 4 };
+      CustomerName: { offset: 148; type: "string"; size: 51 };
+      IdCardType: { offset: 199; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 200; type: "string"; size: 51 };
+      CustType: { offset: 251; type: "char"; size: 1 };
+      BankAccount: { offset: 252; type: "string"; size: 41 };
+      BankPassWord: { offset: 293; type: "string"; size: 41 };
+      AccountID: { offset: 334; type: "string"; size: 13 };
+      Password: { offset: 347; type: "string"; size: 41 };
+      InstallID: { offset: 388; type: "int32"; size: 4 };
+      FutureSerial: { offset: 392; type: "int32"; size: 4 };
+      UserID: { offset: 396; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 412; type: "char"; size: 1 };
+      CurrencyID: { offset: 413; type: "string"; size: 4 };
+      TradeAmount: { offset: 424; type: "double"; size: 8 };
+      FutureFetchAmount: { offset: 432; type: "double"; size: 8 };
+      FeePayFlag: { offset: 440; type: "char"; size: 1 };
+      CustFee: { offset: 448; type: "double"; size: 8 };
+      BrokerFee: { offset: 456; type: "double"; size: 8 };
+      Message: { offset: 464; type: "string"; size: 129 };
+      Digest: { offset: 593; type: "string"; size: 36 };
+      BankAccType: { offset: 629; type: "char"; size: 1 };
+      DeviceID: { offset: 630; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 633; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 634; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 667; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 708; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 709; type: "char"; size: 1 };
+      OperNo: { offset: 710; type: "string"; size: 17 };
+      RequestID: { offset: 728; type: "int32"; size: 4 };
+      TID: { offset: 732; type: "int32"; size: 4 };
+      TransferStatus: { offset: 736; type: "char"; size: 1 };
+      ErrorID: { offset: 740; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 744; type: "string"; size: 81 };
+      LongCustomerName: { offset: 825; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcReqQueryAccountField: {
+    size: 688;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      CustType: { offset: 215; type: "char"; size: 1 };
+      BankAccount: { offset: 216; type: "string"; size: 41 };
+      BankPassWord: { offset: 257; type: "string"; size: 41 };
+      AccountID: { offset: 298; type: "string"; size: 13 };
+      Password: { offset: 311; type: "string"; size: 41 };
+      FutureSerial: { offset: 352; type: "int32"; size: 4 };
+      InstallID: { offset: 356; type: "int32"; size: 4 };
+      UserID: { offset: 360; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 376; type: "char"; size: 1 };
+      CurrencyID: { offset: 377; type: "string"; size: 4 };
+      Digest: { offset: 381; type: "string"; size: 36 };
+      BankAccType: { offset: 417; type: "char"; size: 1 };
+      DeviceID: { offset: 418; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 421; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 422; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 455; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 496; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 497; type: "char"; size: 1 };
+      OperNo: { offset: 498; type: "string"; size: 17 };
+      RequestID: { offset: 516; type: "int32"; size: 4 };
+      TID: { offset: 520; type: "int32"; size: 4 };
+      LongCustomerName: { offset: 524; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcNotifyQueryAccountField: {
+    size: 792;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      CustType: { offset: 215; type: "char"; size: 1 };
+      BankAccount: { offset: 216; type: "string"; size: 41 };
+      BankPassWord: { offset: 257; type: "string"; size: 41 };
+      AccountID: { offset: 298; type: "string"; size: 13 };
+      Password: { offset: 311; type: "string"; size: 41 };
+      FutureSerial: { offset: 352; type: "int32"; size: 4 };
+      InstallID: { offset: 356; type: "int32"; size: 4 };
+      UserID: { offset: 360; type: "string"; size: 16 };
+      VerifyCertNoFlag: { offset: 376; type: "char"; size: 1 };
+      CurrencyID: { offset: 377; type: "string"; size: 4 };
+      Digest: { offset: 381; type: "string"; size: 36 };
+      BankAccType: { offset: 417; type: "char"; size: 1 };
+      DeviceID: { offset: 418; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 421; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 422; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 455; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 496; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 497; type: "char"; size: 1 };
+      OperNo: { offset: 498; type: "string"; size: 17 };
+      RequestID: { offset: 516; type: "int32"; size: 4 };
+      TID: { offset: 520; type: "int32"; size: 4 };
+      BankUseAmount: { offset: 528; type: "double"; size: 8 };
+      BankFetchAmount: { offset: 536; type: "double"; size: 8 };
+      ErrorID: { offset: 544; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 548; type: "string"; size: 81 };
+      LongCustomerName: { offset: 629; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcTransferSerialField: {
+    size: 416;
+    fields: {
+      PlateSerial: { offset: 0; type: "int32"; size: 4 };
+      TradeDate: { offset: 4; type: "string"; size: 9 };
+      TradingDay: { offset: 13; type: "string"; size: 9 };
+      TradeTime: { offset: 22; type: "string"; size: 9 };
+      TradeCode: { offset: 31; type: "string"; size: 7 };
+      SessionID: { offset: 40; type: "int32"; size: 4 };
+      BankID: { offset: 44; type: "string"; size: 4 };
+      BankBranchID: { offset: 48; type: "string"; size: 5 };
+      BankAccType: { offset: 53; type: "char"; size: 1 };
+      BankAccount: { offset: 54; type: "string"; size: 41 };
+      BankSerial: { offset: 95; type: "string"; size: 13 };
+      BrokerID: { offset: 108; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 119; type: "string"; size: 31 };
+      FutureAccType: { offset: 150; type: "char"; size: 1 };
+      AccountID: { offset: 151; type: "string"; size: 13 };
+      InvestorID: { offset: 164; type: "string"; size: 13 };
+      FutureSerial: { offset: 180; type: "int32"; size: 4 };
+      IdCardType: { offset: 184; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 185; type: "string"; size: 51 };
+      CurrencyID: { offset: 236; type: "string"; size: 4 };
+      TradeAmount: { offset: 240; type: "double"; size: 8 };
+      CustFee: { offset: 248; type: "double"; size: 8 };
+      BrokerFee: { offset: 256; type: "double"; size: 8 };
+      AvailabilityFlag: { offset: 264; type: "char"; size: 1 };
+      OperatorCode: { offset: 265; type: "string"; size: 17 };
+      BankNewAccount: { offset: 282; type: "string"; size: 41 };
+      ErrorID: { offset: 324; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 328; type: "string"; size: 81 };
+    };
+  };
+  CThostFtdcAccountregisterField: {
+    size: 408;
+    fields: {
+      TradeDay: { offset: 0; type: "string"; size: 9 };
+      BankID: { offset: 9; type: "string"; size: 4 };
+      BankBranchID: { offset: 13; type: "string"; size: 5 };
+      BankAccount: { offset: 18; type: "string"; size: 41 };
+      BrokerID: { offset: 59; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 70; type: "string"; size: 31 };
+      AccountID: { offset: 101; type: "string"; size: 13 };
+      IdCardType: { offset: 114; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 115; type: "string"; size: 51 };
+      CustomerName: { offset: 166; type: "string"; size: 51 };
+      CurrencyID: { offset: 217; type: "string"; size: 4 };
+      OpenOrDestroy: { offset: 221; type: "char"; size: 1 };
+      RegDate: { offset: 222; type: "string"; size: 9 };
+      OutDate: { offset: 231; type: "string"; size: 9 };
+      TID: { offset: 240; type: "int32"; size: 4 };
+      CustType: { offset: 244; type: "char"; size: 1 };
+      BankAccType: { offset: 245; type: "char"; size: 1 };
+      LongCustomerName: { offset: 246; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcOpenAccountField: {
+    size: 1040;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      Gender: { offset: 215; type: "char"; size: 1 };
+      CountryCode: { offset: 216; type: "string"; size: 21 };
+      CustType: { offset: 237; type: "char"; size: 1 };
+      Address: { offset: 238; type: "string"; size: 101 };
+      ZipCode: { offset: 339; type: "string"; size: 7 };
+      Telephone: { offset: 346; type: "string"; size: 41 };
+      MobilePhone: { offset: 387; type: "string"; size: 21 };
+      Fax: { offset: 408; type: "string"; size: 41 };
+      EMail: { offset: 449; type: "string"; size: 41 };
+      MoneyAccountStatus: { offset: 490; type: "char"; size: 1 };
+      BankAccount: { offset: 491; type: "string"; size: 41 };
+      BankPassWord: { offset: 532; type: "string"; size: 41 };
+      AccountID: { offset: 573; type: "string"; size: 13 };
+      Password: { offset: 586; type: "string"; size: 41 };
+      InstallID: { offset: 628; type: "int32"; size: 4 };
+      VerifyCertNoFlag: { offset: 632; type: "char"; size: 1 };
+      CurrencyID: { offset: 633; type: "string"; size: 4 };
+      CashExchangeCode: { offset: 637; type: "char"; size: 1 };
+      Digest: { offset: 638; type: "string"; size: 36 };
+      BankAccType: { offset: 674; type: "char"; size: 1 };
+      DeviceID: { offset: 675; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 678; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 679; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 712; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 753; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 754; type: "char"; size: 1 };
+      OperNo: { offset: 755; type: "string"; size: 17 };
+      TID: { offset: 772; type: "int32"; size: 4 };
+      UserID: { offset: 776; type: "string"; size: 16 };
+      ErrorID: { offset: 792; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 796; type: "string"; size: 81 };
+      LongCustomerName: { offset: 877; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcCancelAccountField: {
+    size: 1040;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      Gender: { offset: 215; type: "char"; size: 1 };
+      CountryCode: { offset: 216; type: "string"; size: 21 };
+      CustType: { offset: 237; type: "char"; size: 1 };
+      Address: { offset: 238; type: "string"; size: 101 };
+      ZipCode: { offset: 339; type: "string"; size: 7 };
+      Telephone: { offset: 346; type: "string"; size: 41 };
+      MobilePhone: { offset: 387; type: "string"; size: 21 };
+      Fax: { offset: 408; type: "string"; size: 41 };
+      EMail: { offset: 449; type: "string"; size: 41 };
+      MoneyAccountStatus: { offset: 490; type: "char"; size: 1 };
+      BankAccount: { offset: 491; type: "string"; size: 41 };
+      BankPassWord: { offset: 532; type: "string"; size: 41 };
+      AccountID: { offset: 573; type: "string"; size: 13 };
+      Password: { offset: 586; type: "string"; size: 41 };
+      InstallID: { offset: 628; type: "int32"; size: 4 };
+      VerifyCertNoFlag: { offset: 632; type: "char"; size: 1 };
+      CurrencyID: { offset: 633; type: "string"; size: 4 };
+      CashExchangeCode: { offset: 637; type: "char"; size: 1 };
+      Digest: { offset: 638; type: "string"; size: 36 };
+      BankAccType: { offset: 674; type: "char"; size: 1 };
+      DeviceID: { offset: 675; type: "string"; size: 3 };
+      BankSecuAccType: { offset: 678; type: "char"; size: 1 };
+      BrokerIDByBank: { offset: 679; type: "string"; size: 33 };
+      BankSecuAcc: { offset: 712; type: "string"; size: 41 };
+      BankPwdFlag: { offset: 753; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 754; type: "char"; size: 1 };
+      OperNo: { offset: 755; type: "string"; size: 17 };
+      TID: { offset: 772; type: "int32"; size: 4 };
+      UserID: { offset: 776; type: "string"; size: 16 };
+      ErrorID: { offset: 792; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 796; type: "string"; size: 81 };
+      LongCustomerName: { offset: 877; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcChangeAccountField: {
+    size: 1044;
+    fields: {
+      TradeCode: { offset: 0; type: "string"; size: 7 };
+      BankID: { offset: 7; type: "string"; size: 4 };
+      BankBranchID: { offset: 11; type: "string"; size: 5 };
+      BrokerID: { offset: 16; type: "string"; size: 11 };
+      BrokerBranchID: { offset: 27; type: "string"; size: 31 };
+      TradeDate: { offset: 58; type: "string"; size: 9 };
+      TradeTime: { offset: 67; type: "string"; size: 9 };
+      BankSerial: { offset: 76; type: "string"; size: 13 };
+      TradingDay: { offset: 89; type: "string"; size: 9 };
+      PlateSerial: { offset: 100; type: "int32"; size: 4 };
+      LastFragment: { offset: 104; type: "char"; size: 1 };
+      SessionID: { offset: 108; type: "int32"; size: 4 };
+      CustomerName: { offset: 112; type: "string"; size: 51 };
+      IdCardType: { offset: 163; type: "char"; size: 1 };
+      IdentifiedCardNo: { offset: 164; type: "string"; size: 51 };
+      Gender: { offset: 215; type: "char"; size: 1 };
+      CountryCode: { offset: 216; type: "string"; size: 21 };
+      CustType: { offset: 237; type: "char"; size: 1 };
+      Address: { offset: 238; type: "string"; size: 101 };
+      ZipCode: { offset: 339; type: "string"; size: 7 };
+      Telephone: { offset: 346; type: "string"; size: 41 };
+      MobilePhone: { offset: 387; type: "string"; size: 21 };
+      Fax: { offset: 408; type: "string"; size: 41 };
+      EMail: { offset: 449; type: "string"; size: 41 };
+      MoneyAccountStatus: { offset: 490; type: "char"; size: 1 };
+      BankAccount: { offset: 491; type: "string"; size: 41 };
+      BankPassWord: { offset: 532; type: "string"; size: 41 };
+      NewBankAccount: { offset: 573; type: "string"; size: 41 };
+      NewBankPassWord: { offset: 614; type: "string"; size: 41 };
+      AccountID: { offset: 655; type: "string"; size: 13 };
+      Password: { offset: 668; type: "string"; size: 41 };
+      BankAccType: { offset: 709; type: "char"; size: 1 };
+      InstallID: { offset: 712; type: "int32"; size: 4 };
+      VerifyCertNoFlag: { offset: 716; type: "char"; size: 1 };
+      CurrencyID: { offset: 717; type: "string"; size: 4 };
+      BrokerIDByBank: { offset: 721; type: "string"; size: 33 };
+      BankPwdFlag: { offset: 754; type: "char"; size: 1 };
+      SecuPwdFlag: { offset: 755; type: "char"; size: 1 };
+      TID: { offset: 756; type: "int32"; size: 4 };
+      Digest: { offset: 760; type: "string"; size: 36 };
+      ErrorID: { offset: 796; type: "int32"; size: 4 };
+      ErrorMsg: { offset: 800; type: "string"; size: 81 };
+      LongCustomerName: { offset: 881; type: "string"; size: 161 };
+    };
+  };
+  CThostFtdcSecAgentACIDMapField: {
+    size: 57;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      UserID: { offset: 11; type: "string"; size: 16 };
+      AccountID: { offset: 27; type: "string"; size: 13 };
+      CurrencyID: { offset: 40; type: "string"; size: 4 };
+      BrokerSecAgentID: { offset: 44; type: "string"; size: 13 };
+    };
+  };
+  CThostFtdcRspUserAuthMethodField: {
+    size: 4;
+    fields: {
+      UsableAuthMethod: { offset: 0; type: "int32"; size: 4 };
+    };
+  };
+  CThostFtdcRspGenUserCaptchaField: {
+    size: 2596;
+    fields: {
+      BrokerID: { offset: 0; type: "string"; size: 11 };
+      UserID: { offset: 11; type: "string"; size: 16 };
+      CaptchaInfoLen: { offset: 28; type: "int32"; size: 4 };
+      CaptchaInfo: { offset: 32; type: "string"; size: 2561 };
+    };
+  };
+  CThostFtdcRspGenUserTextField: {
+    size: 4;
+    fields: {
+      UserTextSeq: { offset: 0; type: "int32"; size: 4 };
+    };
+  };
+  CThostFtdcCombPromotionParamField: {
+    size: 104;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      InstrumentID: { offset: 9; type: "string"; size: 81 };
+      CombHedgeFlag: { offset: 90; type: "string"; size: 5 };
+      Xparameter: { offset: 96; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcRiskSettleInvstPositionField: {
+    size: 432;
+    fields: {
+      InstrumentID: { offset: 0; type: "string"; size: 81 };
+      BrokerID: { offset: 81; type: "string"; size: 11 };
+      InvestorID: { offset: 92; type: "string"; size: 13 };
+      PosiDirection: { offset: 105; type: "char"; size: 1 };
+      HedgeFlag: { offset: 106; type: "char"; size: 1 };
+      PositionDate: { offset: 107; type: "char"; size: 1 };
+      YdPosition: { offset: 108; type: "int32"; size: 4 };
+      Position: { offset: 112; type: "int32"; size: 4 };
+      LongFrozen: { offset: 116; type: "int32"; size: 4 };
+      ShortFrozen: { offset: 120; type: "int32"; size: 4 };
+      LongFrozenAmount: { offset: 128; type: "double"; size: 8 };
+      ShortFrozenAmount: { offset: 136; type: "double"; size: 8 };
+      OpenVolume: { offset: 144; type: "int32"; size: 4 };
+      CloseVolume: { offset: 148; type: "int32"; size: 4 };
+      OpenAmount: { offset: 152; type: "double"; size: 8 };
+      CloseAmount: { offset: 160; type: "double"; size: 8 };
+      PositionCost: { offset: 168; type: "double"; size: 8 };
+      PreMargin: { offset: 176; type: "double"; size: 8 };
+      UseMargin: { offset: 184; type: "double"; size: 8 };
+      FrozenMargin: { offset: 192; type: "double"; size: 8 };
+      FrozenCash: { offset: 200; type: "double"; size: 8 };
+      FrozenCommission: { offset: 208; type: "double"; size: 8 };
+      CashIn: { offset: 216; type: "double"; size: 8 };
+      Commission: { offset: 224; type: "double"; size: 8 };
+      CloseProfit: { offset: 232; type: "double"; size: 8 };
+      PositionProfit: { offset: 240; type: "double"; size: 8 };
+      PreSettlementPrice: { offset: 248; type: "double"; size: 8 };
+      SettlementPrice: { offset: 256; type: "double"; size: 8 };
+      TradingDay: { offset: 264; type: "string"; size: 9 };
+      SettlementID: { offset: 276; type: "int32"; size: 4 };
+      OpenCost: { offset: 280; type: "double"; size: 8 };
+      ExchangeMargin: { offset: 288; type: "double"; size: 8 };
+      CombPosition: { offset: 296; type: "int32"; size: 4 };
+      CombLongFrozen: { offset: 300; type: "int32"; size: 4 };
+      CombShortFrozen: { offset: 304; type: "int32"; size: 4 };
+      CloseProfitByDate: { offset: 312; type: "double"; size: 8 };
+      CloseProfitByTrade: { offset: 320; type: "double"; size: 8 };
+      TodayPosition: { offset: 328; type: "int32"; size: 4 };
+      MarginRateByMoney: { offset: 336; type: "double"; size: 8 };
+      MarginRateByVolume: { offset: 344; type: "double"; size: 8 };
+      StrikeFrozen: { offset: 352; type: "int32"; size: 4 };
+      StrikeFrozenAmount: { offset: 360; type: "double"; size: 8 };
+      AbandonFrozen: { offset: 368; type: "int32"; size: 4 };
+      ExchangeID: { offset: 372; type: "string"; size: 9 };
+      YdStrikeFrozen: { offset: 384; type: "int32"; size: 4 };
+      InvestUnitID: { offset: 388; type: "string"; size: 17 };
+      PositionCostOffset: { offset: 408; type: "double"; size: 8 };
+      TasPosition: { offset: 416; type: "int32"; size: 4 };
+      TasPositionCost: { offset: 424; type: "double"; size: 8 };
+    };
+  };
+  CThostFtdcRiskSettleProductStatusField: {
+    size: 91;
+    fields: {
+      ExchangeID: { offset: 0; type: "string"; size: 9 };
+      ProductID: { offset: 9; type: "string"; size: 81 };
+      ProductStatus: { offset: 90; type: "char"; size: 1 };
+    };
+  };
+}
+
+/** 行情事件投递的结构体 */
+export interface MarketDataEventStructs {
+  "rsp-user-login": "CThostFtdcRspUserLoginField";
+  "rsp-user-logout": "CThostFtdcUserLogoutField";
+  "rsp-qry-multicast-instrument": "CThostFtdcMulticastInstrumentField";
+  "rsp-error": "CThostFtdcRspInfoField";
+  "rsp-sub-market-data": "CThostFtdcSpecificInstrumentField";
+  "rsp-unsub-market-data": "CThostFtdcSpecificInstrumentField";
+  "rsp-sub-for-quote": "CThostFtdcSpecificInstrumentField";
+  "rsp-unsub-for-quote": "CThostFtdcSpecificInstrumentField";
+  "rtn-depth-market-data": "CThostFtdcDepthMarketDataField";
+  "rtn-for-quote": "CThostFtdcForQuoteRspField";
+}
+
+/** 交易事件投递的结构体 */
+export interface TraderEventStructs {
+  "rsp-authenticate": "CThostFtdcRspAuthenticateField";
+  "rsp-user-login": "CThostFtdcRspUserLoginField";
+  "rsp-user-logout": "CThostFtdcUserLogoutField";
+  "rsp-user-password-update": "CThostFtdcUserPasswordUpdateField";
+  "rsp-trading-account-password-update": "CThostFtdcTradingAccountPasswordUpdateField";
+  "rsp-user-auth-method": "CThostFtdcRspUserAuthMethodField";
+  "rsp-gen-user-captcha": "CThostFtdcRspGenUserCaptchaField";
+  "rsp-gen-user-text": "CThostFtdcRspGenUserTextField";
+  "rsp-order-insert": "CThostFtdcInputOrderField";
+  "rsp-parked-order-insert": "CThostFtdcParkedOrderField";
+  "rsp-parked-order-action": "CThostFtdcParkedOrderActionField";
+  "rsp-order-action": "CThostFtdcInputOrderActionField";
+  "rsp-qry-max-order-volume": "CThostFtdcQryMaxOrderVolumeField";
+  "rsp-settlement-info-confirm": "CThostFtdcSettlementInfoConfirmField";
+  "rsp-remove-parked-order": "CThostFtdcRemoveParkedOrderField";
+  "rsp-remove-parked-order-action": "CThostFtdcRemoveParkedOrderActionField";
+  "rsp-exec-order-insert": "CThostFtdcInputExecOrderField";
+  "rsp-exec-order-action": "CThostFtdcInputExecOrderActionField";
+  "rsp-for-quote-insert": "CThostFtdcInputForQuoteField";
+  "rsp-quote-insert": "CThostFtdcInputQuoteField";
+  "rsp-quote-action": "CThostFtdcInputQuoteActionField";
+  "rsp-batch-order-action": "CThostFtdcInputBatchOrderActionField";
+  "rsp-option-self-close-insert": "CThostFtdcInputOptionSelfCloseField";
+  "rsp-option-self-close-action": "CThostFtdcInputOptionSelfCloseActionField";
+  "rsp-comb-action-insert": "CThostFtdcInputCombActionField";
+  "rsp-qry-order": "CThostFtdcOrderField";
+  "rsp-qry-trade": "CThostFtdcTradeField";
+  "rsp-qry-investor-position": "CThostFtdcInvestorPositionField";
+  "rsp-qry-trading-account": "CThostFtdcTradingAccountField";
+  "rsp-qry-investor": "CThostFtdcInvestorField";
+  "rsp-qry-trading-code": "CThostFtdcTradingCodeField";
+  "rsp-qry-instrument-margin-rate": "CThostFtdcInstrumentMarginRateField";
+  "rsp-qry-instrument-commission-rate": "CThostFtdcInstrumentCommissionRateField";
+  "rsp-qry-exchange": "CThostFtdcExchangeField";
+  "rsp-qry-product": "CThostFtdcProductField";
+  "rsp-qry-instrument": "CThostFtdcInstrumentField";
+  "rsp-qry-depth-market-data": "CThostFtdcDepthMarketDataField";
+  "rsp-qry-trader-offer": "CThostFtdcTraderOfferField";
+  "rsp-qry-settlement-info": "CThostFtdcSettlementInfoField";
+  "rsp-qry-transfer-bank": "CThostFtdcTransferBankField";
+  "rsp-qry-investor-position-detail": "CThostFtdcInvestorPositionDetailField";
+  "rsp-qry-notice": "CThostFtdcNoticeField";
+  "rsp-qry-settlement-info-confirm": "CThostFtdcSettlementInfoConfirmField";
+  "rsp-qry-investor-position-combine-detail": "CThostFtdcInvestorPositionCombineDetailField";
+  "rsp-qry-cfmmc-trading-account-key": "CThostFtdcCFMMCTradingAccountKeyField";
+  "rsp-qry-e-warrant-offset": "CThostFtdcEWarrantOffsetField";
+  "rsp-qry-investor-product-group-margin": "CThostFtdcInvestorProductGroupMarginField";
+  "rsp-qry-exchange-margin-rate": "CThostFtdcExchangeMarginRateField";
+  "rsp-qry-exchange-margin-rate-adjust": "CThostFtdcExchangeMarginRateAdjustField";
+  "rsp-qry-exchange-rate": "CThostFtdcExchangeRateField";
+  "rsp-qry-sec-agent-acid-map": "CThostFtdcSecAgentACIDMapField";
+  "rsp-qry-product-exch-rate": "CThostFtdcProductExchRateField";
+  "rsp-qry-product-group": "CThostFtdcProductGroupField";
+  "rsp-qry-mm-instrument-commission-rate": "CThostFtdcMMInstrumentCommissionRateField";
+  "rsp-qry-mm-option-instr-comm-rate": "CThostFtdcMMOptionInstrCommRateField";
+  "rsp-qry-instrument-order-comm-rate": "CThostFtdcInstrumentOrderCommRateField";
+  "rsp-qry-sec-agent-trading-account": "CThostFtdcTradingAccountField";
+  "rsp-qry-sec-agent-check-mode": "CThostFtdcSecAgentCheckModeField";
+  "rsp-qry-sec-agent-trade-info": "CThostFtdcSecAgentTradeInfoField";
+  "rsp-qry-option-instr-trade-cost": "CThostFtdcOptionInstrTradeCostField";
+  "rsp-qry-option-instr-comm-rate": "CThostFtdcOptionInstrCommRateField";
+  "rsp-qry-exec-order": "CThostFtdcExecOrderField";
+  "rsp-qry-for-quote": "CThostFtdcForQuoteField";
+  "rsp-qry-quote": "CThostFtdcQuoteField";
+  "rsp-qry-option-self-close": "CThostFtdcOptionSelfCloseField";
+  "rsp-qry-invest-unit": "CThostFtdcInvestUnitField";
+  "rsp-qry-comb-instrument-guard": "CThostFtdcCombInstrumentGuardField";
+  "rsp-qry-comb-action": "CThostFtdcCombActionField";
+  "rsp-qry-transfer-serial": "CThostFtdcTransferSerialField";
+  "rsp-qry-account-register": "CThostFtdcAccountregisterField";
+  "rsp-error": "CThostFtdcRspInfoField";
+  "rtn-order": "CThostFtdcOrderField";
+  "rtn-trade": "CThostFtdcTradeField";
+  "err-rtn-order-insert": "CThostFtdcInputOrderField";
+  "err-rtn-order-action": "CThostFtdcOrderActionField";
+  "rtn-instrument-status": "CThostFtdcInstrumentStatusField";
+  "rtn-bulletin": "CThostFtdcBulletinField";
+  "rtn-trading-notice": "CThostFtdcTradingNoticeInfoField";
+  "rtn-error-conditional-order": "CThostFtdcErrorConditionalOrderField";
+  "rtn-exec-order": "CThostFtdcExecOrderField";
+  "err-rtn-exec-order-insert": "CThostFtdcInputExecOrderField";
+  "err-rtn-exec-order-action": "CThostFtdcExecOrderActionField";
+  "err-rtn-for-quote-insert": "CThostFtdcInputForQuoteField";
+  "rtn-quote": "CThostFtdcQuoteField";
+  "err-rtn-quote-insert": "CThostFtdcInputQuoteField";
+  "err-rtn-quote-action": "CThostFtdcQuoteActionField";
+  "rtn-for-quote": "CThostFtdcForQuoteRspField";
+  "rtn-cfmmc-trading-account-token": "CThostFtdcCFMMCTradingAccountTokenField";
+  "err-rtn-batch-order-action": "CThostFtdcBatchOrderActionField";
+  "rtn-option-self-close": "CThostFtdcOptionSelfCloseField";
+  "err-rtn-option-self-close-insert": "CThostFtdcInputOptionSelfCloseField";
+  "err-rtn-option-self-close-action": "CThostFtdcOptionSelfCloseActionField";
+  "rtn-comb-action": "CThostFtdcCombActionField";
+  "err-rtn-comb-action-insert": "CThostFtdcInputCombActionField";
+  "rsp-qry-contract-bank": "CThostFtdcContractBankField";
+  "rsp-qry-parked-order": "CThostFtdcParkedOrderField";
+  "rsp-qry-parked-order-action": "CThostFtdcParkedOrderActionField";
+  "rsp-qry-trading-notice": "CThostFtdcTradingNoticeField";
+  "rsp-qry-broker-trading-params": "CThostFtdcBrokerTradingParamsField";
+  "rsp-qry-broker-trading-algos": "CThostFtdcBrokerTradingAlgosField";
+  "rsp-query-cfmmc-trading-account-token": "CThostFtdcQueryCFMMCTradingAccountTokenField";
+  "rtn-from-bank-to-future-by-bank": "CThostFtdcRspTransferField";
+  "rtn-from-future-to-bank-by-bank": "CThostFtdcRspTransferField";
+  "rtn-repeal-from-bank-to-future-by-bank": "CThostFtdcRspRepealField";
+  "rtn-repeal-from-future-to-bank-by-bank": "CThostFtdcRspRepealField";
+  "rtn-from-bank-to-future-by-future": "CThostFtdcRspTransferField";
+  "rtn-from-future-to-bank-by-future": "CThostFtdcRspTransferField";
+  "rtn-repeal-from-bank-to-future-by-future-manual": "CThostFtdcRspRepealField";
+  "rtn-repeal-from-future-to-bank-by-future-manual": "CThostFtdcRspRepealField";
+  "rtn-query-bank-balance-by-future": "CThostFtdcNotifyQueryAccountField";
+  "err-rtn-bank-to-future-by-future": "CThostFtdcReqTransferField";
+  "err-rtn-future-to-bank-by-future": "CThostFtdcReqTransferField";
+  "err-rtn-repeal-bank-to-future-by-future-manual": "CThostFtdcReqRepealField";
+  "err-rtn-repeal-future-to-bank-by-future-manual": "CThostFtdcReqRepealField";
+  "err-rtn-query-bank-balance-by-future": "CThostFtdcReqQueryAccountField";
+  "rtn-repeal-from-bank-to-future-by-future": "CThostFtdcRspRepealField";
+  "rtn-repeal-from-future-to-bank-by-future": "CThostFtdcRspRepealField";
+  "rsp-from-bank-to-future-by-future": "CThostFtdcReqTransferField";
+  "rsp-from-future-to-bank-by-future": "CThostFtdcReqTransferField";
+  "rsp-query-bank-account-money-by-future": "CThostFtdcReqQueryAccountField";
+  "rtn-open-account-by-bank": "CThostFtdcOpenAccountField";
+  "rtn-cancel-account-by-bank": "CThostFtdcCancelAccountField";
+  "rtn-change-account-by-bank": "CThostFtdcChangeAccountField";
+  "rsp-qry-classified-instrument": "CThostFtdcInstrumentField";
+  "rsp-qry-comb-promotion-param": "CThostFtdcCombPromotionParamField";
+  "rsp-qry-risk-settle-invst-position": "CThostFtdcRiskSettleInvstPositionField";
+  "rsp-qry-risk-settle-product-status": "CThostFtdcRiskSettleProductStatusField";
+}
+
+export declare const structs: StructLayouts;
+
+export declare const events: {
+  marketData: MarketDataEventStructs;
+  trader: TraderEventStructs;
+};
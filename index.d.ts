@@ -9,6 +9,8 @@
  * https://github.com/shixiongfei/napi-ctp
  */
 
+import { StructLayouts, MarketDataEventStructs, TraderEventStructs } from "./ctpstructs";
+
 /** 行情消息事件 */
 export enum MarketDataEvent {
   Quit = "quit",
@@ -25,6 +27,7 @@ export enum MarketDataEvent {
   RspUnSubForQuote = "rsp-unsub-for-quote",
   RtnDepthMarketData = "rtn-depth-market-data",
   RtnForQuote = "rtn-for-quote",
+  Bar = "bar",
 }
 
 /** 交易消息事件 */
@@ -3945,8 +3948,374 @@ export enum EnumBoolType {
   True = "1",
 }
 
-/** 消息事件回调接口 */
-export type CallbackFunction = (message?: number | object) => void;
+/**
+ * 消息事件回调接口, 交易对象的响应消息附带请求编号及是否为最后一条,
+ * 通知类消息的请求编号为 0
+ */
+export type CallbackFunction = (message?: number | object, requestId?: number, isLast?: boolean) => void;
+
+/** 批量消息事件回调接口 */
+export type BatchCallbackFunction = (messages: (number | object | undefined)[]) => void;
+
+/** 汇总查询失败的错误 */
+export interface QueryError extends Error {
+  /** 请求编号 */
+  requestId: number;
+  /** 请求未能发出时为请求的返回值, CTP 返回错误时为其错误代码, 超时时没有 */
+  ErrorID?: number;
+}
+
+/** 消息回调选项 */
+export interface ListenerOptions {
+  /** 批量模式下一次回调最多投递的消息数量, 0 为逐条投递 */
+  batchSize?: number;
+  /** 批量模式下等待凑批的时间窗口(微秒), 0 为只取队列中已有的消息 */
+  batchWindow?: number;
+  /** 已投递但尚未被JS处理的消息(批量模式下为批次)数量上限, 超出时派发线程等待, 默认 4096 */
+  maxInflight?: number;
+  /** 列式投递, 仅支持 rtn-depth-market-data, 未指定 batchSize 时默认为 256 */
+  columnar?: boolean;
+  /** 按合约合并未投递的行情, 只投递每个合约最新的一笔, 仅支持 rtn-depth-market-data, 不能与 columnar 同时使用 */
+  conflate?: boolean;
+  /**
+   * 惰性对象投递, 消息为按结构体生成的类的实例, 字段在首次读取时才解码,
+   * 结构体副本随对象被GC回收; 字段为原型上的只读属性, 不出现在 Object.keys 中,
+   * 需要完整的普通对象时调用 toJSON(). 不能与 columnar 同时使用
+   */
+  lazy?: boolean;
+  /**
+   * 原始投递, 结构体消息为 CTP 结构体副本的 Uint8Array, 不做任何转换;
+   * 每条消息的副本独占一块 ArrayBuffer, byteOffset 为 0.
+   * 布局见 structs 和 events, 用 decodeRaw 或 readRawField 读取.
+   * 不能与 lazy 及 columnar 同时使用
+   */
+  raw?: boolean;
+  /**
+   * 复用对象投递, 仅支持 rtn-depth-market-data、rtn-order 和 rtn-trade.
+   * 每个合约只创建一个对象, 之后的消息就地更新该对象的字段再回调, 不再产生新对象.
+   * 注意: 回调返回后对象随时会被下一条同合约消息覆盖, 需要保留的数据
+   * (包括对象本身)必须在回调中复制, 例如 { ...message }.
+   * 不能与 lazy、raw 及 columnar 同时使用; 除 conflate 外不能与 batchSize 同时使用
+   */
+  reuse?: boolean;
+}
+
+/** 行情合并统计 */
+export interface ConflationStats {
+  /** 收到的行情数量 */
+  received: number;
+  /** 投递给JS的行情数量 */
+  delivered: number;
+  /** 被更新行情覆盖而丢弃的数量 */
+  conflated: number;
+  /** 等待投递的合约数量 */
+  pending: number;
+}
+
+/** 列式深度行情批次, 每列长度均为 count */
+export interface DepthMarketDataColumns {
+  /** 本批次行情条数 */
+  count: number;
+  /** 合约代码表, instrument 列中的值为其下标, 同一回调的下标保持不变 */
+  instruments: string[];
+  /** 合约下标 */
+  instrument: Int32Array;
+  /** 业务日期(yyyymmdd) */
+  ActionDay: Int32Array;
+  /** 最后修改时间, 当日零点起的毫秒数, 无效时为 -1 */
+  UpdateTime: Int32Array;
+  Volume: Int32Array;
+  BidVolume1: Int32Array;
+  AskVolume1: Int32Array;
+  BidVolume2: Int32Array;
+  AskVolume2: Int32Array;
+  BidVolume3: Int32Array;
+  AskVolume3: Int32Array;
+  BidVolume4: Int32Array;
+  AskVolume4: Int32Array;
+  BidVolume5: Int32Array;
+  AskVolume5: Int32Array;
+  LastPrice: Float64Array;
+  PreSettlementPrice: Float64Array;
+  PreClosePrice: Float64Array;
+  PreOpenInterest: Float64Array;
+  OpenPrice: Float64Array;
+  HighestPrice: Float64Array;
+  LowestPrice: Float64Array;
+  Turnover: Float64Array;
+  OpenInterest: Float64Array;
+  ClosePrice: Float64Array;
+  SettlementPrice: Float64Array;
+  UpperLimitPrice: Float64Array;
+  LowerLimitPrice: Float64Array;
+  PreDelta: Float64Array;
+  CurrDelta: Float64Array;
+  BidPrice1: Float64Array;
+  AskPrice1: Float64Array;
+  BidPrice2: Float64Array;
+  AskPrice2: Float64Array;
+  BidPrice3: Float64Array;
+  AskPrice3: Float64Array;
+  BidPrice4: Float64Array;
+  AskPrice4: Float64Array;
+  BidPrice5: Float64Array;
+  AskPrice5: Float64Array;
+  AveragePrice: Float64Array;
+  BandingUpperPrice: Float64Array;
+  BandingLowerPrice: Float64Array;
+}
+
+/** 列式深度行情回调接口 */
+export type DepthColumnsCallbackFunction = (columns: DepthMarketDataColumns) => void;
+
+/**
+ * 消息队列满时的处理策略
+ * - block: 阻塞CTP回调线程直到队列有空位(默认)
+ * - drop-oldest: 丢弃队首最早的可丢弃消息
+ * - drop-newest: 丢弃新到的消息
+ */
+export type OverflowPolicy = "block" | "drop-oldest" | "drop-newest";
+
+/** 行情对象选项 */
+export interface MarketDataOptions {
+  /** 消息队列容量(向上取整为2的幂), 1 到 4194304, 默认 65536 */
+  queueCapacity?: number;
+  /** 按事件设置队列满时的处理策略, 连接类事件只能为 block */
+  overflow?: { [event in MarketDataEvent]?: OverflowPolicy };
+  /**
+   * 行情记录目录(须已存在), 设置后每笔深度行情连同本地接收时间原样写入内存映射文件,
+   * 按交易日滚动, 文件名为 <TradingDay>.<n>.ticks. 下一个文件由后台线程提前打开,
+   * 因此磁盘上会多预留一个文件的空间, 关闭时未用到的文件会被删除
+   */
+  journal?: string;
+  /** 单个行情记录文件预分配的大小(MB), 写满后滚动到下一个文件, 默认 256 */
+  journalFileSize?: number;
+  /**
+   * 最新行情快照缓存可容纳的合约数量(最大 1048576), 默认 0 不开启.
+   * 开启后可用 getSnapshot/getSnapshots 同步读取各合约的最新行情, 无需注册行情回调
+   */
+  snapshotCapacity?: number;
+  /**
+   * K线周期(秒, 须能整除 3600, 最多 8 个), 设置后按合约合成K线, 每根K线结束时触发 bar 事件.
+   * 成交量和成交额取累计值的增量, 夜盘跨零点及交易日切换均按交易日内的时间顺序处理
+   */
+  barIntervals?: number[];
+}
+
+/** 行情回放对象选项 */
+export interface MarketDataReplayOptions extends MarketDataOptions {
+  /**
+   * 回放速度, 1 按记录时的接收间隔回放, N 为 N 倍速, 0 为不等待尽快回放, 默认 0.
+   * 回放的内容与速度无关
+   */
+  speed?: number;
+}
+
+/** 交易对象选项 */
+export interface TraderOptions {
+  /** 消息队列容量(向上取整为2的幂), 1 到 4194304, 默认 65536 */
+  queueCapacity?: number;
+  /** 按事件设置队列满时的处理策略, 连接类及报单、成交类事件只能为 block */
+  overflow?: { [event in TraderEvent]?: OverflowPolicy };
+  /** query 系列查询每秒最多发出的数量, 默认 1, 0 为不限; 被 CTP 流控拒绝时自动退避重发 */
+  queryRate?: number;
+}
+
+/** 查询优先级, 默认报单、成交、持仓及资金类为 high, 合约、费率等基础数据为 low, 其余为 normal */
+export type QueryPriority = "high" | "normal" | "low";
+
+/** 汇总查询选项 */
+export interface QueryOptions {
+  /** 超时时间(毫秒), 自调用时起算, 默认 30000, 0 为不超时 */
+  timeout?: number;
+  /** 优先级, 排队时高优先级先发 */
+  priority?: QueryPriority;
+}
+
+/** 查询调度统计 */
+export interface QueryStats {
+  /** 排队等待发出的查询数量 */
+  queued: number;
+  /** 已发出等待结果的查询数量 */
+  pending: number;
+  /** 累计发出次数 */
+  sent: number;
+  /** 因流控被拒绝而重发的次数 */
+  retries: number;
+  /** 请求失败的数量 */
+  failed: number;
+  /** 超时的数量 */
+  timeouts: number;
+}
+
+/** 合约表加载选项 */
+export interface LoadInstrumentsOptions extends QueryOptions {
+  /** 经纪公司代码, 默认为登录时的 BrokerID */
+  BrokerID?: string;
+  /** 缓存文件路径前缀, 与 flowPath 用法相同, 默认为 flowPath */
+  cachePath?: string;
+  /** 忽略缓存, 重新查询并覆盖缓存 */
+  refresh?: boolean;
+}
+
+/** 合约表筛选条件, 都缺省时为全部合约 */
+export interface InstrumentFilter {
+  /** 产品代码 */
+  ProductID?: string;
+  /** 交易所代码 */
+  ExchangeID?: string;
+}
+
+/** 合约表信息 */
+export interface InstrumentCatalogInfo {
+  /** 交易日 */
+  tradingDay: string;
+  /** 经纪公司代码 */
+  brokerId: string;
+  /** 合约数量 */
+  count: number;
+  /** 是否从缓存文件加载 */
+  cached: boolean;
+}
+
+/** 合约表, 合约保存在原生内存中, 按需转换为对象 */
+export interface InstrumentCatalog {
+  /**
+   * 按合约代码查找合约
+   * @param instrumentId 合约代码
+   * @returns 合约, 不存在时为 undefined
+   */
+  getInstrument(instrumentId: string): object | undefined;
+
+  /**
+   * 获取合约列表
+   * @param filter 筛选条件
+   * @returns 合约列表
+   */
+  getInstruments(filter?: InstrumentFilter): object[];
+
+  /**
+   * 获取合约代码列表, 不创建合约对象
+   * @param filter 筛选条件
+   * @returns 合约代码列表
+   */
+  getInstrumentIds(filter?: InstrumentFilter): string[];
+
+  /**
+   * 获取合约表信息
+   * @returns 合约表信息
+   */
+  getCatalogInfo(): InstrumentCatalogInfo;
+}
+
+/**
+ * 预编译请求, 模板在 prepare 时一次性转换为原生结构
+ * req 系列方法的 send 返回值与原方法相同, query 系列方法的 send 返回查询结果
+ */
+export interface PreparedRequest {
+  /**
+   * 发送请求
+   * @param args 按 prepare 时声明的顺序传入可变字段的值, 其后可选传入请求编号(req 系列, 1 到 1073741823)或查询选项(query 系列)
+   */
+  send(...args: Array<string | number | QueryOptions | undefined>): number | Promise<object[]>;
+}
+
+/** 延迟分布(纳秒) */
+export interface LatencyHistogram {
+  /** 样本数量 */
+  count: number;
+  /** 最小值 */
+  min: number;
+  /** 平均值 */
+  mean: number;
+  /** 50分位 */
+  p50: number;
+  /** 90分位 */
+  p90: number;
+  /** 99分位 */
+  p99: number;
+  /** 99.9分位 */
+  p999: number;
+  /** 最大值 */
+  max: number;
+}
+
+/** 单个事件各阶段的延迟分布 */
+export interface EventLatency {
+  /** CTP回调到派发线程交给JS线程 */
+  queue: LatencyHistogram;
+  /** 交给JS线程到JS线程开始处理(每次投递) */
+  transfer: LatencyHistogram;
+  /** 生成JS对象(每次投递) */
+  convert: LatencyHistogram;
+  /** JS回调函数执行(每次投递) */
+  callback: LatencyHistogram;
+  /** CTP回调到JS回调函数返回 */
+  total: LatencyHistogram;
+}
+
+/** 按事件名称索引的延迟统计 */
+export type LatencyStats = { [event: string]: EventLatency };
+
+/** 消息队列统计 */
+export interface QueueStats {
+  /** 队列容量 */
+  capacity: number;
+  /** 当前队列深度 */
+  depth: number;
+  /** 队列深度的历史最高值(采样) */
+  highWater: number;
+  /** 累计入队数量 */
+  enqueued: number;
+  /** 累计出队数量 */
+  dequeued: number;
+  /** 队列满时累计丢弃的数量 */
+  dropped: number;
+}
+
+/** 行情记录统计 */
+export interface JournalStats {
+  /** 已写入的行情数量 */
+  records: number;
+  /** 因文件无法打开, 或等待文件打开时积压过多而未写入的行情数量 */
+  failed: number;
+  /** 已写入过的文件数量 */
+  files: number;
+}
+
+/** 行情快照统计 */
+export interface SnapshotStats {
+  /** 已缓存的合约数量 */
+  instruments: number;
+  /** 可缓存的合约数量 */
+  capacity: number;
+  /** 累计更新次数 */
+  updates: number;
+  /** 因缓存已满而未缓存的行情数量 */
+  rejected: number;
+}
+
+/** 行情回放统计 */
+export interface ReplayStats {
+  /** 回放文件中的行情总数 */
+  total: number;
+  /** 已回放(已订阅合约)的行情数量 */
+  played: number;
+  /** 虚拟时钟, 最近回放的行情记录时的接收时间(Unix纪元起的纳秒) */
+  clock: number;
+  /** 是否已回放完毕 */
+  finished: boolean;
+}
+
+/** 消息内存池统计 */
+export interface PoolStats {
+  /** 累计分配次数 */
+  allocations: number;
+  /** 累计向系统申请内存的次数, 稳定运行后不再增长 */
+  mallocs: number;
+  /** 活动中的线程内存池数量 */
+  pools: number;
+}
 
 /** 行情对象 */
 export declare class MarketData {
@@ -3954,8 +4323,9 @@ export declare class MarketData {
    *
    * @param flowMdPath 存贮订阅信息文件的目录
    * @param frontMdAddr 前置机网络地址
+   * @param options 行情对象选项
    */
-  constructor(flowMdPath: string, frontMdAddr: string);
+  constructor(flowMdPath: string, frontMdAddr: string, options?: MarketDataOptions);
 
   /**
    * 获取API的版本信息
@@ -3963,6 +4333,55 @@ export declare class MarketData {
    */
   getApiVersion(): string;
 
+  /**
+   * 获取消息队列统计
+   * @returns 队列统计
+   */
+  getQueueStats(): QueueStats;
+
+  /**
+   * 获取各事件从CTP回调到JS回调返回的延迟统计
+   * @param reset 读取后清零
+   * @returns 延迟统计, 仅包含已投递过的事件
+   */
+  getLatencyStats(reset?: boolean): LatencyStats;
+
+  /**
+   * 获取行情记录统计, 未开启记录时各项为 0
+   * @returns 记录统计
+   */
+  getJournalStats(): JournalStats;
+
+  /**
+   * 获取行情快照统计, 未开启快照时各项为 0
+   * @returns 快照统计
+   */
+  getSnapshotStats(): SnapshotStats;
+
+  /**
+   * 同步读取合约的最新行情快照, 须设置 snapshotCapacity 选项
+   * @param instrumentId 合约ID
+   * @param fields 只读取的字段名称, 不传时读取全部字段
+   * @returns 与 rtn-depth-market-data 相同的行情对象, 尚无行情时为 undefined
+   */
+  getSnapshot(instrumentId: string, fields?: string[]): object | undefined;
+
+  /**
+   * 同步读取多个合约的最新行情快照, 须设置 snapshotCapacity 选项
+   * @param instrumentIds 合约ID列表
+   * @param fields 只读取的字段名称, 不传时读取全部字段
+   * @returns 与合约ID列表一一对应的行情对象, 尚无行情的合约为 undefined
+   */
+  getSnapshots(instrumentIds: string[], fields?: string[]): (object | undefined)[];
+
+  /**
+   * 读取合约尚未结束的K线, 须设置 barIntervals 选项
+   * @param instrumentId 合约ID
+   * @param interval K线周期(秒)
+   * @returns 与 bar 事件相同的K线对象, 没有时为 undefined
+   */
+  getBar(instrumentId: string, interval: number): object | undefined;
+
   /**
    * 订阅行情
    * @param instrumentIds 合约ID列表
@@ -3999,12 +4418,34 @@ export declare class MarketData {
    */
   reqUserLogout(req: object): number;
 
+  /**
+   * 获取深度行情合并统计, 未开启合并时各项为 0
+   * @returns 合并统计
+   */
+  getConflationStats(): ConflationStats;
+
   /**
    * 注册行情消息回调函数
    * @param event 行情消息事件
    * @param func 回调函数
    */
   on(event: MarketDataEvent, func: CallbackFunction): MarketData;
+
+  /**
+   * 注册列式深度行情回调函数
+   * @param event 深度行情事件
+   * @param func 列式回调函数
+   * @param options 回调选项, columnar 须为 true
+   */
+  on(event: MarketDataEvent.RtnDepthMarketData, func: DepthColumnsCallbackFunction, options: ListenerOptions & { columnar: true }): MarketData;
+
+  /**
+   * 注册批量行情消息回调函数
+   * @param event 行情消息事件
+   * @param func 批量回调函数
+   * @param options 回调选项
+   */
+  on(event: MarketDataEvent, func: BatchCallbackFunction, options: ListenerOptions): MarketData;
 }
 
 /** 交易对象 */
@@ -4013,8 +4454,9 @@ export declare class Trader {
    *
    * @param flowPath 存贮订阅信息文件的目录
    * @param frontAddr 前置机网络地址
+   * @param options 交易对象选项
    */
-  constructor(flowPath: string, frontAddr: string);
+  constructor(flowPath: string, frontAddr: string, options?: TraderOptions);
 
   /**
    * 获取API的版本信息
@@ -4022,527 +4464,1098 @@ export declare class Trader {
    */
   getApiVersion(): string;
 
+  /**
+   * 获取消息队列统计
+   * @returns 队列统计
+   */
+  getQueueStats(): QueueStats;
+
+  /**
+   * 获取各事件从CTP回调到JS回调返回的延迟统计
+   * @param reset 读取后清零
+   * @returns 延迟统计, 仅包含已投递过的事件
+   */
+  getLatencyStats(reset?: boolean): LatencyStats;
+
+  /**
+   * 获取查询调度统计
+   * @returns 查询调度统计
+   */
+  getQueryStats(): QueryStats;
+
+  /**
+   * 加载当日合约表, 登录后调用
+   * 存在同一交易日及经纪公司的缓存文件时直接加载, 否则查询全部合约并写入缓存
+   * @param options 加载选项, 查询默认为 low 优先级
+   * @returns 合约表
+   */
+  loadInstruments(options?: LoadInstrumentsOptions): Promise<InstrumentCatalog>;
+
+  /**
+   * 预编译请求, 之后每次发送只需传入可变字段
+   * @param method 请求方法名, 如 reqOrderInsert、queryInvestorPosition, 按名称直接对应原生方法, 不调用对象上改写的同名方法
+   * @param template 请求模板, 包含不变的字段
+   * @param fields 可变字段名列表, 最多 16 个
+   * @returns 预编译请求
+   */
+  prepare(method: string, template: object, fields?: string[]): PreparedRequest;
+
   /**
    * 客户端认证请求
    * @param req 客户端认证信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqAuthenticate(req: object): number;
+  reqAuthenticate(req: object, requestId?: number): number;
 
   /**
    * 用户登录请求
    * @param req 用户登陆信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserLogin(req: object): number;
+  reqUserLogin(req: object, requestId?: number): number;
 
   /**
    * 用户登出请求
    * @param req 用户登出信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserLogout(req: object): number;
+  reqUserLogout(req: object, requestId?: number): number;
 
   /**
    * 用户口令更新请求
    * @param req 用户口令信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserPasswordUpdate(req: object): number;
+  reqUserPasswordUpdate(req: object, requestId?: number): number;
 
   /**
    * 资金账户口令更新请求
    * @param req 用户口令信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqTradingAccountPasswordUpdate(req: object): number;
+  reqTradingAccountPasswordUpdate(req: object, requestId?: number): number;
 
   /**
    * 查询用户当前支持的认证模式
    * @param req 用户信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserAuthMethod(req: object): number;
+  reqUserAuthMethod(req: object, requestId?: number): number;
 
   /**
    * 用户发出获取图形验证码请求
    * @param req 用户信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqGenUserCaptcha(req: object): number;
+  reqGenUserCaptcha(req: object, requestId?: number): number;
 
   /**
    * 用户发出获取短信验证码请求
    * @param req 用户信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqGenUserText(req: object): number;
+  reqGenUserText(req: object, requestId?: number): number;
 
   /**
    * 用户发出带有图片验证码的登陆请求
    * @param req 用户登陆信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserLoginWithCaptcha(req: object): number;
+  reqUserLoginWithCaptcha(req: object, requestId?: number): number;
 
   /**
    * 用户发出带有短信验证码的登陆请求
    * @param req 用户登陆信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserLoginWithText(req: object): number;
+  reqUserLoginWithText(req: object, requestId?: number): number;
 
   /**
    * 用户发出带有动态口令的登陆请求
    * @param req 用户登陆信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqUserLoginWithOTP(req: object): number;
+  reqUserLoginWithOTP(req: object, requestId?: number): number;
 
   /**
    * 报单录入请求
    * @param req 报单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqOrderInsert(req: object): number;
+  reqOrderInsert(req: object, requestId?: number): number;
 
   /**
    * 预埋单录入请求
    * @param req 预埋单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqParkedOrderInsert(req: object): number;
+  reqParkedOrderInsert(req: object, requestId?: number): number;
 
   /**
    * 预埋撤单录入请求
    * @param req 预埋单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqParkedOrderAction(req: object): number;
+  reqParkedOrderAction(req: object, requestId?: number): number;
 
   /**
    * 报单操作请求
    * @param req 报单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqOrderAction(req: object): number;
+  reqOrderAction(req: object, requestId?: number): number;
 
   /**
    * 查询最大报单数量请求
    * @param req 查询最大报单数量
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryMaxOrderVolume(req: object, requestId?: number): number;
+
+  /**
+   * 查询最大报单数量请求, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询最大报单数量
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryMaxOrderVolume(req: object): number;
+  queryMaxOrderVolume(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 投资者结算结果确认
    * @param req 投资者结算结果确认信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqSettlementInfoConfirm(req: object): number;
+  reqSettlementInfoConfirm(req: object, requestId?: number): number;
 
   /**
    * 请求删除预埋单
    * @param req 预埋单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqRemoveParkedOrder(req: object): number;
+  reqRemoveParkedOrder(req: object, requestId?: number): number;
 
   /**
    * 请求删除预埋撤单
    * @param req 预埋单信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqRemoveParkedOrderAction(req: object): number;
+  reqRemoveParkedOrderAction(req: object, requestId?: number): number;
 
   /**
    * 执行宣告录入请求
    * @param req 宣告信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqExecOrderInsert(req: object): number;
+  reqExecOrderInsert(req: object, requestId?: number): number;
 
   /**
    * 执行宣告操作请求
    * @param req 宣告信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqExecOrderAction(req: object): number;
+  reqExecOrderAction(req: object, requestId?: number): number;
 
   /**
    * 询价录入请求
    * @param req 询价信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqForQuoteInsert(req: object): number;
+  reqForQuoteInsert(req: object, requestId?: number): number;
 
   /**
    * 报价录入请求
    * @param req 报价信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQuoteInsert(req: object): number;
+  reqQuoteInsert(req: object, requestId?: number): number;
 
   /**
    * 报价操作请求
    * @param req 报价信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQuoteAction(req: object): number;
+  reqQuoteAction(req: object, requestId?: number): number;
 
   /**
    * 批量报单操作请求
    * @param req 报单请求
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqBatchOrderAction(req: object): number;
+  reqBatchOrderAction(req: object, requestId?: number): number;
 
   /**
    * 期权自对冲录入请求
    * @param req 期权自对冲信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqOptionSelfCloseInsert(req: object): number;
+  reqOptionSelfCloseInsert(req: object, requestId?: number): number;
 
   /**
    * 期权自对冲操作请求
    * @param req 期权自对冲信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqOptionSelfCloseAction(req: object): number;
+  reqOptionSelfCloseAction(req: object, requestId?: number): number;
 
   /**
    * 申请组合录入请求
    * @param req 组合信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqCombActionInsert(req: object): number;
+  reqCombActionInsert(req: object, requestId?: number): number;
 
   /**
    * 请求查询报单
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryOrder(req: object): number;
+  reqQryOrder(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询报单, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryOrder(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询成交
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryTrade(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询成交, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryTrade(req: object): number;
+  queryTrade(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者持仓
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryInvestorPosition(req: object): number;
+  reqQryInvestorPosition(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者持仓, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryInvestorPosition(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询资金账户
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryTradingAccount(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询资金账户, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryTradingAccount(req: object): number;
+  queryTradingAccount(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryInvestor(req: object): number;
+  reqQryInvestor(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryInvestor(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易编码
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryTradingCode(req: object): number;
+  reqQryTradingCode(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易编码, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryTradingCode(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询合约保证金率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryInstrumentMarginRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询合约保证金率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryInstrumentMarginRate(req: object): number;
+  queryInstrumentMarginRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询合约手续费率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryInstrumentCommissionRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询合约手续费率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryInstrumentCommissionRate(req: object): number;
+  queryInstrumentCommissionRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易所
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryExchange(req: object): number;
+  reqQryExchange(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易所, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryExchange(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询产品
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryProduct(req: object): number;
+  reqQryProduct(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询产品, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryProduct(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询合约
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryInstrument(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询合约, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryInstrument(req: object): number;
+  queryInstrument(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询行情
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryDepthMarketData(req: object): number;
+  reqQryDepthMarketData(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询行情, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryDepthMarketData(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易员报盘机
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryTraderOffer(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易员报盘机, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryTraderOffer(req: object): number;
+  queryTraderOffer(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者结算结果
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQrySettlementInfo(req: object): number;
+  reqQrySettlementInfo(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者结算结果, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  querySettlementInfo(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询转帐银行
    * @param req 转账信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryTransferBank(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询转帐银行, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 转账信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryTransferBank(req: object): number;
+  queryTransferBank(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者持仓明细
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryInvestorPositionDetail(req: object): number;
+  reqQryInvestorPositionDetail(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者持仓明细, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryInvestorPositionDetail(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询客户通知
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryNotice(req: object): number;
+  reqQryNotice(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询客户通知, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryNotice(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询结算信息确认
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQrySettlementInfoConfirm(req: object): number;
+  reqQrySettlementInfoConfirm(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询结算信息确认, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  querySettlementInfoConfirm(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者持仓明细
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryInvestorPositionCombineDetail(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者持仓明细, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryInvestorPositionCombineDetail(req: object): number;
+  queryInvestorPositionCombineDetail(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询保证金监管系统经纪公司资金账户密钥
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryCFMMCTradingAccountKey(req: object): number;
+  reqQryCFMMCTradingAccountKey(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询保证金监管系统经纪公司资金账户密钥, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryCFMMCTradingAccountKey(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询仓单折抵信息
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryEWarrantOffset(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询仓单折抵信息, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryEWarrantOffset(req: object): number;
+  queryEWarrantOffset(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资者品种/跨品种保证金
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryInvestorProductGroupMargin(req: object): number;
+  reqQryInvestorProductGroupMargin(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资者品种/跨品种保证金, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryInvestorProductGroupMargin(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易所保证金率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryExchangeMarginRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易所保证金率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryExchangeMarginRate(req: object): number;
+  queryExchangeMarginRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易所调整保证金率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryExchangeMarginRateAdjust(req: object): number;
+  reqQryExchangeMarginRateAdjust(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易所调整保证金率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryExchangeMarginRateAdjust(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询汇率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryExchangeRate(req: object): number;
+  reqQryExchangeRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询汇率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryExchangeRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询二级代理操作员银期权限
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQrySecAgentACIDMap(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询二级代理操作员银期权限, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQrySecAgentACIDMap(req: object): number;
+  querySecAgentACIDMap(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询产品报价汇率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryProductExchRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询产品报价汇率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryProductExchRate(req: object): number;
+  queryProductExchRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询产品组
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryProductGroup(req: object): number;
+  reqQryProductGroup(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询产品组, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryProductGroup(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询做市商合约手续费率
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryMMInstrumentCommissionRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询做市商合约手续费率, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryMMInstrumentCommissionRate(req: object): number;
+  queryMMInstrumentCommissionRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询做市商期权合约手续费
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryMMOptionInstrCommRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询做市商期权合约手续费, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryMMOptionInstrCommRate(req: object): number;
+  queryMMOptionInstrCommRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询报单手续费
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryInstrumentOrderCommRate(req: object): number;
+  reqQryInstrumentOrderCommRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询报单手续费, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryInstrumentOrderCommRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询资金账户
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQrySecAgentTradingAccount(req: object): number;
+  reqQrySecAgentTradingAccount(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询资金账户, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  querySecAgentTradingAccount(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询二级代理商资金校验模式
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQrySecAgentCheckMode(req: object): number;
+  reqQrySecAgentCheckMode(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询二级代理商资金校验模式, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  querySecAgentCheckMode(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询二级代理商信息
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQrySecAgentTradeInfo(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询二级代理商信息, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQrySecAgentTradeInfo(req: object): number;
+  querySecAgentTradeInfo(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询期权交易成本
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryOptionInstrTradeCost(req: object): number;
+  reqQryOptionInstrTradeCost(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询期权交易成本, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryOptionInstrTradeCost(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询期权合约手续费
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryOptionInstrCommRate(req: object): number;
+  reqQryOptionInstrCommRate(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询期权合约手续费, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryOptionInstrCommRate(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询执行宣告
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryExecOrder(req: object): number;
+  reqQryExecOrder(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询执行宣告, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryExecOrder(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询询价
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryForQuote(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询询价, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryForQuote(req: object): number;
+  queryForQuote(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询报价
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryQuote(req: object): number;
+  reqQryQuote(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询报价, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryQuote(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询期权自对冲
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryOptionSelfClose(req: object): number;
+  reqQryOptionSelfClose(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询期权自对冲, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryOptionSelfClose(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询投资单元
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryInvestUnit(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询投资单元, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryInvestUnit(req: object): number;
+  queryInvestUnit(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询组合合约安全系数
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryCombInstrumentGuard(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询组合合约安全系数, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryCombInstrumentGuard(req: object): number;
+  queryCombInstrumentGuard(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询申请组合
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryCombAction(req: object): number;
+  reqQryCombAction(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询申请组合, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryCombAction(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询转帐流水
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryTransferSerial(req: object): number;
+  reqQryTransferSerial(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询转帐流水, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryTransferSerial(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询银期签约关系
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryAccountregister(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询银期签约关系, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryAccountregister(req: object): number;
+  queryAccountregister(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询签约银行
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryContractBank(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询签约银行, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryContractBank(req: object): number;
+  queryContractBank(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询预埋单
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryParkedOrder(req: object): number;
+  reqQryParkedOrder(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询预埋单, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryParkedOrder(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询预埋撤单
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryParkedOrderAction(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询预埋撤单, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryParkedOrderAction(req: object): number;
+  queryParkedOrderAction(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询交易通知
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryTradingNotice(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询交易通知, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryTradingNotice(req: object): number;
+  queryTradingNotice(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询经纪公司交易参数
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryBrokerTradingParams(req: object): number;
+  reqQryBrokerTradingParams(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询经纪公司交易参数, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryBrokerTradingParams(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询经纪公司交易算法
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryBrokerTradingAlgos(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询经纪公司交易算法, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryBrokerTradingAlgos(req: object): number;
+  queryBrokerTradingAlgos(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求查询监控中心用户令牌
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQueryCFMMCTradingAccountToken(req: object): number;
+  reqQueryCFMMCTradingAccountToken(req: object, requestId?: number): number;
 
   /**
    * 期货发起银行资金转期货请求
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqFromBankToFutureByFuture(req: object): number;
+  reqFromBankToFutureByFuture(req: object, requestId?: number): number;
 
   /**
    * 期货发起期货资金转银行请求
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqFromFutureToBankByFuture(req: object): number;
+  reqFromFutureToBankByFuture(req: object, requestId?: number): number;
 
   /**
    * 期货发起查询银行余额请求
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQueryBankAccountMoneyByFuture(req: object): number;
+  reqQueryBankAccountMoneyByFuture(req: object, requestId?: number): number;
 
   /**
    * 请求查询分类合约
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryClassifiedInstrument(req: object): number;
+  reqQryClassifiedInstrument(req: object, requestId?: number): number;
+
+  /**
+   * 请求查询分类合约, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryClassifiedInstrument(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 请求组合优惠比例
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
+   */
+  reqQryCombPromotionParam(req: object, requestId?: number): number;
+
+  /**
+   * 请求组合优惠比例, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
    */
-  reqQryCombPromotionParam(req: object): number;
+  queryCombPromotionParam(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 投资者风险结算持仓查询
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryRiskSettleInvstPosition(req: object): number;
+  reqQryRiskSettleInvstPosition(req: object, requestId?: number): number;
+
+  /**
+   * 投资者风险结算持仓查询, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryRiskSettleInvstPosition(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 风险结算产品查询
    * @param req 查询信息
+   * @param requestId 请求编号, 1 到 1073741823, 缺省时自动分配
    */
-  reqQryRiskSettleProductStatus(req: object): number;
+  reqQryRiskSettleProductStatus(req: object, requestId?: number): number;
+
+  /**
+   * 风险结算产品查询, 经查询调度按流控发出, 汇总全部结果后一次返回, 结果不再投递给回调函数
+   * @param req 查询信息
+   * @param options 查询选项, 为数值时即超时时间
+   * @returns 全部查询结果, 请求失败, CTP 返回错误或超时时以 QueryError 拒绝
+   */
+  queryRiskSettleProductStatus(req: object, options?: number | QueryOptions): Promise<object[]>;
 
   /**
    * 注册交易消息回调函数
@@ -4550,26 +5563,133 @@ export declare class Trader {
    * @param func 回调函数
    */
   on(event: TraderEvent, func: CallbackFunction): Trader;
+
+  /**
+   * 注册批量交易消息回调函数
+   * @param event 交易消息事件
+   * @param func 批量回调函数
+   * @param options 回调选项
+   */
+  on(event: TraderEvent, func: BatchCallbackFunction, options: ListenerOptions): Trader;
 }
 
 /**
  * 创建行情对象
  * @param flowMdPath 存贮订阅信息文件的目录
  * @param frontMdAddr 前置机网络地址
+ * @param options 行情对象选项
  * @returns 行情对象
  */
 export declare function createMarketData(
   flowMdPath: string,
-  frontMdAddr: string
+  frontMdAddr: string,
+  options?: MarketDataOptions
 ): MarketData;
 
+/**
+ * 行情回放对象, 读取行情记录文件, 以与行情对象相同的事件和回调方式回放.
+ * 连接后登录, 订阅合约(可用 "*" 订阅全部)后开始回放, 回放完毕时触发
+ * front-disconnected 事件, 原因为 0
+ */
+export declare class MarketDataReplay extends MarketData {
+  /**
+   *
+   * @param files 行情记录文件, 按给定顺序回放
+   * @param options 行情回放对象选项
+   */
+  constructor(files: string | string[], options?: MarketDataReplayOptions);
+
+  /**
+   * 获取行情回放统计
+   * @returns 回放统计
+   */
+  getReplayStats(): ReplayStats;
+}
+
+/**
+ * 创建行情回放对象
+ * @param files 行情记录文件, 按给定顺序回放
+ * @param options 行情回放对象选项
+ * @returns 行情回放对象
+ */
+export declare function createMarketDataReplay(
+  files: string | string[],
+  options?: MarketDataReplayOptions
+): MarketDataReplay;
+
 /**
  * 创建交易对象
  * @param flowPath 存贮订阅信息文件的目录
  * @param frontAddr 前置机网络地址
+ * @param options 交易对象选项
  * @returns 交易对象
  */
 export declare function createTrader(
   flowPath: string,
-  frontAddr: string
+  frontAddr: string,
+  options?: TraderOptions
 ): Trader;
+
+/**
+ * 获取消息内存池统计
+ * @returns 内存池统计
+ */
+export declare function getPoolStats(): PoolStats;
+
+/** 原始投递的结构体字段类型 */
+export type RawFieldType = "string" | "char" | "int16" | "int32" | "double";
+
+/** 原始投递的结构体字段布局 */
+export interface RawField {
+  /** 字段在结构体中的偏移 */
+  offset: number;
+  /** 字段类型 */
+  type: RawFieldType;
+  /** 字段长度, 字符串含结尾的 0 */
+  size: number;
+}
+
+/** 原始投递的结构体布局 */
+export interface RawStruct {
+  /** 结构体长度 */
+  size: number;
+  /** 字段布局 */
+  fields: { [field: string]: RawField };
+}
+
+/** 按结构体布局解码出的普通对象, 字符串及字符字段为 string, 其余为 number */
+export type DecodedStruct<K extends keyof StructLayouts> = {
+  [F in keyof StructLayouts[K]["fields"]]: StructLayouts[K]["fields"][F] extends { type: "string" | "char" } ? string : number;
+};
+
+/** 原始投递的结构体布局 */
+export declare const structs: StructLayouts;
+
+/** 原始投递时各事件的结构体 */
+export declare const events: {
+  marketData: MarketDataEventStructs;
+  trader: TraderEventStructs;
+};
+
+/**
+ * 解码原始投递的结构体
+ * @param struct 结构体名
+ * @param bytes 原始投递的 Uint8Array, 或从头存放结构体的 ArrayBuffer
+ * @param fields 需要解码的字段, 默认全部
+ * @returns 解码后的普通对象
+ */
+export declare function decodeRaw<K extends keyof StructLayouts>(
+  struct: K,
+  bytes: Uint8Array | ArrayBuffer,
+  fields?: (keyof StructLayouts[K]["fields"])[]
+): DecodedStruct<K>;
+
+/**
+ * 读取原始投递的结构体中的单个字段
+ * @param view 从结构体起始处开始的 DataView
+ * @param field 字段布局
+ * @returns 字段值
+ */
+export declare function readRawField(view: DataView, field: RawField): string | number;
+
+export { StructLayouts, MarketDataEventStructs, TraderEventStructs };
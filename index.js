@@ -10,4 +10,4 @@
  */
 
 const binding = require("node-gyp-build")(__dirname);
-module.exports = binding;
+module.exports = Object.assign(binding, require("./raw"));
@@ -0,0 +1,91 @@
+/*
+ * raw.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+// Readers of the CTP structs raw events deliver as Uint8Arrays, in the
+// byte order of the host like the structs themselves.
+
+const os = require("os");
+const { structs, events } = require("./ctpstructs");
+
+const littleEndian = os.endianness() === "LE";
+
+// Node without full ICU has no GBK, the bytes still come through as latin1.
+const gbk = (() => {
+  try {
+    return new TextDecoder("gbk");
+  } catch (e) {
+    return null;
+  }
+})();
+
+// Up to the terminating NUL, codes, dates and times are plain ASCII.
+const readString = (view, offset, size) => {
+  let end = offset, bits = 0;
+
+  for (const limit = offset + size; end < limit; ++end) {
+    const c = view.getUint8(end);
+
+    if (!c) {
+      break;
+    }
+
+    bits |= c;
+  }
+
+  const bytes = new Uint8Array(view.buffer, view.byteOffset + offset, end - offset);
+
+  if (bits < 0x80 || !gbk) {
+    return String.fromCharCode.apply(null, bytes);
+  }
+
+  return gbk.decode(bytes);
+};
+
+const readRawField = (view, field) => {
+  switch (field.type) {
+    case "double":
+      return view.getFloat64(field.offset, littleEndian);
+    case "int32":
+      return view.getInt32(field.offset, littleEndian);
+    case "int16":
+      return view.getInt16(field.offset, littleEndian);
+    default:
+      return readString(view, field.offset, field.size);
+  }
+};
+
+const decodeRaw = (struct, bytes, names) => {
+  const layout = structs[struct];
+
+  if (!layout) {
+    throw new TypeError(`Unknown struct ${struct}`);
+  }
+
+  if (bytes.byteLength < layout.size) {
+    throw new RangeError(`${struct} needs ${layout.size} bytes, got ${bytes.byteLength}`);
+  }
+
+  // Raw records fill their own buffer, other views may start anywhere in theirs.
+  const view = ArrayBuffer.isView(bytes) ? new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength) : new DataView(bytes);
+  const result = {};
+
+  for (const name of names || Object.keys(layout.fields)) {
+    const field = layout.fields[name];
+
+    if (field) {
+      result[name] = readRawField(view, field);
+    }
+  }
+
+  return result;
+};
+
+module.exports = { structs, events, decodeRaw, readRawField };
@@ -23,9 +23,31 @@ static void destructor(napi_env env, void *data, void *hint) {
   if (constructors->marketData)
     CHECK(napi_delete_reference(env, constructors->marketData));
 
+  if (constructors->marketDataReplay)
+    CHECK(napi_delete_reference(env, constructors->marketDataReplay));
+
   if (constructors->trader)
     CHECK(napi_delete_reference(env, constructors->trader));
 
+  if (constructors->instrumentCatalog)
+    CHECK(napi_delete_reference(env, constructors->instrumentCatalog));
+
+  if (constructors->preparedRequest)
+    CHECK(napi_delete_reference(env, constructors->preparedRequest));
+
+  for (int i = 0; i < OBJECT_FACTORY_MAX; ++i)
+    if (constructors->objectFactories[i])
+      CHECK(napi_delete_reference(env, constructors->objectFactories[i]));
+
+  if (constructors->lazySlab.buffer)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.buffer));
+
+  if (constructors->lazySlab.view)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.view));
+
+  if (constructors->lazySlab.factory)
+    CHECK(napi_delete_reference(env, constructors->lazySlab.factory));
+
   free(constructors);
 }
 
@@ -40,15 +62,34 @@ static napi_status defineConstructors(napi_env env) {
   memset(constructors, 0, sizeof(Constructors));
 
   CHECK(defineMarketData(env, &constructors->marketData));
+  CHECK(defineMarketDataReplay(env, &constructors->marketDataReplay));
   CHECK(defineTrader(env, &constructors->trader));
+  CHECK(defineInstrumentCatalog(env, &constructors->instrumentCatalog));
+  CHECK(definePreparedRequest(env, &constructors->preparedRequest));
 
   return napi_set_instance_data(env, constructors, destructor, nullptr);
 }
 
+static napi_value getPoolStats(napi_env env, napi_callback_info info) {
+  MessagePoolStats stats;
+  napi_value object;
+
+  getMessagePoolStats(&stats);
+
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetInt64(env, object, "allocations", (int64_t)stats.allocations));
+  CHECK(objectSetInt64(env, object, "mallocs", (int64_t)stats.mallocs));
+  CHECK(objectSetUint32(env, object, "pools", stats.pools));
+
+  return object;
+}
+
 static napi_status defineMethods(napi_env env, napi_value exports) {
   napi_property_descriptor props[] = {
       DECLARE_NAPI_METHOD(createMarketData),
+      DECLARE_NAPI_METHOD(createMarketDataReplay),
       DECLARE_NAPI_METHOD(createTrader),
+      DECLARE_NAPI_METHOD(getPoolStats),
   };
   return napi_define_properties(env, exports, arraysize(props), props);
 }
@@ -0,0 +1,138 @@
+/*
+ * ctpfields.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "ctpfields.h"
+#include <string.h>
+
+#define CTP_FIELD(type, name, kind) {#name, offsetof(type, name), sizeof(type::name), kind},
+
+// The perfect hash is built by the compiler, a collision can not reach run time.
+// The size pins the natural alignment layout ctpstructs.js hands to raw readers.
+#define DEFINE_CTP_FIELDS(type, size)                                          \
+  static_assert(sizeof(type) == size, #type " does not match its generated layout"); \
+  static constexpr CtpField type##Fields[] = {CTP_FIELDS_##type(CTP_FIELD)};   \
+  static constexpr auto type##Hash = buildCtpFieldHash(type##Fields);          \
+  static const CtpFields type##Table = {type##Fields, arraysize(type##Fields), type##Hash.seeds, type##Hash.indexes, type##Hash.slots}; \
+  template <> const CtpFields *ctpFields<type>() { return &type##Table; }
+
+CTP_STRUCTS(DEFINE_CTP_FIELDS)
+
+const CtpField *findCtpField(const CtpFields *table, const char *name) {
+  if (!table)
+    return nullptr;
+
+  size_t bucket = ctpFieldHash(name, 0) % table->count;
+  uint8_t index = table->indexes[ctpFieldHash(name, table->seeds[bucket]) & (table->slots - 1)];
+
+  if (index == CTP_FIELD_EMPTY || 0 != strcmp(table->fields[index].name, name))
+    return nullptr;
+
+  return &table->fields[index];
+}
+
+const char *ctpFieldTypeName(const CtpField *field) {
+  return field->type == CTP_FIELD_STRING || field->type == CTP_FIELD_CHAR ? "string" : "number";
+}
+
+napi_status setCtpField(napi_env env, void *record, const CtpField *field, napi_value value) {
+  uint8_t *address = (uint8_t *)record + field->offset;
+
+  switch (field->type) {
+  case CTP_FIELD_STRING:
+    return napi_get_value_string_utf8(env, value, (char *)address, field->size, nullptr);
+  case CTP_FIELD_CHAR: {
+    char strbuf[8] = {0};
+    napi_status status = napi_get_value_string_utf8(env, value, strbuf, arraysize(strbuf), nullptr);
+
+    if (status == napi_ok)
+      *(char *)address = strbuf[0];
+
+    return status;
+  }
+  case CTP_FIELD_INT16: {
+    int32_t number = 0;
+    napi_status status = napi_get_value_int32(env, value, &number);
+
+    if (status == napi_ok)
+      *(int16_t *)address = (int16_t)number;
+
+    return status;
+  }
+  case CTP_FIELD_INT32:
+    return napi_get_value_int32(env, value, (int32_t *)address);
+  case CTP_FIELD_DOUBLE:
+    return napi_get_value_double(env, value, (double *)address);
+  default:
+    return napi_invalid_arg;
+  }
+}
+
+napi_status getCtpField(napi_env env, const void *record, const CtpField *field, napi_value *result) {
+  const uint8_t *address = (const uint8_t *)record + field->offset;
+
+  switch (field->type) {
+  case CTP_FIELD_STRING:
+    return createString(env, (const char *)address, result);
+  case CTP_FIELD_CHAR: {
+    const char str[2] = {*(const char *)address, 0};
+    return createString(env, str, result);
+  }
+  case CTP_FIELD_INT16:
+    return napi_create_int32(env, *(const int16_t *)address, result);
+  case CTP_FIELD_INT32:
+    return napi_create_int32(env, *(const int32_t *)address, result);
+  case CTP_FIELD_DOUBLE:
+    return napi_create_double(env, *(const double *)address, result);
+  default:
+    return napi_invalid_arg;
+  }
+}
+
+napi_status unmarshalCtpFields(napi_env env, napi_value object, const CtpFields *table, void *record, const CtpField **mistyped) {
+  napi_value names, key, value;
+  napi_valuetype valuetype;
+  uint32_t length;
+  char name[CTP_FIELD_NAME_MAX];
+  size_t size;
+
+  *mistyped = nullptr;
+
+  CHECK(napi_get_property_names(env, object, &names));
+  CHECK(napi_get_array_length(env, names, &length));
+
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, names, i, &key));
+    CHECK(napi_get_value_string_utf8(env, key, name, sizeof(name), &size));
+
+    // A truncated name is longer than any field name.
+    if (size >= sizeof(name) - 1)
+      continue;
+
+    const CtpField *field = findCtpField(table, name);
+
+    if (!field)
+      continue;
+
+    CHECK(napi_get_property(env, object, key, &value));
+
+    if (napi_ok == setCtpField(env, record, field, value))
+      continue;
+
+    CHECK(napi_typeof(env, value, &valuetype));
+
+    if (valuetype != napi_undefined && valuetype != napi_null) {
+      *mistyped = field;
+      break;
+    }
+  }
+
+  return napi_ok;
+}
@@ -0,0 +1,149 @@
+/*
+ * ctpfields.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __CTPFIELDS_H__
+#define __CTPFIELDS_H__
+
+#include "ctpstructs.h"
+#include "napi_ctp.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define CTP_FIELD_NAME_MAX 64
+#define CTP_FIELD_EMPTY 0xff
+
+enum { CTP_FIELD_STRING = 0, CTP_FIELD_CHAR, CTP_FIELD_INT16, CTP_FIELD_INT32, CTP_FIELD_DOUBLE };
+
+typedef struct CtpField {
+  const char *name;
+  size_t offset;
+  size_t size;
+  int type;
+} CtpField;
+
+/*
+ * The fields of a CTP struct behind a perfect hash: the name picks a
+ * bucket, the seed of the bucket picks a slot, and the slot holds the
+ * index of the only field that can have that name.
+ */
+typedef struct CtpFields {
+  const CtpField *fields;
+  size_t count;
+  const uint32_t *seeds;
+  const uint8_t *indexes;
+  size_t slots;
+} CtpFields;
+
+constexpr uint32_t ctpFieldHash(const char *name, uint32_t seed) {
+  uint32_t hash = 2166136261u ^ (seed * 0x9e3779b9u);
+
+  for (; *name; ++name)
+    hash = (hash ^ (uint8_t)*name) * 16777619u;
+
+  hash ^= hash >> 15;
+  hash *= 0x85ebca6bu;
+
+  return hash ^ (hash >> 13);
+}
+
+constexpr size_t ctpFieldSlots(size_t count) {
+  size_t slots = 1;
+
+  while (slots < count * 2)
+    slots <<= 1;
+
+  return slots;
+}
+
+template <size_t N> struct CtpFieldHash {
+  static constexpr size_t slots = ctpFieldSlots(N);
+
+  uint32_t seeds[N];
+  uint8_t indexes[slots];
+};
+
+// Hash and displace, largest buckets first, each with the first seed that lands all its fields on free slots.
+template <size_t N> constexpr CtpFieldHash<N> buildCtpFieldHash(const CtpField (&fields)[N]) {
+  static_assert(N < CTP_FIELD_EMPTY, "Too many fields for a CtpFieldHash");
+
+  constexpr size_t mask = CtpFieldHash<N>::slots - 1;
+  CtpFieldHash<N> hash = {};
+  size_t buckets[N] = {}, sizes[N] = {};
+
+  for (size_t i = 0; i < CtpFieldHash<N>::slots; ++i)
+    hash.indexes[i] = CTP_FIELD_EMPTY;
+
+  for (size_t i = 0; i < N; ++i) {
+    buckets[i] = ctpFieldHash(fields[i].name, 0) % N;
+    sizes[buckets[i]] += 1;
+  }
+
+  for (size_t size = N; size > 0; --size) {
+    for (size_t bucket = 0; bucket < N; ++bucket) {
+      if (sizes[bucket] != size)
+        continue;
+
+      for (uint32_t seed = 1;; ++seed) {
+        size_t taken[N] = {}, count = 0;
+        bool isFree = true;
+
+        for (size_t i = 0; i < N && isFree; ++i) {
+          if (buckets[i] != bucket)
+            continue;
+
+          size_t slot = ctpFieldHash(fields[i].name, seed) & mask;
+
+          isFree = hash.indexes[slot] == CTP_FIELD_EMPTY;
+
+          for (size_t j = 0; j < count && isFree; ++j)
+            isFree = taken[j] != slot;
+
+          taken[count++] = slot;
+        }
+
+        if (!isFree)
+          continue;
+
+        for (size_t i = 0, j = 0; i < N; ++i)
+          if (buckets[i] == bucket)
+            hash.indexes[taken[j++]] = (uint8_t)i;
+
+        hash.seeds[bucket] = seed;
+        break;
+      }
+    }
+  }
+
+  return hash;
+}
+
+/* The fields of a CTP struct as tools/ctpstructs.js found them, nullptr for any other T. */
+template <typename T> const CtpFields *ctpFields() { return nullptr; }
+
+#define DECLARE_CTP_FIELDS(type, size) template <> const CtpFields *ctpFields<type>();
+CTP_STRUCTS(DECLARE_CTP_FIELDS)
+#undef DECLARE_CTP_FIELDS
+
+const CtpField *findCtpField(const CtpFields *table, const char *name);
+const char *ctpFieldTypeName(const CtpField *field);
+
+/* Writes value into the field of record, napi_string_expected or napi_number_expected when it does not fit. */
+napi_status setCtpField(napi_env env, void *record, const CtpField *field, napi_value value);
+napi_status getCtpField(napi_env env, const void *record, const CtpField *field, napi_value *result);
+
+/*
+ * Reads the properties the object actually has, enumerated once, into the
+ * record. Unknown names are skipped, as are undefined and null values; a
+ * known field of the wrong type stops it with *mistyped set.
+ */
+napi_status unmarshalCtpFields(napi_env env, napi_value object, const CtpFields *table, void *record, const CtpField **mistyped);
+
+#endif /* __CTPFIELDS_H__ */
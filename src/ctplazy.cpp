@@ -0,0 +1,250 @@
+/*
+ * ctplazy.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "ctplazy.h"
+#include <string.h>
+#include <string>
+
+// Anything but a buffer holding a whole record at offset reads as undefined, a forged one is never read past its end.
+static const uint8_t *getLazyRecord(napi_env env, const LazyClass *lazyClass, size_t argc, const napi_value *argv) {
+  uint32_t offset;
+  size_t length;
+  void *data;
+  bool isArrayBuffer;
+
+  if (argc < 2)
+    return nullptr;
+
+  CHECK(napi_is_arraybuffer(env, argv[0], &isArrayBuffer));
+
+  if (!isArrayBuffer || napi_ok != napi_get_value_uint32(env, argv[1], &offset))
+    return nullptr;
+
+  CHECK(napi_get_arraybuffer_info(env, argv[0], &data, &length));
+
+  return (size_t)offset + lazyClass->size <= length ? (const uint8_t *)data + offset : nullptr;
+}
+
+// decode(buffer, offset, index)
+static napi_value decodeLazyField(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value argv[3], result;
+  LazyClass *lazyClass;
+  uint32_t index;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, (void **)&lazyClass));
+
+  const uint8_t *record = getLazyRecord(env, lazyClass, argc, argv);
+
+  if (!record || argc < 3 || napi_ok != napi_get_value_uint32(env, argv[2], &index) || index >= lazyClass->table->count) {
+    CHECK(napi_get_undefined(env, &result));
+    return result;
+  }
+
+  CHECK(getCtpField(env, record, &lazyClass->table->fields[index], &result));
+
+  return result;
+}
+
+// convert(buffer, offset)
+static napi_value convertLazyObject(napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  napi_value argv[2], result;
+  LazyClass *lazyClass;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, (void **)&lazyClass));
+
+  const uint8_t *record = getLazyRecord(env, lazyClass, argc, argv);
+
+  if (!record) {
+    CHECK(napi_get_undefined(env, &result));
+    return result;
+  }
+
+  Message message(0, (uintptr_t)record);
+  CHECK(lazyClass->convert(env, &message, &result));
+
+  return result;
+}
+
+// The typed array a number is read through, empty when it is not aligned for one.
+static std::string numberView(const CtpField *field, std::string *index) {
+  static const struct {
+    int type;
+    size_t size;
+    const char *view;
+    const char *shift;
+  } views[] = {
+    {CTP_FIELD_INT16, 2, "i16", "1"},
+    {CTP_FIELD_INT32, 4, "i32", "2"},
+    {CTP_FIELD_DOUBLE, 8, "f64", "3"},
+  };
+
+  for (int i = 0; i < arraysize(views); ++i) {
+    if (views[i].type != field->type || field->offset % views[i].size != 0)
+      continue;
+
+    *index = "(this[offset] + " + std::to_string(field->offset) + ") >> " + views[i].shift;
+    return views[i].view;
+  }
+
+  return "";
+}
+
+// (function (decode, convert) { ... class Name { constructor(s, o) { ... } get Field() { ... } ... } ... })
+static napi_status compileLazyClass(napi_env env, const LazyClass *lazyClass, napi_ref *result) {
+  const CtpFields *table = lazyClass->table;
+  std::string getters, name = lazyClass->name;
+  napi_value source, factory, argv[2], undefined, cons;
+  size_t strings = 0;
+
+  for (size_t i = 0; i < table->count; ++i) {
+    const CtpField *field = &table->fields[i];
+    std::string index, decode = "decode(this[slab].buffer, this[offset], " + std::to_string(i) + ")";
+    std::string view = numberView(field, &index);
+
+    getters += "    get " + std::string(field->name) + "() { ";
+
+    if (!view.empty()) {
+      getters += "return this[slab]." + view + "[" + index + "];";
+    } else if (field->type == CTP_FIELD_CHAR) {
+      // Single char strings are interned by V8, only a GBK byte goes native.
+      getters += "const c = this[slab].u8[this[offset] + " + std::to_string(field->offset) + "]; ";
+      getters += "return c < 0x80 ? (c ? String.fromCharCode(c) : \"\") : " + decode + ";";
+    } else if (field->type == CTP_FIELD_STRING) {
+      std::string slot = std::to_string(strings++);
+
+      getters += "const values = this[cache] || (this[cache] = new Array(STRINGS)); const value = values[" + slot + "]; ";
+      getters += "return value !== undefined ? value : (values[" + slot + "] = " + decode + ");";
+    } else {
+      getters += "return " + decode + ";";
+    }
+
+    getters += " }\n";
+  }
+
+  for (size_t pos = getters.find("STRINGS"); pos != std::string::npos; pos = getters.find("STRINGS", pos))
+    getters.replace(pos, 7, std::to_string(strings));
+
+  std::string code = "(function (decode, convert) {\n"
+                     "  const slab = Symbol(\"slab\"), offset = Symbol(\"offset\"), cache = Symbol(\"cache\");\n"
+                     "  class " + name + " {\n"
+                     "    constructor(s, o) { this[slab] = s; this[offset] = o; this[cache] = undefined; }\n" +
+                     getters +
+                     "    toJSON() { return convert(this[slab].buffer, this[offset]); }\n"
+                     "  }\n"
+                     "  return " + name + ";\n"
+                     "})";
+
+  CHECK(napi_create_string_utf8(env, code.c_str(), code.length(), &source));
+  CHECK(napi_run_script(env, source, &factory));
+  CHECK(napi_create_function(env, "decode", NAPI_AUTO_LENGTH, decodeLazyField, (void *)lazyClass, &argv[0]));
+  CHECK(napi_create_function(env, "convert", NAPI_AUTO_LENGTH, convertLazyObject, (void *)lazyClass, &argv[1]));
+  CHECK(napi_get_undefined(env, &undefined));
+  CHECK(napi_call_function(env, undefined, factory, 2, argv, &cons));
+
+  return napi_create_reference(env, cons, 1, result);
+}
+
+static napi_status compileSlabFactory(napi_env env, napi_ref *result) {
+  static const char code[] = "(function (buffer) { return { buffer: buffer, u8: new Uint8Array(buffer), i16: new Int16Array(buffer), "
+                             "i32: new Int32Array(buffer), f64: new Float64Array(buffer) }; })";
+  napi_value source, factory;
+
+  CHECK(napi_create_string_utf8(env, code, sizeof(code) - 1, &source));
+  CHECK(napi_run_script(env, source, &factory));
+
+  return napi_create_reference(env, factory, 1, result);
+}
+
+static napi_status newLazySlab(napi_env env, LazySlab *slab, size_t size) {
+  napi_value buffer, factory, undefined, view;
+  void *data;
+
+  if (!slab->factory)
+    CHECK(compileSlabFactory(env, &slab->factory));
+
+  if (slab->buffer) {
+    CHECK(napi_delete_reference(env, slab->buffer));
+    CHECK(napi_delete_reference(env, slab->view));
+  }
+
+  CHECK(napi_create_arraybuffer(env, size > LAZY_SLAB_SIZE ? size : LAZY_SLAB_SIZE, &data, &buffer));
+  CHECK(napi_get_reference_value(env, slab->factory, &factory));
+  CHECK(napi_get_undefined(env, &undefined));
+  CHECK(napi_call_function(env, undefined, factory, 1, &buffer, &view));
+
+  // Weak, the objects carved from the slab keep it alive, not the slab state.
+  CHECK(napi_create_reference(env, buffer, 0, &slab->buffer));
+  CHECK(napi_create_reference(env, view, 0, &slab->view));
+
+  slab->used = 0;
+
+  return napi_ok;
+}
+
+// Copies record to the 8 byte aligned offset of the current slab, a new slab when it does not fit.
+static napi_status copyToLazySlab(napi_env env, const void *record, size_t size, napi_value *buffer, napi_value *view, size_t *offset) {
+  LazySlab *slab = &getConstructors(env)->lazySlab;
+  size_t aligned = (size + 7) & ~(size_t)7, length = 0;
+  void *data = nullptr;
+
+  *buffer = *view = nullptr;
+
+  // Gone once collected, empty once detached, either way a new slab is due.
+  if (slab->buffer) {
+    CHECK(napi_get_reference_value(env, slab->buffer, buffer));
+    CHECK(napi_get_reference_value(env, slab->view, view));
+  }
+
+  if (*buffer)
+    CHECK(napi_get_arraybuffer_info(env, *buffer, &data, &length));
+
+  if (!*buffer || !*view || slab->used + aligned > length) {
+    CHECK(newLazySlab(env, slab, aligned));
+    CHECK(napi_get_reference_value(env, slab->buffer, buffer));
+    CHECK(napi_get_reference_value(env, slab->view, view));
+    CHECK(napi_get_arraybuffer_info(env, *buffer, &data, &length));
+  }
+
+  memcpy((uint8_t *)data + slab->used, record, size);
+
+  *offset = slab->used;
+  slab->used += aligned;
+
+  return napi_ok;
+}
+
+napi_status createLazyObject(napi_env env, const LazyClass *lazyClass, const void *record, napi_value *result) {
+  napi_ref *constructor = &getConstructors(env)->objectFactories[lazyClass->factory];
+  napi_value argv[2], buffer, cons;
+  size_t offset;
+
+  if (!*constructor)
+    CHECK(compileLazyClass(env, lazyClass, constructor));
+
+  CHECK(copyToLazySlab(env, record, lazyClass->size, &buffer, &argv[0], &offset));
+  CHECK(napi_create_uint32(env, (uint32_t)offset, &argv[1]));
+  CHECK(napi_get_reference_value(env, *constructor, &cons));
+
+  return napi_new_instance(env, cons, 2, argv, result);
+}
+
+napi_status createRawRecord(napi_env env, const void *record, size_t size, napi_value *result) {
+  napi_value buffer;
+  void *data;
+
+  CHECK(napi_create_arraybuffer(env, size, &data, &buffer));
+
+  memcpy(data, record, size);
+
+  return napi_create_typedarray(env, napi_uint8_array, size, buffer, 0, result);
+}
@@ -0,0 +1,49 @@
+/*
+ * ctplazy.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __CTPLAZY_H__
+#define __CTPLAZY_H__
+
+#include "ctpfields.h"
+#include "napi_ctp.h"
+
+#define LAZY_SLAB_SIZE 16384
+
+typedef napi_status (*LazyConverter)(napi_env env, const Message *message, napi_value *result);
+
+/*
+ * The JS class of the lazy objects of one CTP struct, compiled on first use
+ * into the factory slot. convert builds the eager object for toJSON().
+ */
+typedef struct LazyClass {
+  const char *name;
+  const CtpFields *table;
+  LazyConverter convert;
+  size_t size;
+  int factory;
+} LazyClass;
+
+/*
+ * Copies record into the current slab and returns an object whose getters
+ * read it: numbers and chars straight from typed arrays over the slab,
+ * strings through a native decode, cached after the first access. The slab
+ * is an ArrayBuffer, freed by the GC with the last object carved from it.
+ */
+napi_status createLazyObject(napi_env env, const LazyClass *lazyClass, const void *record, napi_value *result);
+
+/*
+ * Copies record into an ArrayBuffer of its own and returns a Uint8Array
+ * over all of it, for raw delivery. Not the slab: a consumer may write
+ * through .buffer, and lazy objects read theirs from the slab.
+ */
+napi_status createRawRecord(napi_env env, const void *record, size_t size, napi_value *result);
+
+#endif /* __CTPLAZY_H__ */
@@ -0,0 +1,221 @@
+/*
+ * ctpreuse.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "ctpreuse.h"
+#include <string.h>
+
+enum { REUSE_VIEW_F64 = 0, REUSE_VIEW_I32, REUSE_VIEW_I16 };
+
+// The typed array a number is copied through, -1 when it is not aligned for one.
+static int numberView(const CtpField *field, std::string *index) {
+  static const struct {
+    int type;
+    size_t size;
+    int view;
+  } views[] = {
+    {CTP_FIELD_INT16, 2, REUSE_VIEW_I16},
+    {CTP_FIELD_INT32, 4, REUSE_VIEW_I32},
+    {CTP_FIELD_DOUBLE, 8, REUSE_VIEW_F64},
+  };
+
+  for (int i = 0; i < arraysize(views); ++i) {
+    if (views[i].type != field->type || field->offset % views[i].size != 0)
+      continue;
+
+    *index = std::to_string(field->offset / views[i].size);
+    return views[i].view;
+  }
+
+  return -1;
+}
+
+// (function (o, f64, i32, i16) { o.Field = f64[n]; ... })
+static napi_status compileUpdater(napi_env env, const ReuseClass *reuseClass, napi_ref *result) {
+  static const char *viewNames[] = {"f64", "i32", "i16"};
+  const CtpFields *table = reuseClass->table;
+  std::string assignments;
+  napi_value source, updater;
+
+  for (size_t i = 0; i < table->count; ++i) {
+    std::string index;
+    int view = numberView(&table->fields[i], &index);
+
+    if (view >= 0)
+      assignments += " o." + std::string(table->fields[i].name) + " = " + viewNames[view] + "[" + index + "];";
+  }
+
+  std::string code = "(function (o, f64, i32, i16) {" + assignments + " })";
+
+  CHECK(napi_create_string_utf8(env, code.c_str(), code.length(), &source));
+  CHECK(napi_run_script(env, source, &updater));
+
+  return napi_create_reference(env, updater, 1, result);
+}
+
+// The scratch buffer with its views, and the keys of the compared fields.
+static napi_status createScratch(napi_env env, ReuseCache *cache) {
+  static const struct {
+    napi_typedarray_type type;
+    size_t size;
+  } views[] = {
+    {napi_float64_array, 8},
+    {napi_int32_array, 4},
+    {napi_int16_array, 2},
+  };
+  const CtpFields *table = cache->reuseClass->table;
+  size_t size = (cache->reuseClass->size + 7) & ~(size_t)7;
+  napi_value buffer, view, keys, key;
+  void *data;
+
+  CHECK(napi_create_arraybuffer(env, size, &data, &buffer));
+
+  for (int i = 0; i < arraysize(views); ++i) {
+    CHECK(napi_create_typedarray(env, views[i].type, size / views[i].size, buffer, 0, &view));
+    CHECK(napi_create_reference(env, view, 1, &cache->views[i]));
+  }
+
+  CHECK(napi_create_array_with_length(env, table->count, &keys));
+
+  for (auto it = cache->compared.begin(); it != cache->compared.end(); ++it) {
+    CHECK(napi_create_string_latin1(env, table->fields[*it].name, NAPI_AUTO_LENGTH, &key));
+    CHECK(napi_set_element(env, keys, *it, key));
+  }
+
+  CHECK(napi_create_reference(env, keys, 1, &cache->keys));
+
+  cache->scratch = (uint8_t *)data;
+
+  return napi_ok;
+}
+
+// Numbers go through the compiled updater, so V8 stores them without boxing a value per field.
+static napi_status updateNumbers(napi_env env, ReuseCache *cache, const uint8_t *record, napi_value object) {
+  napi_ref *updater = &getConstructors(env)->objectFactories[cache->reuseClass->factory];
+  napi_value argv[4], func, undefined;
+
+  if (!*updater)
+    CHECK(compileUpdater(env, cache->reuseClass, updater));
+
+  if (!cache->scratch)
+    CHECK(createScratch(env, cache));
+
+  memcpy(cache->scratch, record, cache->reuseClass->size);
+
+  argv[0] = object;
+
+  for (int i = 0; i < 3; ++i)
+    CHECK(napi_get_reference_value(env, cache->views[i], &argv[i + 1]));
+
+  CHECK(napi_get_reference_value(env, *updater, &func));
+  CHECK(napi_get_undefined(env, &undefined));
+
+  return napi_call_function(env, undefined, func, 4, argv, nullptr);
+}
+
+static bool isFieldChanged(const CtpField *field, const uint8_t *record, const uint8_t *previous) {
+  const uint8_t *current = record + field->offset, *last = previous + field->offset;
+
+  if (field->type == CTP_FIELD_STRING)
+    return 0 != strncmp((const char *)current, (const char *)last, field->size);
+
+  return 0 != memcmp(current, last, field->size);
+}
+
+// Strings, chars and any number the updater can not reach are set here, and only when changed.
+static napi_status updateFields(napi_env env, ReuseCache *cache, const uint8_t *record, const uint8_t *previous, napi_value object) {
+  const CtpFields *table = cache->reuseClass->table;
+  napi_value keys, key, value;
+
+  CHECK(napi_get_reference_value(env, cache->keys, &keys));
+
+  for (auto it = cache->compared.begin(); it != cache->compared.end(); ++it) {
+    const CtpField *field = &table->fields[*it];
+
+    if (!isFieldChanged(field, record, previous))
+      continue;
+
+    CHECK(napi_get_element(env, keys, *it, &key));
+    CHECK(getCtpField(env, record, field, &value));
+    CHECK(napi_set_property(env, object, key, value));
+  }
+
+  return napi_ok;
+}
+
+ReuseCache *createReuseCache(const ReuseClass *reuseClass) {
+  ReuseCache *cache = new ReuseCache();
+  std::string index;
+
+  if (!cache)
+    return nullptr;
+
+  for (uint32_t i = 0; i < reuseClass->table->count; ++i)
+    if (numberView(&reuseClass->table->fields[i], &index) < 0)
+      cache->compared.push_back(i);
+
+  cache->reuseClass = reuseClass;
+  cache->instrument = findCtpField(reuseClass->table, "InstrumentID");
+  cache->keys = nullptr;
+  cache->scratch = nullptr;
+
+  for (int i = 0; i < arraysize(cache->views); ++i)
+    cache->views[i] = nullptr;
+
+  assert(cache->instrument != nullptr);
+
+  return cache;
+}
+
+void freeReuseCache(napi_env env, ReuseCache *cache) {
+  for (auto it = cache->objects.begin(); it != cache->objects.end(); ++it)
+    CHECK(napi_delete_reference(env, *it));
+
+  if (cache->keys)
+    CHECK(napi_delete_reference(env, cache->keys));
+
+  for (int i = 0; i < arraysize(cache->views); ++i)
+    if (cache->views[i])
+      CHECK(napi_delete_reference(env, cache->views[i]));
+
+  delete cache;
+}
+
+napi_status getReusedValue(napi_env env, ReuseCache *cache, const Message *message, napi_value *result) {
+  const ReuseClass *reuseClass = cache->reuseClass;
+  const uint8_t *record = (const uint8_t *)message->data;
+  napi_ref object;
+
+  // CTP answers a query that matched nothing with a null struct.
+  if (!record)
+    return napi_get_undefined(env, result);
+
+  auto iter = cache->indexes.emplace((const char *)record + cache->instrument->offset, (uint32_t)cache->objects.size());
+
+  if (iter.second) {
+    CHECK(reuseClass->convert(env, message, result));
+    CHECK(napi_create_reference(env, *result, 1, &object));
+
+    cache->objects.push_back(object);
+    cache->records.insert(cache->records.end(), record, record + reuseClass->size);
+
+    return napi_ok;
+  }
+
+  uint8_t *previous = &cache->records[(size_t)iter.first->second * reuseClass->size];
+
+  CHECK(napi_get_reference_value(env, cache->objects[iter.first->second], result));
+  CHECK(updateNumbers(env, cache, record, *result));
+  CHECK(updateFields(env, cache, record, previous, *result));
+
+  memcpy(previous, record, reuseClass->size);
+
+  return napi_ok;
+}
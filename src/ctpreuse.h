@@ -0,0 +1,64 @@
+/*
+ * ctpreuse.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __CTPREUSE_H__
+#define __CTPREUSE_H__
+
+#include "ctpfields.h"
+#include "napi_ctp.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef napi_status (*ReuseConverter)(napi_env env, const Message *message, napi_value *result);
+
+/*
+ * A CTP struct whose objects a listener keeps per instrument. convert builds
+ * the first object of an instrument, the numbers of later ticks are copied
+ * in by an updater compiled into the factory slot.
+ */
+typedef struct ReuseClass {
+  const CtpFields *table;
+  ReuseConverter convert;
+  size_t size;
+  int factory;
+} ReuseClass;
+
+/*
+ * The objects of one listener, one per instrument, with the record each
+ * one was last updated from. Only the JS thread touches it. compared lists
+ * the fields the updater does not copy, keys holds their names by field
+ * index, scratch is the ArrayBuffer the updater reads the numbers of the
+ * current tick from.
+ */
+typedef struct ReuseCache {
+  const ReuseClass *reuseClass;
+  const CtpField *instrument;
+  std::unordered_map<std::string, uint32_t> indexes;
+  std::vector<napi_ref> objects;
+  std::vector<uint8_t> records;
+  std::vector<uint32_t> compared;
+  napi_ref keys;
+  napi_ref views[3];
+  uint8_t *scratch;
+} ReuseCache;
+
+ReuseCache *createReuseCache(const ReuseClass *reuseClass);
+void freeReuseCache(napi_env env, ReuseCache *cache);
+
+/*
+ * Updates the object of the instrument of message in place and returns it,
+ * the first tick of an instrument creates it. Strings and chars are only
+ * set when their bytes changed, so an unchanged instrument allocates nothing.
+ */
+napi_status getReusedValue(napi_env env, ReuseCache *cache, const Message *message, napi_value *result);
+
+#endif /* __CTPREUSE_H__ */
@@ -0,0 +1,5664 @@
+/*
+ * ctpstructs.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+/*
+ * Generated by tools/ctpstructs.js from tradeapi/ThostFtdcUserApiStruct.h,
+ * do not edit. CTP_STRUCTS lists every struct as X(struct, size),
+ * CTP_FIELDS_<struct> its fields in declaration order as
+ * F(struct, field, type).
+ */
+
+#ifndef __CTPSTRUCTS_H__
+#define __CTPSTRUCTS_H__
+
+#define CTP_STRUCTS(X)                                                         \
+  X(CThostFtdcDisseminationField, 8)                                           \
+  X(CThostFtdcReqUserLoginField, 264)                                          \
+  X(CThostFtdcRspUserLoginField, 196)                                          \
+  X(CThostFtdcUserLogoutField, 27)                                             \
+  X(CThostFtdcForceUserLogoutField, 27)                                        \
+  X(CThostFtdcReqAuthenticateField, 88)                                        \
+  X(CThostFtdcRspAuthenticateField, 72)                                        \
+  X(CThostFtdcAuthenticationInfoField, 256)                                    \
+  X(CThostFtdcRspUserLogin2Field, 172)                                         \
+  X(CThostFtdcTransferHeaderField, 96)                                         \
+  X(CThostFtdcTransferBankToFutureReqField, 56)                                \
+  X(CThostFtdcTransferBankToFutureRspField, 176)                               \
+  X(CThostFtdcTransferFutureToBankReqField, 56)                                \
+  X(CThostFtdcTransferFutureToBankRspField, 176)                               \
+  X(CThostFtdcTransferQryBankReqField, 35)                                     \
+  X(CThostFtdcTransferQryBankRspField, 184)                                    \
+  X(CThostFtdcTransferQryDetailReqField, 13)                                   \
+  X(CThostFtdcTransferQryDetailRspField, 168)                                  \
+  X(CThostFtdcRspInfoField, 88)                                                \
+  X(CThostFtdcExchangeField, 71)                                               \
+  X(CThostFtdcProductField, 312)                                               \
+  X(CThostFtdcInstrumentField, 616)                                            \
+  X(CThostFtdcBrokerField, 108)                                                \
+  X(CThostFtdcTraderField, 100)                                                \
+  X(CThostFtdcInvestorField, 396)                                              \
+  X(CThostFtdcTradingCodeField, 76)                                            \
+  X(CThostFtdcPartBrokerField, 36)                                             \
+  X(CThostFtdcSuperUserField, 144)                                             \
+  X(CThostFtdcSuperUserFunctionField, 17)                                      \
+  X(CThostFtdcInvestorGroupField, 65)                                          \
+  X(CThostFtdcTradingAccountField, 400)                                        \
+  X(CThostFtdcInvestorPositionField, 472)                                      \
+  X(CThostFtdcInstrumentMarginRateField, 208)                                  \
+  X(CThostFtdcInstrumentCommissionRateField, 216)                              \
+  X(CThostFtdcDepthMarketDataField, 584)                                       \
+  X(CThostFtdcInstrumentTradingRightField, 138)                                \
+  X(CThostFtdcBrokerUserField, 124)                                            \
+  X(CThostFtdcBrokerUserPasswordField, 120)                                    \
+  X(CThostFtdcBrokerUserFunctionField, 28)                                     \
+  X(CThostFtdcTraderOfferField, 224)                                           \
+  X(CThostFtdcSettlementInfoField, 564)                                        \
+  X(CThostFtdcInstrumentMarginRateAdjustField, 184)                            \
+  X(CThostFtdcExchangeMarginRateField, 176)                                    \
+  X(CThostFtdcExchangeMarginRateAdjustField, 232)                              \
+  X(CThostFtdcExchangeRateField, 40)                                           \
+  X(CThostFtdcSettlementRefField, 16)                                          \
+  X(CThostFtdcCurrentTimeField, 36)                                            \
+  X(CThostFtdcCommPhaseField, 34)                                              \
+  X(CThostFtdcLoginInfoField, 420)                                             \
+  X(CThostFtdcLogoutAllField, 52)                                              \
+  X(CThostFtdcFrontStatusField, 28)                                            \
+  X(CThostFtdcUserPasswordUpdateField, 109)                                    \
+  X(CThostFtdcInputOrderField, 392)                                            \
+  X(CThostFtdcOrderField, 856)                                                 \
+  X(CThostFtdcExchangeOrderField, 504)                                         \
+  X(CThostFtdcExchangeOrderInsertErrorField, 152)                              \
+  X(CThostFtdcInputOrderActionField, 320)                                      \
+  X(CThostFtdcOrderActionField, 520)                                           \
+  X(CThostFtdcExchangeOrderActionField, 256)                                   \
+  X(CThostFtdcExchangeOrderActionErrorField, 172)                              \
+  X(CThostFtdcExchangeTradeField, 304)                                         \
+  X(CThostFtdcTradeField, 496)                                                 \
+  X(CThostFtdcUserSessionField, 192)                                           \
+  X(CThostFtdcQryMaxOrderVolumeField, 172)                                     \
+  X(CThostFtdcSettlementInfoConfirmField, 68)                                  \
+  X(CThostFtdcSyncDepositField, 104)                                           \
+  X(CThostFtdcSyncFundMortgageField, 64)                                       \
+  X(CThostFtdcBrokerSyncField, 11)                                             \
+  X(CThostFtdcSyncingInvestorField, 396)                                       \
+  X(CThostFtdcSyncingTradingCodeField, 52)                                     \
+  X(CThostFtdcSyncingInvestorGroupField, 65)                                   \
+  X(CThostFtdcSyncingTradingAccountField, 392)                                 \
+  X(CThostFtdcSyncingInvestorPositionField, 472)                               \
+  X(CThostFtdcSyncingInstrumentMarginRateField, 184)                           \
+  X(CThostFtdcSyncingInstrumentCommissionRateField, 192)                       \
+  X(CThostFtdcSyncingInstrumentTradingRightField, 138)                         \
+  X(CThostFtdcQryOrderField, 201)                                              \
+  X(CThostFtdcQryTradeField, 201)                                              \
+  X(CThostFtdcQryInvestorPositionField, 162)                                   \
+  X(CThostFtdcQryTradingAccountField, 42)                                      \
+  X(CThostFtdcQryInvestorField, 24)                                            \
+  X(CThostFtdcQryTradingCodeField, 62)                                         \
+  X(CThostFtdcQryInvestorGroupField, 11)                                       \
+  X(CThostFtdcQryInstrumentMarginRateField, 163)                               \
+  X(CThostFtdcQryInstrumentCommissionRateField, 162)                           \
+  X(CThostFtdcQryInstrumentTradingRightField, 136)                             \
+  X(CThostFtdcQryBrokerField, 11)                                              \
+  X(CThostFtdcQryTraderField, 41)                                              \
+  X(CThostFtdcQrySuperUserFunctionField, 16)                                   \
+  X(CThostFtdcQryUserSessionField, 36)                                         \
+  X(CThostFtdcQryPartBrokerField, 31)                                          \
+  X(CThostFtdcQryFrontStatusField, 4)                                          \
+  X(CThostFtdcQryExchangeOrderField, 164)                                      \
+  X(CThostFtdcQryOrderActionField, 33)                                         \
+  X(CThostFtdcQryExchangeOrderActionField, 52)                                 \
+  X(CThostFtdcQrySuperUserField, 16)                                           \
+  X(CThostFtdcQryExchangeField, 9)                                             \
+  X(CThostFtdcQryProductField, 122)                                            \
+  X(CThostFtdcQryInstrumentField, 345)                                         \
+  X(CThostFtdcQryDepthMarketDataField, 121)                                    \
+  X(CThostFtdcQryBrokerUserField, 27)                                          \
+  X(CThostFtdcQryBrokerUserFunctionField, 27)                                  \
+  X(CThostFtdcQryTraderOfferField, 41)                                         \
+  X(CThostFtdcQrySyncDepositField, 26)                                         \
+  X(CThostFtdcQrySettlementInfoField, 50)                                      \
+  X(CThostFtdcQryExchangeMarginRateField, 133)                                 \
+  X(CThostFtdcQryExchangeMarginRateAdjustField, 124)                           \
+  X(CThostFtdcQryExchangeRateField, 19)                                        \
+  X(CThostFtdcQrySyncFundMortgageField, 26)                                    \
+  X(CThostFtdcQryHisOrderField, 200)                                           \
+  X(CThostFtdcOptionInstrMiniMarginField, 160)                                 \
+  X(CThostFtdcOptionInstrMarginAdjustField, 216)                               \
+  X(CThostFtdcOptionInstrCommRateField, 232)                                   \
+  X(CThostFtdcOptionInstrTradeCostField, 208)                                  \
+  X(CThostFtdcQryOptionInstrTradeCostField, 184)                               \
+  X(CThostFtdcQryOptionInstrCommRateField, 162)                                \
+  X(CThostFtdcIndexPriceField, 144)                                            \
+  X(CThostFtdcInputExecOrderField, 324)                                        \
+  X(CThostFtdcInputExecOrderActionField, 304)                                  \
+  X(CThostFtdcExecOrderField, 704)                                             \
+  X(CThostFtdcExecOrderActionField, 508)                                       \
+  X(CThostFtdcQryExecOrderField, 184)                                          \
+  X(CThostFtdcExchangeExecOrderField, 384)                                     \
+  X(CThostFtdcQryExchangeExecOrderField, 164)                                  \
+  X(CThostFtdcQryExecOrderActionField, 33)                                     \
+  X(CThostFtdcExchangeExecOrderActionField, 360)                               \
+  X(CThostFtdcQryExchangeExecOrderActionField, 52)                             \
+  X(CThostFtdcErrExecOrderField, 412)                                          \
+  X(CThostFtdcQryErrExecOrderField, 24)                                        \
+  X(CThostFtdcErrExecOrderActionField, 388)                                    \
+  X(CThostFtdcQryErrExecOrderActionField, 24)                                  \
+  X(CThostFtdcOptionInstrTradingRightField, 139)                               \
+  X(CThostFtdcQryOptionInstrTradingRightField, 137)                            \
+  X(CThostFtdcInputForQuoteField, 261)                                         \
+  X(CThostFtdcForQuoteField, 568)                                              \
+  X(CThostFtdcQryForQuoteField, 180)                                           \
+  X(CThostFtdcExchangeForQuoteField, 272)                                      \
+  X(CThostFtdcQryExchangeForQuoteField, 164)                                   \
+  X(CThostFtdcInputQuoteField, 400)                                            \
+  X(CThostFtdcInputQuoteActionField, 316)                                      \
+  X(CThostFtdcQuoteField, 840)                                                 \
+  X(CThostFtdcQuoteActionField, 508)                                           \
+  X(CThostFtdcQryQuoteField, 201)                                              \
+  X(CThostFtdcExchangeQuoteField, 464)                                         \
+  X(CThostFtdcQryExchangeQuoteField, 164)                                      \
+  X(CThostFtdcQryQuoteActionField, 33)                                         \
+  X(CThostFtdcExchangeQuoteActionField, 232)                                   \
+  X(CThostFtdcQryExchangeQuoteActionField, 52)                                 \
+  X(CThostFtdcOptionInstrDeltaField, 152)                                      \
+  X(CThostFtdcForQuoteRspField, 169)                                           \
+  X(CThostFtdcStrikeOffsetField, 152)                                          \
+  X(CThostFtdcQryStrikeOffsetField, 136)                                       \
+  X(CThostFtdcInputBatchOrderActionField, 152)                                 \
+  X(CThostFtdcBatchOrderActionField, 336)                                      \
+  X(CThostFtdcExchangeBatchOrderActionField, 196)                              \
+  X(CThostFtdcQryBatchOrderActionField, 33)                                    \
+  X(CThostFtdcCombInstrumentGuardField, 152)                                   \
+  X(CThostFtdcQryCombInstrumentGuardField, 132)                                \
+  X(CThostFtdcInputCombActionField, 284)                                       \
+  X(CThostFtdcCombActionField, 604)                                            \
+  X(CThostFtdcQryCombActionField, 162)                                         \
+  X(CThostFtdcExchangeCombActionField, 324)                                    \
+  X(CThostFtdcQryExchangeCombActionField, 164)                                 \
+  X(CThostFtdcProductExchRateField, 144)                                       \
+  X(CThostFtdcQryProductExchRateField, 121)                                    \
+  X(CThostFtdcQryForQuoteParamField, 132)                                      \
+  X(CThostFtdcForQuoteParamField, 160)                                         \
+  X(CThostFtdcMMOptionInstrCommRateField, 208)                                 \
+  X(CThostFtdcQryMMOptionInstrCommRateField, 136)                              \
+  X(CThostFtdcMMInstrumentCommissionRateField, 192)                            \
+  X(CThostFtdcQryMMInstrumentCommissionRateField, 136)                         \
+  X(CThostFtdcInstrumentOrderCommRateField, 208)                               \
+  X(CThostFtdcQryInstrumentOrderCommRateField, 136)                            \
+  X(CThostFtdcTradeParamField, 429)                                            \
+  X(CThostFtdcInstrumentMarginRateULField, 184)                                \
+  X(CThostFtdcFutureLimitPosiParamField, 152)                                  \
+  X(CThostFtdcLoginForbiddenIPField, 49)                                       \
+  X(CThostFtdcIPListField, 56)                                                 \
+  X(CThostFtdcInputOptionSelfCloseField, 320)                                  \
+  X(CThostFtdcInputOptionSelfCloseActionField, 304)                            \
+  X(CThostFtdcOptionSelfCloseField, 700)                                       \
+  X(CThostFtdcOptionSelfCloseActionField, 508)                                 \
+  X(CThostFtdcQryOptionSelfCloseField, 184)                                    \
+  X(CThostFtdcExchangeOptionSelfCloseField, 380)                               \
+  X(CThostFtdcQryOptionSelfCloseActionField, 33)                               \
+  X(CThostFtdcExchangeOptionSelfCloseActionField, 356)                         \
+  X(CThostFtdcSyncDelaySwapField, 96)                                          \
+  X(CThostFtdcQrySyncDelaySwapField, 26)                                       \
+  X(CThostFtdcInvestUnitField, 178)                                            \
+  X(CThostFtdcQryInvestUnitField, 41)                                          \
+  X(CThostFtdcSecAgentCheckModeField, 48)                                      \
+  X(CThostFtdcSecAgentTradeInfoField, 198)                                     \
+  X(CThostFtdcMarketDataField, 400)                                            \
+  X(CThostFtdcMarketDataBaseField, 48)                                         \
+  X(CThostFtdcMarketDataStaticField, 64)                                       \
+  X(CThostFtdcMarketDataLastMatchField, 32)                                    \
+  X(CThostFtdcMarketDataBestPriceField, 32)                                    \
+  X(CThostFtdcMarketDataBid23Field, 32)                                        \
+  X(CThostFtdcMarketDataAsk23Field, 32)                                        \
+  X(CThostFtdcMarketDataBid45Field, 32)                                        \
+  X(CThostFtdcMarketDataAsk45Field, 32)                                        \
+  X(CThostFtdcMarketDataUpdateTimeField, 136)                                  \
+  X(CThostFtdcMarketDataBandingPriceField, 16)                                 \
+  X(CThostFtdcMarketDataExchangeField, 9)                                      \
+  X(CThostFtdcSpecificInstrumentField, 112)                                    \
+  X(CThostFtdcInstrumentStatusField, 260)                                      \
+  X(CThostFtdcQryInstrumentStatusField, 121)                                   \
+  X(CThostFtdcInvestorAccountField, 41)                                        \
+  X(CThostFtdcPositionProfitAlgorithmField, 190)                               \
+  X(CThostFtdcDiscountField, 40)                                               \
+  X(CThostFtdcQryTransferBankField, 9)                                         \
+  X(CThostFtdcTransferBankField, 116)                                          \
+  X(CThostFtdcQryInvestorPositionDetailField, 162)                             \
+  X(CThostFtdcInvestorPositionDetailField, 448)                                \
+  X(CThostFtdcTradingAccountPasswordField, 69)                                 \
+  X(CThostFtdcMDTraderOfferField, 224)                                         \
+  X(CThostFtdcQryMDTraderOfferField, 41)                                       \
+  X(CThostFtdcQryNoticeField, 11)                                              \
+  X(CThostFtdcNoticeField, 514)                                                \
+  X(CThostFtdcUserRightField, 32)                                              \
+  X(CThostFtdcQrySettlementInfoConfirmField, 41)                               \
+  X(CThostFtdcLoadSettlementInfoField, 11)                                     \
+  X(CThostFtdcBrokerWithdrawAlgorithmField, 56)                                \
+  X(CThostFtdcTradingAccountPasswordUpdateV1Field, 106)                        \
+  X(CThostFtdcTradingAccountPasswordUpdateField, 110)                          \
+  X(CThostFtdcQryCombinationLegField, 232)                                     \
+  X(CThostFtdcQrySyncStatusField, 9)                                           \
+  X(CThostFtdcCombinationLegField, 240)                                        \
+  X(CThostFtdcSyncStatusField, 10)                                             \
+  X(CThostFtdcQryLinkManField, 24)                                             \
+  X(CThostFtdcLinkManField, 424)                                               \
+  X(CThostFtdcQryBrokerUserEventField, 28)                                     \
+  X(CThostFtdcBrokerUserEventField, 1200)                                      \
+  X(CThostFtdcQryContractBankField, 20)                                        \
+  X(CThostFtdcContractBankField, 121)                                          \
+  X(CThostFtdcInvestorPositionCombineDetailField, 392)                         \
+  X(CThostFtdcParkedOrderField, 488)                                           \
+  X(CThostFtdcParkedOrderActionField, 424)                                     \
+  X(CThostFtdcQryParkedOrderField, 162)                                        \
+  X(CThostFtdcQryParkedOrderActionField, 162)                                  \
+  X(CThostFtdcRemoveParkedOrderField, 54)                                      \
+  X(CThostFtdcRemoveParkedOrderActionField, 54)                                \
+  X(CThostFtdcInvestorWithdrawAlgorithmField, 56)                              \
+  X(CThostFtdcQryInvestorPositionCombineDetailField, 162)                      \
+  X(CThostFtdcMarketDataAveragePriceField, 8)                                  \
+  X(CThostFtdcVerifyInvestorPasswordField, 65)                                 \
+  X(CThostFtdcUserIPField, 146)                                                \
+  X(CThostFtdcTradingNoticeInfoField, 560)                                     \
+  X(CThostFtdcTradingNoticeField, 580)                                         \
+  X(CThostFtdcQryTradingNoticeField, 41)                                       \
+  X(CThostFtdcQryErrOrderField, 24)                                            \
+  X(CThostFtdcErrOrderField, 480)                                              \
+  X(CThostFtdcErrorConditionalOrderField, 944)                                 \
+  X(CThostFtdcQryErrOrderActionField, 24)                                      \
+  X(CThostFtdcErrOrderActionField, 608)                                        \
+  X(CThostFtdcQryExchangeSequenceField, 9)                                     \
+  X(CThostFtdcExchangeSequenceField, 20)                                       \
+  X(CThostFtdcQryMaxOrderVolumeWithPriceField, 184)                            \
+  X(CThostFtdcQryBrokerTradingParamsField, 41)                                 \
+  X(CThostFtdcBrokerTradingParamsField, 45)                                    \
+  X(CThostFtdcQryBrokerTradingAlgosField, 132)                                 \
+  X(CThostFtdcBrokerTradingAlgosField, 135)                                    \
+  X(CThostFtdcQueryBrokerDepositField, 20)                                     \
+  X(CThostFtdcBrokerDepositField, 112)                                         \
+  X(CThostFtdcQryCFMMCBrokerKeyField, 11)                                      \
+  X(CThostFtdcCFMMCBrokerKeyField, 68)                                         \
+  X(CThostFtdcCFMMCTradingAccountKeyField, 64)                                 \
+  X(CThostFtdcQryCFMMCTradingAccountKeyField, 24)                              \
+  X(CThostFtdcBrokerUserOTPParamField, 100)                                    \
+  X(CThostFtdcManualSyncBrokerUserOTPField, 110)                               \
+  X(CThostFtdcCommRateModelField, 185)                                         \
+  X(CThostFtdcQryCommRateModelField, 24)                                       \
+  X(CThostFtdcMarginModelField, 185)                                           \
+  X(CThostFtdcQryMarginModelField, 24)                                         \
+  X(CThostFtdcEWarrantOffsetField, 180)                                        \
+  X(CThostFtdcQryEWarrantOffsetField, 162)                                     \
+  X(CThostFtdcQryInvestorProductGroupMarginField, 163)                         \
+  X(CThostFtdcInvestorProductGroupMarginField, 352)                            \
+  X(CThostFtdcQueryCFMMCTradingAccountTokenField, 41)                          \
+  X(CThostFtdcCFMMCTradingAccountTokenField, 64)                               \
+  X(CThostFtdcQryProductGroupField, 121)                                       \
+  X(CThostFtdcProductGroupField, 233)                                          \
+  X(CThostFtdcBulletinField, 876)                                              \
+  X(CThostFtdcQryBulletinField, 24)                                            \
+  X(CThostFtdcMulticastInstrumentField, 152)                                   \
+  X(CThostFtdcQryMulticastInstrumentField, 116)                                \
+  X(CThostFtdcAppIDAuthAssignField, 48)                                        \
+  X(CThostFtdcReqOpenAccountField, 956)                                        \
+  X(CThostFtdcReqCancelAccountField, 956)                                      \
+  X(CThostFtdcReqChangeAccountField, 960)                                      \
+  X(CThostFtdcReqTransferField, 864)                                           \
+  X(CThostFtdcRspTransferField, 952)                                           \
+  X(CThostFtdcReqRepealField, 904)                                             \
+  X(CThostFtdcRspRepealField, 992)                                             \
+  X(CThostFtdcReqQueryAccountField, 688)                                       \
+  X(CThostFtdcRspQueryAccountField, 712)                                       \
+  X(CThostFtdcFutureSignIOField, 236)                                          \
+  X(CThostFtdcRspFutureSignInField, 580)                                       \
+  X(CThostFtdcReqFutureSignOutField, 236)                                      \
+  X(CThostFtdcRspFutureSignOutField, 324)                                      \
+  X(CThostFtdcReqQueryTradeResultBySerialField, 608)                           \
+  X(CThostFtdcRspQueryTradeResultBySerialField, 568)                           \
+  X(CThostFtdcReqDayEndFileReadyField, 152)                                    \
+  X(CThostFtdcReturnResultField, 136)                                          \
+  X(CThostFtdcVerifyFuturePasswordField, 260)                                  \
+  X(CThostFtdcVerifyCustInfoField, 265)                                        \
+  X(CThostFtdcVerifyFuturePasswordAndCustInfoField, 323)                       \
+  X(CThostFtdcDepositResultInformField, 192)                                   \
+  X(CThostFtdcReqSyncKeyField, 324)                                            \
+  X(CThostFtdcRspSyncKeyField, 412)                                            \
+  X(CThostFtdcNotifyQueryAccountField, 792)                                    \
+  X(CThostFtdcTransferSerialField, 416)                                        \
+  X(CThostFtdcQryTransferSerialField, 32)                                      \
+  X(CThostFtdcNotifyFutureSignInField, 580)                                    \
+  X(CThostFtdcNotifyFutureSignOutField, 324)                                   \
+  X(CThostFtdcNotifySyncKeyField, 412)                                         \
+  X(CThostFtdcQryAccountregisterField, 37)                                     \
+  X(CThostFtdcAccountregisterField, 408)                                       \
+  X(CThostFtdcOpenAccountField, 1040)                                          \
+  X(CThostFtdcCancelAccountField, 1040)                                        \
+  X(CThostFtdcChangeAccountField, 1044)                                        \
+  X(CThostFtdcSecAgentACIDMapField, 57)                                        \
+  X(CThostFtdcQrySecAgentACIDMapField, 44)                                     \
+  X(CThostFtdcUserRightsAssignField, 32)                                       \
+  X(CThostFtdcBrokerUserRightAssignField, 20)                                  \
+  X(CThostFtdcDRTransferField, 32)                                             \
+  X(CThostFtdcFensUserInfoField, 28)                                           \
+  X(CThostFtdcCurrTransferIdentityField, 4)                                    \
+  X(CThostFtdcLoginForbiddenUserField, 76)                                     \
+  X(CThostFtdcQryLoginForbiddenUserField, 27)                                  \
+  X(CThostFtdcTradingAccountReserveField, 40)                                  \
+  X(CThostFtdcQryLoginForbiddenIPField, 49)                                    \
+  X(CThostFtdcQryIPListField, 49)                                              \
+  X(CThostFtdcQryUserRightsAssignField, 27)                                    \
+  X(CThostFtdcReserveOpenAccountConfirmField, 976)                             \
+  X(CThostFtdcReserveOpenAccountField, 860)                                    \
+  X(CThostFtdcAccountPropertyField, 384)                                       \
+  X(CThostFtdcQryCurrDRIdentityField, 4)                                       \
+  X(CThostFtdcCurrDRIdentityField, 4)                                          \
+  X(CThostFtdcQrySecAgentCheckModeField, 24)                                   \
+  X(CThostFtdcQrySecAgentTradeInfoField, 24)                                   \
+  X(CThostFtdcReqUserAuthMethodField, 36)                                      \
+  X(CThostFtdcRspUserAuthMethodField, 4)                                       \
+  X(CThostFtdcReqGenUserCaptchaField, 36)                                      \
+  X(CThostFtdcRspGenUserCaptchaField, 2596)                                    \
+  X(CThostFtdcReqGenUserTextField, 36)                                         \
+  X(CThostFtdcRspGenUserTextField, 4)                                          \
+  X(CThostFtdcReqUserLoginWithCaptchaField, 264)                               \
+  X(CThostFtdcReqUserLoginWithTextField, 264)                                  \
+  X(CThostFtdcReqUserLoginWithOTPField, 264)                                   \
+  X(CThostFtdcReqApiHandshakeField, 31)                                        \
+  X(CThostFtdcRspApiHandshakeField, 312)                                       \
+  X(CThostFtdcReqVerifyApiKeyField, 308)                                       \
+  X(CThostFtdcDepartmentUserField, 41)                                         \
+  X(CThostFtdcQueryFreqField, 4)                                               \
+  X(CThostFtdcAuthForbiddenIPField, 33)                                        \
+  X(CThostFtdcQryAuthForbiddenIPField, 33)                                     \
+  X(CThostFtdcSyncDelaySwapFrozenField, 64)                                    \
+  X(CThostFtdcUserSystemInfoField, 556)                                        \
+  X(CThostFtdcAuthUserIDField, 61)                                             \
+  X(CThostFtdcAuthIPField, 77)                                                 \
+  X(CThostFtdcQryClassifiedInstrumentField, 254)                               \
+  X(CThostFtdcQryCombPromotionParamField, 90)                                  \
+  X(CThostFtdcCombPromotionParamField, 104)                                    \
+  X(CThostFtdcReqUserLoginSCField, 300)                                        \
+  X(CThostFtdcQryRiskSettleInvstPositionField, 105)                            \
+  X(CThostFtdcQryRiskSettleProductStatusField, 81)                             \
+  X(CThostFtdcRiskSettleInvstPositionField, 432)                               \
+  X(CThostFtdcRiskSettleProductStatusField, 91)                                \
+  X(CThostFtdcSyncDeltaInfoField, 268)                                         \
+  X(CThostFtdcSyncDeltaProductStatusField, 96)                                 \
+  X(CThostFtdcSyncDeltaInvstPosDtlField, 376)                                  \
+  X(CThostFtdcSyncDeltaInvstPosCombDtlField, 248)                              \
+  X(CThostFtdcSyncDeltaTradingAccountField, 400)                               \
+  X(CThostFtdcSyncDeltaInitInvstMarginField, 128)                              \
+  X(CThostFtdcSyncDeltaDceCombInstrumentField, 280)                            \
+  X(CThostFtdcSyncDeltaInvstMarginRateField, 160)                              \
+  X(CThostFtdcSyncDeltaExchMarginRateField, 136)                               \
+  X(CThostFtdcSyncDeltaOptExchMarginField, 168)                                \
+  X(CThostFtdcSyncDeltaOptInvstMarginField, 192)                               \
+  X(CThostFtdcSyncDeltaInvstMarginRateULField, 152)                            \
+  X(CThostFtdcSyncDeltaOptInvstCommRateField, 184)                             \
+  X(CThostFtdcSyncDeltaInvstCommRateField, 168)                                \
+  X(CThostFtdcSyncDeltaProductExchRateField, 104)                              \
+  X(CThostFtdcSyncDeltaDepthMarketDataField, 536)                              \
+  X(CThostFtdcSyncDeltaIndexPriceField, 112)                                   \
+  X(CThostFtdcSyncDeltaEWarrantOffsetField, 140)
+
+#define CTP_FIELDS_CThostFtdcDisseminationField(F)                             \
+  F(CThostFtdcDisseminationField, SequenceSeries, CTP_FIELD_INT16)             \
+  F(CThostFtdcDisseminationField, SequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcReqUserLoginField(F)                              \
+  F(CThostFtdcReqUserLoginField, TradingDay, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqUserLoginField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqUserLoginField, UserID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqUserLoginField, Password, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqUserLoginField, UserProductInfo, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserLoginField, InterfaceProductInfo, CTP_FIELD_STRING)       \
+  F(CThostFtdcReqUserLoginField, ProtocolInfo, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqUserLoginField, MacAddress, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqUserLoginField, OneTimePassword, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserLoginField, reserve1, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqUserLoginField, LoginRemark, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqUserLoginField, ClientIPPort, CTP_FIELD_INT32)                \
+  F(CThostFtdcReqUserLoginField, ClientIPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspUserLoginField(F)                              \
+  F(CThostFtdcRspUserLoginField, TradingDay, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspUserLoginField, LoginTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspUserLoginField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLoginField, UserID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspUserLoginField, SystemName, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspUserLoginField, FrontID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcRspUserLoginField, SessionID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcRspUserLoginField, MaxOrderRef, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspUserLoginField, SHFETime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLoginField, DCETime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspUserLoginField, CZCETime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLoginField, FFEXTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLoginField, INETime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspUserLoginField, SysVersion, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcUserLogoutField(F)                                \
+  F(CThostFtdcUserLogoutField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcUserLogoutField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcForceUserLogoutField(F)                           \
+  F(CThostFtdcForceUserLogoutField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcForceUserLogoutField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqAuthenticateField(F)                           \
+  F(CThostFtdcReqAuthenticateField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqAuthenticateField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqAuthenticateField, UserProductInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqAuthenticateField, AuthCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqAuthenticateField, AppID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspAuthenticateField(F)                           \
+  F(CThostFtdcRspAuthenticateField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspAuthenticateField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspAuthenticateField, UserProductInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcRspAuthenticateField, AppID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspAuthenticateField, AppType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcAuthenticationInfoField(F)                        \
+  F(CThostFtdcAuthenticationInfoField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcAuthenticationInfoField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcAuthenticationInfoField, UserProductInfo, CTP_FIELD_STRING)      \
+  F(CThostFtdcAuthenticationInfoField, AuthInfo, CTP_FIELD_STRING)             \
+  F(CThostFtdcAuthenticationInfoField, IsResult, CTP_FIELD_INT32)              \
+  F(CThostFtdcAuthenticationInfoField, AppID, CTP_FIELD_STRING)                \
+  F(CThostFtdcAuthenticationInfoField, AppType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcAuthenticationInfoField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcAuthenticationInfoField, ClientIPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspUserLogin2Field(F)                             \
+  F(CThostFtdcRspUserLogin2Field, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspUserLogin2Field, LoginTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspUserLogin2Field, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspUserLogin2Field, UserID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspUserLogin2Field, SystemName, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspUserLogin2Field, FrontID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcRspUserLogin2Field, SessionID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcRspUserLogin2Field, MaxOrderRef, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspUserLogin2Field, SHFETime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspUserLogin2Field, DCETime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLogin2Field, CZCETime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspUserLogin2Field, FFEXTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspUserLogin2Field, INETime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspUserLogin2Field, RandomString, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferHeaderField(F)                            \
+  F(CThostFtdcTransferHeaderField, Version, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTransferHeaderField, TradeCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferHeaderField, TradeDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferHeaderField, TradeTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferHeaderField, TradeSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcTransferHeaderField, FutureID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTransferHeaderField, BankID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTransferHeaderField, BankBrchID, CTP_FIELD_STRING)               \
+  F(CThostFtdcTransferHeaderField, OperNo, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTransferHeaderField, DeviceID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTransferHeaderField, RecordNum, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferHeaderField, SessionID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcTransferHeaderField, RequestID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcTransferBankToFutureReqField(F)                   \
+  F(CThostFtdcTransferBankToFutureReqField, FutureAccount, CTP_FIELD_STRING)   \
+  F(CThostFtdcTransferBankToFutureReqField, FuturePwdFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcTransferBankToFutureReqField, FutureAccPwd, CTP_FIELD_STRING)    \
+  F(CThostFtdcTransferBankToFutureReqField, TradeAmt, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTransferBankToFutureReqField, CustFee, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTransferBankToFutureReqField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferBankToFutureRspField(F)                   \
+  F(CThostFtdcTransferBankToFutureRspField, RetCode, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferBankToFutureRspField, RetInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferBankToFutureRspField, FutureAccount, CTP_FIELD_STRING)   \
+  F(CThostFtdcTransferBankToFutureRspField, TradeAmt, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTransferBankToFutureRspField, CustFee, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTransferBankToFutureRspField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferFutureToBankReqField(F)                   \
+  F(CThostFtdcTransferFutureToBankReqField, FutureAccount, CTP_FIELD_STRING)   \
+  F(CThostFtdcTransferFutureToBankReqField, FuturePwdFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcTransferFutureToBankReqField, FutureAccPwd, CTP_FIELD_STRING)    \
+  F(CThostFtdcTransferFutureToBankReqField, TradeAmt, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTransferFutureToBankReqField, CustFee, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTransferFutureToBankReqField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferFutureToBankRspField(F)                   \
+  F(CThostFtdcTransferFutureToBankRspField, RetCode, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferFutureToBankRspField, RetInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferFutureToBankRspField, FutureAccount, CTP_FIELD_STRING)   \
+  F(CThostFtdcTransferFutureToBankRspField, TradeAmt, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTransferFutureToBankRspField, CustFee, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTransferFutureToBankRspField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferQryBankReqField(F)                        \
+  F(CThostFtdcTransferQryBankReqField, FutureAccount, CTP_FIELD_STRING)        \
+  F(CThostFtdcTransferQryBankReqField, FuturePwdFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcTransferQryBankReqField, FutureAccPwd, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferQryBankReqField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferQryBankRspField(F)                        \
+  F(CThostFtdcTransferQryBankRspField, RetCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcTransferQryBankRspField, RetInfo, CTP_FIELD_STRING)              \
+  F(CThostFtdcTransferQryBankRspField, FutureAccount, CTP_FIELD_STRING)        \
+  F(CThostFtdcTransferQryBankRspField, TradeAmt, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcTransferQryBankRspField, UseAmt, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTransferQryBankRspField, FetchAmt, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcTransferQryBankRspField, CurrencyCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferQryDetailReqField(F)                      \
+  F(CThostFtdcTransferQryDetailReqField, FutureAccount, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferQryDetailRspField(F)                      \
+  F(CThostFtdcTransferQryDetailRspField, TradeDate, CTP_FIELD_STRING)          \
+  F(CThostFtdcTransferQryDetailRspField, TradeTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcTransferQryDetailRspField, TradeCode, CTP_FIELD_STRING)          \
+  F(CThostFtdcTransferQryDetailRspField, FutureSerial, CTP_FIELD_INT32)        \
+  F(CThostFtdcTransferQryDetailRspField, FutureID, CTP_FIELD_STRING)           \
+  F(CThostFtdcTransferQryDetailRspField, FutureAccount, CTP_FIELD_STRING)      \
+  F(CThostFtdcTransferQryDetailRspField, BankSerial, CTP_FIELD_INT32)          \
+  F(CThostFtdcTransferQryDetailRspField, BankID, CTP_FIELD_STRING)             \
+  F(CThostFtdcTransferQryDetailRspField, BankBrchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferQryDetailRspField, BankAccount, CTP_FIELD_STRING)        \
+  F(CThostFtdcTransferQryDetailRspField, CertCode, CTP_FIELD_STRING)           \
+  F(CThostFtdcTransferQryDetailRspField, CurrencyCode, CTP_FIELD_STRING)       \
+  F(CThostFtdcTransferQryDetailRspField, TxAmount, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTransferQryDetailRspField, Flag, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcRspInfoField(F)                                   \
+  F(CThostFtdcRspInfoField, ErrorID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcRspInfoField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeField(F)                                  \
+  F(CThostFtdcExchangeField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcExchangeField, ExchangeName, CTP_FIELD_STRING)                   \
+  F(CThostFtdcExchangeField, ExchangeProperty, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcProductField(F)                                   \
+  F(CThostFtdcProductField, reserve1, CTP_FIELD_STRING)                        \
+  F(CThostFtdcProductField, ProductName, CTP_FIELD_STRING)                     \
+  F(CThostFtdcProductField, ExchangeID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcProductField, ProductClass, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcProductField, VolumeMultiple, CTP_FIELD_INT32)                   \
+  F(CThostFtdcProductField, PriceTick, CTP_FIELD_DOUBLE)                       \
+  F(CThostFtdcProductField, MaxMarketOrderVolume, CTP_FIELD_INT32)             \
+  F(CThostFtdcProductField, MinMarketOrderVolume, CTP_FIELD_INT32)             \
+  F(CThostFtdcProductField, MaxLimitOrderVolume, CTP_FIELD_INT32)              \
+  F(CThostFtdcProductField, MinLimitOrderVolume, CTP_FIELD_INT32)              \
+  F(CThostFtdcProductField, PositionType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcProductField, PositionDateType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcProductField, CloseDealType, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcProductField, TradeCurrencyID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcProductField, MortgageFundUseRange, CTP_FIELD_CHAR)              \
+  F(CThostFtdcProductField, reserve2, CTP_FIELD_STRING)                        \
+  F(CThostFtdcProductField, UnderlyingMultiple, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcProductField, ProductID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcProductField, ExchangeProductID, CTP_FIELD_STRING)               \
+  F(CThostFtdcProductField, OpenLimitControlLevel, CTP_FIELD_CHAR)             \
+  F(CThostFtdcProductField, OrderFreqControlLevel, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcInstrumentField(F)                                \
+  F(CThostFtdcInstrumentField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInstrumentField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInstrumentField, InstrumentName, CTP_FIELD_STRING)               \
+  F(CThostFtdcInstrumentField, reserve2, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInstrumentField, reserve3, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInstrumentField, ProductClass, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcInstrumentField, DeliveryYear, CTP_FIELD_INT32)                  \
+  F(CThostFtdcInstrumentField, DeliveryMonth, CTP_FIELD_INT32)                 \
+  F(CThostFtdcInstrumentField, MaxMarketOrderVolume, CTP_FIELD_INT32)          \
+  F(CThostFtdcInstrumentField, MinMarketOrderVolume, CTP_FIELD_INT32)          \
+  F(CThostFtdcInstrumentField, MaxLimitOrderVolume, CTP_FIELD_INT32)           \
+  F(CThostFtdcInstrumentField, MinLimitOrderVolume, CTP_FIELD_INT32)           \
+  F(CThostFtdcInstrumentField, VolumeMultiple, CTP_FIELD_INT32)                \
+  F(CThostFtdcInstrumentField, PriceTick, CTP_FIELD_DOUBLE)                    \
+  F(CThostFtdcInstrumentField, CreateDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInstrumentField, OpenDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInstrumentField, ExpireDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInstrumentField, StartDelivDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcInstrumentField, EndDelivDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInstrumentField, InstLifePhase, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInstrumentField, IsTrading, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInstrumentField, PositionType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcInstrumentField, PositionDateType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcInstrumentField, LongMarginRatio, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcInstrumentField, ShortMarginRatio, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcInstrumentField, MaxMarginSideAlgorithm, CTP_FIELD_CHAR)         \
+  F(CThostFtdcInstrumentField, reserve4, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInstrumentField, StrikePrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcInstrumentField, OptionsType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcInstrumentField, UnderlyingMultiple, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcInstrumentField, CombinationType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcInstrumentField, InstrumentID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInstrumentField, ExchangeInstID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInstrumentField, ProductID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInstrumentField, UnderlyingInstrID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerField(F)                                    \
+  F(CThostFtdcBrokerField, BrokerID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcBrokerField, BrokerAbbr, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBrokerField, BrokerName, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBrokerField, IsActive, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcTraderField(F)                                    \
+  F(CThostFtdcTraderField, ExchangeID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcTraderField, TraderID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcTraderField, ParticipantID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTraderField, Password, CTP_FIELD_STRING)                         \
+  F(CThostFtdcTraderField, InstallCount, CTP_FIELD_INT32)                      \
+  F(CThostFtdcTraderField, BrokerID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcTraderField, OrderCancelAlg, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcInvestorField(F)                                  \
+  F(CThostFtdcInvestorField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInvestorField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcInvestorField, InvestorGroupID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInvestorField, InvestorName, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInvestorField, IdentifiedCardType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcInvestorField, IdentifiedCardNo, CTP_FIELD_STRING)               \
+  F(CThostFtdcInvestorField, IsActive, CTP_FIELD_INT32)                        \
+  F(CThostFtdcInvestorField, Telephone, CTP_FIELD_STRING)                      \
+  F(CThostFtdcInvestorField, Address, CTP_FIELD_STRING)                        \
+  F(CThostFtdcInvestorField, OpenDate, CTP_FIELD_STRING)                       \
+  F(CThostFtdcInvestorField, Mobile, CTP_FIELD_STRING)                         \
+  F(CThostFtdcInvestorField, CommModelID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInvestorField, MarginModelID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInvestorField, IsOrderFreq, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcInvestorField, IsOpenVolLimit, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcTradingCodeField(F)                               \
+  F(CThostFtdcTradingCodeField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTradingCodeField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTradingCodeField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTradingCodeField, ClientID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTradingCodeField, IsActive, CTP_FIELD_INT32)                     \
+  F(CThostFtdcTradingCodeField, ClientIDType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcTradingCodeField, BranchID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTradingCodeField, BizType, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcTradingCodeField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcPartBrokerField(F)                                \
+  F(CThostFtdcPartBrokerField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcPartBrokerField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcPartBrokerField, ParticipantID, CTP_FIELD_STRING)                \
+  F(CThostFtdcPartBrokerField, IsActive, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSuperUserField(F)                                 \
+  F(CThostFtdcSuperUserField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcSuperUserField, UserName, CTP_FIELD_STRING)                      \
+  F(CThostFtdcSuperUserField, Password, CTP_FIELD_STRING)                      \
+  F(CThostFtdcSuperUserField, IsActive, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSuperUserFunctionField(F)                         \
+  F(CThostFtdcSuperUserFunctionField, UserID, CTP_FIELD_STRING)                \
+  F(CThostFtdcSuperUserFunctionField, FunctionCode, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcInvestorGroupField(F)                             \
+  F(CThostFtdcInvestorGroupField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInvestorGroupField, InvestorGroupID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInvestorGroupField, InvestorGroupName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingAccountField(F)                            \
+  F(CThostFtdcTradingAccountField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTradingAccountField, AccountID, CTP_FIELD_STRING)                \
+  F(CThostFtdcTradingAccountField, PreMortgage, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcTradingAccountField, PreCredit, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcTradingAccountField, PreDeposit, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, PreBalance, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, PreMargin, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcTradingAccountField, InterestBase, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcTradingAccountField, Interest, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcTradingAccountField, Deposit, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcTradingAccountField, Withdraw, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcTradingAccountField, FrozenMargin, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcTradingAccountField, FrozenCash, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, FrozenCommission, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTradingAccountField, CurrMargin, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, CashIn, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcTradingAccountField, Commission, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, CloseProfit, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcTradingAccountField, PositionProfit, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountField, Balance, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcTradingAccountField, Available, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcTradingAccountField, WithdrawQuota, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcTradingAccountField, Reserve, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcTradingAccountField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcTradingAccountField, SettlementID, CTP_FIELD_INT32)              \
+  F(CThostFtdcTradingAccountField, Credit, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcTradingAccountField, Mortgage, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcTradingAccountField, ExchangeMargin, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountField, DeliveryMargin, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountField, ExchangeDeliveryMargin, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcTradingAccountField, ReserveBalance, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountField, CurrencyID, CTP_FIELD_STRING)               \
+  F(CThostFtdcTradingAccountField, PreFundMortgageIn, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTradingAccountField, PreFundMortgageOut, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcTradingAccountField, FundMortgageIn, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountField, FundMortgageOut, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcTradingAccountField, FundMortgageAvailable, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcTradingAccountField, MortgageableFund, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcTradingAccountField, SpecProductMargin, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcTradingAccountField, SpecProductFrozenMargin, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcTradingAccountField, SpecProductCommission, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcTradingAccountField, SpecProductFrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcTradingAccountField, SpecProductPositionProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcTradingAccountField, SpecProductCloseProfit, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcTradingAccountField, SpecProductPositionProfitByAlg, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcTradingAccountField, SpecProductExchangeMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcTradingAccountField, BizType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcTradingAccountField, FrozenSwap, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcTradingAccountField, RemainSwap, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcInvestorPositionField(F)                          \
+  F(CThostFtdcInvestorPositionField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcInvestorPositionField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInvestorPositionField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInvestorPositionField, PosiDirection, CTP_FIELD_CHAR)            \
+  F(CThostFtdcInvestorPositionField, HedgeFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcInvestorPositionField, PositionDate, CTP_FIELD_CHAR)             \
+  F(CThostFtdcInvestorPositionField, YdPosition, CTP_FIELD_INT32)              \
+  F(CThostFtdcInvestorPositionField, Position, CTP_FIELD_INT32)                \
+  F(CThostFtdcInvestorPositionField, LongFrozen, CTP_FIELD_INT32)              \
+  F(CThostFtdcInvestorPositionField, ShortFrozen, CTP_FIELD_INT32)             \
+  F(CThostFtdcInvestorPositionField, LongFrozenAmount, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcInvestorPositionField, ShortFrozenAmount, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcInvestorPositionField, OpenVolume, CTP_FIELD_INT32)              \
+  F(CThostFtdcInvestorPositionField, CloseVolume, CTP_FIELD_INT32)             \
+  F(CThostFtdcInvestorPositionField, OpenAmount, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcInvestorPositionField, CloseAmount, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcInvestorPositionField, PositionCost, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcInvestorPositionField, PreMargin, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcInvestorPositionField, UseMargin, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcInvestorPositionField, FrozenMargin, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcInvestorPositionField, FrozenCash, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcInvestorPositionField, FrozenCommission, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcInvestorPositionField, CashIn, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcInvestorPositionField, Commission, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcInvestorPositionField, CloseProfit, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcInvestorPositionField, PositionProfit, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcInvestorPositionField, PreSettlementPrice, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcInvestorPositionField, SettlementPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcInvestorPositionField, TradingDay, CTP_FIELD_STRING)             \
+  F(CThostFtdcInvestorPositionField, SettlementID, CTP_FIELD_INT32)            \
+  F(CThostFtdcInvestorPositionField, OpenCost, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcInvestorPositionField, ExchangeMargin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcInvestorPositionField, CombPosition, CTP_FIELD_INT32)            \
+  F(CThostFtdcInvestorPositionField, CombLongFrozen, CTP_FIELD_INT32)          \
+  F(CThostFtdcInvestorPositionField, CombShortFrozen, CTP_FIELD_INT32)         \
+  F(CThostFtdcInvestorPositionField, CloseProfitByDate, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcInvestorPositionField, CloseProfitByTrade, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcInvestorPositionField, TodayPosition, CTP_FIELD_INT32)           \
+  F(CThostFtdcInvestorPositionField, MarginRateByMoney, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcInvestorPositionField, MarginRateByVolume, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcInvestorPositionField, StrikeFrozen, CTP_FIELD_INT32)            \
+  F(CThostFtdcInvestorPositionField, StrikeFrozenAmount, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcInvestorPositionField, AbandonFrozen, CTP_FIELD_INT32)           \
+  F(CThostFtdcInvestorPositionField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInvestorPositionField, YdStrikeFrozen, CTP_FIELD_INT32)          \
+  F(CThostFtdcInvestorPositionField, InvestUnitID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInvestorPositionField, PositionCostOffset, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcInvestorPositionField, TasPosition, CTP_FIELD_INT32)             \
+  F(CThostFtdcInvestorPositionField, TasPositionCost, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcInvestorPositionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentMarginRateField(F)                      \
+  F(CThostFtdcInstrumentMarginRateField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcInstrumentMarginRateField, InvestorRange, CTP_FIELD_CHAR)        \
+  F(CThostFtdcInstrumentMarginRateField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInstrumentMarginRateField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentMarginRateField, HedgeFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcInstrumentMarginRateField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateField, IsRelative, CTP_FIELD_INT32)          \
+  F(CThostFtdcInstrumentMarginRateField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentMarginRateField, InvestUnitID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInstrumentMarginRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentCommissionRateField(F)                  \
+  F(CThostFtdcInstrumentCommissionRateField, reserve1, CTP_FIELD_STRING)       \
+  F(CThostFtdcInstrumentCommissionRateField, InvestorRange, CTP_FIELD_CHAR)    \
+  F(CThostFtdcInstrumentCommissionRateField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInstrumentCommissionRateField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInstrumentCommissionRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentCommissionRateField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInstrumentCommissionRateField, BizType, CTP_FIELD_CHAR)          \
+  F(CThostFtdcInstrumentCommissionRateField, InvestUnitID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInstrumentCommissionRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcDepthMarketDataField(F)                           \
+  F(CThostFtdcDepthMarketDataField, TradingDay, CTP_FIELD_STRING)              \
+  F(CThostFtdcDepthMarketDataField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcDepthMarketDataField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcDepthMarketDataField, reserve2, CTP_FIELD_STRING)                \
+  F(CThostFtdcDepthMarketDataField, LastPrice, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, PreSettlementPrice, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcDepthMarketDataField, PreClosePrice, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcDepthMarketDataField, PreOpenInterest, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcDepthMarketDataField, OpenPrice, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, HighestPrice, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcDepthMarketDataField, LowestPrice, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcDepthMarketDataField, Volume, CTP_FIELD_INT32)                   \
+  F(CThostFtdcDepthMarketDataField, Turnover, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcDepthMarketDataField, OpenInterest, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcDepthMarketDataField, ClosePrice, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcDepthMarketDataField, SettlementPrice, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcDepthMarketDataField, UpperLimitPrice, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcDepthMarketDataField, LowerLimitPrice, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcDepthMarketDataField, PreDelta, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcDepthMarketDataField, CurrDelta, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, UpdateTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcDepthMarketDataField, UpdateMillisec, CTP_FIELD_INT32)           \
+  F(CThostFtdcDepthMarketDataField, BidPrice1, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, BidVolume1, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AskPrice1, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, AskVolume1, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, BidPrice2, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, BidVolume2, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AskPrice2, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, AskVolume2, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, BidPrice3, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, BidVolume3, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AskPrice3, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, AskVolume3, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, BidPrice4, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, BidVolume4, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AskPrice4, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, AskVolume4, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, BidPrice5, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, BidVolume5, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AskPrice5, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcDepthMarketDataField, AskVolume5, CTP_FIELD_INT32)               \
+  F(CThostFtdcDepthMarketDataField, AveragePrice, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcDepthMarketDataField, ActionDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcDepthMarketDataField, InstrumentID, CTP_FIELD_STRING)            \
+  F(CThostFtdcDepthMarketDataField, ExchangeInstID, CTP_FIELD_STRING)          \
+  F(CThostFtdcDepthMarketDataField, BandingUpperPrice, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcDepthMarketDataField, BandingLowerPrice, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcInstrumentTradingRightField(F)                    \
+  F(CThostFtdcInstrumentTradingRightField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentTradingRightField, InvestorRange, CTP_FIELD_CHAR)      \
+  F(CThostFtdcInstrumentTradingRightField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentTradingRightField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInstrumentTradingRightField, TradingRight, CTP_FIELD_CHAR)       \
+  F(CThostFtdcInstrumentTradingRightField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserField(F)                                \
+  F(CThostFtdcBrokerUserField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcBrokerUserField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBrokerUserField, UserName, CTP_FIELD_STRING)                     \
+  F(CThostFtdcBrokerUserField, UserType, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcBrokerUserField, IsActive, CTP_FIELD_INT32)                      \
+  F(CThostFtdcBrokerUserField, IsUsingOTP, CTP_FIELD_INT32)                    \
+  F(CThostFtdcBrokerUserField, IsAuthForce, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserPasswordField(F)                        \
+  F(CThostFtdcBrokerUserPasswordField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerUserPasswordField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBrokerUserPasswordField, Password, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerUserPasswordField, LastUpdateTime, CTP_FIELD_STRING)       \
+  F(CThostFtdcBrokerUserPasswordField, LastLoginTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcBrokerUserPasswordField, ExpireDate, CTP_FIELD_STRING)           \
+  F(CThostFtdcBrokerUserPasswordField, WeakExpireDate, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserFunctionField(F)                        \
+  F(CThostFtdcBrokerUserFunctionField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerUserFunctionField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBrokerUserFunctionField, BrokerFunctionCode, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcTraderOfferField(F)                               \
+  F(CThostFtdcTraderOfferField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTraderOfferField, TraderID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTraderOfferField, ParticipantID, CTP_FIELD_STRING)               \
+  F(CThostFtdcTraderOfferField, Password, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTraderOfferField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcTraderOfferField, OrderLocalID, CTP_FIELD_STRING)                \
+  F(CThostFtdcTraderOfferField, TraderConnectStatus, CTP_FIELD_CHAR)           \
+  F(CThostFtdcTraderOfferField, ConnectRequestDate, CTP_FIELD_STRING)          \
+  F(CThostFtdcTraderOfferField, ConnectRequestTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcTraderOfferField, LastReportDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcTraderOfferField, LastReportTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcTraderOfferField, ConnectDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTraderOfferField, ConnectTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTraderOfferField, StartDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTraderOfferField, StartTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTraderOfferField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTraderOfferField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTraderOfferField, MaxTradeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTraderOfferField, MaxOrderMessageReference, CTP_FIELD_STRING)    \
+  F(CThostFtdcTraderOfferField, OrderCancelAlg, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcSettlementInfoField(F)                            \
+  F(CThostFtdcSettlementInfoField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcSettlementInfoField, SettlementID, CTP_FIELD_INT32)              \
+  F(CThostFtdcSettlementInfoField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcSettlementInfoField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcSettlementInfoField, SequenceNo, CTP_FIELD_INT32)                \
+  F(CThostFtdcSettlementInfoField, Content, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSettlementInfoField, AccountID, CTP_FIELD_STRING)                \
+  F(CThostFtdcSettlementInfoField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentMarginRateAdjustField(F)                \
+  F(CThostFtdcInstrumentMarginRateAdjustField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcInstrumentMarginRateAdjustField, InvestorRange, CTP_FIELD_CHAR)  \
+  F(CThostFtdcInstrumentMarginRateAdjustField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInstrumentMarginRateAdjustField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInstrumentMarginRateAdjustField, HedgeFlag, CTP_FIELD_CHAR)      \
+  F(CThostFtdcInstrumentMarginRateAdjustField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateAdjustField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateAdjustField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateAdjustField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateAdjustField, IsRelative, CTP_FIELD_INT32)    \
+  F(CThostFtdcInstrumentMarginRateAdjustField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeMarginRateField(F)                        \
+  F(CThostFtdcExchangeMarginRateField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeMarginRateField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeMarginRateField, HedgeFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeMarginRateField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcExchangeMarginRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeMarginRateAdjustField(F)                  \
+  F(CThostFtdcExchangeMarginRateAdjustField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeMarginRateAdjustField, reserve1, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeMarginRateAdjustField, HedgeFlag, CTP_FIELD_CHAR)        \
+  F(CThostFtdcExchangeMarginRateAdjustField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ExchLongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ExchLongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ExchShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, ExchShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, NoLongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, NoLongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, NoShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, NoShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcExchangeMarginRateAdjustField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeRateField(F)                              \
+  F(CThostFtdcExchangeRateField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcExchangeRateField, FromCurrencyID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeRateField, FromCurrencyUnit, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcExchangeRateField, ToCurrencyID, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeRateField, ExchangeRate, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcSettlementRefField(F)                             \
+  F(CThostFtdcSettlementRefField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcSettlementRefField, SettlementID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcCurrentTimeField(F)                               \
+  F(CThostFtdcCurrentTimeField, CurrDate, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCurrentTimeField, CurrTime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCurrentTimeField, CurrMillisec, CTP_FIELD_INT32)                 \
+  F(CThostFtdcCurrentTimeField, ActionDay, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCommPhaseField(F)                                 \
+  F(CThostFtdcCommPhaseField, TradingDay, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCommPhaseField, CommPhaseNo, CTP_FIELD_INT16)                    \
+  F(CThostFtdcCommPhaseField, SystemID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcLoginInfoField(F)                                 \
+  F(CThostFtdcLoginInfoField, FrontID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcLoginInfoField, SessionID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcLoginInfoField, BrokerID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcLoginInfoField, LoginDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcLoginInfoField, LoginTime, CTP_FIELD_STRING)                     \
+  F(CThostFtdcLoginInfoField, reserve1, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, UserProductInfo, CTP_FIELD_STRING)               \
+  F(CThostFtdcLoginInfoField, InterfaceProductInfo, CTP_FIELD_STRING)          \
+  F(CThostFtdcLoginInfoField, ProtocolInfo, CTP_FIELD_STRING)                  \
+  F(CThostFtdcLoginInfoField, SystemName, CTP_FIELD_STRING)                    \
+  F(CThostFtdcLoginInfoField, PasswordDeprecated, CTP_FIELD_STRING)            \
+  F(CThostFtdcLoginInfoField, MaxOrderRef, CTP_FIELD_STRING)                   \
+  F(CThostFtdcLoginInfoField, SHFETime, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, DCETime, CTP_FIELD_STRING)                       \
+  F(CThostFtdcLoginInfoField, CZCETime, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, FFEXTime, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, MacAddress, CTP_FIELD_STRING)                    \
+  F(CThostFtdcLoginInfoField, OneTimePassword, CTP_FIELD_STRING)               \
+  F(CThostFtdcLoginInfoField, INETime, CTP_FIELD_STRING)                       \
+  F(CThostFtdcLoginInfoField, IsQryControl, CTP_FIELD_INT32)                   \
+  F(CThostFtdcLoginInfoField, LoginRemark, CTP_FIELD_STRING)                   \
+  F(CThostFtdcLoginInfoField, Password, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLoginInfoField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcLogoutAllField(F)                                 \
+  F(CThostFtdcLogoutAllField, FrontID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcLogoutAllField, SessionID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcLogoutAllField, SystemName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcFrontStatusField(F)                               \
+  F(CThostFtdcFrontStatusField, FrontID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcFrontStatusField, LastReportDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcFrontStatusField, LastReportTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcFrontStatusField, IsActive, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcUserPasswordUpdateField(F)                        \
+  F(CThostFtdcUserPasswordUpdateField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcUserPasswordUpdateField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcUserPasswordUpdateField, OldPassword, CTP_FIELD_STRING)          \
+  F(CThostFtdcUserPasswordUpdateField, NewPassword, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputOrderField(F)                                \
+  F(CThostFtdcInputOrderField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputOrderField, InvestorID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputOrderField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputOrderField, OrderRef, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputOrderField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcInputOrderField, OrderPriceType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcInputOrderField, Direction, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcInputOrderField, CombOffsetFlag, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputOrderField, CombHedgeFlag, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputOrderField, LimitPrice, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcInputOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)           \
+  F(CThostFtdcInputOrderField, TimeCondition, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInputOrderField, GTDDate, CTP_FIELD_STRING)                      \
+  F(CThostFtdcInputOrderField, VolumeCondition, CTP_FIELD_CHAR)                \
+  F(CThostFtdcInputOrderField, MinVolume, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInputOrderField, ContingentCondition, CTP_FIELD_CHAR)            \
+  F(CThostFtdcInputOrderField, StopPrice, CTP_FIELD_DOUBLE)                    \
+  F(CThostFtdcInputOrderField, ForceCloseReason, CTP_FIELD_CHAR)               \
+  F(CThostFtdcInputOrderField, IsAutoSuspend, CTP_FIELD_INT32)                 \
+  F(CThostFtdcInputOrderField, BusinessUnit, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputOrderField, RequestID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInputOrderField, UserForceClose, CTP_FIELD_INT32)                \
+  F(CThostFtdcInputOrderField, IsSwapOrder, CTP_FIELD_INT32)                   \
+  F(CThostFtdcInputOrderField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputOrderField, InvestUnitID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputOrderField, AccountID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInputOrderField, CurrencyID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputOrderField, ClientID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputOrderField, reserve2, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputOrderField, MacAddress, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputOrderField, InstrumentID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOrderField(F)                                     \
+  F(CThostFtdcOrderField, BrokerID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, InvestorID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, reserve1, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, OrderRef, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, UserID, CTP_FIELD_STRING)                            \
+  F(CThostFtdcOrderField, OrderPriceType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcOrderField, Direction, CTP_FIELD_CHAR)                           \
+  F(CThostFtdcOrderField, CombOffsetFlag, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderField, CombHedgeFlag, CTP_FIELD_STRING)                     \
+  F(CThostFtdcOrderField, LimitPrice, CTP_FIELD_DOUBLE)                        \
+  F(CThostFtdcOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)                \
+  F(CThostFtdcOrderField, TimeCondition, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcOrderField, GTDDate, CTP_FIELD_STRING)                           \
+  F(CThostFtdcOrderField, VolumeCondition, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcOrderField, MinVolume, CTP_FIELD_INT32)                          \
+  F(CThostFtdcOrderField, ContingentCondition, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcOrderField, StopPrice, CTP_FIELD_DOUBLE)                         \
+  F(CThostFtdcOrderField, ForceCloseReason, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcOrderField, IsAutoSuspend, CTP_FIELD_INT32)                      \
+  F(CThostFtdcOrderField, BusinessUnit, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderField, RequestID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcOrderField, OrderLocalID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderField, ExchangeID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, ParticipantID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcOrderField, ClientID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, reserve2, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, TraderID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, InstallID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcOrderField, OrderSubmitStatus, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcOrderField, NotifySequence, CTP_FIELD_INT32)                     \
+  F(CThostFtdcOrderField, TradingDay, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, SettlementID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcOrderField, OrderSysID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, OrderSource, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcOrderField, OrderStatus, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcOrderField, OrderType, CTP_FIELD_CHAR)                           \
+  F(CThostFtdcOrderField, VolumeTraded, CTP_FIELD_INT32)                       \
+  F(CThostFtdcOrderField, VolumeTotal, CTP_FIELD_INT32)                        \
+  F(CThostFtdcOrderField, InsertDate, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, InsertTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, ActiveTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, SuspendTime, CTP_FIELD_STRING)                       \
+  F(CThostFtdcOrderField, UpdateTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, CancelTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, ActiveTraderID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderField, ClearingPartID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderField, SequenceNo, CTP_FIELD_INT32)                         \
+  F(CThostFtdcOrderField, FrontID, CTP_FIELD_INT32)                            \
+  F(CThostFtdcOrderField, SessionID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcOrderField, UserProductInfo, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOrderField, StatusMsg, CTP_FIELD_STRING)                         \
+  F(CThostFtdcOrderField, UserForceClose, CTP_FIELD_INT32)                     \
+  F(CThostFtdcOrderField, ActiveUserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderField, BrokerOrderSeq, CTP_FIELD_INT32)                     \
+  F(CThostFtdcOrderField, RelativeOrderSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOrderField, ZCETotalTradedVolume, CTP_FIELD_INT32)               \
+  F(CThostFtdcOrderField, IsSwapOrder, CTP_FIELD_INT32)                        \
+  F(CThostFtdcOrderField, BranchID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, InvestUnitID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderField, AccountID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcOrderField, CurrencyID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, reserve3, CTP_FIELD_STRING)                          \
+  F(CThostFtdcOrderField, MacAddress, CTP_FIELD_STRING)                        \
+  F(CThostFtdcOrderField, InstrumentID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderField, ExchangeInstID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOrderField(F)                             \
+  F(CThostFtdcExchangeOrderField, OrderPriceType, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeOrderField, Direction, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExchangeOrderField, CombOffsetFlag, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderField, CombHedgeFlag, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeOrderField, LimitPrice, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcExchangeOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)        \
+  F(CThostFtdcExchangeOrderField, TimeCondition, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExchangeOrderField, GTDDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcExchangeOrderField, VolumeCondition, CTP_FIELD_CHAR)             \
+  F(CThostFtdcExchangeOrderField, MinVolume, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeOrderField, ContingentCondition, CTP_FIELD_CHAR)         \
+  F(CThostFtdcExchangeOrderField, StopPrice, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcExchangeOrderField, ForceCloseReason, CTP_FIELD_CHAR)            \
+  F(CThostFtdcExchangeOrderField, IsAutoSuspend, CTP_FIELD_INT32)              \
+  F(CThostFtdcExchangeOrderField, BusinessUnit, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeOrderField, RequestID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeOrderField, OrderLocalID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeOrderField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, ParticipantID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeOrderField, ClientID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeOrderField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeOrderField, TraderID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeOrderField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeOrderField, OrderSubmitStatus, CTP_FIELD_CHAR)           \
+  F(CThostFtdcExchangeOrderField, NotifySequence, CTP_FIELD_INT32)             \
+  F(CThostFtdcExchangeOrderField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, SettlementID, CTP_FIELD_INT32)               \
+  F(CThostFtdcExchangeOrderField, OrderSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, OrderSource, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeOrderField, OrderStatus, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeOrderField, OrderType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExchangeOrderField, VolumeTraded, CTP_FIELD_INT32)               \
+  F(CThostFtdcExchangeOrderField, VolumeTotal, CTP_FIELD_INT32)                \
+  F(CThostFtdcExchangeOrderField, InsertDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, InsertTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, ActiveTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, SuspendTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeOrderField, UpdateTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, CancelTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, ActiveTraderID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderField, ClearingPartID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderField, SequenceNo, CTP_FIELD_INT32)                 \
+  F(CThostFtdcExchangeOrderField, BranchID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeOrderField, reserve2, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeOrderField, MacAddress, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeOrderField, ExchangeInstID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOrderInsertErrorField(F)                  \
+  F(CThostFtdcExchangeOrderInsertErrorField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeOrderInsertErrorField, ParticipantID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOrderInsertErrorField, TraderID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeOrderInsertErrorField, InstallID, CTP_FIELD_INT32)       \
+  F(CThostFtdcExchangeOrderInsertErrorField, OrderLocalID, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeOrderInsertErrorField, ErrorID, CTP_FIELD_INT32)         \
+  F(CThostFtdcExchangeOrderInsertErrorField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputOrderActionField(F)                          \
+  F(CThostFtdcInputOrderActionField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputOrderActionField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputOrderActionField, OrderActionRef, CTP_FIELD_INT32)          \
+  F(CThostFtdcInputOrderActionField, OrderRef, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputOrderActionField, RequestID, CTP_FIELD_INT32)               \
+  F(CThostFtdcInputOrderActionField, FrontID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcInputOrderActionField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcInputOrderActionField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputOrderActionField, OrderSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputOrderActionField, ActionFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcInputOrderActionField, LimitPrice, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcInputOrderActionField, VolumeChange, CTP_FIELD_INT32)            \
+  F(CThostFtdcInputOrderActionField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputOrderActionField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputOrderActionField, InvestUnitID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOrderActionField, reserve2, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputOrderActionField, MacAddress, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputOrderActionField, InstrumentID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOrderActionField(F)                               \
+  F(CThostFtdcOrderActionField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, OrderActionRef, CTP_FIELD_INT32)               \
+  F(CThostFtdcOrderActionField, OrderRef, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, RequestID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcOrderActionField, FrontID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcOrderActionField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcOrderActionField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, OrderSysID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, ActionFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcOrderActionField, LimitPrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcOrderActionField, VolumeChange, CTP_FIELD_INT32)                 \
+  F(CThostFtdcOrderActionField, ActionDate, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, ActionTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, TraderID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcOrderActionField, OrderLocalID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOrderActionField, ActionLocalID, CTP_FIELD_STRING)               \
+  F(CThostFtdcOrderActionField, ParticipantID, CTP_FIELD_STRING)               \
+  F(CThostFtdcOrderActionField, ClientID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, BusinessUnit, CTP_FIELD_STRING)                \
+  F(CThostFtdcOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)             \
+  F(CThostFtdcOrderActionField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOrderActionField, StatusMsg, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOrderActionField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, BranchID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, InvestUnitID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOrderActionField, reserve2, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOrderActionField, MacAddress, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOrderActionField, InstrumentID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOrderActionField(F)                       \
+  F(CThostFtdcExchangeOrderActionField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeOrderActionField, OrderSysID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeOrderActionField, ActionFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcExchangeOrderActionField, LimitPrice, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcExchangeOrderActionField, VolumeChange, CTP_FIELD_INT32)         \
+  F(CThostFtdcExchangeOrderActionField, ActionDate, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeOrderActionField, ActionTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeOrderActionField, TraderID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderActionField, InstallID, CTP_FIELD_INT32)            \
+  F(CThostFtdcExchangeOrderActionField, OrderLocalID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOrderActionField, ActionLocalID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeOrderActionField, ParticipantID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeOrderActionField, ClientID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderActionField, BusinessUnit, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)     \
+  F(CThostFtdcExchangeOrderActionField, UserID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeOrderActionField, BranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderActionField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeOrderActionField, MacAddress, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOrderActionErrorField(F)                  \
+  F(CThostFtdcExchangeOrderActionErrorField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeOrderActionErrorField, OrderSysID, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeOrderActionErrorField, TraderID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeOrderActionErrorField, InstallID, CTP_FIELD_INT32)       \
+  F(CThostFtdcExchangeOrderActionErrorField, OrderLocalID, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeOrderActionErrorField, ActionLocalID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOrderActionErrorField, ErrorID, CTP_FIELD_INT32)         \
+  F(CThostFtdcExchangeOrderActionErrorField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeTradeField(F)                             \
+  F(CThostFtdcExchangeTradeField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeTradeField, TradeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcExchangeTradeField, Direction, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExchangeTradeField, OrderSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeTradeField, ParticipantID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeTradeField, ClientID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeTradeField, TradingRole, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeTradeField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeTradeField, OffsetFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcExchangeTradeField, HedgeFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExchangeTradeField, Price, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcExchangeTradeField, Volume, CTP_FIELD_INT32)                     \
+  F(CThostFtdcExchangeTradeField, TradeDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcExchangeTradeField, TradeTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcExchangeTradeField, TradeType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExchangeTradeField, PriceSource, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeTradeField, TraderID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeTradeField, OrderLocalID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeTradeField, ClearingPartID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeTradeField, BusinessUnit, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeTradeField, SequenceNo, CTP_FIELD_INT32)                 \
+  F(CThostFtdcExchangeTradeField, TradeSource, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeTradeField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradeField(F)                                     \
+  F(CThostFtdcTradeField, BrokerID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, InvestorID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcTradeField, reserve1, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, OrderRef, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, UserID, CTP_FIELD_STRING)                            \
+  F(CThostFtdcTradeField, ExchangeID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcTradeField, TradeID, CTP_FIELD_STRING)                           \
+  F(CThostFtdcTradeField, Direction, CTP_FIELD_CHAR)                           \
+  F(CThostFtdcTradeField, OrderSysID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcTradeField, ParticipantID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcTradeField, ClientID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, TradingRole, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcTradeField, reserve2, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, OffsetFlag, CTP_FIELD_CHAR)                          \
+  F(CThostFtdcTradeField, HedgeFlag, CTP_FIELD_CHAR)                           \
+  F(CThostFtdcTradeField, Price, CTP_FIELD_DOUBLE)                             \
+  F(CThostFtdcTradeField, Volume, CTP_FIELD_INT32)                             \
+  F(CThostFtdcTradeField, TradeDate, CTP_FIELD_STRING)                         \
+  F(CThostFtdcTradeField, TradeTime, CTP_FIELD_STRING)                         \
+  F(CThostFtdcTradeField, TradeType, CTP_FIELD_CHAR)                           \
+  F(CThostFtdcTradeField, PriceSource, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcTradeField, TraderID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcTradeField, OrderLocalID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcTradeField, ClearingPartID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTradeField, BusinessUnit, CTP_FIELD_STRING)                      \
+  F(CThostFtdcTradeField, SequenceNo, CTP_FIELD_INT32)                         \
+  F(CThostFtdcTradeField, TradingDay, CTP_FIELD_STRING)                        \
+  F(CThostFtdcTradeField, SettlementID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcTradeField, BrokerOrderSeq, CTP_FIELD_INT32)                     \
+  F(CThostFtdcTradeField, TradeSource, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcTradeField, InvestUnitID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcTradeField, InstrumentID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcTradeField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcUserSessionField(F)                               \
+  F(CThostFtdcUserSessionField, FrontID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcUserSessionField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcUserSessionField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcUserSessionField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcUserSessionField, LoginDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcUserSessionField, LoginTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcUserSessionField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcUserSessionField, UserProductInfo, CTP_FIELD_STRING)             \
+  F(CThostFtdcUserSessionField, InterfaceProductInfo, CTP_FIELD_STRING)        \
+  F(CThostFtdcUserSessionField, ProtocolInfo, CTP_FIELD_STRING)                \
+  F(CThostFtdcUserSessionField, MacAddress, CTP_FIELD_STRING)                  \
+  F(CThostFtdcUserSessionField, LoginRemark, CTP_FIELD_STRING)                 \
+  F(CThostFtdcUserSessionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryMaxOrderVolumeField(F)                         \
+  F(CThostFtdcQryMaxOrderVolumeField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryMaxOrderVolumeField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryMaxOrderVolumeField, reserve1, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryMaxOrderVolumeField, Direction, CTP_FIELD_CHAR)               \
+  F(CThostFtdcQryMaxOrderVolumeField, OffsetFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcQryMaxOrderVolumeField, HedgeFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcQryMaxOrderVolumeField, MaxVolume, CTP_FIELD_INT32)              \
+  F(CThostFtdcQryMaxOrderVolumeField, ExchangeID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryMaxOrderVolumeField, InvestUnitID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryMaxOrderVolumeField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSettlementInfoConfirmField(F)                     \
+  F(CThostFtdcSettlementInfoConfirmField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcSettlementInfoConfirmField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSettlementInfoConfirmField, ConfirmDate, CTP_FIELD_STRING)       \
+  F(CThostFtdcSettlementInfoConfirmField, ConfirmTime, CTP_FIELD_STRING)       \
+  F(CThostFtdcSettlementInfoConfirmField, SettlementID, CTP_FIELD_INT32)       \
+  F(CThostFtdcSettlementInfoConfirmField, AccountID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSettlementInfoConfirmField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncDepositField(F)                               \
+  F(CThostFtdcSyncDepositField, DepositSeqNo, CTP_FIELD_STRING)                \
+  F(CThostFtdcSyncDepositField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcSyncDepositField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSyncDepositField, Deposit, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcSyncDepositField, IsForce, CTP_FIELD_INT32)                      \
+  F(CThostFtdcSyncDepositField, CurrencyID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSyncDepositField, IsFromSopt, CTP_FIELD_INT32)                   \
+  F(CThostFtdcSyncDepositField, TradingPassword, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncFundMortgageField(F)                          \
+  F(CThostFtdcSyncFundMortgageField, MortgageSeqNo, CTP_FIELD_STRING)          \
+  F(CThostFtdcSyncFundMortgageField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcSyncFundMortgageField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcSyncFundMortgageField, FromCurrencyID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncFundMortgageField, MortgageAmount, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncFundMortgageField, ToCurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerSyncField(F)                                \
+  F(CThostFtdcBrokerSyncField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncingInvestorField(F)                           \
+  F(CThostFtdcSyncingInvestorField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcSyncingInvestorField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcSyncingInvestorField, InvestorGroupID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncingInvestorField, InvestorName, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncingInvestorField, IdentifiedCardType, CTP_FIELD_CHAR)        \
+  F(CThostFtdcSyncingInvestorField, IdentifiedCardNo, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncingInvestorField, IsActive, CTP_FIELD_INT32)                 \
+  F(CThostFtdcSyncingInvestorField, Telephone, CTP_FIELD_STRING)               \
+  F(CThostFtdcSyncingInvestorField, Address, CTP_FIELD_STRING)                 \
+  F(CThostFtdcSyncingInvestorField, OpenDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcSyncingInvestorField, Mobile, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSyncingInvestorField, CommModelID, CTP_FIELD_STRING)             \
+  F(CThostFtdcSyncingInvestorField, MarginModelID, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncingInvestorField, IsOrderFreq, CTP_FIELD_CHAR)               \
+  F(CThostFtdcSyncingInvestorField, IsOpenVolLimit, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcSyncingTradingCodeField(F)                        \
+  F(CThostFtdcSyncingTradingCodeField, InvestorID, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncingTradingCodeField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcSyncingTradingCodeField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncingTradingCodeField, ClientID, CTP_FIELD_STRING)             \
+  F(CThostFtdcSyncingTradingCodeField, IsActive, CTP_FIELD_INT32)              \
+  F(CThostFtdcSyncingTradingCodeField, ClientIDType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcSyncingInvestorGroupField(F)                      \
+  F(CThostFtdcSyncingInvestorGroupField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncingInvestorGroupField, InvestorGroupID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncingInvestorGroupField, InvestorGroupName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncingTradingAccountField(F)                     \
+  F(CThostFtdcSyncingTradingAccountField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcSyncingTradingAccountField, AccountID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncingTradingAccountField, PreMortgage, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncingTradingAccountField, PreCredit, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncingTradingAccountField, PreDeposit, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, PreBalance, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, PreMargin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncingTradingAccountField, InterestBase, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncingTradingAccountField, Interest, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncingTradingAccountField, Deposit, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcSyncingTradingAccountField, Withdraw, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncingTradingAccountField, FrozenMargin, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncingTradingAccountField, FrozenCash, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, FrozenCommission, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncingTradingAccountField, CurrMargin, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, CashIn, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcSyncingTradingAccountField, Commission, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, CloseProfit, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncingTradingAccountField, PositionProfit, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingTradingAccountField, Balance, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcSyncingTradingAccountField, Available, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncingTradingAccountField, WithdrawQuota, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncingTradingAccountField, Reserve, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcSyncingTradingAccountField, TradingDay, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncingTradingAccountField, SettlementID, CTP_FIELD_INT32)       \
+  F(CThostFtdcSyncingTradingAccountField, Credit, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcSyncingTradingAccountField, Mortgage, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncingTradingAccountField, ExchangeMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingTradingAccountField, DeliveryMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingTradingAccountField, ExchangeDeliveryMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, ReserveBalance, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingTradingAccountField, CurrencyID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncingTradingAccountField, PreFundMortgageIn, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncingTradingAccountField, PreFundMortgageOut, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, FundMortgageIn, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingTradingAccountField, FundMortgageOut, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncingTradingAccountField, FundMortgageAvailable, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, MortgageableFund, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncingTradingAccountField, SpecProductMargin, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncingTradingAccountField, SpecProductFrozenMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductFrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductPositionProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductCloseProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductPositionProfitByAlg, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, SpecProductExchangeMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingTradingAccountField, FrozenSwap, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingTradingAccountField, RemainSwap, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcSyncingInvestorPositionField(F)                   \
+  F(CThostFtdcSyncingInvestorPositionField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncingInvestorPositionField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncingInvestorPositionField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncingInvestorPositionField, PosiDirection, CTP_FIELD_CHAR)     \
+  F(CThostFtdcSyncingInvestorPositionField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcSyncingInvestorPositionField, PositionDate, CTP_FIELD_CHAR)      \
+  F(CThostFtdcSyncingInvestorPositionField, YdPosition, CTP_FIELD_INT32)       \
+  F(CThostFtdcSyncingInvestorPositionField, Position, CTP_FIELD_INT32)         \
+  F(CThostFtdcSyncingInvestorPositionField, LongFrozen, CTP_FIELD_INT32)       \
+  F(CThostFtdcSyncingInvestorPositionField, ShortFrozen, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncingInvestorPositionField, LongFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, ShortFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, OpenVolume, CTP_FIELD_INT32)       \
+  F(CThostFtdcSyncingInvestorPositionField, CloseVolume, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncingInvestorPositionField, OpenAmount, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncingInvestorPositionField, CloseAmount, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncingInvestorPositionField, PositionCost, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingInvestorPositionField, PreMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncingInvestorPositionField, UseMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncingInvestorPositionField, FrozenMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncingInvestorPositionField, FrozenCash, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncingInvestorPositionField, FrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, CashIn, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncingInvestorPositionField, Commission, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncingInvestorPositionField, CloseProfit, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncingInvestorPositionField, PositionProfit, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncingInvestorPositionField, PreSettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, SettlementPrice, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncingInvestorPositionField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncingInvestorPositionField, SettlementID, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncingInvestorPositionField, OpenCost, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncingInvestorPositionField, ExchangeMargin, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncingInvestorPositionField, CombPosition, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncingInvestorPositionField, CombLongFrozen, CTP_FIELD_INT32)   \
+  F(CThostFtdcSyncingInvestorPositionField, CombShortFrozen, CTP_FIELD_INT32)  \
+  F(CThostFtdcSyncingInvestorPositionField, CloseProfitByDate, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, CloseProfitByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, TodayPosition, CTP_FIELD_INT32)    \
+  F(CThostFtdcSyncingInvestorPositionField, MarginRateByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, MarginRateByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, StrikeFrozen, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncingInvestorPositionField, StrikeFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, AbandonFrozen, CTP_FIELD_INT32)    \
+  F(CThostFtdcSyncingInvestorPositionField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncingInvestorPositionField, YdStrikeFrozen, CTP_FIELD_INT32)   \
+  F(CThostFtdcSyncingInvestorPositionField, InvestUnitID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncingInvestorPositionField, PositionCostOffset, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInvestorPositionField, TasPosition, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncingInvestorPositionField, TasPositionCost, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncingInvestorPositionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncingInstrumentMarginRateField(F)               \
+  F(CThostFtdcSyncingInstrumentMarginRateField, reserve1, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncingInstrumentMarginRateField, InvestorRange, CTP_FIELD_CHAR) \
+  F(CThostFtdcSyncingInstrumentMarginRateField, BrokerID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncingInstrumentMarginRateField, InvestorID, CTP_FIELD_STRING)  \
+  F(CThostFtdcSyncingInstrumentMarginRateField, HedgeFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcSyncingInstrumentMarginRateField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentMarginRateField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentMarginRateField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentMarginRateField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentMarginRateField, IsRelative, CTP_FIELD_INT32)   \
+  F(CThostFtdcSyncingInstrumentMarginRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncingInstrumentCommissionRateField(F)           \
+  F(CThostFtdcSyncingInstrumentCommissionRateField, reserve1, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, InvestorRange, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, BrokerID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncingInstrumentCommissionRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncingInstrumentTradingRightField(F)             \
+  F(CThostFtdcSyncingInstrumentTradingRightField, reserve1, CTP_FIELD_STRING)  \
+  F(CThostFtdcSyncingInstrumentTradingRightField, InvestorRange, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncingInstrumentTradingRightField, BrokerID, CTP_FIELD_STRING)  \
+  F(CThostFtdcSyncingInstrumentTradingRightField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncingInstrumentTradingRightField, TradingRight, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncingInstrumentTradingRightField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOrderField(F)                                  \
+  F(CThostFtdcQryOrderField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryOrderField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryOrderField, reserve1, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryOrderField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryOrderField, OrderSysID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryOrderField, InsertTimeStart, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryOrderField, InsertTimeEnd, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryOrderField, InvestUnitID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryOrderField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTradeField(F)                                  \
+  F(CThostFtdcQryTradeField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryTradeField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryTradeField, reserve1, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryTradeField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryTradeField, TradeID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQryTradeField, TradeTimeStart, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryTradeField, TradeTimeEnd, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryTradeField, InvestUnitID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryTradeField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorPositionField(F)                       \
+  F(CThostFtdcQryInvestorPositionField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryInvestorPositionField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryInvestorPositionField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryInvestorPositionField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryInvestorPositionField, InvestUnitID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryInvestorPositionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTradingAccountField(F)                         \
+  F(CThostFtdcQryTradingAccountField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryTradingAccountField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryTradingAccountField, CurrencyID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryTradingAccountField, BizType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcQryTradingAccountField, AccountID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorField(F)                               \
+  F(CThostFtdcQryInvestorField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryInvestorField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTradingCodeField(F)                            \
+  F(CThostFtdcQryTradingCodeField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryTradingCodeField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryTradingCodeField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryTradingCodeField, ClientID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryTradingCodeField, ClientIDType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcQryTradingCodeField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorGroupField(F)                          \
+  F(CThostFtdcQryInvestorGroupField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentMarginRateField(F)                   \
+  F(CThostFtdcQryInstrumentMarginRateField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryInstrumentMarginRateField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInstrumentMarginRateField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryInstrumentMarginRateField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcQryInstrumentMarginRateField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInstrumentMarginRateField, InvestUnitID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInstrumentMarginRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentCommissionRateField(F)               \
+  F(CThostFtdcQryInstrumentCommissionRateField, BrokerID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInstrumentCommissionRateField, InvestorID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryInstrumentCommissionRateField, reserve1, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInstrumentCommissionRateField, ExchangeID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryInstrumentCommissionRateField, InvestUnitID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInstrumentCommissionRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentTradingRightField(F)                 \
+  F(CThostFtdcQryInstrumentTradingRightField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInstrumentTradingRightField, InvestorID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInstrumentTradingRightField, reserve1, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInstrumentTradingRightField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerField(F)                                 \
+  F(CThostFtdcQryBrokerField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTraderField(F)                                 \
+  F(CThostFtdcQryTraderField, ExchangeID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryTraderField, ParticipantID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryTraderField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySuperUserFunctionField(F)                      \
+  F(CThostFtdcQrySuperUserFunctionField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryUserSessionField(F)                            \
+  F(CThostFtdcQryUserSessionField, FrontID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcQryUserSessionField, SessionID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcQryUserSessionField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryUserSessionField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryPartBrokerField(F)                             \
+  F(CThostFtdcQryPartBrokerField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryPartBrokerField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryPartBrokerField, ParticipantID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryFrontStatusField(F)                            \
+  F(CThostFtdcQryFrontStatusField, FrontID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeOrderField(F)                          \
+  F(CThostFtdcQryExchangeOrderField, ParticipantID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeOrderField, ClientID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeOrderField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeOrderField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryExchangeOrderField, TraderID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeOrderField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOrderActionField(F)                            \
+  F(CThostFtdcQryOrderActionField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryOrderActionField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryOrderActionField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeOrderActionField(F)                    \
+  F(CThostFtdcQryExchangeOrderActionField, ParticipantID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryExchangeOrderActionField, ClientID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryExchangeOrderActionField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryExchangeOrderActionField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySuperUserField(F)                              \
+  F(CThostFtdcQrySuperUserField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeField(F)                               \
+  F(CThostFtdcQryExchangeField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryProductField(F)                                \
+  F(CThostFtdcQryProductField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryProductField, ProductClass, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcQryProductField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryProductField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentField(F)                             \
+  F(CThostFtdcQryInstrumentField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryInstrumentField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryInstrumentField, reserve2, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryInstrumentField, reserve3, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryInstrumentField, InstrumentID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryInstrumentField, ExchangeInstID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryInstrumentField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryDepthMarketDataField(F)                        \
+  F(CThostFtdcQryDepthMarketDataField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryDepthMarketDataField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryDepthMarketDataField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerUserField(F)                             \
+  F(CThostFtdcQryBrokerUserField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryBrokerUserField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerUserFunctionField(F)                     \
+  F(CThostFtdcQryBrokerUserFunctionField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryBrokerUserFunctionField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTraderOfferField(F)                            \
+  F(CThostFtdcQryTraderOfferField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryTraderOfferField, ParticipantID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryTraderOfferField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySyncDepositField(F)                            \
+  F(CThostFtdcQrySyncDepositField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQrySyncDepositField, DepositSeqNo, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySettlementInfoField(F)                         \
+  F(CThostFtdcQrySettlementInfoField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQrySettlementInfoField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQrySettlementInfoField, TradingDay, CTP_FIELD_STRING)            \
+  F(CThostFtdcQrySettlementInfoField, AccountID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQrySettlementInfoField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeMarginRateField(F)                     \
+  F(CThostFtdcQryExchangeMarginRateField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeMarginRateField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeMarginRateField, HedgeFlag, CTP_FIELD_CHAR)           \
+  F(CThostFtdcQryExchangeMarginRateField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryExchangeMarginRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeMarginRateAdjustField(F)               \
+  F(CThostFtdcQryExchangeMarginRateAdjustField, BrokerID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryExchangeMarginRateAdjustField, reserve1, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryExchangeMarginRateAdjustField, HedgeFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcQryExchangeMarginRateAdjustField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeRateField(F)                           \
+  F(CThostFtdcQryExchangeRateField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryExchangeRateField, FromCurrencyID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeRateField, ToCurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySyncFundMortgageField(F)                       \
+  F(CThostFtdcQrySyncFundMortgageField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQrySyncFundMortgageField, MortgageSeqNo, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryHisOrderField(F)                               \
+  F(CThostFtdcQryHisOrderField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryHisOrderField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryHisOrderField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryHisOrderField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryHisOrderField, OrderSysID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryHisOrderField, InsertTimeStart, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryHisOrderField, InsertTimeEnd, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryHisOrderField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryHisOrderField, SettlementID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcQryHisOrderField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrMiniMarginField(F)                     \
+  F(CThostFtdcOptionInstrMiniMarginField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionInstrMiniMarginField, InvestorRange, CTP_FIELD_CHAR)       \
+  F(CThostFtdcOptionInstrMiniMarginField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionInstrMiniMarginField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrMiniMarginField, MinMargin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcOptionInstrMiniMarginField, ValueMethod, CTP_FIELD_CHAR)         \
+  F(CThostFtdcOptionInstrMiniMarginField, IsRelative, CTP_FIELD_INT32)         \
+  F(CThostFtdcOptionInstrMiniMarginField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrMarginAdjustField(F)                   \
+  F(CThostFtdcOptionInstrMarginAdjustField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrMarginAdjustField, InvestorRange, CTP_FIELD_CHAR)     \
+  F(CThostFtdcOptionInstrMarginAdjustField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrMarginAdjustField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionInstrMarginAdjustField, SShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, SShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, HShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, HShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, AShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, AShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, IsRelative, CTP_FIELD_INT32)       \
+  F(CThostFtdcOptionInstrMarginAdjustField, MShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, MShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrMarginAdjustField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrCommRateField(F)                       \
+  F(CThostFtdcOptionInstrCommRateField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionInstrCommRateField, InvestorRange, CTP_FIELD_CHAR)         \
+  F(CThostFtdcOptionInstrCommRateField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionInstrCommRateField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionInstrCommRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcOptionInstrCommRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcOptionInstrCommRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcOptionInstrCommRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcOptionInstrCommRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrCommRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcOptionInstrCommRateField, StrikeRatioByMoney, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcOptionInstrCommRateField, StrikeRatioByVolume, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcOptionInstrCommRateField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionInstrCommRateField, InvestUnitID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrCommRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrTradeCostField(F)                      \
+  F(CThostFtdcOptionInstrTradeCostField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcOptionInstrTradeCostField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcOptionInstrTradeCostField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcOptionInstrTradeCostField, HedgeFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcOptionInstrTradeCostField, FixedMargin, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcOptionInstrTradeCostField, MiniMargin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcOptionInstrTradeCostField, Royalty, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcOptionInstrTradeCostField, ExchFixedMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcOptionInstrTradeCostField, ExchMiniMargin, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcOptionInstrTradeCostField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcOptionInstrTradeCostField, InvestUnitID, CTP_FIELD_STRING)       \
+  F(CThostFtdcOptionInstrTradeCostField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOptionInstrTradeCostField(F)                   \
+  F(CThostFtdcQryOptionInstrTradeCostField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryOptionInstrTradeCostField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryOptionInstrTradeCostField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryOptionInstrTradeCostField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcQryOptionInstrTradeCostField, InputPrice, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcQryOptionInstrTradeCostField, UnderlyingPrice, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcQryOptionInstrTradeCostField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryOptionInstrTradeCostField, InvestUnitID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryOptionInstrTradeCostField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOptionInstrCommRateField(F)                    \
+  F(CThostFtdcQryOptionInstrCommRateField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryOptionInstrCommRateField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryOptionInstrCommRateField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryOptionInstrCommRateField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryOptionInstrCommRateField, InvestUnitID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryOptionInstrCommRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcIndexPriceField(F)                                \
+  F(CThostFtdcIndexPriceField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcIndexPriceField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcIndexPriceField, ClosePrice, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcIndexPriceField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputExecOrderField(F)                            \
+  F(CThostFtdcInputExecOrderField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputExecOrderField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputExecOrderField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputExecOrderField, ExecOrderRef, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputExecOrderField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputExecOrderField, Volume, CTP_FIELD_INT32)                    \
+  F(CThostFtdcInputExecOrderField, RequestID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcInputExecOrderField, BusinessUnit, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputExecOrderField, OffsetFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcInputExecOrderField, HedgeFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInputExecOrderField, ActionType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcInputExecOrderField, PosiDirection, CTP_FIELD_CHAR)              \
+  F(CThostFtdcInputExecOrderField, ReservePositionFlag, CTP_FIELD_CHAR)        \
+  F(CThostFtdcInputExecOrderField, CloseFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInputExecOrderField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputExecOrderField, InvestUnitID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputExecOrderField, AccountID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputExecOrderField, CurrencyID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputExecOrderField, ClientID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputExecOrderField, reserve2, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputExecOrderField, MacAddress, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputExecOrderField, InstrumentID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputExecOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputExecOrderActionField(F)                      \
+  F(CThostFtdcInputExecOrderActionField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputExecOrderActionField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputExecOrderActionField, ExecOrderActionRef, CTP_FIELD_INT32)  \
+  F(CThostFtdcInputExecOrderActionField, ExecOrderRef, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputExecOrderActionField, RequestID, CTP_FIELD_INT32)           \
+  F(CThostFtdcInputExecOrderActionField, FrontID, CTP_FIELD_INT32)             \
+  F(CThostFtdcInputExecOrderActionField, SessionID, CTP_FIELD_INT32)           \
+  F(CThostFtdcInputExecOrderActionField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputExecOrderActionField, ExecOrderSysID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInputExecOrderActionField, ActionFlag, CTP_FIELD_CHAR)           \
+  F(CThostFtdcInputExecOrderActionField, UserID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputExecOrderActionField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputExecOrderActionField, InvestUnitID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputExecOrderActionField, reserve2, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputExecOrderActionField, MacAddress, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputExecOrderActionField, InstrumentID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputExecOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExecOrderField(F)                                 \
+  F(CThostFtdcExecOrderField, BrokerID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, InvestorID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, reserve1, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, ExecOrderRef, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcExecOrderField, Volume, CTP_FIELD_INT32)                         \
+  F(CThostFtdcExecOrderField, RequestID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcExecOrderField, BusinessUnit, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderField, OffsetFlag, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcExecOrderField, HedgeFlag, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcExecOrderField, ActionType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcExecOrderField, PosiDirection, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcExecOrderField, ReservePositionFlag, CTP_FIELD_CHAR)             \
+  F(CThostFtdcExecOrderField, CloseFlag, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcExecOrderField, ExecOrderLocalID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderField, ExchangeID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, ParticipantID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcExecOrderField, ClientID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, reserve2, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, TraderID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, InstallID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcExecOrderField, OrderSubmitStatus, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExecOrderField, NotifySequence, CTP_FIELD_INT32)                 \
+  F(CThostFtdcExecOrderField, TradingDay, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, SettlementID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcExecOrderField, ExecOrderSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderField, InsertDate, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, InsertTime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, CancelTime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, ExecResult, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcExecOrderField, ClearingPartID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderField, SequenceNo, CTP_FIELD_INT32)                     \
+  F(CThostFtdcExecOrderField, FrontID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcExecOrderField, SessionID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcExecOrderField, UserProductInfo, CTP_FIELD_STRING)               \
+  F(CThostFtdcExecOrderField, StatusMsg, CTP_FIELD_STRING)                     \
+  F(CThostFtdcExecOrderField, ActiveUserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderField, BrokerExecOrderSeq, CTP_FIELD_INT32)             \
+  F(CThostFtdcExecOrderField, BranchID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, InvestUnitID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderField, AccountID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcExecOrderField, CurrencyID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, reserve3, CTP_FIELD_STRING)                      \
+  F(CThostFtdcExecOrderField, MacAddress, CTP_FIELD_STRING)                    \
+  F(CThostFtdcExecOrderField, InstrumentID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderField, ExchangeInstID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExecOrderActionField(F)                           \
+  F(CThostFtdcExecOrderActionField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderActionField, ExecOrderActionRef, CTP_FIELD_INT32)       \
+  F(CThostFtdcExecOrderActionField, ExecOrderRef, CTP_FIELD_STRING)            \
+  F(CThostFtdcExecOrderActionField, RequestID, CTP_FIELD_INT32)                \
+  F(CThostFtdcExecOrderActionField, FrontID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExecOrderActionField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcExecOrderActionField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderActionField, ExecOrderSysID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExecOrderActionField, ActionFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcExecOrderActionField, ActionDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderActionField, ActionTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderActionField, TraderID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, InstallID, CTP_FIELD_INT32)                \
+  F(CThostFtdcExecOrderActionField, ExecOrderLocalID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExecOrderActionField, ActionLocalID, CTP_FIELD_STRING)           \
+  F(CThostFtdcExecOrderActionField, ParticipantID, CTP_FIELD_STRING)           \
+  F(CThostFtdcExecOrderActionField, ClientID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, BusinessUnit, CTP_FIELD_STRING)            \
+  F(CThostFtdcExecOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcExecOrderActionField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExecOrderActionField, ActionType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcExecOrderActionField, StatusMsg, CTP_FIELD_STRING)               \
+  F(CThostFtdcExecOrderActionField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, BranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, InvestUnitID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExecOrderActionField, reserve2, CTP_FIELD_STRING)                \
+  F(CThostFtdcExecOrderActionField, MacAddress, CTP_FIELD_STRING)              \
+  F(CThostFtdcExecOrderActionField, InstrumentID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExecOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExecOrderField(F)                              \
+  F(CThostFtdcQryExecOrderField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryExecOrderField, InvestorID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryExecOrderField, reserve1, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryExecOrderField, ExchangeID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryExecOrderField, ExecOrderSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryExecOrderField, InsertTimeStart, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryExecOrderField, InsertTimeEnd, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryExecOrderField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeExecOrderField(F)                         \
+  F(CThostFtdcExchangeExecOrderField, Volume, CTP_FIELD_INT32)                 \
+  F(CThostFtdcExchangeExecOrderField, RequestID, CTP_FIELD_INT32)              \
+  F(CThostFtdcExchangeExecOrderField, BusinessUnit, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeExecOrderField, OffsetFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeExecOrderField, HedgeFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExchangeExecOrderField, ActionType, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeExecOrderField, PosiDirection, CTP_FIELD_CHAR)           \
+  F(CThostFtdcExchangeExecOrderField, ReservePositionFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcExchangeExecOrderField, CloseFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExchangeExecOrderField, ExecOrderLocalID, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeExecOrderField, ExchangeID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, ParticipantID, CTP_FIELD_STRING)         \
+  F(CThostFtdcExchangeExecOrderField, ClientID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeExecOrderField, reserve1, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeExecOrderField, TraderID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeExecOrderField, InstallID, CTP_FIELD_INT32)              \
+  F(CThostFtdcExchangeExecOrderField, OrderSubmitStatus, CTP_FIELD_CHAR)       \
+  F(CThostFtdcExchangeExecOrderField, NotifySequence, CTP_FIELD_INT32)         \
+  F(CThostFtdcExchangeExecOrderField, TradingDay, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, SettlementID, CTP_FIELD_INT32)           \
+  F(CThostFtdcExchangeExecOrderField, ExecOrderSysID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderField, InsertDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, InsertTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, CancelTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, ExecResult, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeExecOrderField, ClearingPartID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderField, SequenceNo, CTP_FIELD_INT32)             \
+  F(CThostFtdcExchangeExecOrderField, BranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeExecOrderField, reserve2, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeExecOrderField, MacAddress, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeExecOrderField, ExchangeInstID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeExecOrderField(F)                      \
+  F(CThostFtdcQryExchangeExecOrderField, ParticipantID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryExchangeExecOrderField, ClientID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryExchangeExecOrderField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryExchangeExecOrderField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryExchangeExecOrderField, TraderID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryExchangeExecOrderField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExecOrderActionField(F)                        \
+  F(CThostFtdcQryExecOrderActionField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryExecOrderActionField, InvestorID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryExecOrderActionField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeExecOrderActionField(F)                   \
+  F(CThostFtdcExchangeExecOrderActionField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeExecOrderActionField, ExecOrderSysID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeExecOrderActionField, ActionFlag, CTP_FIELD_CHAR)        \
+  F(CThostFtdcExchangeExecOrderActionField, ActionDate, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeExecOrderActionField, ActionTime, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeExecOrderActionField, TraderID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderActionField, InstallID, CTP_FIELD_INT32)        \
+  F(CThostFtdcExchangeExecOrderActionField, ExecOrderLocalID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeExecOrderActionField, ActionLocalID, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeExecOrderActionField, ParticipantID, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeExecOrderActionField, ClientID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderActionField, BusinessUnit, CTP_FIELD_STRING)    \
+  F(CThostFtdcExchangeExecOrderActionField, OrderActionStatus, CTP_FIELD_CHAR) \
+  F(CThostFtdcExchangeExecOrderActionField, UserID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeExecOrderActionField, ActionType, CTP_FIELD_CHAR)        \
+  F(CThostFtdcExchangeExecOrderActionField, BranchID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderActionField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderActionField, MacAddress, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeExecOrderActionField, reserve2, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeExecOrderActionField, Volume, CTP_FIELD_INT32)           \
+  F(CThostFtdcExchangeExecOrderActionField, IPAddress, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeExecOrderActionField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeExecOrderActionField(F)                \
+  F(CThostFtdcQryExchangeExecOrderActionField, ParticipantID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryExchangeExecOrderActionField, ClientID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryExchangeExecOrderActionField, ExchangeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryExchangeExecOrderActionField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcErrExecOrderField(F)                              \
+  F(CThostFtdcErrExecOrderField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrExecOrderField, InvestorID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrExecOrderField, reserve1, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrExecOrderField, ExecOrderRef, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrExecOrderField, UserID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcErrExecOrderField, Volume, CTP_FIELD_INT32)                      \
+  F(CThostFtdcErrExecOrderField, RequestID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcErrExecOrderField, BusinessUnit, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrExecOrderField, OffsetFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcErrExecOrderField, HedgeFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcErrExecOrderField, ActionType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcErrExecOrderField, PosiDirection, CTP_FIELD_CHAR)                \
+  F(CThostFtdcErrExecOrderField, ReservePositionFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcErrExecOrderField, CloseFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcErrExecOrderField, ExchangeID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrExecOrderField, InvestUnitID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrExecOrderField, AccountID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcErrExecOrderField, CurrencyID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrExecOrderField, ClientID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrExecOrderField, reserve2, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrExecOrderField, MacAddress, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrExecOrderField, ErrorID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcErrExecOrderField, ErrorMsg, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrExecOrderField, InstrumentID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrExecOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryErrExecOrderField(F)                           \
+  F(CThostFtdcQryErrExecOrderField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryErrExecOrderField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcErrExecOrderActionField(F)                        \
+  F(CThostFtdcErrExecOrderActionField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrExecOrderActionField, InvestorID, CTP_FIELD_STRING)           \
+  F(CThostFtdcErrExecOrderActionField, ExecOrderActionRef, CTP_FIELD_INT32)    \
+  F(CThostFtdcErrExecOrderActionField, ExecOrderRef, CTP_FIELD_STRING)         \
+  F(CThostFtdcErrExecOrderActionField, RequestID, CTP_FIELD_INT32)             \
+  F(CThostFtdcErrExecOrderActionField, FrontID, CTP_FIELD_INT32)               \
+  F(CThostFtdcErrExecOrderActionField, SessionID, CTP_FIELD_INT32)             \
+  F(CThostFtdcErrExecOrderActionField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcErrExecOrderActionField, ExecOrderSysID, CTP_FIELD_STRING)       \
+  F(CThostFtdcErrExecOrderActionField, ActionFlag, CTP_FIELD_CHAR)             \
+  F(CThostFtdcErrExecOrderActionField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrExecOrderActionField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrExecOrderActionField, InvestUnitID, CTP_FIELD_STRING)         \
+  F(CThostFtdcErrExecOrderActionField, reserve2, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrExecOrderActionField, MacAddress, CTP_FIELD_STRING)           \
+  F(CThostFtdcErrExecOrderActionField, ErrorID, CTP_FIELD_INT32)               \
+  F(CThostFtdcErrExecOrderActionField, ErrorMsg, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrExecOrderActionField, InstrumentID, CTP_FIELD_STRING)         \
+  F(CThostFtdcErrExecOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryErrExecOrderActionField(F)                     \
+  F(CThostFtdcQryErrExecOrderActionField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryErrExecOrderActionField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrTradingRightField(F)                   \
+  F(CThostFtdcOptionInstrTradingRightField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrTradingRightField, InvestorRange, CTP_FIELD_CHAR)     \
+  F(CThostFtdcOptionInstrTradingRightField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionInstrTradingRightField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionInstrTradingRightField, Direction, CTP_FIELD_CHAR)         \
+  F(CThostFtdcOptionInstrTradingRightField, TradingRight, CTP_FIELD_CHAR)      \
+  F(CThostFtdcOptionInstrTradingRightField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOptionInstrTradingRightField(F)                \
+  F(CThostFtdcQryOptionInstrTradingRightField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryOptionInstrTradingRightField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryOptionInstrTradingRightField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryOptionInstrTradingRightField, Direction, CTP_FIELD_CHAR)      \
+  F(CThostFtdcQryOptionInstrTradingRightField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputForQuoteField(F)                             \
+  F(CThostFtdcInputForQuoteField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputForQuoteField, InvestorID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputForQuoteField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputForQuoteField, ForQuoteRef, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputForQuoteField, UserID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInputForQuoteField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputForQuoteField, InvestUnitID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInputForQuoteField, reserve2, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputForQuoteField, MacAddress, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputForQuoteField, InstrumentID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInputForQuoteField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcForQuoteField(F)                                  \
+  F(CThostFtdcForQuoteField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcForQuoteField, reserve1, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, ForQuoteRef, CTP_FIELD_STRING)                    \
+  F(CThostFtdcForQuoteField, UserID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcForQuoteField, ForQuoteLocalID, CTP_FIELD_STRING)                \
+  F(CThostFtdcForQuoteField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcForQuoteField, ParticipantID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcForQuoteField, ClientID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, reserve2, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, TraderID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, InstallID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcForQuoteField, InsertDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcForQuoteField, InsertTime, CTP_FIELD_STRING)                     \
+  F(CThostFtdcForQuoteField, ForQuoteStatus, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcForQuoteField, FrontID, CTP_FIELD_INT32)                         \
+  F(CThostFtdcForQuoteField, SessionID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcForQuoteField, StatusMsg, CTP_FIELD_STRING)                      \
+  F(CThostFtdcForQuoteField, ActiveUserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcForQuoteField, BrokerForQutoSeq, CTP_FIELD_INT32)                \
+  F(CThostFtdcForQuoteField, InvestUnitID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcForQuoteField, reserve3, CTP_FIELD_STRING)                       \
+  F(CThostFtdcForQuoteField, MacAddress, CTP_FIELD_STRING)                     \
+  F(CThostFtdcForQuoteField, InstrumentID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcForQuoteField, ExchangeInstID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcForQuoteField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryForQuoteField(F)                               \
+  F(CThostFtdcQryForQuoteField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryForQuoteField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryForQuoteField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryForQuoteField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryForQuoteField, InsertTimeStart, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryForQuoteField, InsertTimeEnd, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryForQuoteField, InvestUnitID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryForQuoteField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeForQuoteField(F)                          \
+  F(CThostFtdcExchangeForQuoteField, ForQuoteLocalID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeForQuoteField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeForQuoteField, ParticipantID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeForQuoteField, ClientID, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeForQuoteField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeForQuoteField, TraderID, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeForQuoteField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcExchangeForQuoteField, InsertDate, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeForQuoteField, InsertTime, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeForQuoteField, ForQuoteStatus, CTP_FIELD_CHAR)           \
+  F(CThostFtdcExchangeForQuoteField, reserve2, CTP_FIELD_STRING)               \
+  F(CThostFtdcExchangeForQuoteField, MacAddress, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeForQuoteField, ExchangeInstID, CTP_FIELD_STRING)         \
+  F(CThostFtdcExchangeForQuoteField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeForQuoteField(F)                       \
+  F(CThostFtdcQryExchangeForQuoteField, ParticipantID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryExchangeForQuoteField, ClientID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryExchangeForQuoteField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryExchangeForQuoteField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeForQuoteField, TraderID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryExchangeForQuoteField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputQuoteField(F)                                \
+  F(CThostFtdcInputQuoteField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputQuoteField, InvestorID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputQuoteField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputQuoteField, QuoteRef, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputQuoteField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcInputQuoteField, AskPrice, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcInputQuoteField, BidPrice, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcInputQuoteField, AskVolume, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInputQuoteField, BidVolume, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInputQuoteField, RequestID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcInputQuoteField, BusinessUnit, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputQuoteField, AskOffsetFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInputQuoteField, BidOffsetFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcInputQuoteField, AskHedgeFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcInputQuoteField, BidHedgeFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcInputQuoteField, AskOrderRef, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputQuoteField, BidOrderRef, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputQuoteField, ForQuoteSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputQuoteField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputQuoteField, InvestUnitID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputQuoteField, ClientID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputQuoteField, reserve2, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInputQuoteField, MacAddress, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInputQuoteField, InstrumentID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputQuoteField, IPAddress, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInputQuoteField, ReplaceSysID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputQuoteActionField(F)                          \
+  F(CThostFtdcInputQuoteActionField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputQuoteActionField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputQuoteActionField, QuoteActionRef, CTP_FIELD_INT32)          \
+  F(CThostFtdcInputQuoteActionField, QuoteRef, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputQuoteActionField, RequestID, CTP_FIELD_INT32)               \
+  F(CThostFtdcInputQuoteActionField, FrontID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcInputQuoteActionField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcInputQuoteActionField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputQuoteActionField, QuoteSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputQuoteActionField, ActionFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcInputQuoteActionField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInputQuoteActionField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputQuoteActionField, InvestUnitID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputQuoteActionField, ClientID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputQuoteActionField, reserve2, CTP_FIELD_STRING)               \
+  F(CThostFtdcInputQuoteActionField, MacAddress, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputQuoteActionField, InstrumentID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputQuoteActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQuoteField(F)                                     \
+  F(CThostFtdcQuoteField, BrokerID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, InvestorID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, reserve1, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, QuoteRef, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, UserID, CTP_FIELD_STRING)                            \
+  F(CThostFtdcQuoteField, AskPrice, CTP_FIELD_DOUBLE)                          \
+  F(CThostFtdcQuoteField, BidPrice, CTP_FIELD_DOUBLE)                          \
+  F(CThostFtdcQuoteField, AskVolume, CTP_FIELD_INT32)                          \
+  F(CThostFtdcQuoteField, BidVolume, CTP_FIELD_INT32)                          \
+  F(CThostFtdcQuoteField, RequestID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcQuoteField, BusinessUnit, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteField, AskOffsetFlag, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcQuoteField, BidOffsetFlag, CTP_FIELD_CHAR)                       \
+  F(CThostFtdcQuoteField, AskHedgeFlag, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcQuoteField, BidHedgeFlag, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcQuoteField, QuoteLocalID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteField, ExchangeID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, ParticipantID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQuoteField, ClientID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, reserve2, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, TraderID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, InstallID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcQuoteField, NotifySequence, CTP_FIELD_INT32)                     \
+  F(CThostFtdcQuoteField, OrderSubmitStatus, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcQuoteField, TradingDay, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, SettlementID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcQuoteField, QuoteSysID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, InsertDate, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, InsertTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, CancelTime, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, QuoteStatus, CTP_FIELD_CHAR)                         \
+  F(CThostFtdcQuoteField, ClearingPartID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteField, SequenceNo, CTP_FIELD_INT32)                         \
+  F(CThostFtdcQuoteField, AskOrderSysID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQuoteField, BidOrderSysID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQuoteField, FrontID, CTP_FIELD_INT32)                            \
+  F(CThostFtdcQuoteField, SessionID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcQuoteField, UserProductInfo, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQuoteField, StatusMsg, CTP_FIELD_STRING)                         \
+  F(CThostFtdcQuoteField, ActiveUserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteField, BrokerQuoteSeq, CTP_FIELD_INT32)                     \
+  F(CThostFtdcQuoteField, AskOrderRef, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQuoteField, BidOrderRef, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQuoteField, ForQuoteSysID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQuoteField, BranchID, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, InvestUnitID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteField, AccountID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcQuoteField, CurrencyID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, reserve3, CTP_FIELD_STRING)                          \
+  F(CThostFtdcQuoteField, MacAddress, CTP_FIELD_STRING)                        \
+  F(CThostFtdcQuoteField, InstrumentID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteField, ExchangeInstID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteField, IPAddress, CTP_FIELD_STRING)                         \
+  F(CThostFtdcQuoteField, ReplaceSysID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQuoteActionField(F)                               \
+  F(CThostFtdcQuoteActionField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, QuoteActionRef, CTP_FIELD_INT32)               \
+  F(CThostFtdcQuoteActionField, QuoteRef, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, RequestID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcQuoteActionField, FrontID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcQuoteActionField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcQuoteActionField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, QuoteSysID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, ActionFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcQuoteActionField, ActionDate, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, ActionTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, TraderID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcQuoteActionField, QuoteLocalID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQuoteActionField, ActionLocalID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQuoteActionField, ParticipantID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQuoteActionField, ClientID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, BusinessUnit, CTP_FIELD_STRING)                \
+  F(CThostFtdcQuoteActionField, OrderActionStatus, CTP_FIELD_CHAR)             \
+  F(CThostFtdcQuoteActionField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQuoteActionField, StatusMsg, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQuoteActionField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, BranchID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, InvestUnitID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQuoteActionField, reserve2, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQuoteActionField, MacAddress, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQuoteActionField, InstrumentID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQuoteActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryQuoteField(F)                                  \
+  F(CThostFtdcQryQuoteField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryQuoteField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryQuoteField, reserve1, CTP_FIELD_STRING)                       \
+  F(CThostFtdcQryQuoteField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryQuoteField, QuoteSysID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryQuoteField, InsertTimeStart, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryQuoteField, InsertTimeEnd, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryQuoteField, InvestUnitID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcQryQuoteField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeQuoteField(F)                             \
+  F(CThostFtdcExchangeQuoteField, AskPrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcExchangeQuoteField, BidPrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcExchangeQuoteField, AskVolume, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeQuoteField, BidVolume, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeQuoteField, RequestID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeQuoteField, BusinessUnit, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeQuoteField, AskOffsetFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExchangeQuoteField, BidOffsetFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcExchangeQuoteField, AskHedgeFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcExchangeQuoteField, BidHedgeFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcExchangeQuoteField, QuoteLocalID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeQuoteField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, ParticipantID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeQuoteField, ClientID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeQuoteField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeQuoteField, TraderID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeQuoteField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcExchangeQuoteField, NotifySequence, CTP_FIELD_INT32)             \
+  F(CThostFtdcExchangeQuoteField, OrderSubmitStatus, CTP_FIELD_CHAR)           \
+  F(CThostFtdcExchangeQuoteField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, SettlementID, CTP_FIELD_INT32)               \
+  F(CThostFtdcExchangeQuoteField, QuoteSysID, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, InsertDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, InsertTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, CancelTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, QuoteStatus, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcExchangeQuoteField, ClearingPartID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeQuoteField, SequenceNo, CTP_FIELD_INT32)                 \
+  F(CThostFtdcExchangeQuoteField, AskOrderSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeQuoteField, BidOrderSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeQuoteField, ForQuoteSysID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeQuoteField, BranchID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeQuoteField, reserve2, CTP_FIELD_STRING)                  \
+  F(CThostFtdcExchangeQuoteField, MacAddress, CTP_FIELD_STRING)                \
+  F(CThostFtdcExchangeQuoteField, ExchangeInstID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeQuoteField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeQuoteField(F)                          \
+  F(CThostFtdcQryExchangeQuoteField, ParticipantID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeQuoteField, ClientID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeQuoteField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeQuoteField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryExchangeQuoteField, TraderID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryExchangeQuoteField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryQuoteActionField(F)                            \
+  F(CThostFtdcQryQuoteActionField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryQuoteActionField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryQuoteActionField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeQuoteActionField(F)                       \
+  F(CThostFtdcExchangeQuoteActionField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeQuoteActionField, QuoteSysID, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeQuoteActionField, ActionFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcExchangeQuoteActionField, ActionDate, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeQuoteActionField, ActionTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeQuoteActionField, TraderID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeQuoteActionField, InstallID, CTP_FIELD_INT32)            \
+  F(CThostFtdcExchangeQuoteActionField, QuoteLocalID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeQuoteActionField, ActionLocalID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeQuoteActionField, ParticipantID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeQuoteActionField, ClientID, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeQuoteActionField, BusinessUnit, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeQuoteActionField, OrderActionStatus, CTP_FIELD_CHAR)     \
+  F(CThostFtdcExchangeQuoteActionField, UserID, CTP_FIELD_STRING)              \
+  F(CThostFtdcExchangeQuoteActionField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcExchangeQuoteActionField, MacAddress, CTP_FIELD_STRING)          \
+  F(CThostFtdcExchangeQuoteActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeQuoteActionField(F)                    \
+  F(CThostFtdcQryExchangeQuoteActionField, ParticipantID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryExchangeQuoteActionField, ClientID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryExchangeQuoteActionField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryExchangeQuoteActionField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionInstrDeltaField(F)                          \
+  F(CThostFtdcOptionInstrDeltaField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcOptionInstrDeltaField, InvestorRange, CTP_FIELD_CHAR)            \
+  F(CThostFtdcOptionInstrDeltaField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcOptionInstrDeltaField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcOptionInstrDeltaField, Delta, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcOptionInstrDeltaField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcForQuoteRspField(F)                               \
+  F(CThostFtdcForQuoteRspField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcForQuoteRspField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcForQuoteRspField, ForQuoteSysID, CTP_FIELD_STRING)               \
+  F(CThostFtdcForQuoteRspField, ForQuoteTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcForQuoteRspField, ActionDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcForQuoteRspField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcForQuoteRspField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcStrikeOffsetField(F)                              \
+  F(CThostFtdcStrikeOffsetField, reserve1, CTP_FIELD_STRING)                   \
+  F(CThostFtdcStrikeOffsetField, InvestorRange, CTP_FIELD_CHAR)                \
+  F(CThostFtdcStrikeOffsetField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcStrikeOffsetField, InvestorID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcStrikeOffsetField, Offset, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcStrikeOffsetField, OffsetType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcStrikeOffsetField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryStrikeOffsetField(F)                           \
+  F(CThostFtdcQryStrikeOffsetField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryStrikeOffsetField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryStrikeOffsetField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryStrikeOffsetField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputBatchOrderActionField(F)                     \
+  F(CThostFtdcInputBatchOrderActionField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcInputBatchOrderActionField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcInputBatchOrderActionField, OrderActionRef, CTP_FIELD_INT32)     \
+  F(CThostFtdcInputBatchOrderActionField, RequestID, CTP_FIELD_INT32)          \
+  F(CThostFtdcInputBatchOrderActionField, FrontID, CTP_FIELD_INT32)            \
+  F(CThostFtdcInputBatchOrderActionField, SessionID, CTP_FIELD_INT32)          \
+  F(CThostFtdcInputBatchOrderActionField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcInputBatchOrderActionField, UserID, CTP_FIELD_STRING)            \
+  F(CThostFtdcInputBatchOrderActionField, InvestUnitID, CTP_FIELD_STRING)      \
+  F(CThostFtdcInputBatchOrderActionField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcInputBatchOrderActionField, MacAddress, CTP_FIELD_STRING)        \
+  F(CThostFtdcInputBatchOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBatchOrderActionField(F)                          \
+  F(CThostFtdcBatchOrderActionField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBatchOrderActionField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBatchOrderActionField, OrderActionRef, CTP_FIELD_INT32)          \
+  F(CThostFtdcBatchOrderActionField, RequestID, CTP_FIELD_INT32)               \
+  F(CThostFtdcBatchOrderActionField, FrontID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcBatchOrderActionField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcBatchOrderActionField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBatchOrderActionField, ActionDate, CTP_FIELD_STRING)             \
+  F(CThostFtdcBatchOrderActionField, ActionTime, CTP_FIELD_STRING)             \
+  F(CThostFtdcBatchOrderActionField, TraderID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBatchOrderActionField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcBatchOrderActionField, ActionLocalID, CTP_FIELD_STRING)          \
+  F(CThostFtdcBatchOrderActionField, ParticipantID, CTP_FIELD_STRING)          \
+  F(CThostFtdcBatchOrderActionField, ClientID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBatchOrderActionField, BusinessUnit, CTP_FIELD_STRING)           \
+  F(CThostFtdcBatchOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)        \
+  F(CThostFtdcBatchOrderActionField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcBatchOrderActionField, StatusMsg, CTP_FIELD_STRING)              \
+  F(CThostFtdcBatchOrderActionField, InvestUnitID, CTP_FIELD_STRING)           \
+  F(CThostFtdcBatchOrderActionField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcBatchOrderActionField, MacAddress, CTP_FIELD_STRING)             \
+  F(CThostFtdcBatchOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeBatchOrderActionField(F)                  \
+  F(CThostFtdcExchangeBatchOrderActionField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeBatchOrderActionField, ActionDate, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeBatchOrderActionField, ActionTime, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeBatchOrderActionField, TraderID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeBatchOrderActionField, InstallID, CTP_FIELD_INT32)       \
+  F(CThostFtdcExchangeBatchOrderActionField, ActionLocalID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeBatchOrderActionField, ParticipantID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeBatchOrderActionField, ClientID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeBatchOrderActionField, BusinessUnit, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeBatchOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)\
+  F(CThostFtdcExchangeBatchOrderActionField, UserID, CTP_FIELD_STRING)         \
+  F(CThostFtdcExchangeBatchOrderActionField, reserve1, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeBatchOrderActionField, MacAddress, CTP_FIELD_STRING)     \
+  F(CThostFtdcExchangeBatchOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBatchOrderActionField(F)                       \
+  F(CThostFtdcQryBatchOrderActionField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryBatchOrderActionField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryBatchOrderActionField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCombInstrumentGuardField(F)                       \
+  F(CThostFtdcCombInstrumentGuardField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcCombInstrumentGuardField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcCombInstrumentGuardField, GuarantRatio, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcCombInstrumentGuardField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcCombInstrumentGuardField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCombInstrumentGuardField(F)                    \
+  F(CThostFtdcQryCombInstrumentGuardField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryCombInstrumentGuardField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryCombInstrumentGuardField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryCombInstrumentGuardField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputCombActionField(F)                           \
+  F(CThostFtdcInputCombActionField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputCombActionField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInputCombActionField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputCombActionField, CombActionRef, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputCombActionField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInputCombActionField, Direction, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcInputCombActionField, Volume, CTP_FIELD_INT32)                   \
+  F(CThostFtdcInputCombActionField, CombDirection, CTP_FIELD_CHAR)             \
+  F(CThostFtdcInputCombActionField, HedgeFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcInputCombActionField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInputCombActionField, reserve2, CTP_FIELD_STRING)                \
+  F(CThostFtdcInputCombActionField, MacAddress, CTP_FIELD_STRING)              \
+  F(CThostFtdcInputCombActionField, InvestUnitID, CTP_FIELD_STRING)            \
+  F(CThostFtdcInputCombActionField, FrontID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcInputCombActionField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcInputCombActionField, InstrumentID, CTP_FIELD_STRING)            \
+  F(CThostFtdcInputCombActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCombActionField(F)                                \
+  F(CThostFtdcCombActionField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, InvestorID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCombActionField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, CombActionRef, CTP_FIELD_STRING)                \
+  F(CThostFtdcCombActionField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcCombActionField, Direction, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcCombActionField, Volume, CTP_FIELD_INT32)                        \
+  F(CThostFtdcCombActionField, CombDirection, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcCombActionField, HedgeFlag, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcCombActionField, ActionLocalID, CTP_FIELD_STRING)                \
+  F(CThostFtdcCombActionField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCombActionField, ParticipantID, CTP_FIELD_STRING)                \
+  F(CThostFtdcCombActionField, ClientID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, reserve2, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, TraderID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, InstallID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcCombActionField, ActionStatus, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcCombActionField, NotifySequence, CTP_FIELD_INT32)                \
+  F(CThostFtdcCombActionField, TradingDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCombActionField, SettlementID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcCombActionField, SequenceNo, CTP_FIELD_INT32)                    \
+  F(CThostFtdcCombActionField, FrontID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcCombActionField, SessionID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcCombActionField, UserProductInfo, CTP_FIELD_STRING)              \
+  F(CThostFtdcCombActionField, StatusMsg, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCombActionField, reserve3, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, MacAddress, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCombActionField, ComTradeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCombActionField, BranchID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCombActionField, InvestUnitID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCombActionField, InstrumentID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCombActionField, ExchangeInstID, CTP_FIELD_STRING)               \
+  F(CThostFtdcCombActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCombActionField(F)                             \
+  F(CThostFtdcQryCombActionField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryCombActionField, InvestorID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryCombActionField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryCombActionField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryCombActionField, InvestUnitID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryCombActionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeCombActionField(F)                        \
+  F(CThostFtdcExchangeCombActionField, Direction, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeCombActionField, Volume, CTP_FIELD_INT32)                \
+  F(CThostFtdcExchangeCombActionField, CombDirection, CTP_FIELD_CHAR)          \
+  F(CThostFtdcExchangeCombActionField, HedgeFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcExchangeCombActionField, ActionLocalID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeCombActionField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcExchangeCombActionField, ParticipantID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeCombActionField, ClientID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeCombActionField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeCombActionField, TraderID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeCombActionField, InstallID, CTP_FIELD_INT32)             \
+  F(CThostFtdcExchangeCombActionField, ActionStatus, CTP_FIELD_CHAR)           \
+  F(CThostFtdcExchangeCombActionField, NotifySequence, CTP_FIELD_INT32)        \
+  F(CThostFtdcExchangeCombActionField, TradingDay, CTP_FIELD_STRING)           \
+  F(CThostFtdcExchangeCombActionField, SettlementID, CTP_FIELD_INT32)          \
+  F(CThostFtdcExchangeCombActionField, SequenceNo, CTP_FIELD_INT32)            \
+  F(CThostFtdcExchangeCombActionField, reserve2, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeCombActionField, MacAddress, CTP_FIELD_STRING)           \
+  F(CThostFtdcExchangeCombActionField, ComTradeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcExchangeCombActionField, BranchID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeCombActionField, ExchangeInstID, CTP_FIELD_STRING)       \
+  F(CThostFtdcExchangeCombActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeCombActionField(F)                     \
+  F(CThostFtdcQryExchangeCombActionField, ParticipantID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryExchangeCombActionField, ClientID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeCombActionField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeCombActionField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryExchangeCombActionField, TraderID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryExchangeCombActionField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcProductExchRateField(F)                           \
+  F(CThostFtdcProductExchRateField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcProductExchRateField, QuoteCurrencyID, CTP_FIELD_STRING)         \
+  F(CThostFtdcProductExchRateField, ExchangeRate, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcProductExchRateField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcProductExchRateField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryProductExchRateField(F)                        \
+  F(CThostFtdcQryProductExchRateField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryProductExchRateField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryProductExchRateField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryForQuoteParamField(F)                          \
+  F(CThostFtdcQryForQuoteParamField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryForQuoteParamField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryForQuoteParamField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryForQuoteParamField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcForQuoteParamField(F)                             \
+  F(CThostFtdcForQuoteParamField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcForQuoteParamField, reserve1, CTP_FIELD_STRING)                  \
+  F(CThostFtdcForQuoteParamField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcForQuoteParamField, LastPrice, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcForQuoteParamField, PriceInterval, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcForQuoteParamField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMMOptionInstrCommRateField(F)                     \
+  F(CThostFtdcMMOptionInstrCommRateField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcMMOptionInstrCommRateField, InvestorRange, CTP_FIELD_CHAR)       \
+  F(CThostFtdcMMOptionInstrCommRateField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcMMOptionInstrCommRateField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcMMOptionInstrCommRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcMMOptionInstrCommRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcMMOptionInstrCommRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcMMOptionInstrCommRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMOptionInstrCommRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMOptionInstrCommRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMOptionInstrCommRateField, StrikeRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMOptionInstrCommRateField, StrikeRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMOptionInstrCommRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryMMOptionInstrCommRateField(F)                  \
+  F(CThostFtdcQryMMOptionInstrCommRateField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryMMOptionInstrCommRateField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryMMOptionInstrCommRateField, reserve1, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryMMOptionInstrCommRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMMInstrumentCommissionRateField(F)                \
+  F(CThostFtdcMMInstrumentCommissionRateField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcMMInstrumentCommissionRateField, InvestorRange, CTP_FIELD_CHAR)  \
+  F(CThostFtdcMMInstrumentCommissionRateField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcMMInstrumentCommissionRateField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcMMInstrumentCommissionRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMMInstrumentCommissionRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryMMInstrumentCommissionRateField(F)             \
+  F(CThostFtdcQryMMInstrumentCommissionRateField, BrokerID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryMMInstrumentCommissionRateField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryMMInstrumentCommissionRateField, reserve1, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryMMInstrumentCommissionRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentOrderCommRateField(F)                   \
+  F(CThostFtdcInstrumentOrderCommRateField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcInstrumentOrderCommRateField, InvestorRange, CTP_FIELD_CHAR)     \
+  F(CThostFtdcInstrumentOrderCommRateField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcInstrumentOrderCommRateField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcInstrumentOrderCommRateField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcInstrumentOrderCommRateField, OrderCommByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentOrderCommRateField, OrderActionCommByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentOrderCommRateField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcInstrumentOrderCommRateField, InvestUnitID, CTP_FIELD_STRING)    \
+  F(CThostFtdcInstrumentOrderCommRateField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcInstrumentOrderCommRateField, OrderCommByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentOrderCommRateField, OrderActionCommByTrade, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentOrderCommRateField(F)                \
+  F(CThostFtdcQryInstrumentOrderCommRateField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryInstrumentOrderCommRateField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryInstrumentOrderCommRateField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryInstrumentOrderCommRateField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradeParamField(F)                                \
+  F(CThostFtdcTradeParamField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcTradeParamField, TradeParamID, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcTradeParamField, TradeParamValue, CTP_FIELD_STRING)              \
+  F(CThostFtdcTradeParamField, Memo, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentMarginRateULField(F)                    \
+  F(CThostFtdcInstrumentMarginRateULField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentMarginRateULField, InvestorRange, CTP_FIELD_CHAR)      \
+  F(CThostFtdcInstrumentMarginRateULField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentMarginRateULField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInstrumentMarginRateULField, HedgeFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcInstrumentMarginRateULField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateULField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateULField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateULField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInstrumentMarginRateULField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcFutureLimitPosiParamField(F)                      \
+  F(CThostFtdcFutureLimitPosiParamField, InvestorRange, CTP_FIELD_CHAR)        \
+  F(CThostFtdcFutureLimitPosiParamField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcFutureLimitPosiParamField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcFutureLimitPosiParamField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcFutureLimitPosiParamField, SpecOpenVolume, CTP_FIELD_INT32)      \
+  F(CThostFtdcFutureLimitPosiParamField, ArbiOpenVolume, CTP_FIELD_INT32)      \
+  F(CThostFtdcFutureLimitPosiParamField, OpenVolume, CTP_FIELD_INT32)          \
+  F(CThostFtdcFutureLimitPosiParamField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcLoginForbiddenIPField(F)                          \
+  F(CThostFtdcLoginForbiddenIPField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcLoginForbiddenIPField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcIPListField(F)                                    \
+  F(CThostFtdcIPListField, reserve1, CTP_FIELD_STRING)                         \
+  F(CThostFtdcIPListField, IsWhite, CTP_FIELD_INT32)                           \
+  F(CThostFtdcIPListField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputOptionSelfCloseField(F)                      \
+  F(CThostFtdcInputOptionSelfCloseField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOptionSelfCloseField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputOptionSelfCloseField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOptionSelfCloseField, OptionSelfCloseRef, CTP_FIELD_STRING) \
+  F(CThostFtdcInputOptionSelfCloseField, UserID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInputOptionSelfCloseField, Volume, CTP_FIELD_INT32)              \
+  F(CThostFtdcInputOptionSelfCloseField, RequestID, CTP_FIELD_INT32)           \
+  F(CThostFtdcInputOptionSelfCloseField, BusinessUnit, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputOptionSelfCloseField, HedgeFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcInputOptionSelfCloseField, OptSelfCloseFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcInputOptionSelfCloseField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputOptionSelfCloseField, InvestUnitID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputOptionSelfCloseField, AccountID, CTP_FIELD_STRING)          \
+  F(CThostFtdcInputOptionSelfCloseField, CurrencyID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputOptionSelfCloseField, ClientID, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOptionSelfCloseField, reserve2, CTP_FIELD_STRING)           \
+  F(CThostFtdcInputOptionSelfCloseField, MacAddress, CTP_FIELD_STRING)         \
+  F(CThostFtdcInputOptionSelfCloseField, InstrumentID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputOptionSelfCloseField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInputOptionSelfCloseActionField(F)                \
+  F(CThostFtdcInputOptionSelfCloseActionField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInputOptionSelfCloseActionField, OptionSelfCloseActionRef, CTP_FIELD_INT32)\
+  F(CThostFtdcInputOptionSelfCloseActionField, OptionSelfCloseRef, CTP_FIELD_STRING)\
+  F(CThostFtdcInputOptionSelfCloseActionField, RequestID, CTP_FIELD_INT32)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, FrontID, CTP_FIELD_INT32)       \
+  F(CThostFtdcInputOptionSelfCloseActionField, SessionID, CTP_FIELD_INT32)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, ExchangeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInputOptionSelfCloseActionField, OptionSelfCloseSysID, CTP_FIELD_STRING)\
+  F(CThostFtdcInputOptionSelfCloseActionField, ActionFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, UserID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInputOptionSelfCloseActionField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, InvestUnitID, CTP_FIELD_STRING) \
+  F(CThostFtdcInputOptionSelfCloseActionField, reserve2, CTP_FIELD_STRING)     \
+  F(CThostFtdcInputOptionSelfCloseActionField, MacAddress, CTP_FIELD_STRING)   \
+  F(CThostFtdcInputOptionSelfCloseActionField, InstrumentID, CTP_FIELD_STRING) \
+  F(CThostFtdcInputOptionSelfCloseActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionSelfCloseField(F)                           \
+  F(CThostFtdcOptionSelfCloseField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, OptionSelfCloseRef, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionSelfCloseField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOptionSelfCloseField, Volume, CTP_FIELD_INT32)                   \
+  F(CThostFtdcOptionSelfCloseField, RequestID, CTP_FIELD_INT32)                \
+  F(CThostFtdcOptionSelfCloseField, BusinessUnit, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionSelfCloseField, HedgeFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcOptionSelfCloseField, OptSelfCloseFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcOptionSelfCloseField, OptionSelfCloseLocalID, CTP_FIELD_STRING)  \
+  F(CThostFtdcOptionSelfCloseField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, ParticipantID, CTP_FIELD_STRING)           \
+  F(CThostFtdcOptionSelfCloseField, ClientID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, reserve2, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, TraderID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, InstallID, CTP_FIELD_INT32)                \
+  F(CThostFtdcOptionSelfCloseField, OrderSubmitStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcOptionSelfCloseField, NotifySequence, CTP_FIELD_INT32)           \
+  F(CThostFtdcOptionSelfCloseField, TradingDay, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, SettlementID, CTP_FIELD_INT32)             \
+  F(CThostFtdcOptionSelfCloseField, OptionSelfCloseSysID, CTP_FIELD_STRING)    \
+  F(CThostFtdcOptionSelfCloseField, InsertDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, InsertTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, CancelTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, ExecResult, CTP_FIELD_CHAR)                \
+  F(CThostFtdcOptionSelfCloseField, ClearingPartID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseField, SequenceNo, CTP_FIELD_INT32)               \
+  F(CThostFtdcOptionSelfCloseField, FrontID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcOptionSelfCloseField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcOptionSelfCloseField, UserProductInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcOptionSelfCloseField, StatusMsg, CTP_FIELD_STRING)               \
+  F(CThostFtdcOptionSelfCloseField, ActiveUserID, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionSelfCloseField, BrokerOptionSelfCloseSeq, CTP_FIELD_INT32) \
+  F(CThostFtdcOptionSelfCloseField, BranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, InvestUnitID, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionSelfCloseField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcOptionSelfCloseField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, reserve3, CTP_FIELD_STRING)                \
+  F(CThostFtdcOptionSelfCloseField, MacAddress, CTP_FIELD_STRING)              \
+  F(CThostFtdcOptionSelfCloseField, InstrumentID, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionSelfCloseField, ExchangeInstID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOptionSelfCloseActionField(F)                     \
+  F(CThostFtdcOptionSelfCloseActionField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionSelfCloseActionField, OptionSelfCloseActionRef, CTP_FIELD_INT32)\
+  F(CThostFtdcOptionSelfCloseActionField, OptionSelfCloseRef, CTP_FIELD_STRING)\
+  F(CThostFtdcOptionSelfCloseActionField, RequestID, CTP_FIELD_INT32)          \
+  F(CThostFtdcOptionSelfCloseActionField, FrontID, CTP_FIELD_INT32)            \
+  F(CThostFtdcOptionSelfCloseActionField, SessionID, CTP_FIELD_INT32)          \
+  F(CThostFtdcOptionSelfCloseActionField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionSelfCloseActionField, OptionSelfCloseSysID, CTP_FIELD_STRING)\
+  F(CThostFtdcOptionSelfCloseActionField, ActionFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcOptionSelfCloseActionField, ActionDate, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionSelfCloseActionField, ActionTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionSelfCloseActionField, TraderID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, InstallID, CTP_FIELD_INT32)          \
+  F(CThostFtdcOptionSelfCloseActionField, OptionSelfCloseLocalID, CTP_FIELD_STRING)\
+  F(CThostFtdcOptionSelfCloseActionField, ActionLocalID, CTP_FIELD_STRING)     \
+  F(CThostFtdcOptionSelfCloseActionField, ParticipantID, CTP_FIELD_STRING)     \
+  F(CThostFtdcOptionSelfCloseActionField, ClientID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, BusinessUnit, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionSelfCloseActionField, OrderActionStatus, CTP_FIELD_CHAR)   \
+  F(CThostFtdcOptionSelfCloseActionField, UserID, CTP_FIELD_STRING)            \
+  F(CThostFtdcOptionSelfCloseActionField, StatusMsg, CTP_FIELD_STRING)         \
+  F(CThostFtdcOptionSelfCloseActionField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, BranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, InvestUnitID, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionSelfCloseActionField, reserve2, CTP_FIELD_STRING)          \
+  F(CThostFtdcOptionSelfCloseActionField, MacAddress, CTP_FIELD_STRING)        \
+  F(CThostFtdcOptionSelfCloseActionField, InstrumentID, CTP_FIELD_STRING)      \
+  F(CThostFtdcOptionSelfCloseActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOptionSelfCloseField(F)                        \
+  F(CThostFtdcQryOptionSelfCloseField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryOptionSelfCloseField, InvestorID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryOptionSelfCloseField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryOptionSelfCloseField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryOptionSelfCloseField, OptionSelfCloseSysID, CTP_FIELD_STRING) \
+  F(CThostFtdcQryOptionSelfCloseField, InsertTimeStart, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryOptionSelfCloseField, InsertTimeEnd, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryOptionSelfCloseField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOptionSelfCloseField(F)                   \
+  F(CThostFtdcExchangeOptionSelfCloseField, Volume, CTP_FIELD_INT32)           \
+  F(CThostFtdcExchangeOptionSelfCloseField, RequestID, CTP_FIELD_INT32)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, BusinessUnit, CTP_FIELD_STRING)    \
+  F(CThostFtdcExchangeOptionSelfCloseField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcExchangeOptionSelfCloseField, OptSelfCloseFlag, CTP_FIELD_CHAR)  \
+  F(CThostFtdcExchangeOptionSelfCloseField, OptionSelfCloseLocalID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, ParticipantID, CTP_FIELD_STRING)   \
+  F(CThostFtdcExchangeOptionSelfCloseField, ClientID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, TraderID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, InstallID, CTP_FIELD_INT32)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, OrderSubmitStatus, CTP_FIELD_CHAR) \
+  F(CThostFtdcExchangeOptionSelfCloseField, NotifySequence, CTP_FIELD_INT32)   \
+  F(CThostFtdcExchangeOptionSelfCloseField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, SettlementID, CTP_FIELD_INT32)     \
+  F(CThostFtdcExchangeOptionSelfCloseField, OptionSelfCloseSysID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseField, InsertDate, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, InsertTime, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, CancelTime, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, ExecResult, CTP_FIELD_CHAR)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, ClearingPartID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseField, SequenceNo, CTP_FIELD_INT32)       \
+  F(CThostFtdcExchangeOptionSelfCloseField, BranchID, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, reserve2, CTP_FIELD_STRING)        \
+  F(CThostFtdcExchangeOptionSelfCloseField, MacAddress, CTP_FIELD_STRING)      \
+  F(CThostFtdcExchangeOptionSelfCloseField, ExchangeInstID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryOptionSelfCloseActionField(F)                  \
+  F(CThostFtdcQryOptionSelfCloseActionField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryOptionSelfCloseActionField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryOptionSelfCloseActionField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeOptionSelfCloseActionField(F)             \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ExchangeID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, OptionSelfCloseSysID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ActionFlag, CTP_FIELD_CHAR)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ActionDate, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ActionTime, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, TraderID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, InstallID, CTP_FIELD_INT32)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, OptionSelfCloseLocalID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ActionLocalID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ParticipantID, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ClientID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, BusinessUnit, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, OrderActionStatus, CTP_FIELD_CHAR)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, UserID, CTP_FIELD_STRING)    \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, BranchID, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, reserve1, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, MacAddress, CTP_FIELD_STRING)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, reserve2, CTP_FIELD_STRING)  \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, OptSelfCloseFlag, CTP_FIELD_CHAR)\
+  F(CThostFtdcExchangeOptionSelfCloseActionField, IPAddress, CTP_FIELD_STRING) \
+  F(CThostFtdcExchangeOptionSelfCloseActionField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncDelaySwapField(F)                             \
+  F(CThostFtdcSyncDelaySwapField, DelaySwapSeqNo, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncDelaySwapField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSyncDelaySwapField, InvestorID, CTP_FIELD_STRING)                \
+  F(CThostFtdcSyncDelaySwapField, FromCurrencyID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncDelaySwapField, FromAmount, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcSyncDelaySwapField, FromFrozenSwap, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcSyncDelaySwapField, FromRemainSwap, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcSyncDelaySwapField, ToCurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcSyncDelaySwapField, ToAmount, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcSyncDelaySwapField, IsManualSwap, CTP_FIELD_INT32)               \
+  F(CThostFtdcSyncDelaySwapField, IsAllRemainSetZero, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcQrySyncDelaySwapField(F)                          \
+  F(CThostFtdcQrySyncDelaySwapField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQrySyncDelaySwapField, DelaySwapSeqNo, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestUnitField(F)                                \
+  F(CThostFtdcInvestUnitField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcInvestUnitField, InvestorID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcInvestUnitField, InvestUnitID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcInvestUnitField, InvestorUnitName, CTP_FIELD_STRING)             \
+  F(CThostFtdcInvestUnitField, InvestorGroupID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInvestUnitField, CommModelID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcInvestUnitField, MarginModelID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInvestUnitField, AccountID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcInvestUnitField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInvestUnitField(F)                             \
+  F(CThostFtdcQryInvestUnitField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryInvestUnitField, InvestorID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryInvestUnitField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSecAgentCheckModeField(F)                         \
+  F(CThostFtdcSecAgentCheckModeField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSecAgentCheckModeField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcSecAgentCheckModeField, CurrencyID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSecAgentCheckModeField, BrokerSecAgentID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSecAgentCheckModeField, CheckSelfAccount, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSecAgentTradeInfoField(F)                         \
+  F(CThostFtdcSecAgentTradeInfoField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcSecAgentTradeInfoField, BrokerSecAgentID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSecAgentTradeInfoField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSecAgentTradeInfoField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMarketDataField(F)                                \
+  F(CThostFtdcMarketDataField, TradingDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcMarketDataField, reserve1, CTP_FIELD_STRING)                     \
+  F(CThostFtdcMarketDataField, ExchangeID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcMarketDataField, reserve2, CTP_FIELD_STRING)                     \
+  F(CThostFtdcMarketDataField, LastPrice, CTP_FIELD_DOUBLE)                    \
+  F(CThostFtdcMarketDataField, PreSettlementPrice, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMarketDataField, PreClosePrice, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcMarketDataField, PreOpenInterest, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcMarketDataField, OpenPrice, CTP_FIELD_DOUBLE)                    \
+  F(CThostFtdcMarketDataField, HighestPrice, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcMarketDataField, LowestPrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcMarketDataField, Volume, CTP_FIELD_INT32)                        \
+  F(CThostFtdcMarketDataField, Turnover, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcMarketDataField, OpenInterest, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcMarketDataField, ClosePrice, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcMarketDataField, SettlementPrice, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcMarketDataField, UpperLimitPrice, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcMarketDataField, LowerLimitPrice, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcMarketDataField, PreDelta, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcMarketDataField, CurrDelta, CTP_FIELD_DOUBLE)                    \
+  F(CThostFtdcMarketDataField, UpdateTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcMarketDataField, UpdateMillisec, CTP_FIELD_INT32)                \
+  F(CThostFtdcMarketDataField, ActionDay, CTP_FIELD_STRING)                    \
+  F(CThostFtdcMarketDataField, InstrumentID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcMarketDataField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMarketDataBaseField(F)                            \
+  F(CThostFtdcMarketDataBaseField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcMarketDataBaseField, PreSettlementPrice, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcMarketDataBaseField, PreClosePrice, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcMarketDataBaseField, PreOpenInterest, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcMarketDataBaseField, PreDelta, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcMarketDataStaticField(F)                          \
+  F(CThostFtdcMarketDataStaticField, OpenPrice, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcMarketDataStaticField, HighestPrice, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMarketDataStaticField, LowestPrice, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcMarketDataStaticField, ClosePrice, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcMarketDataStaticField, UpperLimitPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcMarketDataStaticField, LowerLimitPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcMarketDataStaticField, SettlementPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcMarketDataStaticField, CurrDelta, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcMarketDataLastMatchField(F)                       \
+  F(CThostFtdcMarketDataLastMatchField, LastPrice, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMarketDataLastMatchField, Volume, CTP_FIELD_INT32)               \
+  F(CThostFtdcMarketDataLastMatchField, Turnover, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcMarketDataLastMatchField, OpenInterest, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcMarketDataBestPriceField(F)                       \
+  F(CThostFtdcMarketDataBestPriceField, BidPrice1, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMarketDataBestPriceField, BidVolume1, CTP_FIELD_INT32)           \
+  F(CThostFtdcMarketDataBestPriceField, AskPrice1, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMarketDataBestPriceField, AskVolume1, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcMarketDataBid23Field(F)                           \
+  F(CThostFtdcMarketDataBid23Field, BidPrice2, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataBid23Field, BidVolume2, CTP_FIELD_INT32)               \
+  F(CThostFtdcMarketDataBid23Field, BidPrice3, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataBid23Field, BidVolume3, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcMarketDataAsk23Field(F)                           \
+  F(CThostFtdcMarketDataAsk23Field, AskPrice2, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataAsk23Field, AskVolume2, CTP_FIELD_INT32)               \
+  F(CThostFtdcMarketDataAsk23Field, AskPrice3, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataAsk23Field, AskVolume3, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcMarketDataBid45Field(F)                           \
+  F(CThostFtdcMarketDataBid45Field, BidPrice4, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataBid45Field, BidVolume4, CTP_FIELD_INT32)               \
+  F(CThostFtdcMarketDataBid45Field, BidPrice5, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataBid45Field, BidVolume5, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcMarketDataAsk45Field(F)                           \
+  F(CThostFtdcMarketDataAsk45Field, AskPrice4, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataAsk45Field, AskVolume4, CTP_FIELD_INT32)               \
+  F(CThostFtdcMarketDataAsk45Field, AskPrice5, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcMarketDataAsk45Field, AskVolume5, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcMarketDataUpdateTimeField(F)                      \
+  F(CThostFtdcMarketDataUpdateTimeField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcMarketDataUpdateTimeField, UpdateTime, CTP_FIELD_STRING)         \
+  F(CThostFtdcMarketDataUpdateTimeField, UpdateMillisec, CTP_FIELD_INT32)      \
+  F(CThostFtdcMarketDataUpdateTimeField, ActionDay, CTP_FIELD_STRING)          \
+  F(CThostFtdcMarketDataUpdateTimeField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMarketDataBandingPriceField(F)                    \
+  F(CThostFtdcMarketDataBandingPriceField, BandingUpperPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcMarketDataBandingPriceField, BandingLowerPrice, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcMarketDataExchangeField(F)                        \
+  F(CThostFtdcMarketDataExchangeField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSpecificInstrumentField(F)                        \
+  F(CThostFtdcSpecificInstrumentField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcSpecificInstrumentField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInstrumentStatusField(F)                          \
+  F(CThostFtdcInstrumentStatusField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcInstrumentStatusField, reserve1, CTP_FIELD_STRING)               \
+  F(CThostFtdcInstrumentStatusField, SettlementGroupID, CTP_FIELD_STRING)      \
+  F(CThostFtdcInstrumentStatusField, reserve2, CTP_FIELD_STRING)               \
+  F(CThostFtdcInstrumentStatusField, InstrumentStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcInstrumentStatusField, TradingSegmentSN, CTP_FIELD_INT32)        \
+  F(CThostFtdcInstrumentStatusField, EnterTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcInstrumentStatusField, EnterReason, CTP_FIELD_CHAR)              \
+  F(CThostFtdcInstrumentStatusField, ExchangeInstID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInstrumentStatusField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInstrumentStatusField(F)                       \
+  F(CThostFtdcQryInstrumentStatusField, ExchangeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryInstrumentStatusField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryInstrumentStatusField, ExchangeInstID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestorAccountField(F)                           \
+  F(CThostFtdcInvestorAccountField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcInvestorAccountField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcInvestorAccountField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcInvestorAccountField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcPositionProfitAlgorithmField(F)                   \
+  F(CThostFtdcPositionProfitAlgorithmField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcPositionProfitAlgorithmField, AccountID, CTP_FIELD_STRING)       \
+  F(CThostFtdcPositionProfitAlgorithmField, Algorithm, CTP_FIELD_CHAR)         \
+  F(CThostFtdcPositionProfitAlgorithmField, Memo, CTP_FIELD_STRING)            \
+  F(CThostFtdcPositionProfitAlgorithmField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcDiscountField(F)                                  \
+  F(CThostFtdcDiscountField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcDiscountField, InvestorRange, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcDiscountField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcDiscountField, Discount, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcQryTransferBankField(F)                           \
+  F(CThostFtdcQryTransferBankField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryTransferBankField, BankBrchID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferBankField(F)                              \
+  F(CThostFtdcTransferBankField, BankID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcTransferBankField, BankBrchID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTransferBankField, BankName, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTransferBankField, IsActive, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorPositionDetailField(F)                 \
+  F(CThostFtdcQryInvestorPositionDetailField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInvestorPositionDetailField, InvestorID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInvestorPositionDetailField, reserve1, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryInvestorPositionDetailField, ExchangeID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryInvestorPositionDetailField, InvestUnitID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryInvestorPositionDetailField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestorPositionDetailField(F)                    \
+  F(CThostFtdcInvestorPositionDetailField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcInvestorPositionDetailField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcInvestorPositionDetailField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInvestorPositionDetailField, HedgeFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcInvestorPositionDetailField, Direction, CTP_FIELD_CHAR)          \
+  F(CThostFtdcInvestorPositionDetailField, OpenDate, CTP_FIELD_STRING)         \
+  F(CThostFtdcInvestorPositionDetailField, TradeID, CTP_FIELD_STRING)          \
+  F(CThostFtdcInvestorPositionDetailField, Volume, CTP_FIELD_INT32)            \
+  F(CThostFtdcInvestorPositionDetailField, OpenPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcInvestorPositionDetailField, TradingDay, CTP_FIELD_STRING)       \
+  F(CThostFtdcInvestorPositionDetailField, SettlementID, CTP_FIELD_INT32)      \
+  F(CThostFtdcInvestorPositionDetailField, TradeType, CTP_FIELD_CHAR)          \
+  F(CThostFtdcInvestorPositionDetailField, reserve2, CTP_FIELD_STRING)         \
+  F(CThostFtdcInvestorPositionDetailField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcInvestorPositionDetailField, CloseProfitByDate, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, CloseProfitByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, PositionProfitByDate, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, PositionProfitByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, Margin, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcInvestorPositionDetailField, ExchMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcInvestorPositionDetailField, MarginRateByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, MarginRateByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, LastSettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionDetailField, SettlementPrice, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcInvestorPositionDetailField, CloseVolume, CTP_FIELD_INT32)       \
+  F(CThostFtdcInvestorPositionDetailField, CloseAmount, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcInvestorPositionDetailField, TimeFirstVolume, CTP_FIELD_INT32)   \
+  F(CThostFtdcInvestorPositionDetailField, InvestUnitID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInvestorPositionDetailField, SpecPosiType, CTP_FIELD_CHAR)       \
+  F(CThostFtdcInvestorPositionDetailField, InstrumentID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInvestorPositionDetailField, CombInstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingAccountPasswordField(F)                    \
+  F(CThostFtdcTradingAccountPasswordField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcTradingAccountPasswordField, AccountID, CTP_FIELD_STRING)        \
+  F(CThostFtdcTradingAccountPasswordField, Password, CTP_FIELD_STRING)         \
+  F(CThostFtdcTradingAccountPasswordField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMDTraderOfferField(F)                             \
+  F(CThostFtdcMDTraderOfferField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcMDTraderOfferField, TraderID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcMDTraderOfferField, ParticipantID, CTP_FIELD_STRING)             \
+  F(CThostFtdcMDTraderOfferField, Password, CTP_FIELD_STRING)                  \
+  F(CThostFtdcMDTraderOfferField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcMDTraderOfferField, OrderLocalID, CTP_FIELD_STRING)              \
+  F(CThostFtdcMDTraderOfferField, TraderConnectStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcMDTraderOfferField, ConnectRequestDate, CTP_FIELD_STRING)        \
+  F(CThostFtdcMDTraderOfferField, ConnectRequestTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcMDTraderOfferField, LastReportDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcMDTraderOfferField, LastReportTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcMDTraderOfferField, ConnectDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcMDTraderOfferField, ConnectTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcMDTraderOfferField, StartDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcMDTraderOfferField, StartTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcMDTraderOfferField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcMDTraderOfferField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcMDTraderOfferField, MaxTradeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcMDTraderOfferField, MaxOrderMessageReference, CTP_FIELD_STRING)  \
+  F(CThostFtdcMDTraderOfferField, OrderCancelAlg, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcQryMDTraderOfferField(F)                          \
+  F(CThostFtdcQryMDTraderOfferField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryMDTraderOfferField, ParticipantID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryMDTraderOfferField, TraderID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryNoticeField(F)                                 \
+  F(CThostFtdcQryNoticeField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcNoticeField(F)                                    \
+  F(CThostFtdcNoticeField, BrokerID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcNoticeField, Content, CTP_FIELD_STRING)                          \
+  F(CThostFtdcNoticeField, SequenceLabel, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcUserRightField(F)                                 \
+  F(CThostFtdcUserRightField, BrokerID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcUserRightField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcUserRightField, UserRightType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcUserRightField, IsForbidden, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcQrySettlementInfoConfirmField(F)                  \
+  F(CThostFtdcQrySettlementInfoConfirmField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQrySettlementInfoConfirmField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQrySettlementInfoConfirmField, AccountID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQrySettlementInfoConfirmField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcLoadSettlementInfoField(F)                        \
+  F(CThostFtdcLoadSettlementInfoField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerWithdrawAlgorithmField(F)                   \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, WithdrawAlgorithm, CTP_FIELD_CHAR) \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, UsingRatio, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, IncludeCloseProfit, CTP_FIELD_CHAR)\
+  F(CThostFtdcBrokerWithdrawAlgorithmField, AllWithoutTrade, CTP_FIELD_CHAR)   \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, AvailIncludeCloseProfit, CTP_FIELD_CHAR)\
+  F(CThostFtdcBrokerWithdrawAlgorithmField, IsBrokerUserEvent, CTP_FIELD_INT32)\
+  F(CThostFtdcBrokerWithdrawAlgorithmField, CurrencyID, CTP_FIELD_STRING)      \
+  F(CThostFtdcBrokerWithdrawAlgorithmField, FundMortgageRatio, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcBrokerWithdrawAlgorithmField, BalanceAlgorithm, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcTradingAccountPasswordUpdateV1Field(F)            \
+  F(CThostFtdcTradingAccountPasswordUpdateV1Field, BrokerID, CTP_FIELD_STRING) \
+  F(CThostFtdcTradingAccountPasswordUpdateV1Field, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcTradingAccountPasswordUpdateV1Field, OldPassword, CTP_FIELD_STRING)\
+  F(CThostFtdcTradingAccountPasswordUpdateV1Field, NewPassword, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingAccountPasswordUpdateField(F)              \
+  F(CThostFtdcTradingAccountPasswordUpdateField, BrokerID, CTP_FIELD_STRING)   \
+  F(CThostFtdcTradingAccountPasswordUpdateField, AccountID, CTP_FIELD_STRING)  \
+  F(CThostFtdcTradingAccountPasswordUpdateField, OldPassword, CTP_FIELD_STRING)\
+  F(CThostFtdcTradingAccountPasswordUpdateField, NewPassword, CTP_FIELD_STRING)\
+  F(CThostFtdcTradingAccountPasswordUpdateField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCombinationLegField(F)                         \
+  F(CThostFtdcQryCombinationLegField, reserve1, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryCombinationLegField, LegID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcQryCombinationLegField, reserve2, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryCombinationLegField, CombInstrumentID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryCombinationLegField, LegInstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySyncStatusField(F)                             \
+  F(CThostFtdcQrySyncStatusField, TradingDay, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCombinationLegField(F)                            \
+  F(CThostFtdcCombinationLegField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCombinationLegField, LegID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcCombinationLegField, reserve2, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCombinationLegField, Direction, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcCombinationLegField, LegMultiple, CTP_FIELD_INT32)               \
+  F(CThostFtdcCombinationLegField, ImplyLevel, CTP_FIELD_INT32)                \
+  F(CThostFtdcCombinationLegField, CombInstrumentID, CTP_FIELD_STRING)         \
+  F(CThostFtdcCombinationLegField, LegInstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncStatusField(F)                                \
+  F(CThostFtdcSyncStatusField, TradingDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcSyncStatusField, DataSyncStatus, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcQryLinkManField(F)                                \
+  F(CThostFtdcQryLinkManField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcQryLinkManField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcLinkManField(F)                                   \
+  F(CThostFtdcLinkManField, BrokerID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcLinkManField, InvestorID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLinkManField, PersonType, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcLinkManField, IdentifiedCardType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcLinkManField, IdentifiedCardNo, CTP_FIELD_STRING)                \
+  F(CThostFtdcLinkManField, PersonName, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLinkManField, Telephone, CTP_FIELD_STRING)                       \
+  F(CThostFtdcLinkManField, Address, CTP_FIELD_STRING)                         \
+  F(CThostFtdcLinkManField, ZipCode, CTP_FIELD_STRING)                         \
+  F(CThostFtdcLinkManField, Priority, CTP_FIELD_INT32)                         \
+  F(CThostFtdcLinkManField, UOAZipCode, CTP_FIELD_STRING)                      \
+  F(CThostFtdcLinkManField, PersonFullName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerUserEventField(F)                        \
+  F(CThostFtdcQryBrokerUserEventField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryBrokerUserEventField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryBrokerUserEventField, UserEventType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserEventField(F)                           \
+  F(CThostFtdcBrokerUserEventField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcBrokerUserEventField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcBrokerUserEventField, UserEventType, CTP_FIELD_CHAR)             \
+  F(CThostFtdcBrokerUserEventField, EventSequenceNo, CTP_FIELD_INT32)          \
+  F(CThostFtdcBrokerUserEventField, EventDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcBrokerUserEventField, EventTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcBrokerUserEventField, UserEventInfo, CTP_FIELD_STRING)           \
+  F(CThostFtdcBrokerUserEventField, InvestorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcBrokerUserEventField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcBrokerUserEventField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryContractBankField(F)                           \
+  F(CThostFtdcQryContractBankField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryContractBankField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryContractBankField, BankBrchID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcContractBankField(F)                              \
+  F(CThostFtdcContractBankField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcContractBankField, BankID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcContractBankField, BankBrchID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcContractBankField, BankName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestorPositionCombineDetailField(F)             \
+  F(CThostFtdcInvestorPositionCombineDetailField, TradingDay, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, OpenDate, CTP_FIELD_STRING)  \
+  F(CThostFtdcInvestorPositionCombineDetailField, ExchangeID, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, SettlementID, CTP_FIELD_INT32)\
+  F(CThostFtdcInvestorPositionCombineDetailField, BrokerID, CTP_FIELD_STRING)  \
+  F(CThostFtdcInvestorPositionCombineDetailField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, ComTradeID, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, TradeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInvestorPositionCombineDetailField, reserve1, CTP_FIELD_STRING)  \
+  F(CThostFtdcInvestorPositionCombineDetailField, HedgeFlag, CTP_FIELD_CHAR)   \
+  F(CThostFtdcInvestorPositionCombineDetailField, Direction, CTP_FIELD_CHAR)   \
+  F(CThostFtdcInvestorPositionCombineDetailField, TotalAmt, CTP_FIELD_INT32)   \
+  F(CThostFtdcInvestorPositionCombineDetailField, Margin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcInvestorPositionCombineDetailField, ExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionCombineDetailField, MarginRateByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionCombineDetailField, MarginRateByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorPositionCombineDetailField, LegID, CTP_FIELD_INT32)      \
+  F(CThostFtdcInvestorPositionCombineDetailField, LegMultiple, CTP_FIELD_INT32)\
+  F(CThostFtdcInvestorPositionCombineDetailField, reserve2, CTP_FIELD_STRING)  \
+  F(CThostFtdcInvestorPositionCombineDetailField, TradeGroupID, CTP_FIELD_INT32)\
+  F(CThostFtdcInvestorPositionCombineDetailField, InvestUnitID, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, InstrumentID, CTP_FIELD_STRING)\
+  F(CThostFtdcInvestorPositionCombineDetailField, CombInstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcParkedOrderField(F)                               \
+  F(CThostFtdcParkedOrderField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, InvestorID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcParkedOrderField, reserve1, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, OrderRef, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcParkedOrderField, OrderPriceType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcParkedOrderField, Direction, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcParkedOrderField, CombOffsetFlag, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderField, CombHedgeFlag, CTP_FIELD_STRING)               \
+  F(CThostFtdcParkedOrderField, LimitPrice, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcParkedOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)          \
+  F(CThostFtdcParkedOrderField, TimeCondition, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcParkedOrderField, GTDDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcParkedOrderField, VolumeCondition, CTP_FIELD_CHAR)               \
+  F(CThostFtdcParkedOrderField, MinVolume, CTP_FIELD_INT32)                    \
+  F(CThostFtdcParkedOrderField, ContingentCondition, CTP_FIELD_CHAR)           \
+  F(CThostFtdcParkedOrderField, StopPrice, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcParkedOrderField, ForceCloseReason, CTP_FIELD_CHAR)              \
+  F(CThostFtdcParkedOrderField, IsAutoSuspend, CTP_FIELD_INT32)                \
+  F(CThostFtdcParkedOrderField, BusinessUnit, CTP_FIELD_STRING)                \
+  F(CThostFtdcParkedOrderField, RequestID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcParkedOrderField, UserForceClose, CTP_FIELD_INT32)               \
+  F(CThostFtdcParkedOrderField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcParkedOrderField, ParkedOrderID, CTP_FIELD_STRING)               \
+  F(CThostFtdcParkedOrderField, UserType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcParkedOrderField, Status, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcParkedOrderField, ErrorID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcParkedOrderField, ErrorMsg, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, IsSwapOrder, CTP_FIELD_INT32)                  \
+  F(CThostFtdcParkedOrderField, AccountID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcParkedOrderField, CurrencyID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcParkedOrderField, ClientID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, InvestUnitID, CTP_FIELD_STRING)                \
+  F(CThostFtdcParkedOrderField, reserve2, CTP_FIELD_STRING)                    \
+  F(CThostFtdcParkedOrderField, MacAddress, CTP_FIELD_STRING)                  \
+  F(CThostFtdcParkedOrderField, InstrumentID, CTP_FIELD_STRING)                \
+  F(CThostFtdcParkedOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcParkedOrderActionField(F)                         \
+  F(CThostFtdcParkedOrderActionField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderActionField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcParkedOrderActionField, OrderActionRef, CTP_FIELD_INT32)         \
+  F(CThostFtdcParkedOrderActionField, OrderRef, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderActionField, RequestID, CTP_FIELD_INT32)              \
+  F(CThostFtdcParkedOrderActionField, FrontID, CTP_FIELD_INT32)                \
+  F(CThostFtdcParkedOrderActionField, SessionID, CTP_FIELD_INT32)              \
+  F(CThostFtdcParkedOrderActionField, ExchangeID, CTP_FIELD_STRING)            \
+  F(CThostFtdcParkedOrderActionField, OrderSysID, CTP_FIELD_STRING)            \
+  F(CThostFtdcParkedOrderActionField, ActionFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcParkedOrderActionField, LimitPrice, CTP_FIELD_DOUBLE)            \
+  F(CThostFtdcParkedOrderActionField, VolumeChange, CTP_FIELD_INT32)           \
+  F(CThostFtdcParkedOrderActionField, UserID, CTP_FIELD_STRING)                \
+  F(CThostFtdcParkedOrderActionField, reserve1, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderActionField, ParkedOrderActionID, CTP_FIELD_STRING)   \
+  F(CThostFtdcParkedOrderActionField, UserType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcParkedOrderActionField, Status, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcParkedOrderActionField, ErrorID, CTP_FIELD_INT32)                \
+  F(CThostFtdcParkedOrderActionField, ErrorMsg, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderActionField, InvestUnitID, CTP_FIELD_STRING)          \
+  F(CThostFtdcParkedOrderActionField, reserve2, CTP_FIELD_STRING)              \
+  F(CThostFtdcParkedOrderActionField, MacAddress, CTP_FIELD_STRING)            \
+  F(CThostFtdcParkedOrderActionField, InstrumentID, CTP_FIELD_STRING)          \
+  F(CThostFtdcParkedOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryParkedOrderField(F)                            \
+  F(CThostFtdcQryParkedOrderField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryParkedOrderField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryParkedOrderField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryParkedOrderField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryParkedOrderField, InvestUnitID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryParkedOrderField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryParkedOrderActionField(F)                      \
+  F(CThostFtdcQryParkedOrderActionField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryParkedOrderActionField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryParkedOrderActionField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcQryParkedOrderActionField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryParkedOrderActionField, InvestUnitID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryParkedOrderActionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRemoveParkedOrderField(F)                         \
+  F(CThostFtdcRemoveParkedOrderField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcRemoveParkedOrderField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcRemoveParkedOrderField, ParkedOrderID, CTP_FIELD_STRING)         \
+  F(CThostFtdcRemoveParkedOrderField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRemoveParkedOrderActionField(F)                   \
+  F(CThostFtdcRemoveParkedOrderActionField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcRemoveParkedOrderActionField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcRemoveParkedOrderActionField, ParkedOrderActionID, CTP_FIELD_STRING)\
+  F(CThostFtdcRemoveParkedOrderActionField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestorWithdrawAlgorithmField(F)                 \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, InvestorRange, CTP_FIELD_CHAR)   \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, InvestorID, CTP_FIELD_STRING)    \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, UsingRatio, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, CurrencyID, CTP_FIELD_STRING)    \
+  F(CThostFtdcInvestorWithdrawAlgorithmField, FundMortgageRatio, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorPositionCombineDetailField(F)          \
+  F(CThostFtdcQryInvestorPositionCombineDetailField, BrokerID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorPositionCombineDetailField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorPositionCombineDetailField, reserve1, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorPositionCombineDetailField, ExchangeID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorPositionCombineDetailField, InvestUnitID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorPositionCombineDetailField, CombInstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMarketDataAveragePriceField(F)                    \
+  F(CThostFtdcMarketDataAveragePriceField, AveragePrice, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcVerifyInvestorPasswordField(F)                    \
+  F(CThostFtdcVerifyInvestorPasswordField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcVerifyInvestorPasswordField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcVerifyInvestorPasswordField, Password, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcUserIPField(F)                                    \
+  F(CThostFtdcUserIPField, BrokerID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcUserIPField, UserID, CTP_FIELD_STRING)                           \
+  F(CThostFtdcUserIPField, reserve1, CTP_FIELD_STRING)                         \
+  F(CThostFtdcUserIPField, reserve2, CTP_FIELD_STRING)                         \
+  F(CThostFtdcUserIPField, MacAddress, CTP_FIELD_STRING)                       \
+  F(CThostFtdcUserIPField, IPAddress, CTP_FIELD_STRING)                        \
+  F(CThostFtdcUserIPField, IPMask, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingNoticeInfoField(F)                         \
+  F(CThostFtdcTradingNoticeInfoField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcTradingNoticeInfoField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcTradingNoticeInfoField, SendTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcTradingNoticeInfoField, FieldContent, CTP_FIELD_STRING)          \
+  F(CThostFtdcTradingNoticeInfoField, SequenceSeries, CTP_FIELD_INT16)         \
+  F(CThostFtdcTradingNoticeInfoField, SequenceNo, CTP_FIELD_INT32)             \
+  F(CThostFtdcTradingNoticeInfoField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingNoticeField(F)                             \
+  F(CThostFtdcTradingNoticeField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTradingNoticeField, InvestorRange, CTP_FIELD_CHAR)               \
+  F(CThostFtdcTradingNoticeField, InvestorID, CTP_FIELD_STRING)                \
+  F(CThostFtdcTradingNoticeField, SequenceSeries, CTP_FIELD_INT16)             \
+  F(CThostFtdcTradingNoticeField, UserID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcTradingNoticeField, SendTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcTradingNoticeField, SequenceNo, CTP_FIELD_INT32)                 \
+  F(CThostFtdcTradingNoticeField, FieldContent, CTP_FIELD_STRING)              \
+  F(CThostFtdcTradingNoticeField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTradingNoticeField(F)                          \
+  F(CThostFtdcQryTradingNoticeField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryTradingNoticeField, InvestorID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryTradingNoticeField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryErrOrderField(F)                               \
+  F(CThostFtdcQryErrOrderField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryErrOrderField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcErrOrderField(F)                                  \
+  F(CThostFtdcErrOrderField, BrokerID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, InvestorID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcErrOrderField, reserve1, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, OrderRef, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, UserID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcErrOrderField, OrderPriceType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcErrOrderField, Direction, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcErrOrderField, CombOffsetFlag, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderField, CombHedgeFlag, CTP_FIELD_STRING)                  \
+  F(CThostFtdcErrOrderField, LimitPrice, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcErrOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)             \
+  F(CThostFtdcErrOrderField, TimeCondition, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcErrOrderField, GTDDate, CTP_FIELD_STRING)                        \
+  F(CThostFtdcErrOrderField, VolumeCondition, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcErrOrderField, MinVolume, CTP_FIELD_INT32)                       \
+  F(CThostFtdcErrOrderField, ContingentCondition, CTP_FIELD_CHAR)              \
+  F(CThostFtdcErrOrderField, StopPrice, CTP_FIELD_DOUBLE)                      \
+  F(CThostFtdcErrOrderField, ForceCloseReason, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcErrOrderField, IsAutoSuspend, CTP_FIELD_INT32)                   \
+  F(CThostFtdcErrOrderField, BusinessUnit, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrOrderField, RequestID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcErrOrderField, UserForceClose, CTP_FIELD_INT32)                  \
+  F(CThostFtdcErrOrderField, ErrorID, CTP_FIELD_INT32)                         \
+  F(CThostFtdcErrOrderField, ErrorMsg, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, IsSwapOrder, CTP_FIELD_INT32)                     \
+  F(CThostFtdcErrOrderField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcErrOrderField, InvestUnitID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrOrderField, AccountID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcErrOrderField, CurrencyID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcErrOrderField, ClientID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, reserve2, CTP_FIELD_STRING)                       \
+  F(CThostFtdcErrOrderField, MacAddress, CTP_FIELD_STRING)                     \
+  F(CThostFtdcErrOrderField, InstrumentID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcErrorConditionalOrderField(F)                     \
+  F(CThostFtdcErrorConditionalOrderField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, InvestorID, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, OrderRef, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, UserID, CTP_FIELD_STRING)            \
+  F(CThostFtdcErrorConditionalOrderField, OrderPriceType, CTP_FIELD_CHAR)      \
+  F(CThostFtdcErrorConditionalOrderField, Direction, CTP_FIELD_CHAR)           \
+  F(CThostFtdcErrorConditionalOrderField, CombOffsetFlag, CTP_FIELD_STRING)    \
+  F(CThostFtdcErrorConditionalOrderField, CombHedgeFlag, CTP_FIELD_STRING)     \
+  F(CThostFtdcErrorConditionalOrderField, LimitPrice, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcErrorConditionalOrderField, VolumeTotalOriginal, CTP_FIELD_INT32)\
+  F(CThostFtdcErrorConditionalOrderField, TimeCondition, CTP_FIELD_CHAR)       \
+  F(CThostFtdcErrorConditionalOrderField, GTDDate, CTP_FIELD_STRING)           \
+  F(CThostFtdcErrorConditionalOrderField, VolumeCondition, CTP_FIELD_CHAR)     \
+  F(CThostFtdcErrorConditionalOrderField, MinVolume, CTP_FIELD_INT32)          \
+  F(CThostFtdcErrorConditionalOrderField, ContingentCondition, CTP_FIELD_CHAR) \
+  F(CThostFtdcErrorConditionalOrderField, StopPrice, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcErrorConditionalOrderField, ForceCloseReason, CTP_FIELD_CHAR)    \
+  F(CThostFtdcErrorConditionalOrderField, IsAutoSuspend, CTP_FIELD_INT32)      \
+  F(CThostFtdcErrorConditionalOrderField, BusinessUnit, CTP_FIELD_STRING)      \
+  F(CThostFtdcErrorConditionalOrderField, RequestID, CTP_FIELD_INT32)          \
+  F(CThostFtdcErrorConditionalOrderField, OrderLocalID, CTP_FIELD_STRING)      \
+  F(CThostFtdcErrorConditionalOrderField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, ParticipantID, CTP_FIELD_STRING)     \
+  F(CThostFtdcErrorConditionalOrderField, ClientID, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, reserve2, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, TraderID, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, InstallID, CTP_FIELD_INT32)          \
+  F(CThostFtdcErrorConditionalOrderField, OrderSubmitStatus, CTP_FIELD_CHAR)   \
+  F(CThostFtdcErrorConditionalOrderField, NotifySequence, CTP_FIELD_INT32)     \
+  F(CThostFtdcErrorConditionalOrderField, TradingDay, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, SettlementID, CTP_FIELD_INT32)       \
+  F(CThostFtdcErrorConditionalOrderField, OrderSysID, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, OrderSource, CTP_FIELD_CHAR)         \
+  F(CThostFtdcErrorConditionalOrderField, OrderStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcErrorConditionalOrderField, OrderType, CTP_FIELD_CHAR)           \
+  F(CThostFtdcErrorConditionalOrderField, VolumeTraded, CTP_FIELD_INT32)       \
+  F(CThostFtdcErrorConditionalOrderField, VolumeTotal, CTP_FIELD_INT32)        \
+  F(CThostFtdcErrorConditionalOrderField, InsertDate, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, InsertTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, ActiveTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, SuspendTime, CTP_FIELD_STRING)       \
+  F(CThostFtdcErrorConditionalOrderField, UpdateTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, CancelTime, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, ActiveTraderID, CTP_FIELD_STRING)    \
+  F(CThostFtdcErrorConditionalOrderField, ClearingPartID, CTP_FIELD_STRING)    \
+  F(CThostFtdcErrorConditionalOrderField, SequenceNo, CTP_FIELD_INT32)         \
+  F(CThostFtdcErrorConditionalOrderField, FrontID, CTP_FIELD_INT32)            \
+  F(CThostFtdcErrorConditionalOrderField, SessionID, CTP_FIELD_INT32)          \
+  F(CThostFtdcErrorConditionalOrderField, UserProductInfo, CTP_FIELD_STRING)   \
+  F(CThostFtdcErrorConditionalOrderField, StatusMsg, CTP_FIELD_STRING)         \
+  F(CThostFtdcErrorConditionalOrderField, UserForceClose, CTP_FIELD_INT32)     \
+  F(CThostFtdcErrorConditionalOrderField, ActiveUserID, CTP_FIELD_STRING)      \
+  F(CThostFtdcErrorConditionalOrderField, BrokerOrderSeq, CTP_FIELD_INT32)     \
+  F(CThostFtdcErrorConditionalOrderField, RelativeOrderSysID, CTP_FIELD_STRING)\
+  F(CThostFtdcErrorConditionalOrderField, ZCETotalTradedVolume, CTP_FIELD_INT32)\
+  F(CThostFtdcErrorConditionalOrderField, ErrorID, CTP_FIELD_INT32)            \
+  F(CThostFtdcErrorConditionalOrderField, ErrorMsg, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, IsSwapOrder, CTP_FIELD_INT32)        \
+  F(CThostFtdcErrorConditionalOrderField, BranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, InvestUnitID, CTP_FIELD_STRING)      \
+  F(CThostFtdcErrorConditionalOrderField, AccountID, CTP_FIELD_STRING)         \
+  F(CThostFtdcErrorConditionalOrderField, CurrencyID, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, reserve3, CTP_FIELD_STRING)          \
+  F(CThostFtdcErrorConditionalOrderField, MacAddress, CTP_FIELD_STRING)        \
+  F(CThostFtdcErrorConditionalOrderField, InstrumentID, CTP_FIELD_STRING)      \
+  F(CThostFtdcErrorConditionalOrderField, ExchangeInstID, CTP_FIELD_STRING)    \
+  F(CThostFtdcErrorConditionalOrderField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryErrOrderActionField(F)                         \
+  F(CThostFtdcQryErrOrderActionField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryErrOrderActionField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcErrOrderActionField(F)                            \
+  F(CThostFtdcErrOrderActionField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, OrderActionRef, CTP_FIELD_INT32)            \
+  F(CThostFtdcErrOrderActionField, OrderRef, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, RequestID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcErrOrderActionField, FrontID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcErrOrderActionField, SessionID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcErrOrderActionField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, OrderSysID, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, ActionFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcErrOrderActionField, LimitPrice, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcErrOrderActionField, VolumeChange, CTP_FIELD_INT32)              \
+  F(CThostFtdcErrOrderActionField, ActionDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, ActionTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, TraderID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, InstallID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcErrOrderActionField, OrderLocalID, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrOrderActionField, ActionLocalID, CTP_FIELD_STRING)            \
+  F(CThostFtdcErrOrderActionField, ParticipantID, CTP_FIELD_STRING)            \
+  F(CThostFtdcErrOrderActionField, ClientID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, BusinessUnit, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrOrderActionField, OrderActionStatus, CTP_FIELD_CHAR)          \
+  F(CThostFtdcErrOrderActionField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcErrOrderActionField, StatusMsg, CTP_FIELD_STRING)                \
+  F(CThostFtdcErrOrderActionField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, BranchID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, InvestUnitID, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrOrderActionField, reserve2, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, MacAddress, CTP_FIELD_STRING)               \
+  F(CThostFtdcErrOrderActionField, ErrorID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcErrOrderActionField, ErrorMsg, CTP_FIELD_STRING)                 \
+  F(CThostFtdcErrOrderActionField, InstrumentID, CTP_FIELD_STRING)             \
+  F(CThostFtdcErrOrderActionField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryExchangeSequenceField(F)                       \
+  F(CThostFtdcQryExchangeSequenceField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcExchangeSequenceField(F)                          \
+  F(CThostFtdcExchangeSequenceField, ExchangeID, CTP_FIELD_STRING)             \
+  F(CThostFtdcExchangeSequenceField, SequenceNo, CTP_FIELD_INT32)              \
+  F(CThostFtdcExchangeSequenceField, MarketStatus, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcQryMaxOrderVolumeWithPriceField(F)                \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, Direction, CTP_FIELD_CHAR)      \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, OffsetFlag, CTP_FIELD_CHAR)     \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, HedgeFlag, CTP_FIELD_CHAR)      \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, MaxVolume, CTP_FIELD_INT32)     \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, Price, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, ExchangeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, InvestUnitID, CTP_FIELD_STRING) \
+  F(CThostFtdcQryMaxOrderVolumeWithPriceField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerTradingParamsField(F)                    \
+  F(CThostFtdcQryBrokerTradingParamsField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryBrokerTradingParamsField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryBrokerTradingParamsField, CurrencyID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryBrokerTradingParamsField, AccountID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerTradingParamsField(F)                       \
+  F(CThostFtdcBrokerTradingParamsField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcBrokerTradingParamsField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcBrokerTradingParamsField, MarginPriceType, CTP_FIELD_CHAR)       \
+  F(CThostFtdcBrokerTradingParamsField, Algorithm, CTP_FIELD_CHAR)             \
+  F(CThostFtdcBrokerTradingParamsField, AvailIncludeCloseProfit, CTP_FIELD_CHAR)\
+  F(CThostFtdcBrokerTradingParamsField, CurrencyID, CTP_FIELD_STRING)          \
+  F(CThostFtdcBrokerTradingParamsField, OptionRoyaltyPriceType, CTP_FIELD_CHAR)\
+  F(CThostFtdcBrokerTradingParamsField, AccountID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBrokerTradingAlgosField(F)                     \
+  F(CThostFtdcQryBrokerTradingAlgosField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryBrokerTradingAlgosField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryBrokerTradingAlgosField, reserve1, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryBrokerTradingAlgosField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerTradingAlgosField(F)                        \
+  F(CThostFtdcBrokerTradingAlgosField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerTradingAlgosField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcBrokerTradingAlgosField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerTradingAlgosField, HandlePositionAlgoID, CTP_FIELD_CHAR)   \
+  F(CThostFtdcBrokerTradingAlgosField, FindMarginRateAlgoID, CTP_FIELD_CHAR)   \
+  F(CThostFtdcBrokerTradingAlgosField, HandleTradingAccountAlgoID, CTP_FIELD_CHAR)\
+  F(CThostFtdcBrokerTradingAlgosField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQueryBrokerDepositField(F)                        \
+  F(CThostFtdcQueryBrokerDepositField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQueryBrokerDepositField, ExchangeID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerDepositField(F)                             \
+  F(CThostFtdcBrokerDepositField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcBrokerDepositField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcBrokerDepositField, ParticipantID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerDepositField, ExchangeID, CTP_FIELD_STRING)                \
+  F(CThostFtdcBrokerDepositField, PreBalance, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcBrokerDepositField, CurrMargin, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcBrokerDepositField, CloseProfit, CTP_FIELD_DOUBLE)               \
+  F(CThostFtdcBrokerDepositField, Balance, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcBrokerDepositField, Deposit, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcBrokerDepositField, Withdraw, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcBrokerDepositField, Available, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcBrokerDepositField, Reserve, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcBrokerDepositField, FrozenMargin, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcQryCFMMCBrokerKeyField(F)                         \
+  F(CThostFtdcQryCFMMCBrokerKeyField, BrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCFMMCBrokerKeyField(F)                            \
+  F(CThostFtdcCFMMCBrokerKeyField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCFMMCBrokerKeyField, ParticipantID, CTP_FIELD_STRING)            \
+  F(CThostFtdcCFMMCBrokerKeyField, CreateDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcCFMMCBrokerKeyField, CreateTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcCFMMCBrokerKeyField, KeyID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcCFMMCBrokerKeyField, CurrentKey, CTP_FIELD_STRING)               \
+  F(CThostFtdcCFMMCBrokerKeyField, KeyKind, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcCFMMCTradingAccountKeyField(F)                    \
+  F(CThostFtdcCFMMCTradingAccountKeyField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcCFMMCTradingAccountKeyField, ParticipantID, CTP_FIELD_STRING)    \
+  F(CThostFtdcCFMMCTradingAccountKeyField, AccountID, CTP_FIELD_STRING)        \
+  F(CThostFtdcCFMMCTradingAccountKeyField, KeyID, CTP_FIELD_INT32)             \
+  F(CThostFtdcCFMMCTradingAccountKeyField, CurrentKey, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCFMMCTradingAccountKeyField(F)                 \
+  F(CThostFtdcQryCFMMCTradingAccountKeyField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryCFMMCTradingAccountKeyField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserOTPParamField(F)                        \
+  F(CThostFtdcBrokerUserOTPParamField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcBrokerUserOTPParamField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcBrokerUserOTPParamField, OTPVendorsID, CTP_FIELD_STRING)         \
+  F(CThostFtdcBrokerUserOTPParamField, SerialNumber, CTP_FIELD_STRING)         \
+  F(CThostFtdcBrokerUserOTPParamField, AuthKey, CTP_FIELD_STRING)              \
+  F(CThostFtdcBrokerUserOTPParamField, LastDrift, CTP_FIELD_INT32)             \
+  F(CThostFtdcBrokerUserOTPParamField, LastSuccess, CTP_FIELD_INT32)           \
+  F(CThostFtdcBrokerUserOTPParamField, OTPType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcManualSyncBrokerUserOTPField(F)                   \
+  F(CThostFtdcManualSyncBrokerUserOTPField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcManualSyncBrokerUserOTPField, UserID, CTP_FIELD_STRING)          \
+  F(CThostFtdcManualSyncBrokerUserOTPField, OTPType, CTP_FIELD_CHAR)           \
+  F(CThostFtdcManualSyncBrokerUserOTPField, FirstOTP, CTP_FIELD_STRING)        \
+  F(CThostFtdcManualSyncBrokerUserOTPField, SecondOTP, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCommRateModelField(F)                             \
+  F(CThostFtdcCommRateModelField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcCommRateModelField, CommModelID, CTP_FIELD_STRING)               \
+  F(CThostFtdcCommRateModelField, CommModelName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCommRateModelField(F)                          \
+  F(CThostFtdcQryCommRateModelField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryCommRateModelField, CommModelID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcMarginModelField(F)                               \
+  F(CThostFtdcMarginModelField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcMarginModelField, MarginModelID, CTP_FIELD_STRING)               \
+  F(CThostFtdcMarginModelField, MarginModelName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryMarginModelField(F)                            \
+  F(CThostFtdcQryMarginModelField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcQryMarginModelField, MarginModelID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcEWarrantOffsetField(F)                            \
+  F(CThostFtdcEWarrantOffsetField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcEWarrantOffsetField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcEWarrantOffsetField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcEWarrantOffsetField, ExchangeID, CTP_FIELD_STRING)               \
+  F(CThostFtdcEWarrantOffsetField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcEWarrantOffsetField, Direction, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcEWarrantOffsetField, HedgeFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcEWarrantOffsetField, Volume, CTP_FIELD_INT32)                    \
+  F(CThostFtdcEWarrantOffsetField, InvestUnitID, CTP_FIELD_STRING)             \
+  F(CThostFtdcEWarrantOffsetField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryEWarrantOffsetField(F)                         \
+  F(CThostFtdcQryEWarrantOffsetField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryEWarrantOffsetField, InvestorID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryEWarrantOffsetField, ExchangeID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryEWarrantOffsetField, reserve1, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryEWarrantOffsetField, InvestUnitID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryEWarrantOffsetField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryInvestorProductGroupMarginField(F)             \
+  F(CThostFtdcQryInvestorProductGroupMarginField, BrokerID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryInvestorProductGroupMarginField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorProductGroupMarginField, reserve1, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryInvestorProductGroupMarginField, HedgeFlag, CTP_FIELD_CHAR)   \
+  F(CThostFtdcQryInvestorProductGroupMarginField, ExchangeID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorProductGroupMarginField, InvestUnitID, CTP_FIELD_STRING)\
+  F(CThostFtdcQryInvestorProductGroupMarginField, ProductGroupID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcInvestorProductGroupMarginField(F)                \
+  F(CThostFtdcInvestorProductGroupMarginField, reserve1, CTP_FIELD_STRING)     \
+  F(CThostFtdcInvestorProductGroupMarginField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcInvestorProductGroupMarginField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInvestorProductGroupMarginField, TradingDay, CTP_FIELD_STRING)   \
+  F(CThostFtdcInvestorProductGroupMarginField, SettlementID, CTP_FIELD_INT32)  \
+  F(CThostFtdcInvestorProductGroupMarginField, FrozenMargin, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcInvestorProductGroupMarginField, LongFrozenMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ShortFrozenMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, UseMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcInvestorProductGroupMarginField, LongUseMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ShortUseMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ExchMargin, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcInvestorProductGroupMarginField, LongExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ShortExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, CloseProfit, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcInvestorProductGroupMarginField, FrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, Commission, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcInvestorProductGroupMarginField, FrozenCash, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcInvestorProductGroupMarginField, CashIn, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcInvestorProductGroupMarginField, PositionProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, OffsetAmount, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcInvestorProductGroupMarginField, LongOffsetAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ShortOffsetAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ExchOffsetAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, LongExchOffsetAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, ShortExchOffsetAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcInvestorProductGroupMarginField, HedgeFlag, CTP_FIELD_CHAR)      \
+  F(CThostFtdcInvestorProductGroupMarginField, ExchangeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcInvestorProductGroupMarginField, InvestUnitID, CTP_FIELD_STRING) \
+  F(CThostFtdcInvestorProductGroupMarginField, ProductGroupID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQueryCFMMCTradingAccountTokenField(F)             \
+  F(CThostFtdcQueryCFMMCTradingAccountTokenField, BrokerID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQueryCFMMCTradingAccountTokenField, InvestorID, CTP_FIELD_STRING)\
+  F(CThostFtdcQueryCFMMCTradingAccountTokenField, InvestUnitID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCFMMCTradingAccountTokenField(F)                  \
+  F(CThostFtdcCFMMCTradingAccountTokenField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcCFMMCTradingAccountTokenField, ParticipantID, CTP_FIELD_STRING)  \
+  F(CThostFtdcCFMMCTradingAccountTokenField, AccountID, CTP_FIELD_STRING)      \
+  F(CThostFtdcCFMMCTradingAccountTokenField, KeyID, CTP_FIELD_INT32)           \
+  F(CThostFtdcCFMMCTradingAccountTokenField, Token, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryProductGroupField(F)                           \
+  F(CThostFtdcQryProductGroupField, reserve1, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryProductGroupField, ExchangeID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryProductGroupField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcProductGroupField(F)                              \
+  F(CThostFtdcProductGroupField, reserve1, CTP_FIELD_STRING)                   \
+  F(CThostFtdcProductGroupField, ExchangeID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcProductGroupField, reserve2, CTP_FIELD_STRING)                   \
+  F(CThostFtdcProductGroupField, ProductID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcProductGroupField, ProductGroupID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcBulletinField(F)                                  \
+  F(CThostFtdcBulletinField, ExchangeID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcBulletinField, TradingDay, CTP_FIELD_STRING)                     \
+  F(CThostFtdcBulletinField, BulletinID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcBulletinField, SequenceNo, CTP_FIELD_INT32)                      \
+  F(CThostFtdcBulletinField, NewsType, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBulletinField, NewsUrgency, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcBulletinField, SendTime, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBulletinField, Abstract, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBulletinField, ComeFrom, CTP_FIELD_STRING)                       \
+  F(CThostFtdcBulletinField, Content, CTP_FIELD_STRING)                        \
+  F(CThostFtdcBulletinField, URLLink, CTP_FIELD_STRING)                        \
+  F(CThostFtdcBulletinField, MarketID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryBulletinField(F)                               \
+  F(CThostFtdcQryBulletinField, ExchangeID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcQryBulletinField, BulletinID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcQryBulletinField, SequenceNo, CTP_FIELD_INT32)                   \
+  F(CThostFtdcQryBulletinField, NewsType, CTP_FIELD_STRING)                    \
+  F(CThostFtdcQryBulletinField, NewsUrgency, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcMulticastInstrumentField(F)                       \
+  F(CThostFtdcMulticastInstrumentField, TopicID, CTP_FIELD_INT32)              \
+  F(CThostFtdcMulticastInstrumentField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcMulticastInstrumentField, InstrumentNo, CTP_FIELD_INT32)         \
+  F(CThostFtdcMulticastInstrumentField, CodePrice, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMulticastInstrumentField, VolumeMultiple, CTP_FIELD_INT32)       \
+  F(CThostFtdcMulticastInstrumentField, PriceTick, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcMulticastInstrumentField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryMulticastInstrumentField(F)                    \
+  F(CThostFtdcQryMulticastInstrumentField, TopicID, CTP_FIELD_INT32)           \
+  F(CThostFtdcQryMulticastInstrumentField, reserve1, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryMulticastInstrumentField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcAppIDAuthAssignField(F)                           \
+  F(CThostFtdcAppIDAuthAssignField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcAppIDAuthAssignField, AppID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcAppIDAuthAssignField, DRIdentityID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcReqOpenAccountField(F)                            \
+  F(CThostFtdcReqOpenAccountField, TradeCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqOpenAccountField, BankID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqOpenAccountField, BankBranchID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqOpenAccountField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqOpenAccountField, BrokerBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqOpenAccountField, TradeDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqOpenAccountField, TradeTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqOpenAccountField, BankSerial, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqOpenAccountField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqOpenAccountField, PlateSerial, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqOpenAccountField, LastFragment, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqOpenAccountField, SessionID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcReqOpenAccountField, CustomerName, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqOpenAccountField, IdCardType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcReqOpenAccountField, IdentifiedCardNo, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqOpenAccountField, Gender, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcReqOpenAccountField, CountryCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqOpenAccountField, CustType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqOpenAccountField, Address, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqOpenAccountField, ZipCode, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqOpenAccountField, Telephone, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqOpenAccountField, MobilePhone, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqOpenAccountField, Fax, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqOpenAccountField, EMail, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqOpenAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)         \
+  F(CThostFtdcReqOpenAccountField, BankAccount, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqOpenAccountField, BankPassWord, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqOpenAccountField, AccountID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqOpenAccountField, Password, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqOpenAccountField, InstallID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcReqOpenAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)           \
+  F(CThostFtdcReqOpenAccountField, CurrencyID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqOpenAccountField, CashExchangeCode, CTP_FIELD_CHAR)           \
+  F(CThostFtdcReqOpenAccountField, Digest, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqOpenAccountField, BankAccType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqOpenAccountField, DeviceID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqOpenAccountField, BankSecuAccType, CTP_FIELD_CHAR)            \
+  F(CThostFtdcReqOpenAccountField, BrokerIDByBank, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqOpenAccountField, BankSecuAcc, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqOpenAccountField, BankPwdFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqOpenAccountField, SecuPwdFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqOpenAccountField, OperNo, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqOpenAccountField, TID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcReqOpenAccountField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqOpenAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqCancelAccountField(F)                          \
+  F(CThostFtdcReqCancelAccountField, TradeCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqCancelAccountField, BankID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqCancelAccountField, BankBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqCancelAccountField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqCancelAccountField, BrokerBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqCancelAccountField, TradeDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqCancelAccountField, TradeTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqCancelAccountField, BankSerial, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqCancelAccountField, TradingDay, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqCancelAccountField, PlateSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqCancelAccountField, LastFragment, CTP_FIELD_CHAR)             \
+  F(CThostFtdcReqCancelAccountField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqCancelAccountField, CustomerName, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqCancelAccountField, IdCardType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqCancelAccountField, IdentifiedCardNo, CTP_FIELD_STRING)       \
+  F(CThostFtdcReqCancelAccountField, Gender, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqCancelAccountField, CountryCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqCancelAccountField, CustType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcReqCancelAccountField, Address, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqCancelAccountField, ZipCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqCancelAccountField, Telephone, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqCancelAccountField, MobilePhone, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqCancelAccountField, Fax, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqCancelAccountField, EMail, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqCancelAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)       \
+  F(CThostFtdcReqCancelAccountField, BankAccount, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqCancelAccountField, BankPassWord, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqCancelAccountField, AccountID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqCancelAccountField, Password, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqCancelAccountField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqCancelAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcReqCancelAccountField, CurrencyID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqCancelAccountField, CashExchangeCode, CTP_FIELD_CHAR)         \
+  F(CThostFtdcReqCancelAccountField, Digest, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqCancelAccountField, BankAccType, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqCancelAccountField, DeviceID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqCancelAccountField, BankSecuAccType, CTP_FIELD_CHAR)          \
+  F(CThostFtdcReqCancelAccountField, BrokerIDByBank, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqCancelAccountField, BankSecuAcc, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqCancelAccountField, BankPwdFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqCancelAccountField, SecuPwdFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqCancelAccountField, OperNo, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqCancelAccountField, TID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcReqCancelAccountField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqCancelAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqChangeAccountField(F)                          \
+  F(CThostFtdcReqChangeAccountField, TradeCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqChangeAccountField, BankID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqChangeAccountField, BankBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqChangeAccountField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqChangeAccountField, BrokerBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqChangeAccountField, TradeDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqChangeAccountField, TradeTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqChangeAccountField, BankSerial, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqChangeAccountField, TradingDay, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqChangeAccountField, PlateSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqChangeAccountField, LastFragment, CTP_FIELD_CHAR)             \
+  F(CThostFtdcReqChangeAccountField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqChangeAccountField, CustomerName, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqChangeAccountField, IdCardType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqChangeAccountField, IdentifiedCardNo, CTP_FIELD_STRING)       \
+  F(CThostFtdcReqChangeAccountField, Gender, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqChangeAccountField, CountryCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqChangeAccountField, CustType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcReqChangeAccountField, Address, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqChangeAccountField, ZipCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqChangeAccountField, Telephone, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqChangeAccountField, MobilePhone, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqChangeAccountField, Fax, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqChangeAccountField, EMail, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqChangeAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)       \
+  F(CThostFtdcReqChangeAccountField, BankAccount, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqChangeAccountField, BankPassWord, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqChangeAccountField, NewBankAccount, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqChangeAccountField, NewBankPassWord, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqChangeAccountField, AccountID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqChangeAccountField, Password, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqChangeAccountField, BankAccType, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqChangeAccountField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqChangeAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcReqChangeAccountField, CurrencyID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqChangeAccountField, BrokerIDByBank, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqChangeAccountField, BankPwdFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqChangeAccountField, SecuPwdFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqChangeAccountField, TID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcReqChangeAccountField, Digest, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqChangeAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqTransferField(F)                               \
+  F(CThostFtdcReqTransferField, TradeCode, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqTransferField, BankID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqTransferField, BankBranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqTransferField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqTransferField, BrokerBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqTransferField, TradeDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqTransferField, TradeTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqTransferField, BankSerial, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqTransferField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqTransferField, PlateSerial, CTP_FIELD_INT32)                  \
+  F(CThostFtdcReqTransferField, LastFragment, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcReqTransferField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcReqTransferField, CustomerName, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqTransferField, IdCardType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcReqTransferField, IdentifiedCardNo, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqTransferField, CustType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcReqTransferField, BankAccount, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqTransferField, BankPassWord, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqTransferField, AccountID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqTransferField, Password, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqTransferField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcReqTransferField, FutureSerial, CTP_FIELD_INT32)                 \
+  F(CThostFtdcReqTransferField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqTransferField, VerifyCertNoFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqTransferField, CurrencyID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqTransferField, TradeAmount, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcReqTransferField, FutureFetchAmount, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcReqTransferField, FeePayFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcReqTransferField, CustFee, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcReqTransferField, BrokerFee, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcReqTransferField, Message, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqTransferField, Digest, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqTransferField, BankAccType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqTransferField, DeviceID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqTransferField, BankSecuAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqTransferField, BrokerIDByBank, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqTransferField, BankSecuAcc, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqTransferField, BankPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqTransferField, SecuPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqTransferField, OperNo, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqTransferField, RequestID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcReqTransferField, TID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcReqTransferField, TransferStatus, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqTransferField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspTransferField(F)                               \
+  F(CThostFtdcRspTransferField, TradeCode, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspTransferField, BankID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspTransferField, BankBranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspTransferField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspTransferField, BrokerBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspTransferField, TradeDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspTransferField, TradeTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspTransferField, BankSerial, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspTransferField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspTransferField, PlateSerial, CTP_FIELD_INT32)                  \
+  F(CThostFtdcRspTransferField, LastFragment, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcRspTransferField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcRspTransferField, CustomerName, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspTransferField, IdCardType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcRspTransferField, IdentifiedCardNo, CTP_FIELD_STRING)            \
+  F(CThostFtdcRspTransferField, CustType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcRspTransferField, BankAccount, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspTransferField, BankPassWord, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspTransferField, AccountID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspTransferField, Password, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspTransferField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcRspTransferField, FutureSerial, CTP_FIELD_INT32)                 \
+  F(CThostFtdcRspTransferField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspTransferField, VerifyCertNoFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcRspTransferField, CurrencyID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspTransferField, TradeAmount, CTP_FIELD_DOUBLE)                 \
+  F(CThostFtdcRspTransferField, FutureFetchAmount, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcRspTransferField, FeePayFlag, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcRspTransferField, CustFee, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcRspTransferField, BrokerFee, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcRspTransferField, Message, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspTransferField, Digest, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspTransferField, BankAccType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcRspTransferField, DeviceID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspTransferField, BankSecuAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcRspTransferField, BrokerIDByBank, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspTransferField, BankSecuAcc, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspTransferField, BankPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcRspTransferField, SecuPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcRspTransferField, OperNo, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspTransferField, RequestID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcRspTransferField, TID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcRspTransferField, TransferStatus, CTP_FIELD_CHAR)                \
+  F(CThostFtdcRspTransferField, ErrorID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspTransferField, ErrorMsg, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspTransferField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqRepealField(F)                                 \
+  F(CThostFtdcReqRepealField, RepealTimeInterval, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqRepealField, RepealedTimes, CTP_FIELD_INT32)                  \
+  F(CThostFtdcReqRepealField, BankRepealFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcReqRepealField, BrokerRepealFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqRepealField, PlateRepealSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcReqRepealField, BankRepealSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqRepealField, FutureRepealSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqRepealField, TradeCode, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqRepealField, BankID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcReqRepealField, BankBranchID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqRepealField, BrokerID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqRepealField, BrokerBranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqRepealField, TradeDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqRepealField, TradeTime, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqRepealField, BankSerial, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqRepealField, TradingDay, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqRepealField, PlateSerial, CTP_FIELD_INT32)                    \
+  F(CThostFtdcReqRepealField, LastFragment, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcReqRepealField, SessionID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcReqRepealField, CustomerName, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqRepealField, IdCardType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcReqRepealField, IdentifiedCardNo, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqRepealField, CustType, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcReqRepealField, BankAccount, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqRepealField, BankPassWord, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqRepealField, AccountID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqRepealField, Password, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqRepealField, InstallID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcReqRepealField, FutureSerial, CTP_FIELD_INT32)                   \
+  F(CThostFtdcReqRepealField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcReqRepealField, VerifyCertNoFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqRepealField, CurrencyID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqRepealField, TradeAmount, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcReqRepealField, FutureFetchAmount, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcReqRepealField, FeePayFlag, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcReqRepealField, CustFee, CTP_FIELD_DOUBLE)                       \
+  F(CThostFtdcReqRepealField, BrokerFee, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcReqRepealField, Message, CTP_FIELD_STRING)                       \
+  F(CThostFtdcReqRepealField, Digest, CTP_FIELD_STRING)                        \
+  F(CThostFtdcReqRepealField, BankAccType, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcReqRepealField, DeviceID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqRepealField, BankSecuAccType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcReqRepealField, BrokerIDByBank, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqRepealField, BankSecuAcc, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqRepealField, BankPwdFlag, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcReqRepealField, SecuPwdFlag, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcReqRepealField, OperNo, CTP_FIELD_STRING)                        \
+  F(CThostFtdcReqRepealField, RequestID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcReqRepealField, TID, CTP_FIELD_INT32)                            \
+  F(CThostFtdcReqRepealField, TransferStatus, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcReqRepealField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspRepealField(F)                                 \
+  F(CThostFtdcRspRepealField, RepealTimeInterval, CTP_FIELD_INT32)             \
+  F(CThostFtdcRspRepealField, RepealedTimes, CTP_FIELD_INT32)                  \
+  F(CThostFtdcRspRepealField, BankRepealFlag, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcRspRepealField, BrokerRepealFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcRspRepealField, PlateRepealSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcRspRepealField, BankRepealSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspRepealField, FutureRepealSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcRspRepealField, TradeCode, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspRepealField, BankID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcRspRepealField, BankBranchID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspRepealField, BrokerID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspRepealField, BrokerBranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspRepealField, TradeDate, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspRepealField, TradeTime, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspRepealField, BankSerial, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspRepealField, TradingDay, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspRepealField, PlateSerial, CTP_FIELD_INT32)                    \
+  F(CThostFtdcRspRepealField, LastFragment, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcRspRepealField, SessionID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspRepealField, CustomerName, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspRepealField, IdCardType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcRspRepealField, IdentifiedCardNo, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspRepealField, CustType, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcRspRepealField, BankAccount, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspRepealField, BankPassWord, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspRepealField, AccountID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspRepealField, Password, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspRepealField, InstallID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspRepealField, FutureSerial, CTP_FIELD_INT32)                   \
+  F(CThostFtdcRspRepealField, UserID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcRspRepealField, VerifyCertNoFlag, CTP_FIELD_CHAR)                \
+  F(CThostFtdcRspRepealField, CurrencyID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspRepealField, TradeAmount, CTP_FIELD_DOUBLE)                   \
+  F(CThostFtdcRspRepealField, FutureFetchAmount, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcRspRepealField, FeePayFlag, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcRspRepealField, CustFee, CTP_FIELD_DOUBLE)                       \
+  F(CThostFtdcRspRepealField, BrokerFee, CTP_FIELD_DOUBLE)                     \
+  F(CThostFtdcRspRepealField, Message, CTP_FIELD_STRING)                       \
+  F(CThostFtdcRspRepealField, Digest, CTP_FIELD_STRING)                        \
+  F(CThostFtdcRspRepealField, BankAccType, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcRspRepealField, DeviceID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspRepealField, BankSecuAccType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcRspRepealField, BrokerIDByBank, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspRepealField, BankSecuAcc, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspRepealField, BankPwdFlag, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcRspRepealField, SecuPwdFlag, CTP_FIELD_CHAR)                     \
+  F(CThostFtdcRspRepealField, OperNo, CTP_FIELD_STRING)                        \
+  F(CThostFtdcRspRepealField, RequestID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspRepealField, TID, CTP_FIELD_INT32)                            \
+  F(CThostFtdcRspRepealField, TransferStatus, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcRspRepealField, ErrorID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcRspRepealField, ErrorMsg, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspRepealField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqQueryAccountField(F)                           \
+  F(CThostFtdcReqQueryAccountField, TradeCode, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqQueryAccountField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqQueryAccountField, BankBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqQueryAccountField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqQueryAccountField, BrokerBranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqQueryAccountField, TradeDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqQueryAccountField, TradeTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqQueryAccountField, BankSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqQueryAccountField, TradingDay, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqQueryAccountField, PlateSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcReqQueryAccountField, LastFragment, CTP_FIELD_CHAR)              \
+  F(CThostFtdcReqQueryAccountField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcReqQueryAccountField, CustomerName, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqQueryAccountField, IdCardType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcReqQueryAccountField, IdentifiedCardNo, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqQueryAccountField, CustType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcReqQueryAccountField, BankAccount, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqQueryAccountField, BankPassWord, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqQueryAccountField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqQueryAccountField, Password, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqQueryAccountField, FutureSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqQueryAccountField, InstallID, CTP_FIELD_INT32)                \
+  F(CThostFtdcReqQueryAccountField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqQueryAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcReqQueryAccountField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqQueryAccountField, Digest, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqQueryAccountField, BankAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqQueryAccountField, DeviceID, CTP_FIELD_STRING)                \
+  F(CThostFtdcReqQueryAccountField, BankSecuAccType, CTP_FIELD_CHAR)           \
+  F(CThostFtdcReqQueryAccountField, BrokerIDByBank, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqQueryAccountField, BankSecuAcc, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqQueryAccountField, BankPwdFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqQueryAccountField, SecuPwdFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReqQueryAccountField, OperNo, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReqQueryAccountField, RequestID, CTP_FIELD_INT32)                \
+  F(CThostFtdcReqQueryAccountField, TID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcReqQueryAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspQueryAccountField(F)                           \
+  F(CThostFtdcRspQueryAccountField, TradeCode, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspQueryAccountField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspQueryAccountField, BankBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcRspQueryAccountField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspQueryAccountField, BrokerBranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcRspQueryAccountField, TradeDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspQueryAccountField, TradeTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspQueryAccountField, BankSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspQueryAccountField, TradingDay, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspQueryAccountField, PlateSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcRspQueryAccountField, LastFragment, CTP_FIELD_CHAR)              \
+  F(CThostFtdcRspQueryAccountField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspQueryAccountField, CustomerName, CTP_FIELD_STRING)            \
+  F(CThostFtdcRspQueryAccountField, IdCardType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcRspQueryAccountField, IdentifiedCardNo, CTP_FIELD_STRING)        \
+  F(CThostFtdcRspQueryAccountField, CustType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcRspQueryAccountField, BankAccount, CTP_FIELD_STRING)             \
+  F(CThostFtdcRspQueryAccountField, BankPassWord, CTP_FIELD_STRING)            \
+  F(CThostFtdcRspQueryAccountField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspQueryAccountField, Password, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspQueryAccountField, FutureSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcRspQueryAccountField, InstallID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspQueryAccountField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspQueryAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)          \
+  F(CThostFtdcRspQueryAccountField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspQueryAccountField, Digest, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspQueryAccountField, BankAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcRspQueryAccountField, DeviceID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspQueryAccountField, BankSecuAccType, CTP_FIELD_CHAR)           \
+  F(CThostFtdcRspQueryAccountField, BrokerIDByBank, CTP_FIELD_STRING)          \
+  F(CThostFtdcRspQueryAccountField, BankSecuAcc, CTP_FIELD_STRING)             \
+  F(CThostFtdcRspQueryAccountField, BankPwdFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcRspQueryAccountField, SecuPwdFlag, CTP_FIELD_CHAR)               \
+  F(CThostFtdcRspQueryAccountField, OperNo, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspQueryAccountField, RequestID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspQueryAccountField, TID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspQueryAccountField, BankUseAmount, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcRspQueryAccountField, BankFetchAmount, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcRspQueryAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcFutureSignIOField(F)                              \
+  F(CThostFtdcFutureSignIOField, TradeCode, CTP_FIELD_STRING)                  \
+  F(CThostFtdcFutureSignIOField, BankID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcFutureSignIOField, BankBranchID, CTP_FIELD_STRING)               \
+  F(CThostFtdcFutureSignIOField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcFutureSignIOField, BrokerBranchID, CTP_FIELD_STRING)             \
+  F(CThostFtdcFutureSignIOField, TradeDate, CTP_FIELD_STRING)                  \
+  F(CThostFtdcFutureSignIOField, TradeTime, CTP_FIELD_STRING)                  \
+  F(CThostFtdcFutureSignIOField, BankSerial, CTP_FIELD_STRING)                 \
+  F(CThostFtdcFutureSignIOField, TradingDay, CTP_FIELD_STRING)                 \
+  F(CThostFtdcFutureSignIOField, PlateSerial, CTP_FIELD_INT32)                 \
+  F(CThostFtdcFutureSignIOField, LastFragment, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcFutureSignIOField, SessionID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcFutureSignIOField, InstallID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcFutureSignIOField, UserID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcFutureSignIOField, Digest, CTP_FIELD_STRING)                     \
+  F(CThostFtdcFutureSignIOField, CurrencyID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcFutureSignIOField, DeviceID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcFutureSignIOField, BrokerIDByBank, CTP_FIELD_STRING)             \
+  F(CThostFtdcFutureSignIOField, OperNo, CTP_FIELD_STRING)                     \
+  F(CThostFtdcFutureSignIOField, RequestID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcFutureSignIOField, TID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcRspFutureSignInField(F)                           \
+  F(CThostFtdcRspFutureSignInField, TradeCode, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspFutureSignInField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspFutureSignInField, BankBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcRspFutureSignInField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspFutureSignInField, BrokerBranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcRspFutureSignInField, TradeDate, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspFutureSignInField, TradeTime, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspFutureSignInField, BankSerial, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignInField, TradingDay, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignInField, PlateSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcRspFutureSignInField, LastFragment, CTP_FIELD_CHAR)              \
+  F(CThostFtdcRspFutureSignInField, SessionID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspFutureSignInField, InstallID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspFutureSignInField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspFutureSignInField, Digest, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspFutureSignInField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignInField, DeviceID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspFutureSignInField, BrokerIDByBank, CTP_FIELD_STRING)          \
+  F(CThostFtdcRspFutureSignInField, OperNo, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspFutureSignInField, RequestID, CTP_FIELD_INT32)                \
+  F(CThostFtdcRspFutureSignInField, TID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcRspFutureSignInField, ErrorID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcRspFutureSignInField, ErrorMsg, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspFutureSignInField, PinKey, CTP_FIELD_STRING)                  \
+  F(CThostFtdcRspFutureSignInField, MacKey, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqFutureSignOutField(F)                          \
+  F(CThostFtdcReqFutureSignOutField, TradeCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqFutureSignOutField, BankID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqFutureSignOutField, BankBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqFutureSignOutField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqFutureSignOutField, BrokerBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqFutureSignOutField, TradeDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqFutureSignOutField, TradeTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqFutureSignOutField, BankSerial, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqFutureSignOutField, TradingDay, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqFutureSignOutField, PlateSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqFutureSignOutField, LastFragment, CTP_FIELD_CHAR)             \
+  F(CThostFtdcReqFutureSignOutField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqFutureSignOutField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqFutureSignOutField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqFutureSignOutField, Digest, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqFutureSignOutField, CurrencyID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqFutureSignOutField, DeviceID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqFutureSignOutField, BrokerIDByBank, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqFutureSignOutField, OperNo, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqFutureSignOutField, RequestID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReqFutureSignOutField, TID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcRspFutureSignOutField(F)                          \
+  F(CThostFtdcRspFutureSignOutField, TradeCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignOutField, BankID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspFutureSignOutField, BankBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcRspFutureSignOutField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspFutureSignOutField, BrokerBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcRspFutureSignOutField, TradeDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignOutField, TradeTime, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspFutureSignOutField, BankSerial, CTP_FIELD_STRING)             \
+  F(CThostFtdcRspFutureSignOutField, TradingDay, CTP_FIELD_STRING)             \
+  F(CThostFtdcRspFutureSignOutField, PlateSerial, CTP_FIELD_INT32)             \
+  F(CThostFtdcRspFutureSignOutField, LastFragment, CTP_FIELD_CHAR)             \
+  F(CThostFtdcRspFutureSignOutField, SessionID, CTP_FIELD_INT32)               \
+  F(CThostFtdcRspFutureSignOutField, InstallID, CTP_FIELD_INT32)               \
+  F(CThostFtdcRspFutureSignOutField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspFutureSignOutField, Digest, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspFutureSignOutField, CurrencyID, CTP_FIELD_STRING)             \
+  F(CThostFtdcRspFutureSignOutField, DeviceID, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspFutureSignOutField, BrokerIDByBank, CTP_FIELD_STRING)         \
+  F(CThostFtdcRspFutureSignOutField, OperNo, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspFutureSignOutField, RequestID, CTP_FIELD_INT32)               \
+  F(CThostFtdcRspFutureSignOutField, TID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcRspFutureSignOutField, ErrorID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcRspFutureSignOutField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqQueryTradeResultBySerialField(F)               \
+  F(CThostFtdcReqQueryTradeResultBySerialField, TradeCode, CTP_FIELD_STRING)   \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BankID, CTP_FIELD_STRING)      \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BankBranchID, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, BrokerID, CTP_FIELD_STRING)    \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BrokerBranchID, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, TradeDate, CTP_FIELD_STRING)   \
+  F(CThostFtdcReqQueryTradeResultBySerialField, TradeTime, CTP_FIELD_STRING)   \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BankSerial, CTP_FIELD_STRING)  \
+  F(CThostFtdcReqQueryTradeResultBySerialField, TradingDay, CTP_FIELD_STRING)  \
+  F(CThostFtdcReqQueryTradeResultBySerialField, PlateSerial, CTP_FIELD_INT32)  \
+  F(CThostFtdcReqQueryTradeResultBySerialField, LastFragment, CTP_FIELD_CHAR)  \
+  F(CThostFtdcReqQueryTradeResultBySerialField, SessionID, CTP_FIELD_INT32)    \
+  F(CThostFtdcReqQueryTradeResultBySerialField, Reference, CTP_FIELD_INT32)    \
+  F(CThostFtdcReqQueryTradeResultBySerialField, RefrenceIssureType, CTP_FIELD_CHAR)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, RefrenceIssure, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, CustomerName, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, IdCardType, CTP_FIELD_CHAR)    \
+  F(CThostFtdcReqQueryTradeResultBySerialField, IdentifiedCardNo, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, CustType, CTP_FIELD_CHAR)      \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BankAccount, CTP_FIELD_STRING) \
+  F(CThostFtdcReqQueryTradeResultBySerialField, BankPassWord, CTP_FIELD_STRING)\
+  F(CThostFtdcReqQueryTradeResultBySerialField, AccountID, CTP_FIELD_STRING)   \
+  F(CThostFtdcReqQueryTradeResultBySerialField, Password, CTP_FIELD_STRING)    \
+  F(CThostFtdcReqQueryTradeResultBySerialField, CurrencyID, CTP_FIELD_STRING)  \
+  F(CThostFtdcReqQueryTradeResultBySerialField, TradeAmount, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcReqQueryTradeResultBySerialField, Digest, CTP_FIELD_STRING)      \
+  F(CThostFtdcReqQueryTradeResultBySerialField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspQueryTradeResultBySerialField(F)               \
+  F(CThostFtdcRspQueryTradeResultBySerialField, TradeCode, CTP_FIELD_STRING)   \
+  F(CThostFtdcRspQueryTradeResultBySerialField, BankID, CTP_FIELD_STRING)      \
+  F(CThostFtdcRspQueryTradeResultBySerialField, BankBranchID, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, BrokerID, CTP_FIELD_STRING)    \
+  F(CThostFtdcRspQueryTradeResultBySerialField, BrokerBranchID, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, TradeDate, CTP_FIELD_STRING)   \
+  F(CThostFtdcRspQueryTradeResultBySerialField, TradeTime, CTP_FIELD_STRING)   \
+  F(CThostFtdcRspQueryTradeResultBySerialField, BankSerial, CTP_FIELD_STRING)  \
+  F(CThostFtdcRspQueryTradeResultBySerialField, TradingDay, CTP_FIELD_STRING)  \
+  F(CThostFtdcRspQueryTradeResultBySerialField, PlateSerial, CTP_FIELD_INT32)  \
+  F(CThostFtdcRspQueryTradeResultBySerialField, LastFragment, CTP_FIELD_CHAR)  \
+  F(CThostFtdcRspQueryTradeResultBySerialField, SessionID, CTP_FIELD_INT32)    \
+  F(CThostFtdcRspQueryTradeResultBySerialField, ErrorID, CTP_FIELD_INT32)      \
+  F(CThostFtdcRspQueryTradeResultBySerialField, ErrorMsg, CTP_FIELD_STRING)    \
+  F(CThostFtdcRspQueryTradeResultBySerialField, Reference, CTP_FIELD_INT32)    \
+  F(CThostFtdcRspQueryTradeResultBySerialField, RefrenceIssureType, CTP_FIELD_CHAR)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, RefrenceIssure, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, OriginReturnCode, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, OriginDescrInfoForReturnCode, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, BankAccount, CTP_FIELD_STRING) \
+  F(CThostFtdcRspQueryTradeResultBySerialField, BankPassWord, CTP_FIELD_STRING)\
+  F(CThostFtdcRspQueryTradeResultBySerialField, AccountID, CTP_FIELD_STRING)   \
+  F(CThostFtdcRspQueryTradeResultBySerialField, Password, CTP_FIELD_STRING)    \
+  F(CThostFtdcRspQueryTradeResultBySerialField, CurrencyID, CTP_FIELD_STRING)  \
+  F(CThostFtdcRspQueryTradeResultBySerialField, TradeAmount, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcRspQueryTradeResultBySerialField, Digest, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqDayEndFileReadyField(F)                        \
+  F(CThostFtdcReqDayEndFileReadyField, TradeCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqDayEndFileReadyField, BankID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqDayEndFileReadyField, BankBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqDayEndFileReadyField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqDayEndFileReadyField, BrokerBranchID, CTP_FIELD_STRING)       \
+  F(CThostFtdcReqDayEndFileReadyField, TradeDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqDayEndFileReadyField, TradeTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqDayEndFileReadyField, BankSerial, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqDayEndFileReadyField, TradingDay, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqDayEndFileReadyField, PlateSerial, CTP_FIELD_INT32)           \
+  F(CThostFtdcReqDayEndFileReadyField, LastFragment, CTP_FIELD_CHAR)           \
+  F(CThostFtdcReqDayEndFileReadyField, SessionID, CTP_FIELD_INT32)             \
+  F(CThostFtdcReqDayEndFileReadyField, FileBusinessCode, CTP_FIELD_CHAR)       \
+  F(CThostFtdcReqDayEndFileReadyField, Digest, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReturnResultField(F)                              \
+  F(CThostFtdcReturnResultField, ReturnCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReturnResultField, DescrInfoForReturnCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcVerifyFuturePasswordField(F)                      \
+  F(CThostFtdcVerifyFuturePasswordField, TradeCode, CTP_FIELD_STRING)          \
+  F(CThostFtdcVerifyFuturePasswordField, BankID, CTP_FIELD_STRING)             \
+  F(CThostFtdcVerifyFuturePasswordField, BankBranchID, CTP_FIELD_STRING)       \
+  F(CThostFtdcVerifyFuturePasswordField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcVerifyFuturePasswordField, BrokerBranchID, CTP_FIELD_STRING)     \
+  F(CThostFtdcVerifyFuturePasswordField, TradeDate, CTP_FIELD_STRING)          \
+  F(CThostFtdcVerifyFuturePasswordField, TradeTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcVerifyFuturePasswordField, BankSerial, CTP_FIELD_STRING)         \
+  F(CThostFtdcVerifyFuturePasswordField, TradingDay, CTP_FIELD_STRING)         \
+  F(CThostFtdcVerifyFuturePasswordField, PlateSerial, CTP_FIELD_INT32)         \
+  F(CThostFtdcVerifyFuturePasswordField, LastFragment, CTP_FIELD_CHAR)         \
+  F(CThostFtdcVerifyFuturePasswordField, SessionID, CTP_FIELD_INT32)           \
+  F(CThostFtdcVerifyFuturePasswordField, AccountID, CTP_FIELD_STRING)          \
+  F(CThostFtdcVerifyFuturePasswordField, Password, CTP_FIELD_STRING)           \
+  F(CThostFtdcVerifyFuturePasswordField, BankAccount, CTP_FIELD_STRING)        \
+  F(CThostFtdcVerifyFuturePasswordField, BankPassWord, CTP_FIELD_STRING)       \
+  F(CThostFtdcVerifyFuturePasswordField, InstallID, CTP_FIELD_INT32)           \
+  F(CThostFtdcVerifyFuturePasswordField, TID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcVerifyFuturePasswordField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcVerifyCustInfoField(F)                            \
+  F(CThostFtdcVerifyCustInfoField, CustomerName, CTP_FIELD_STRING)             \
+  F(CThostFtdcVerifyCustInfoField, IdCardType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcVerifyCustInfoField, IdentifiedCardNo, CTP_FIELD_STRING)         \
+  F(CThostFtdcVerifyCustInfoField, CustType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcVerifyCustInfoField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcVerifyFuturePasswordAndCustInfoField(F)           \
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, CustomerName, CTP_FIELD_STRING)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, IdCardType, CTP_FIELD_CHAR)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, IdentifiedCardNo, CTP_FIELD_STRING)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, CustType, CTP_FIELD_CHAR)  \
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, AccountID, CTP_FIELD_STRING)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, Password, CTP_FIELD_STRING)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, CurrencyID, CTP_FIELD_STRING)\
+  F(CThostFtdcVerifyFuturePasswordAndCustInfoField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcDepositResultInformField(F)                       \
+  F(CThostFtdcDepositResultInformField, DepositSeqNo, CTP_FIELD_STRING)        \
+  F(CThostFtdcDepositResultInformField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcDepositResultInformField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcDepositResultInformField, Deposit, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcDepositResultInformField, RequestID, CTP_FIELD_INT32)            \
+  F(CThostFtdcDepositResultInformField, ReturnCode, CTP_FIELD_STRING)          \
+  F(CThostFtdcDepositResultInformField, DescrInfoForReturnCode, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqSyncKeyField(F)                                \
+  F(CThostFtdcReqSyncKeyField, TradeCode, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqSyncKeyField, BankID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcReqSyncKeyField, BankBranchID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqSyncKeyField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqSyncKeyField, BrokerBranchID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqSyncKeyField, TradeDate, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqSyncKeyField, TradeTime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcReqSyncKeyField, BankSerial, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqSyncKeyField, TradingDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqSyncKeyField, PlateSerial, CTP_FIELD_INT32)                   \
+  F(CThostFtdcReqSyncKeyField, LastFragment, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcReqSyncKeyField, SessionID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcReqSyncKeyField, InstallID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcReqSyncKeyField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcReqSyncKeyField, Message, CTP_FIELD_STRING)                      \
+  F(CThostFtdcReqSyncKeyField, DeviceID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcReqSyncKeyField, BrokerIDByBank, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqSyncKeyField, OperNo, CTP_FIELD_STRING)                       \
+  F(CThostFtdcReqSyncKeyField, RequestID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcReqSyncKeyField, TID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcRspSyncKeyField(F)                                \
+  F(CThostFtdcRspSyncKeyField, TradeCode, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspSyncKeyField, BankID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcRspSyncKeyField, BankBranchID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcRspSyncKeyField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspSyncKeyField, BrokerBranchID, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspSyncKeyField, TradeDate, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspSyncKeyField, TradeTime, CTP_FIELD_STRING)                    \
+  F(CThostFtdcRspSyncKeyField, BankSerial, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspSyncKeyField, TradingDay, CTP_FIELD_STRING)                   \
+  F(CThostFtdcRspSyncKeyField, PlateSerial, CTP_FIELD_INT32)                   \
+  F(CThostFtdcRspSyncKeyField, LastFragment, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcRspSyncKeyField, SessionID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcRspSyncKeyField, InstallID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcRspSyncKeyField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcRspSyncKeyField, Message, CTP_FIELD_STRING)                      \
+  F(CThostFtdcRspSyncKeyField, DeviceID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcRspSyncKeyField, BrokerIDByBank, CTP_FIELD_STRING)               \
+  F(CThostFtdcRspSyncKeyField, OperNo, CTP_FIELD_STRING)                       \
+  F(CThostFtdcRspSyncKeyField, RequestID, CTP_FIELD_INT32)                     \
+  F(CThostFtdcRspSyncKeyField, TID, CTP_FIELD_INT32)                           \
+  F(CThostFtdcRspSyncKeyField, ErrorID, CTP_FIELD_INT32)                       \
+  F(CThostFtdcRspSyncKeyField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcNotifyQueryAccountField(F)                        \
+  F(CThostFtdcNotifyQueryAccountField, TradeCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyQueryAccountField, BankID, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyQueryAccountField, BankBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcNotifyQueryAccountField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyQueryAccountField, BrokerBranchID, CTP_FIELD_STRING)       \
+  F(CThostFtdcNotifyQueryAccountField, TradeDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyQueryAccountField, TradeTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyQueryAccountField, BankSerial, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyQueryAccountField, TradingDay, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyQueryAccountField, PlateSerial, CTP_FIELD_INT32)           \
+  F(CThostFtdcNotifyQueryAccountField, LastFragment, CTP_FIELD_CHAR)           \
+  F(CThostFtdcNotifyQueryAccountField, SessionID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyQueryAccountField, CustomerName, CTP_FIELD_STRING)         \
+  F(CThostFtdcNotifyQueryAccountField, IdCardType, CTP_FIELD_CHAR)             \
+  F(CThostFtdcNotifyQueryAccountField, IdentifiedCardNo, CTP_FIELD_STRING)     \
+  F(CThostFtdcNotifyQueryAccountField, CustType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcNotifyQueryAccountField, BankAccount, CTP_FIELD_STRING)          \
+  F(CThostFtdcNotifyQueryAccountField, BankPassWord, CTP_FIELD_STRING)         \
+  F(CThostFtdcNotifyQueryAccountField, AccountID, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyQueryAccountField, Password, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyQueryAccountField, FutureSerial, CTP_FIELD_INT32)          \
+  F(CThostFtdcNotifyQueryAccountField, InstallID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyQueryAccountField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyQueryAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)       \
+  F(CThostFtdcNotifyQueryAccountField, CurrencyID, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyQueryAccountField, Digest, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyQueryAccountField, BankAccType, CTP_FIELD_CHAR)            \
+  F(CThostFtdcNotifyQueryAccountField, DeviceID, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyQueryAccountField, BankSecuAccType, CTP_FIELD_CHAR)        \
+  F(CThostFtdcNotifyQueryAccountField, BrokerIDByBank, CTP_FIELD_STRING)       \
+  F(CThostFtdcNotifyQueryAccountField, BankSecuAcc, CTP_FIELD_STRING)          \
+  F(CThostFtdcNotifyQueryAccountField, BankPwdFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcNotifyQueryAccountField, SecuPwdFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcNotifyQueryAccountField, OperNo, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyQueryAccountField, RequestID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyQueryAccountField, TID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcNotifyQueryAccountField, BankUseAmount, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcNotifyQueryAccountField, BankFetchAmount, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcNotifyQueryAccountField, ErrorID, CTP_FIELD_INT32)               \
+  F(CThostFtdcNotifyQueryAccountField, ErrorMsg, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyQueryAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTransferSerialField(F)                            \
+  F(CThostFtdcTransferSerialField, PlateSerial, CTP_FIELD_INT32)               \
+  F(CThostFtdcTransferSerialField, TradeDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferSerialField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcTransferSerialField, TradeTime, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferSerialField, TradeCode, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferSerialField, SessionID, CTP_FIELD_INT32)                 \
+  F(CThostFtdcTransferSerialField, BankID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcTransferSerialField, BankBranchID, CTP_FIELD_STRING)             \
+  F(CThostFtdcTransferSerialField, BankAccType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcTransferSerialField, BankAccount, CTP_FIELD_STRING)              \
+  F(CThostFtdcTransferSerialField, BankSerial, CTP_FIELD_STRING)               \
+  F(CThostFtdcTransferSerialField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcTransferSerialField, BrokerBranchID, CTP_FIELD_STRING)           \
+  F(CThostFtdcTransferSerialField, FutureAccType, CTP_FIELD_CHAR)              \
+  F(CThostFtdcTransferSerialField, AccountID, CTP_FIELD_STRING)                \
+  F(CThostFtdcTransferSerialField, InvestorID, CTP_FIELD_STRING)               \
+  F(CThostFtdcTransferSerialField, FutureSerial, CTP_FIELD_INT32)              \
+  F(CThostFtdcTransferSerialField, IdCardType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcTransferSerialField, IdentifiedCardNo, CTP_FIELD_STRING)         \
+  F(CThostFtdcTransferSerialField, CurrencyID, CTP_FIELD_STRING)               \
+  F(CThostFtdcTransferSerialField, TradeAmount, CTP_FIELD_DOUBLE)              \
+  F(CThostFtdcTransferSerialField, CustFee, CTP_FIELD_DOUBLE)                  \
+  F(CThostFtdcTransferSerialField, BrokerFee, CTP_FIELD_DOUBLE)                \
+  F(CThostFtdcTransferSerialField, AvailabilityFlag, CTP_FIELD_CHAR)           \
+  F(CThostFtdcTransferSerialField, OperatorCode, CTP_FIELD_STRING)             \
+  F(CThostFtdcTransferSerialField, BankNewAccount, CTP_FIELD_STRING)           \
+  F(CThostFtdcTransferSerialField, ErrorID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcTransferSerialField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryTransferSerialField(F)                         \
+  F(CThostFtdcQryTransferSerialField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcQryTransferSerialField, AccountID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryTransferSerialField, BankID, CTP_FIELD_STRING)                \
+  F(CThostFtdcQryTransferSerialField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcNotifyFutureSignInField(F)                        \
+  F(CThostFtdcNotifyFutureSignInField, TradeCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyFutureSignInField, BankID, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyFutureSignInField, BankBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcNotifyFutureSignInField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyFutureSignInField, BrokerBranchID, CTP_FIELD_STRING)       \
+  F(CThostFtdcNotifyFutureSignInField, TradeDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyFutureSignInField, TradeTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyFutureSignInField, BankSerial, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignInField, TradingDay, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignInField, PlateSerial, CTP_FIELD_INT32)           \
+  F(CThostFtdcNotifyFutureSignInField, LastFragment, CTP_FIELD_CHAR)           \
+  F(CThostFtdcNotifyFutureSignInField, SessionID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyFutureSignInField, InstallID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyFutureSignInField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyFutureSignInField, Digest, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyFutureSignInField, CurrencyID, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignInField, DeviceID, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyFutureSignInField, BrokerIDByBank, CTP_FIELD_STRING)       \
+  F(CThostFtdcNotifyFutureSignInField, OperNo, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyFutureSignInField, RequestID, CTP_FIELD_INT32)             \
+  F(CThostFtdcNotifyFutureSignInField, TID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcNotifyFutureSignInField, ErrorID, CTP_FIELD_INT32)               \
+  F(CThostFtdcNotifyFutureSignInField, ErrorMsg, CTP_FIELD_STRING)             \
+  F(CThostFtdcNotifyFutureSignInField, PinKey, CTP_FIELD_STRING)               \
+  F(CThostFtdcNotifyFutureSignInField, MacKey, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcNotifyFutureSignOutField(F)                       \
+  F(CThostFtdcNotifyFutureSignOutField, TradeCode, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignOutField, BankID, CTP_FIELD_STRING)              \
+  F(CThostFtdcNotifyFutureSignOutField, BankBranchID, CTP_FIELD_STRING)        \
+  F(CThostFtdcNotifyFutureSignOutField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyFutureSignOutField, BrokerBranchID, CTP_FIELD_STRING)      \
+  F(CThostFtdcNotifyFutureSignOutField, TradeDate, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignOutField, TradeTime, CTP_FIELD_STRING)           \
+  F(CThostFtdcNotifyFutureSignOutField, BankSerial, CTP_FIELD_STRING)          \
+  F(CThostFtdcNotifyFutureSignOutField, TradingDay, CTP_FIELD_STRING)          \
+  F(CThostFtdcNotifyFutureSignOutField, PlateSerial, CTP_FIELD_INT32)          \
+  F(CThostFtdcNotifyFutureSignOutField, LastFragment, CTP_FIELD_CHAR)          \
+  F(CThostFtdcNotifyFutureSignOutField, SessionID, CTP_FIELD_INT32)            \
+  F(CThostFtdcNotifyFutureSignOutField, InstallID, CTP_FIELD_INT32)            \
+  F(CThostFtdcNotifyFutureSignOutField, UserID, CTP_FIELD_STRING)              \
+  F(CThostFtdcNotifyFutureSignOutField, Digest, CTP_FIELD_STRING)              \
+  F(CThostFtdcNotifyFutureSignOutField, CurrencyID, CTP_FIELD_STRING)          \
+  F(CThostFtdcNotifyFutureSignOutField, DeviceID, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifyFutureSignOutField, BrokerIDByBank, CTP_FIELD_STRING)      \
+  F(CThostFtdcNotifyFutureSignOutField, OperNo, CTP_FIELD_STRING)              \
+  F(CThostFtdcNotifyFutureSignOutField, RequestID, CTP_FIELD_INT32)            \
+  F(CThostFtdcNotifyFutureSignOutField, TID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcNotifyFutureSignOutField, ErrorID, CTP_FIELD_INT32)              \
+  F(CThostFtdcNotifyFutureSignOutField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcNotifySyncKeyField(F)                             \
+  F(CThostFtdcNotifySyncKeyField, TradeCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcNotifySyncKeyField, BankID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcNotifySyncKeyField, BankBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcNotifySyncKeyField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcNotifySyncKeyField, BrokerBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifySyncKeyField, TradeDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcNotifySyncKeyField, TradeTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcNotifySyncKeyField, BankSerial, CTP_FIELD_STRING)                \
+  F(CThostFtdcNotifySyncKeyField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcNotifySyncKeyField, PlateSerial, CTP_FIELD_INT32)                \
+  F(CThostFtdcNotifySyncKeyField, LastFragment, CTP_FIELD_CHAR)                \
+  F(CThostFtdcNotifySyncKeyField, SessionID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcNotifySyncKeyField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcNotifySyncKeyField, UserID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcNotifySyncKeyField, Message, CTP_FIELD_STRING)                   \
+  F(CThostFtdcNotifySyncKeyField, DeviceID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcNotifySyncKeyField, BrokerIDByBank, CTP_FIELD_STRING)            \
+  F(CThostFtdcNotifySyncKeyField, OperNo, CTP_FIELD_STRING)                    \
+  F(CThostFtdcNotifySyncKeyField, RequestID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcNotifySyncKeyField, TID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcNotifySyncKeyField, ErrorID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcNotifySyncKeyField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryAccountregisterField(F)                        \
+  F(CThostFtdcQryAccountregisterField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQryAccountregisterField, AccountID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryAccountregisterField, BankID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQryAccountregisterField, BankBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcQryAccountregisterField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcAccountregisterField(F)                           \
+  F(CThostFtdcAccountregisterField, TradeDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountregisterField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcAccountregisterField, BankBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcAccountregisterField, BankAccount, CTP_FIELD_STRING)             \
+  F(CThostFtdcAccountregisterField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountregisterField, BrokerBranchID, CTP_FIELD_STRING)          \
+  F(CThostFtdcAccountregisterField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcAccountregisterField, IdCardType, CTP_FIELD_CHAR)                \
+  F(CThostFtdcAccountregisterField, IdentifiedCardNo, CTP_FIELD_STRING)        \
+  F(CThostFtdcAccountregisterField, CustomerName, CTP_FIELD_STRING)            \
+  F(CThostFtdcAccountregisterField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcAccountregisterField, OpenOrDestroy, CTP_FIELD_CHAR)             \
+  F(CThostFtdcAccountregisterField, RegDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcAccountregisterField, OutDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcAccountregisterField, TID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcAccountregisterField, CustType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcAccountregisterField, BankAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcAccountregisterField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcOpenAccountField(F)                               \
+  F(CThostFtdcOpenAccountField, TradeCode, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOpenAccountField, BankID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOpenAccountField, BankBranchID, CTP_FIELD_STRING)                \
+  F(CThostFtdcOpenAccountField, BrokerID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOpenAccountField, BrokerBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcOpenAccountField, TradeDate, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOpenAccountField, TradeTime, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOpenAccountField, BankSerial, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOpenAccountField, TradingDay, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOpenAccountField, PlateSerial, CTP_FIELD_INT32)                  \
+  F(CThostFtdcOpenAccountField, LastFragment, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcOpenAccountField, SessionID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcOpenAccountField, CustomerName, CTP_FIELD_STRING)                \
+  F(CThostFtdcOpenAccountField, IdCardType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcOpenAccountField, IdentifiedCardNo, CTP_FIELD_STRING)            \
+  F(CThostFtdcOpenAccountField, Gender, CTP_FIELD_CHAR)                        \
+  F(CThostFtdcOpenAccountField, CountryCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcOpenAccountField, CustType, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcOpenAccountField, Address, CTP_FIELD_STRING)                     \
+  F(CThostFtdcOpenAccountField, ZipCode, CTP_FIELD_STRING)                     \
+  F(CThostFtdcOpenAccountField, Telephone, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOpenAccountField, MobilePhone, CTP_FIELD_STRING)                 \
+  F(CThostFtdcOpenAccountField, Fax, CTP_FIELD_STRING)                         \
+  F(CThostFtdcOpenAccountField, EMail, CTP_FIELD_STRING)                       \
+  F(CThostFtdcOpenAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)            \
+  F(CThostFtdcOpenAccountField, BankAccount, CTP_FIELD_STRING)                 \
+  F(CThostFtdcOpenAccountField, BankPassWord, CTP_FIELD_STRING)                \
+  F(CThostFtdcOpenAccountField, AccountID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcOpenAccountField, Password, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOpenAccountField, InstallID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcOpenAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)              \
+  F(CThostFtdcOpenAccountField, CurrencyID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcOpenAccountField, CashExchangeCode, CTP_FIELD_CHAR)              \
+  F(CThostFtdcOpenAccountField, Digest, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOpenAccountField, BankAccType, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcOpenAccountField, DeviceID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOpenAccountField, BankSecuAccType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcOpenAccountField, BrokerIDByBank, CTP_FIELD_STRING)              \
+  F(CThostFtdcOpenAccountField, BankSecuAcc, CTP_FIELD_STRING)                 \
+  F(CThostFtdcOpenAccountField, BankPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcOpenAccountField, SecuPwdFlag, CTP_FIELD_CHAR)                   \
+  F(CThostFtdcOpenAccountField, OperNo, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOpenAccountField, TID, CTP_FIELD_INT32)                          \
+  F(CThostFtdcOpenAccountField, UserID, CTP_FIELD_STRING)                      \
+  F(CThostFtdcOpenAccountField, ErrorID, CTP_FIELD_INT32)                      \
+  F(CThostFtdcOpenAccountField, ErrorMsg, CTP_FIELD_STRING)                    \
+  F(CThostFtdcOpenAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCancelAccountField(F)                             \
+  F(CThostFtdcCancelAccountField, TradeCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCancelAccountField, BankID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCancelAccountField, BankBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcCancelAccountField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcCancelAccountField, BrokerBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcCancelAccountField, TradeDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCancelAccountField, TradeTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCancelAccountField, BankSerial, CTP_FIELD_STRING)                \
+  F(CThostFtdcCancelAccountField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcCancelAccountField, PlateSerial, CTP_FIELD_INT32)                \
+  F(CThostFtdcCancelAccountField, LastFragment, CTP_FIELD_CHAR)                \
+  F(CThostFtdcCancelAccountField, SessionID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcCancelAccountField, CustomerName, CTP_FIELD_STRING)              \
+  F(CThostFtdcCancelAccountField, IdCardType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcCancelAccountField, IdentifiedCardNo, CTP_FIELD_STRING)          \
+  F(CThostFtdcCancelAccountField, Gender, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcCancelAccountField, CountryCode, CTP_FIELD_STRING)               \
+  F(CThostFtdcCancelAccountField, CustType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcCancelAccountField, Address, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCancelAccountField, ZipCode, CTP_FIELD_STRING)                   \
+  F(CThostFtdcCancelAccountField, Telephone, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCancelAccountField, MobilePhone, CTP_FIELD_STRING)               \
+  F(CThostFtdcCancelAccountField, Fax, CTP_FIELD_STRING)                       \
+  F(CThostFtdcCancelAccountField, EMail, CTP_FIELD_STRING)                     \
+  F(CThostFtdcCancelAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)          \
+  F(CThostFtdcCancelAccountField, BankAccount, CTP_FIELD_STRING)               \
+  F(CThostFtdcCancelAccountField, BankPassWord, CTP_FIELD_STRING)              \
+  F(CThostFtdcCancelAccountField, AccountID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcCancelAccountField, Password, CTP_FIELD_STRING)                  \
+  F(CThostFtdcCancelAccountField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcCancelAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcCancelAccountField, CurrencyID, CTP_FIELD_STRING)                \
+  F(CThostFtdcCancelAccountField, CashExchangeCode, CTP_FIELD_CHAR)            \
+  F(CThostFtdcCancelAccountField, Digest, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCancelAccountField, BankAccType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcCancelAccountField, DeviceID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcCancelAccountField, BankSecuAccType, CTP_FIELD_CHAR)             \
+  F(CThostFtdcCancelAccountField, BrokerIDByBank, CTP_FIELD_STRING)            \
+  F(CThostFtdcCancelAccountField, BankSecuAcc, CTP_FIELD_STRING)               \
+  F(CThostFtdcCancelAccountField, BankPwdFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcCancelAccountField, SecuPwdFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcCancelAccountField, OperNo, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCancelAccountField, TID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcCancelAccountField, UserID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcCancelAccountField, ErrorID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcCancelAccountField, ErrorMsg, CTP_FIELD_STRING)                  \
+  F(CThostFtdcCancelAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcChangeAccountField(F)                             \
+  F(CThostFtdcChangeAccountField, TradeCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcChangeAccountField, BankID, CTP_FIELD_STRING)                    \
+  F(CThostFtdcChangeAccountField, BankBranchID, CTP_FIELD_STRING)              \
+  F(CThostFtdcChangeAccountField, BrokerID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcChangeAccountField, BrokerBranchID, CTP_FIELD_STRING)            \
+  F(CThostFtdcChangeAccountField, TradeDate, CTP_FIELD_STRING)                 \
+  F(CThostFtdcChangeAccountField, TradeTime, CTP_FIELD_STRING)                 \
+  F(CThostFtdcChangeAccountField, BankSerial, CTP_FIELD_STRING)                \
+  F(CThostFtdcChangeAccountField, TradingDay, CTP_FIELD_STRING)                \
+  F(CThostFtdcChangeAccountField, PlateSerial, CTP_FIELD_INT32)                \
+  F(CThostFtdcChangeAccountField, LastFragment, CTP_FIELD_CHAR)                \
+  F(CThostFtdcChangeAccountField, SessionID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcChangeAccountField, CustomerName, CTP_FIELD_STRING)              \
+  F(CThostFtdcChangeAccountField, IdCardType, CTP_FIELD_CHAR)                  \
+  F(CThostFtdcChangeAccountField, IdentifiedCardNo, CTP_FIELD_STRING)          \
+  F(CThostFtdcChangeAccountField, Gender, CTP_FIELD_CHAR)                      \
+  F(CThostFtdcChangeAccountField, CountryCode, CTP_FIELD_STRING)               \
+  F(CThostFtdcChangeAccountField, CustType, CTP_FIELD_CHAR)                    \
+  F(CThostFtdcChangeAccountField, Address, CTP_FIELD_STRING)                   \
+  F(CThostFtdcChangeAccountField, ZipCode, CTP_FIELD_STRING)                   \
+  F(CThostFtdcChangeAccountField, Telephone, CTP_FIELD_STRING)                 \
+  F(CThostFtdcChangeAccountField, MobilePhone, CTP_FIELD_STRING)               \
+  F(CThostFtdcChangeAccountField, Fax, CTP_FIELD_STRING)                       \
+  F(CThostFtdcChangeAccountField, EMail, CTP_FIELD_STRING)                     \
+  F(CThostFtdcChangeAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)          \
+  F(CThostFtdcChangeAccountField, BankAccount, CTP_FIELD_STRING)               \
+  F(CThostFtdcChangeAccountField, BankPassWord, CTP_FIELD_STRING)              \
+  F(CThostFtdcChangeAccountField, NewBankAccount, CTP_FIELD_STRING)            \
+  F(CThostFtdcChangeAccountField, NewBankPassWord, CTP_FIELD_STRING)           \
+  F(CThostFtdcChangeAccountField, AccountID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcChangeAccountField, Password, CTP_FIELD_STRING)                  \
+  F(CThostFtdcChangeAccountField, BankAccType, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcChangeAccountField, InstallID, CTP_FIELD_INT32)                  \
+  F(CThostFtdcChangeAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcChangeAccountField, CurrencyID, CTP_FIELD_STRING)                \
+  F(CThostFtdcChangeAccountField, BrokerIDByBank, CTP_FIELD_STRING)            \
+  F(CThostFtdcChangeAccountField, BankPwdFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcChangeAccountField, SecuPwdFlag, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcChangeAccountField, TID, CTP_FIELD_INT32)                        \
+  F(CThostFtdcChangeAccountField, Digest, CTP_FIELD_STRING)                    \
+  F(CThostFtdcChangeAccountField, ErrorID, CTP_FIELD_INT32)                    \
+  F(CThostFtdcChangeAccountField, ErrorMsg, CTP_FIELD_STRING)                  \
+  F(CThostFtdcChangeAccountField, LongCustomerName, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSecAgentACIDMapField(F)                           \
+  F(CThostFtdcSecAgentACIDMapField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcSecAgentACIDMapField, UserID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcSecAgentACIDMapField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcSecAgentACIDMapField, CurrencyID, CTP_FIELD_STRING)              \
+  F(CThostFtdcSecAgentACIDMapField, BrokerSecAgentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySecAgentACIDMapField(F)                        \
+  F(CThostFtdcQrySecAgentACIDMapField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcQrySecAgentACIDMapField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcQrySecAgentACIDMapField, AccountID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQrySecAgentACIDMapField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcUserRightsAssignField(F)                          \
+  F(CThostFtdcUserRightsAssignField, BrokerID, CTP_FIELD_STRING)               \
+  F(CThostFtdcUserRightsAssignField, UserID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcUserRightsAssignField, DRIdentityID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcBrokerUserRightAssignField(F)                     \
+  F(CThostFtdcBrokerUserRightAssignField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcBrokerUserRightAssignField, DRIdentityID, CTP_FIELD_INT32)       \
+  F(CThostFtdcBrokerUserRightAssignField, Tradeable, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcDRTransferField(F)                                \
+  F(CThostFtdcDRTransferField, OrigDRIdentityID, CTP_FIELD_INT32)              \
+  F(CThostFtdcDRTransferField, DestDRIdentityID, CTP_FIELD_INT32)              \
+  F(CThostFtdcDRTransferField, OrigBrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcDRTransferField, DestBrokerID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcFensUserInfoField(F)                              \
+  F(CThostFtdcFensUserInfoField, BrokerID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcFensUserInfoField, UserID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcFensUserInfoField, LoginMode, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcCurrTransferIdentityField(F)                      \
+  F(CThostFtdcCurrTransferIdentityField, IdentityID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcLoginForbiddenUserField(F)                        \
+  F(CThostFtdcLoginForbiddenUserField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcLoginForbiddenUserField, UserID, CTP_FIELD_STRING)               \
+  F(CThostFtdcLoginForbiddenUserField, reserve1, CTP_FIELD_STRING)             \
+  F(CThostFtdcLoginForbiddenUserField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryLoginForbiddenUserField(F)                     \
+  F(CThostFtdcQryLoginForbiddenUserField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcQryLoginForbiddenUserField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcTradingAccountReserveField(F)                     \
+  F(CThostFtdcTradingAccountReserveField, BrokerID, CTP_FIELD_STRING)          \
+  F(CThostFtdcTradingAccountReserveField, AccountID, CTP_FIELD_STRING)         \
+  F(CThostFtdcTradingAccountReserveField, Reserve, CTP_FIELD_DOUBLE)           \
+  F(CThostFtdcTradingAccountReserveField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryLoginForbiddenIPField(F)                       \
+  F(CThostFtdcQryLoginForbiddenIPField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryLoginForbiddenIPField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryIPListField(F)                                 \
+  F(CThostFtdcQryIPListField, reserve1, CTP_FIELD_STRING)                      \
+  F(CThostFtdcQryIPListField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryUserRightsAssignField(F)                       \
+  F(CThostFtdcQryUserRightsAssignField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcQryUserRightsAssignField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReserveOpenAccountConfirmField(F)                 \
+  F(CThostFtdcReserveOpenAccountConfirmField, TradeCode, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankID, CTP_FIELD_STRING)        \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankBranchID, CTP_FIELD_STRING)  \
+  F(CThostFtdcReserveOpenAccountConfirmField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, BrokerBranchID, CTP_FIELD_STRING)\
+  F(CThostFtdcReserveOpenAccountConfirmField, TradeDate, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, TradeTime, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankSerial, CTP_FIELD_STRING)    \
+  F(CThostFtdcReserveOpenAccountConfirmField, TradingDay, CTP_FIELD_STRING)    \
+  F(CThostFtdcReserveOpenAccountConfirmField, PlateSerial, CTP_FIELD_INT32)    \
+  F(CThostFtdcReserveOpenAccountConfirmField, LastFragment, CTP_FIELD_CHAR)    \
+  F(CThostFtdcReserveOpenAccountConfirmField, SessionID, CTP_FIELD_INT32)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, CustomerName, CTP_FIELD_STRING)  \
+  F(CThostFtdcReserveOpenAccountConfirmField, IdCardType, CTP_FIELD_CHAR)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, IdentifiedCardNo, CTP_FIELD_STRING)\
+  F(CThostFtdcReserveOpenAccountConfirmField, Gender, CTP_FIELD_CHAR)          \
+  F(CThostFtdcReserveOpenAccountConfirmField, CountryCode, CTP_FIELD_STRING)   \
+  F(CThostFtdcReserveOpenAccountConfirmField, CustType, CTP_FIELD_CHAR)        \
+  F(CThostFtdcReserveOpenAccountConfirmField, Address, CTP_FIELD_STRING)       \
+  F(CThostFtdcReserveOpenAccountConfirmField, ZipCode, CTP_FIELD_STRING)       \
+  F(CThostFtdcReserveOpenAccountConfirmField, Telephone, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, MobilePhone, CTP_FIELD_STRING)   \
+  F(CThostFtdcReserveOpenAccountConfirmField, Fax, CTP_FIELD_STRING)           \
+  F(CThostFtdcReserveOpenAccountConfirmField, EMail, CTP_FIELD_STRING)         \
+  F(CThostFtdcReserveOpenAccountConfirmField, MoneyAccountStatus, CTP_FIELD_CHAR)\
+  F(CThostFtdcReserveOpenAccountConfirmField, BankAccount, CTP_FIELD_STRING)   \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankPassWord, CTP_FIELD_STRING)  \
+  F(CThostFtdcReserveOpenAccountConfirmField, InstallID, CTP_FIELD_INT32)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, VerifyCertNoFlag, CTP_FIELD_CHAR)\
+  F(CThostFtdcReserveOpenAccountConfirmField, CurrencyID, CTP_FIELD_STRING)    \
+  F(CThostFtdcReserveOpenAccountConfirmField, Digest, CTP_FIELD_STRING)        \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankAccType, CTP_FIELD_CHAR)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, BrokerIDByBank, CTP_FIELD_STRING)\
+  F(CThostFtdcReserveOpenAccountConfirmField, TID, CTP_FIELD_INT32)            \
+  F(CThostFtdcReserveOpenAccountConfirmField, AccountID, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountConfirmField, Password, CTP_FIELD_STRING)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, BankReserveOpenSeq, CTP_FIELD_STRING)\
+  F(CThostFtdcReserveOpenAccountConfirmField, BookDate, CTP_FIELD_STRING)      \
+  F(CThostFtdcReserveOpenAccountConfirmField, BookPsw, CTP_FIELD_STRING)       \
+  F(CThostFtdcReserveOpenAccountConfirmField, ErrorID, CTP_FIELD_INT32)        \
+  F(CThostFtdcReserveOpenAccountConfirmField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReserveOpenAccountField(F)                        \
+  F(CThostFtdcReserveOpenAccountField, TradeCode, CTP_FIELD_STRING)            \
+  F(CThostFtdcReserveOpenAccountField, BankID, CTP_FIELD_STRING)               \
+  F(CThostFtdcReserveOpenAccountField, BankBranchID, CTP_FIELD_STRING)         \
+  F(CThostFtdcReserveOpenAccountField, BrokerID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReserveOpenAccountField, BrokerBranchID, CTP_FIELD_STRING)       \
+  F(CThostFtdcReserveOpenAccountField, TradeDate, CTP_FIELD_STRING)            \
+  F(CThostFtdcReserveOpenAccountField, TradeTime, CTP_FIELD_STRING)            \
+  F(CThostFtdcReserveOpenAccountField, BankSerial, CTP_FIELD_STRING)           \
+  F(CThostFtdcReserveOpenAccountField, TradingDay, CTP_FIELD_STRING)           \
+  F(CThostFtdcReserveOpenAccountField, PlateSerial, CTP_FIELD_INT32)           \
+  F(CThostFtdcReserveOpenAccountField, LastFragment, CTP_FIELD_CHAR)           \
+  F(CThostFtdcReserveOpenAccountField, SessionID, CTP_FIELD_INT32)             \
+  F(CThostFtdcReserveOpenAccountField, CustomerName, CTP_FIELD_STRING)         \
+  F(CThostFtdcReserveOpenAccountField, IdCardType, CTP_FIELD_CHAR)             \
+  F(CThostFtdcReserveOpenAccountField, IdentifiedCardNo, CTP_FIELD_STRING)     \
+  F(CThostFtdcReserveOpenAccountField, Gender, CTP_FIELD_CHAR)                 \
+  F(CThostFtdcReserveOpenAccountField, CountryCode, CTP_FIELD_STRING)          \
+  F(CThostFtdcReserveOpenAccountField, CustType, CTP_FIELD_CHAR)               \
+  F(CThostFtdcReserveOpenAccountField, Address, CTP_FIELD_STRING)              \
+  F(CThostFtdcReserveOpenAccountField, ZipCode, CTP_FIELD_STRING)              \
+  F(CThostFtdcReserveOpenAccountField, Telephone, CTP_FIELD_STRING)            \
+  F(CThostFtdcReserveOpenAccountField, MobilePhone, CTP_FIELD_STRING)          \
+  F(CThostFtdcReserveOpenAccountField, Fax, CTP_FIELD_STRING)                  \
+  F(CThostFtdcReserveOpenAccountField, EMail, CTP_FIELD_STRING)                \
+  F(CThostFtdcReserveOpenAccountField, MoneyAccountStatus, CTP_FIELD_CHAR)     \
+  F(CThostFtdcReserveOpenAccountField, BankAccount, CTP_FIELD_STRING)          \
+  F(CThostFtdcReserveOpenAccountField, BankPassWord, CTP_FIELD_STRING)         \
+  F(CThostFtdcReserveOpenAccountField, InstallID, CTP_FIELD_INT32)             \
+  F(CThostFtdcReserveOpenAccountField, VerifyCertNoFlag, CTP_FIELD_CHAR)       \
+  F(CThostFtdcReserveOpenAccountField, CurrencyID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReserveOpenAccountField, Digest, CTP_FIELD_STRING)               \
+  F(CThostFtdcReserveOpenAccountField, BankAccType, CTP_FIELD_CHAR)            \
+  F(CThostFtdcReserveOpenAccountField, BrokerIDByBank, CTP_FIELD_STRING)       \
+  F(CThostFtdcReserveOpenAccountField, TID, CTP_FIELD_INT32)                   \
+  F(CThostFtdcReserveOpenAccountField, ReserveOpenAccStas, CTP_FIELD_CHAR)     \
+  F(CThostFtdcReserveOpenAccountField, ErrorID, CTP_FIELD_INT32)               \
+  F(CThostFtdcReserveOpenAccountField, ErrorMsg, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcAccountPropertyField(F)                           \
+  F(CThostFtdcAccountPropertyField, BrokerID, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountPropertyField, AccountID, CTP_FIELD_STRING)               \
+  F(CThostFtdcAccountPropertyField, BankID, CTP_FIELD_STRING)                  \
+  F(CThostFtdcAccountPropertyField, BankAccount, CTP_FIELD_STRING)             \
+  F(CThostFtdcAccountPropertyField, OpenName, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountPropertyField, OpenBank, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountPropertyField, IsActive, CTP_FIELD_INT32)                 \
+  F(CThostFtdcAccountPropertyField, AccountSourceType, CTP_FIELD_CHAR)         \
+  F(CThostFtdcAccountPropertyField, OpenDate, CTP_FIELD_STRING)                \
+  F(CThostFtdcAccountPropertyField, CancelDate, CTP_FIELD_STRING)              \
+  F(CThostFtdcAccountPropertyField, OperatorID, CTP_FIELD_STRING)              \
+  F(CThostFtdcAccountPropertyField, OperateDate, CTP_FIELD_STRING)             \
+  F(CThostFtdcAccountPropertyField, OperateTime, CTP_FIELD_STRING)             \
+  F(CThostFtdcAccountPropertyField, CurrencyID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryCurrDRIdentityField(F)                         \
+  F(CThostFtdcQryCurrDRIdentityField, DRIdentityID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcCurrDRIdentityField(F)                            \
+  F(CThostFtdcCurrDRIdentityField, DRIdentityID, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcQrySecAgentCheckModeField(F)                      \
+  F(CThostFtdcQrySecAgentCheckModeField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQrySecAgentCheckModeField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQrySecAgentTradeInfoField(F)                      \
+  F(CThostFtdcQrySecAgentTradeInfoField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcQrySecAgentTradeInfoField, BrokerSecAgentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqUserAuthMethodField(F)                         \
+  F(CThostFtdcReqUserAuthMethodField, TradingDay, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserAuthMethodField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqUserAuthMethodField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspUserAuthMethodField(F)                         \
+  F(CThostFtdcRspUserAuthMethodField, UsableAuthMethod, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcReqGenUserCaptchaField(F)                         \
+  F(CThostFtdcReqGenUserCaptchaField, TradingDay, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqGenUserCaptchaField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqGenUserCaptchaField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspGenUserCaptchaField(F)                         \
+  F(CThostFtdcRspGenUserCaptchaField, BrokerID, CTP_FIELD_STRING)              \
+  F(CThostFtdcRspGenUserCaptchaField, UserID, CTP_FIELD_STRING)                \
+  F(CThostFtdcRspGenUserCaptchaField, CaptchaInfoLen, CTP_FIELD_INT32)         \
+  F(CThostFtdcRspGenUserCaptchaField, CaptchaInfo, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqGenUserTextField(F)                            \
+  F(CThostFtdcReqGenUserTextField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqGenUserTextField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqGenUserTextField, UserID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspGenUserTextField(F)                            \
+  F(CThostFtdcRspGenUserTextField, UserTextSeq, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcReqUserLoginWithCaptchaField(F)                   \
+  F(CThostFtdcReqUserLoginWithCaptchaField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcReqUserLoginWithCaptchaField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqUserLoginWithCaptchaField, UserID, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginWithCaptchaField, Password, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqUserLoginWithCaptchaField, UserProductInfo, CTP_FIELD_STRING) \
+  F(CThostFtdcReqUserLoginWithCaptchaField, InterfaceProductInfo, CTP_FIELD_STRING)\
+  F(CThostFtdcReqUserLoginWithCaptchaField, ProtocolInfo, CTP_FIELD_STRING)    \
+  F(CThostFtdcReqUserLoginWithCaptchaField, MacAddress, CTP_FIELD_STRING)      \
+  F(CThostFtdcReqUserLoginWithCaptchaField, reserve1, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqUserLoginWithCaptchaField, LoginRemark, CTP_FIELD_STRING)     \
+  F(CThostFtdcReqUserLoginWithCaptchaField, Captcha, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqUserLoginWithCaptchaField, ClientIPPort, CTP_FIELD_INT32)     \
+  F(CThostFtdcReqUserLoginWithCaptchaField, ClientIPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqUserLoginWithTextField(F)                      \
+  F(CThostFtdcReqUserLoginWithTextField, TradingDay, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqUserLoginWithTextField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqUserLoginWithTextField, UserID, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqUserLoginWithTextField, Password, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqUserLoginWithTextField, UserProductInfo, CTP_FIELD_STRING)    \
+  F(CThostFtdcReqUserLoginWithTextField, InterfaceProductInfo, CTP_FIELD_STRING)\
+  F(CThostFtdcReqUserLoginWithTextField, ProtocolInfo, CTP_FIELD_STRING)       \
+  F(CThostFtdcReqUserLoginWithTextField, MacAddress, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqUserLoginWithTextField, reserve1, CTP_FIELD_STRING)           \
+  F(CThostFtdcReqUserLoginWithTextField, LoginRemark, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqUserLoginWithTextField, Text, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqUserLoginWithTextField, ClientIPPort, CTP_FIELD_INT32)        \
+  F(CThostFtdcReqUserLoginWithTextField, ClientIPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqUserLoginWithOTPField(F)                       \
+  F(CThostFtdcReqUserLoginWithOTPField, TradingDay, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginWithOTPField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserLoginWithOTPField, UserID, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqUserLoginWithOTPField, Password, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserLoginWithOTPField, UserProductInfo, CTP_FIELD_STRING)     \
+  F(CThostFtdcReqUserLoginWithOTPField, InterfaceProductInfo, CTP_FIELD_STRING)\
+  F(CThostFtdcReqUserLoginWithOTPField, ProtocolInfo, CTP_FIELD_STRING)        \
+  F(CThostFtdcReqUserLoginWithOTPField, MacAddress, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginWithOTPField, reserve1, CTP_FIELD_STRING)            \
+  F(CThostFtdcReqUserLoginWithOTPField, LoginRemark, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqUserLoginWithOTPField, OTPPassword, CTP_FIELD_STRING)         \
+  F(CThostFtdcReqUserLoginWithOTPField, ClientIPPort, CTP_FIELD_INT32)         \
+  F(CThostFtdcReqUserLoginWithOTPField, ClientIPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcReqApiHandshakeField(F)                           \
+  F(CThostFtdcReqApiHandshakeField, CryptoKeyVersion, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRspApiHandshakeField(F)                           \
+  F(CThostFtdcRspApiHandshakeField, FrontHandshakeDataLen, CTP_FIELD_INT32)    \
+  F(CThostFtdcRspApiHandshakeField, FrontHandshakeData, CTP_FIELD_STRING)      \
+  F(CThostFtdcRspApiHandshakeField, IsApiAuthEnabled, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcReqVerifyApiKeyField(F)                           \
+  F(CThostFtdcReqVerifyApiKeyField, ApiHandshakeDataLen, CTP_FIELD_INT32)      \
+  F(CThostFtdcReqVerifyApiKeyField, ApiHandshakeData, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcDepartmentUserField(F)                            \
+  F(CThostFtdcDepartmentUserField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcDepartmentUserField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcDepartmentUserField, InvestorRange, CTP_FIELD_CHAR)              \
+  F(CThostFtdcDepartmentUserField, InvestorID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQueryFreqField(F)                                 \
+  F(CThostFtdcQueryFreqField, QueryFreq, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcAuthForbiddenIPField(F)                           \
+  F(CThostFtdcAuthForbiddenIPField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryAuthForbiddenIPField(F)                        \
+  F(CThostFtdcQryAuthForbiddenIPField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcSyncDelaySwapFrozenField(F)                       \
+  F(CThostFtdcSyncDelaySwapFrozenField, DelaySwapSeqNo, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDelaySwapFrozenField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncDelaySwapFrozenField, InvestorID, CTP_FIELD_STRING)          \
+  F(CThostFtdcSyncDelaySwapFrozenField, FromCurrencyID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDelaySwapFrozenField, FromRemainSwap, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDelaySwapFrozenField, IsManualSwap, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcUserSystemInfoField(F)                            \
+  F(CThostFtdcUserSystemInfoField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcUserSystemInfoField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcUserSystemInfoField, ClientSystemInfoLen, CTP_FIELD_INT32)       \
+  F(CThostFtdcUserSystemInfoField, ClientSystemInfo, CTP_FIELD_STRING)         \
+  F(CThostFtdcUserSystemInfoField, reserve1, CTP_FIELD_STRING)                 \
+  F(CThostFtdcUserSystemInfoField, ClientIPPort, CTP_FIELD_INT32)              \
+  F(CThostFtdcUserSystemInfoField, ClientLoginTime, CTP_FIELD_STRING)          \
+  F(CThostFtdcUserSystemInfoField, ClientAppID, CTP_FIELD_STRING)              \
+  F(CThostFtdcUserSystemInfoField, ClientPublicIP, CTP_FIELD_STRING)           \
+  F(CThostFtdcUserSystemInfoField, ClientLoginRemark, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcAuthUserIDField(F)                                \
+  F(CThostFtdcAuthUserIDField, BrokerID, CTP_FIELD_STRING)                     \
+  F(CThostFtdcAuthUserIDField, AppID, CTP_FIELD_STRING)                        \
+  F(CThostFtdcAuthUserIDField, UserID, CTP_FIELD_STRING)                       \
+  F(CThostFtdcAuthUserIDField, AuthType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcAuthIPField(F)                                    \
+  F(CThostFtdcAuthIPField, BrokerID, CTP_FIELD_STRING)                         \
+  F(CThostFtdcAuthIPField, AppID, CTP_FIELD_STRING)                            \
+  F(CThostFtdcAuthIPField, IPAddress, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryClassifiedInstrumentField(F)                   \
+  F(CThostFtdcQryClassifiedInstrumentField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcQryClassifiedInstrumentField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcQryClassifiedInstrumentField, ExchangeInstID, CTP_FIELD_STRING)  \
+  F(CThostFtdcQryClassifiedInstrumentField, ProductID, CTP_FIELD_STRING)       \
+  F(CThostFtdcQryClassifiedInstrumentField, TradingType, CTP_FIELD_CHAR)       \
+  F(CThostFtdcQryClassifiedInstrumentField, ClassType, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcQryCombPromotionParamField(F)                     \
+  F(CThostFtdcQryCombPromotionParamField, ExchangeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcQryCombPromotionParamField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcCombPromotionParamField(F)                        \
+  F(CThostFtdcCombPromotionParamField, ExchangeID, CTP_FIELD_STRING)           \
+  F(CThostFtdcCombPromotionParamField, InstrumentID, CTP_FIELD_STRING)         \
+  F(CThostFtdcCombPromotionParamField, CombHedgeFlag, CTP_FIELD_STRING)        \
+  F(CThostFtdcCombPromotionParamField, Xparameter, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcReqUserLoginSCField(F)                            \
+  F(CThostFtdcReqUserLoginSCField, TradingDay, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqUserLoginSCField, BrokerID, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqUserLoginSCField, UserID, CTP_FIELD_STRING)                   \
+  F(CThostFtdcReqUserLoginSCField, Password, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqUserLoginSCField, UserProductInfo, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginSCField, InterfaceProductInfo, CTP_FIELD_STRING)     \
+  F(CThostFtdcReqUserLoginSCField, ProtocolInfo, CTP_FIELD_STRING)             \
+  F(CThostFtdcReqUserLoginSCField, MacAddress, CTP_FIELD_STRING)               \
+  F(CThostFtdcReqUserLoginSCField, OneTimePassword, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginSCField, ClientIPAddress, CTP_FIELD_STRING)          \
+  F(CThostFtdcReqUserLoginSCField, LoginRemark, CTP_FIELD_STRING)              \
+  F(CThostFtdcReqUserLoginSCField, ClientIPPort, CTP_FIELD_INT32)              \
+  F(CThostFtdcReqUserLoginSCField, AuthCode, CTP_FIELD_STRING)                 \
+  F(CThostFtdcReqUserLoginSCField, AppID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryRiskSettleInvstPositionField(F)                \
+  F(CThostFtdcQryRiskSettleInvstPositionField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcQryRiskSettleInvstPositionField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcQryRiskSettleInvstPositionField, InstrumentID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcQryRiskSettleProductStatusField(F)                \
+  F(CThostFtdcQryRiskSettleProductStatusField, ProductID, CTP_FIELD_STRING)
+
+#define CTP_FIELDS_CThostFtdcRiskSettleInvstPositionField(F)                   \
+  F(CThostFtdcRiskSettleInvstPositionField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcRiskSettleInvstPositionField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcRiskSettleInvstPositionField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcRiskSettleInvstPositionField, PosiDirection, CTP_FIELD_CHAR)     \
+  F(CThostFtdcRiskSettleInvstPositionField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcRiskSettleInvstPositionField, PositionDate, CTP_FIELD_CHAR)      \
+  F(CThostFtdcRiskSettleInvstPositionField, YdPosition, CTP_FIELD_INT32)       \
+  F(CThostFtdcRiskSettleInvstPositionField, Position, CTP_FIELD_INT32)         \
+  F(CThostFtdcRiskSettleInvstPositionField, LongFrozen, CTP_FIELD_INT32)       \
+  F(CThostFtdcRiskSettleInvstPositionField, ShortFrozen, CTP_FIELD_INT32)      \
+  F(CThostFtdcRiskSettleInvstPositionField, LongFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, ShortFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, OpenVolume, CTP_FIELD_INT32)       \
+  F(CThostFtdcRiskSettleInvstPositionField, CloseVolume, CTP_FIELD_INT32)      \
+  F(CThostFtdcRiskSettleInvstPositionField, OpenAmount, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcRiskSettleInvstPositionField, CloseAmount, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcRiskSettleInvstPositionField, PositionCost, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcRiskSettleInvstPositionField, PreMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcRiskSettleInvstPositionField, UseMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcRiskSettleInvstPositionField, FrozenMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcRiskSettleInvstPositionField, FrozenCash, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcRiskSettleInvstPositionField, FrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, CashIn, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcRiskSettleInvstPositionField, Commission, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcRiskSettleInvstPositionField, CloseProfit, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcRiskSettleInvstPositionField, PositionProfit, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcRiskSettleInvstPositionField, PreSettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, SettlementPrice, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcRiskSettleInvstPositionField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcRiskSettleInvstPositionField, SettlementID, CTP_FIELD_INT32)     \
+  F(CThostFtdcRiskSettleInvstPositionField, OpenCost, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcRiskSettleInvstPositionField, ExchangeMargin, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcRiskSettleInvstPositionField, CombPosition, CTP_FIELD_INT32)     \
+  F(CThostFtdcRiskSettleInvstPositionField, CombLongFrozen, CTP_FIELD_INT32)   \
+  F(CThostFtdcRiskSettleInvstPositionField, CombShortFrozen, CTP_FIELD_INT32)  \
+  F(CThostFtdcRiskSettleInvstPositionField, CloseProfitByDate, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, CloseProfitByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, TodayPosition, CTP_FIELD_INT32)    \
+  F(CThostFtdcRiskSettleInvstPositionField, MarginRateByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, MarginRateByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, StrikeFrozen, CTP_FIELD_INT32)     \
+  F(CThostFtdcRiskSettleInvstPositionField, StrikeFrozenAmount, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, AbandonFrozen, CTP_FIELD_INT32)    \
+  F(CThostFtdcRiskSettleInvstPositionField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcRiskSettleInvstPositionField, YdStrikeFrozen, CTP_FIELD_INT32)   \
+  F(CThostFtdcRiskSettleInvstPositionField, InvestUnitID, CTP_FIELD_STRING)    \
+  F(CThostFtdcRiskSettleInvstPositionField, PositionCostOffset, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcRiskSettleInvstPositionField, TasPosition, CTP_FIELD_INT32)      \
+  F(CThostFtdcRiskSettleInvstPositionField, TasPositionCost, CTP_FIELD_DOUBLE)
+
+#define CTP_FIELDS_CThostFtdcRiskSettleProductStatusField(F)                   \
+  F(CThostFtdcRiskSettleProductStatusField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcRiskSettleProductStatusField, ProductID, CTP_FIELD_STRING)       \
+  F(CThostFtdcRiskSettleProductStatusField, ProductStatus, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInfoField(F)                             \
+  F(CThostFtdcSyncDeltaInfoField, SyncDeltaSequenceNo, CTP_FIELD_INT32)        \
+  F(CThostFtdcSyncDeltaInfoField, SyncDeltaStatus, CTP_FIELD_CHAR)             \
+  F(CThostFtdcSyncDeltaInfoField, SyncDescription, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncDeltaInfoField, IsOnlyTrdDelta, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaProductStatusField(F)                    \
+  F(CThostFtdcSyncDeltaProductStatusField, SyncDeltaSequenceNo, CTP_FIELD_INT32)\
+  F(CThostFtdcSyncDeltaProductStatusField, ExchangeID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaProductStatusField, ProductID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaProductStatusField, ProductStatus, CTP_FIELD_CHAR)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInvstPosDtlField(F)                      \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, InstrumentID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, BrokerID, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, InvestorID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, HedgeFlag, CTP_FIELD_CHAR)            \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, Direction, CTP_FIELD_CHAR)            \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, OpenDate, CTP_FIELD_STRING)           \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, TradeID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, Volume, CTP_FIELD_INT32)              \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, OpenPrice, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, TradingDay, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, SettlementID, CTP_FIELD_INT32)        \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, TradeType, CTP_FIELD_CHAR)            \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, CombInstrumentID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, ExchangeID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, CloseProfitByDate, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, CloseProfitByTrade, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, PositionProfitByDate, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstPosDtlField, PositionProfitByTrade, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstPosDtlField, Margin, CTP_FIELD_DOUBLE)             \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, ExchMargin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, MarginRateByMoney, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, MarginRateByVolume, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, LastSettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstPosDtlField, SettlementPrice, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, CloseVolume, CTP_FIELD_INT32)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, CloseAmount, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, TimeFirstVolume, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, SpecPosiType, CTP_FIELD_CHAR)         \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, ActionDirection, CTP_FIELD_CHAR)      \
+  F(CThostFtdcSyncDeltaInvstPosDtlField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInvstPosCombDtlField(F)                  \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, TradingDay, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, OpenDate, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, SettlementID, CTP_FIELD_INT32)    \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, ComTradeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, TradeID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, InstrumentID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, HedgeFlag, CTP_FIELD_CHAR)        \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, Direction, CTP_FIELD_CHAR)        \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, TotalAmt, CTP_FIELD_INT32)        \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, Margin, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, ExchMargin, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, MarginRateByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, MarginRateByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, LegID, CTP_FIELD_INT32)           \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, LegMultiple, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, TradeGroupID, CTP_FIELD_INT32)    \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, ActionDirection, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaInvstPosCombDtlField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaTradingAccountField(F)                   \
+  F(CThostFtdcSyncDeltaTradingAccountField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaTradingAccountField, AccountID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreMortgage, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreCredit, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreDeposit, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreBalance, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreMargin, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncDeltaTradingAccountField, InterestBase, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncDeltaTradingAccountField, Interest, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncDeltaTradingAccountField, Deposit, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncDeltaTradingAccountField, Withdraw, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncDeltaTradingAccountField, FrozenMargin, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncDeltaTradingAccountField, FrozenCash, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, FrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, CurrMargin, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, CashIn, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncDeltaTradingAccountField, Commission, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, CloseProfit, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncDeltaTradingAccountField, PositionProfit, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaTradingAccountField, Balance, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncDeltaTradingAccountField, Available, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncDeltaTradingAccountField, WithdrawQuota, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaTradingAccountField, Reserve, CTP_FIELD_DOUBLE)         \
+  F(CThostFtdcSyncDeltaTradingAccountField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, SettlementID, CTP_FIELD_INT32)     \
+  F(CThostFtdcSyncDeltaTradingAccountField, Credit, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncDeltaTradingAccountField, Mortgage, CTP_FIELD_DOUBLE)        \
+  F(CThostFtdcSyncDeltaTradingAccountField, ExchangeMargin, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaTradingAccountField, DeliveryMargin, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaTradingAccountField, ExchangeDeliveryMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, ReserveBalance, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaTradingAccountField, CurrencyID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, PreFundMortgageIn, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, PreFundMortgageOut, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, FundMortgageIn, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaTradingAccountField, FundMortgageOut, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncDeltaTradingAccountField, FundMortgageAvailable, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, MortgageableFund, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductFrozenMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductFrozenCommission, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductPositionProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductCloseProfit, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductPositionProfitByAlg, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, SpecProductExchangeMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaTradingAccountField, FrozenSwap, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, RemainSwap, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaTradingAccountField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInitInvstMarginField(F)                  \
+  F(CThostFtdcSyncDeltaInitInvstMarginField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInitInvstMarginField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInitInvstMarginField, LastRiskTotalInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, LastRiskTotalExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, ThisSyncInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, ThisSyncExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, RemainRiskInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, RemainRiskExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, LastRiskSpecTotalInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, LastRiskSpecTotalExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, ThisSyncSpecInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, ThisSyncSpecExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, RemainRiskSpecInvstMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, RemainRiskSpecExchMargin, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInitInvstMarginField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaDceCombInstrumentField(F)                \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, CombInstrumentID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, ExchangeID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, ExchangeInstID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, TradeGroupID, CTP_FIELD_INT32)  \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, CombHedgeFlag, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, CombinationType, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, Direction, CTP_FIELD_CHAR)      \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, ProductID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, Xparameter, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, ActionDirection, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncDeltaDceCombInstrumentField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInvstMarginRateField(F)                  \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, InstrumentID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, InvestorRange, CTP_FIELD_CHAR)    \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, BrokerID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, InvestorID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, HedgeFlag, CTP_FIELD_CHAR)        \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateField, IsRelative, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, ActionDirection, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaInvstMarginRateField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaExchMarginRateField(F)                   \
+  F(CThostFtdcSyncDeltaExchMarginRateField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaExchMarginRateField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncDeltaExchMarginRateField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcSyncDeltaExchMarginRateField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaExchMarginRateField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaExchMarginRateField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaExchMarginRateField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaExchMarginRateField, ActionDirection, CTP_FIELD_CHAR)   \
+  F(CThostFtdcSyncDeltaExchMarginRateField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaOptExchMarginField(F)                    \
+  F(CThostFtdcSyncDeltaOptExchMarginField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncDeltaOptExchMarginField, InstrumentID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaOptExchMarginField, SShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, SShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, HShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, HShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, AShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, AShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, MShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, MShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptExchMarginField, ActionDirection, CTP_FIELD_CHAR)    \
+  F(CThostFtdcSyncDeltaOptExchMarginField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaOptInvstMarginField(F)                   \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, InvestorRange, CTP_FIELD_CHAR)     \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, SShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, SShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, HShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, HShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, AShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, AShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, IsRelative, CTP_FIELD_INT32)       \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, MShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, MShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstMarginField, ActionDirection, CTP_FIELD_CHAR)   \
+  F(CThostFtdcSyncDeltaOptInvstMarginField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInvstMarginRateULField(F)                \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, InstrumentID, CTP_FIELD_STRING) \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, InvestorRange, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, BrokerID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, InvestorID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, HedgeFlag, CTP_FIELD_CHAR)      \
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, LongMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, LongMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, ShortMarginRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, ShortMarginRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, ActionDirection, CTP_FIELD_CHAR)\
+  F(CThostFtdcSyncDeltaInvstMarginRateULField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaOptInvstCommRateField(F)                 \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, InstrumentID, CTP_FIELD_STRING)  \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, InvestorRange, CTP_FIELD_CHAR)   \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, BrokerID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, InvestorID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, StrikeRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, StrikeRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, ActionDirection, CTP_FIELD_CHAR) \
+  F(CThostFtdcSyncDeltaOptInvstCommRateField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaInvstCommRateField(F)                    \
+  F(CThostFtdcSyncDeltaInvstCommRateField, InstrumentID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaInvstCommRateField, InvestorRange, CTP_FIELD_CHAR)      \
+  F(CThostFtdcSyncDeltaInvstCommRateField, BrokerID, CTP_FIELD_STRING)         \
+  F(CThostFtdcSyncDeltaInvstCommRateField, InvestorID, CTP_FIELD_STRING)       \
+  F(CThostFtdcSyncDeltaInvstCommRateField, OpenRatioByMoney, CTP_FIELD_DOUBLE) \
+  F(CThostFtdcSyncDeltaInvstCommRateField, OpenRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstCommRateField, CloseRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstCommRateField, CloseRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstCommRateField, CloseTodayRatioByMoney, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstCommRateField, CloseTodayRatioByVolume, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaInvstCommRateField, ActionDirection, CTP_FIELD_CHAR)    \
+  F(CThostFtdcSyncDeltaInvstCommRateField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaProductExchRateField(F)                  \
+  F(CThostFtdcSyncDeltaProductExchRateField, ProductID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaProductExchRateField, QuoteCurrencyID, CTP_FIELD_STRING)\
+  F(CThostFtdcSyncDeltaProductExchRateField, ExchangeRate, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaProductExchRateField, ActionDirection, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaProductExchRateField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaDepthMarketDataField(F)                  \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, TradingDay, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, InstrumentID, CTP_FIELD_STRING)   \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, ExchangeID, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, ExchangeInstID, CTP_FIELD_STRING) \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, LastPrice, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, PreSettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, PreClosePrice, CTP_FIELD_DOUBLE)  \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, PreOpenInterest, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, OpenPrice, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, HighestPrice, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, LowestPrice, CTP_FIELD_DOUBLE)    \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, Volume, CTP_FIELD_INT32)          \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, Turnover, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, OpenInterest, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, ClosePrice, CTP_FIELD_DOUBLE)     \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, SettlementPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, UpperLimitPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, LowerLimitPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, PreDelta, CTP_FIELD_DOUBLE)       \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, CurrDelta, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, UpdateTime, CTP_FIELD_STRING)     \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, UpdateMillisec, CTP_FIELD_INT32)  \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidPrice1, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidVolume1, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskPrice1, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskVolume1, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidPrice2, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidVolume2, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskPrice2, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskVolume2, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidPrice3, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidVolume3, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskPrice3, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskVolume3, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidPrice4, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidVolume4, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskPrice4, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskVolume4, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidPrice5, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BidVolume5, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskPrice5, CTP_FIELD_DOUBLE)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AskVolume5, CTP_FIELD_INT32)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, AveragePrice, CTP_FIELD_DOUBLE)   \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, ActionDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BandingUpperPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, BandingLowerPrice, CTP_FIELD_DOUBLE)\
+  F(CThostFtdcSyncDeltaDepthMarketDataField, ActionDirection, CTP_FIELD_CHAR)  \
+  F(CThostFtdcSyncDeltaDepthMarketDataField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaIndexPriceField(F)                       \
+  F(CThostFtdcSyncDeltaIndexPriceField, BrokerID, CTP_FIELD_STRING)            \
+  F(CThostFtdcSyncDeltaIndexPriceField, InstrumentID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaIndexPriceField, ClosePrice, CTP_FIELD_DOUBLE)          \
+  F(CThostFtdcSyncDeltaIndexPriceField, ActionDirection, CTP_FIELD_CHAR)       \
+  F(CThostFtdcSyncDeltaIndexPriceField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#define CTP_FIELDS_CThostFtdcSyncDeltaEWarrantOffsetField(F)                   \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, TradingDay, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, BrokerID, CTP_FIELD_STRING)        \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, InvestorID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, ExchangeID, CTP_FIELD_STRING)      \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, InstrumentID, CTP_FIELD_STRING)    \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, Direction, CTP_FIELD_CHAR)         \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, HedgeFlag, CTP_FIELD_CHAR)         \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, Volume, CTP_FIELD_INT32)           \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, ActionDirection, CTP_FIELD_CHAR)   \
+  F(CThostFtdcSyncDeltaEWarrantOffsetField, SyncDeltaSequenceNo, CTP_FIELD_INT32)
+
+#endif /* __CTPSTRUCTS_H__ */
@@ -0,0 +1,227 @@
+/*
+ * latency.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "latency.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+static const char *stageNames[LATENCY_STAGES] = {"queue", "transfer", "convert", "callback", "total"};
+
+static inline int log2Floor(uint64_t value) {
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanReverse64(&index, value);
+  return (int)index;
+#else
+  return 63 - __builtin_clzll(value);
+#endif
+}
+
+static inline int bucketIndex(uint64_t value) {
+  if (value < LATENCY_SUB_BUCKETS)
+    return (int)value;
+
+  int exponent = log2Floor(value);
+
+  if (exponent > LATENCY_MAX_EXPONENT)
+    return LATENCY_BUCKETS - 1;
+
+  return (exponent - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS + (int)(value >> (exponent - LATENCY_SUB_BITS)) - LATENCY_SUB_BUCKETS;
+}
+
+// The highest value that falls into the bucket.
+static uint64_t bucketValue(int index) {
+  if (index < LATENCY_SUB_BUCKETS)
+    return (uint64_t)index;
+
+  int exponent = index / LATENCY_SUB_BUCKETS + LATENCY_SUB_BITS - 1;
+  uint64_t sub = (uint64_t)(index % LATENCY_SUB_BUCKETS + LATENCY_SUB_BUCKETS);
+
+  return ((sub + 1) << (exponent - LATENCY_SUB_BITS)) - 1;
+}
+
+static uint64_t percentile(const LatencyHistogram *histogram, double ratio) {
+  uint64_t rank = (uint64_t)(ratio * histogram->count + 0.5), seen = 0;
+
+  if (rank == 0)
+    rank = 1;
+
+  for (int i = 0; i < LATENCY_BUCKETS; ++i) {
+    seen += histogram->buckets[i];
+
+    if (seen >= rank) {
+      uint64_t value = bucketValue(i);
+      return value < histogram->max ? value : histogram->max;
+    }
+  }
+
+  return histogram->max;
+}
+
+static inline uint64_t elapsed(uint64_t from, uint64_t to) {
+  return to > from ? to - from : 0;
+}
+
+LatencyRecorder *createLatencyRecorder(int base, int count) {
+  LatencyRecorder *recorder = (LatencyRecorder *)malloc(sizeof(LatencyRecorder));
+
+  if (!recorder)
+    return nullptr;
+
+  recorder->histograms = (LatencyHistogram **)calloc(count, sizeof(LatencyHistogram *));
+
+  if (!recorder->histograms) {
+    free(recorder);
+    return nullptr;
+  }
+
+  recorder->refs = 1;
+  recorder->base = base;
+  recorder->count = count;
+
+  return recorder;
+}
+
+void retainLatencyRecorder(LatencyRecorder *recorder) {
+  recorder->refs += 1;
+}
+
+void releaseLatencyRecorder(LatencyRecorder *recorder) {
+  if (--recorder->refs > 0)
+    return;
+
+  for (int i = 0; i < recorder->count; ++i)
+    if (recorder->histograms[i])
+      free(recorder->histograms[i]);
+
+  free(recorder->histograms);
+  free(recorder);
+}
+
+void recordLatency(LatencyRecorder *recorder, int event, int stage, uint64_t nanos) {
+  int index = event - recorder->base;
+
+  if (index < 0 || index >= recorder->count)
+    return;
+
+  LatencyHistogram *histograms = recorder->histograms[index];
+
+  if (!histograms) {
+    histograms = (LatencyHistogram *)calloc(LATENCY_STAGES, sizeof(LatencyHistogram));
+
+    if (!histograms)
+      return;
+
+    recorder->histograms[index] = histograms;
+  }
+
+  LatencyHistogram *histogram = &histograms[stage];
+
+  if (histogram->count == 0 || nanos < histogram->min)
+    histogram->min = nanos;
+
+  if (nanos > histogram->max)
+    histogram->max = nanos;
+
+  histogram->count += 1;
+  histogram->sum += nanos;
+  histogram->buckets[bucketIndex(nanos)] += 1;
+}
+
+void recordDelivery(LatencyRecorder *recorder, const Message *messages, uint32_t count, uint64_t dispatched, uint64_t called, uint64_t converted, uint64_t returned) {
+  if (count == 0)
+    return;
+
+  int event = messages[0].event;
+
+  // Queue and total are per message, the rest is paid once per delivery.
+  for (uint32_t i = 0; i < count; ++i) {
+    if (messages[i].timestamp == 0)
+      continue;
+
+    recordLatency(recorder, event, LATENCY_QUEUE, elapsed(messages[i].timestamp, dispatched));
+    recordLatency(recorder, event, LATENCY_TOTAL, elapsed(messages[i].timestamp, returned));
+  }
+
+  recordLatency(recorder, event, LATENCY_TRANSFER, elapsed(dispatched, called));
+  recordLatency(recorder, event, LATENCY_CONVERT, elapsed(called, converted));
+  recordLatency(recorder, event, LATENCY_CALLBACK, elapsed(converted, returned));
+}
+
+void resetLatency(LatencyRecorder *recorder) {
+  for (int i = 0; i < recorder->count; ++i)
+    if (recorder->histograms[i])
+      memset(recorder->histograms[i], 0, LATENCY_STAGES * sizeof(LatencyHistogram));
+}
+
+static napi_status getHistogramValue(napi_env env, const LatencyHistogram *histogram, napi_value *result) {
+  CHECK(napi_create_object(env, result));
+  CHECK(objectSetInt64(env, *result, "count", (int64_t)histogram->count));
+  CHECK(objectSetInt64(env, *result, "min", (int64_t)histogram->min));
+  CHECK(objectSetDouble(env, *result, "mean", histogram->count > 0 ? (double)histogram->sum / histogram->count : 0));
+  CHECK(objectSetInt64(env, *result, "p50", (int64_t)percentile(histogram, 0.5)));
+  CHECK(objectSetInt64(env, *result, "p90", (int64_t)percentile(histogram, 0.9)));
+  CHECK(objectSetInt64(env, *result, "p99", (int64_t)percentile(histogram, 0.99)));
+  CHECK(objectSetInt64(env, *result, "p999", (int64_t)percentile(histogram, 0.999)));
+  CHECK(objectSetInt64(env, *result, "max", (int64_t)histogram->max));
+
+  return napi_ok;
+}
+
+napi_status getLatencyValue(napi_env env, const LatencyRecorder *recorder, const char *(*eventName)(int event), napi_value *result) {
+  napi_value stages, value;
+
+  CHECK(napi_create_object(env, result));
+
+  for (int i = 0; i < recorder->count; ++i) {
+    const LatencyHistogram *histograms = recorder->histograms[i];
+
+    if (!histograms || histograms[LATENCY_CALLBACK].count == 0)
+      continue;
+
+    CHECK(napi_create_object(env, &stages));
+
+    for (int stage = 0; stage < LATENCY_STAGES; ++stage) {
+      CHECK(getHistogramValue(env, &histograms[stage], &value));
+      CHECK(napi_set_named_property(env, stages, stageNames[stage], value));
+    }
+
+    CHECK(napi_set_named_property(env, *result, eventName(recorder->base + i), stages));
+  }
+
+  return napi_ok;
+}
+
+CallContext *createCallContext(int event, LatencyRecorder *latency, void *state) {
+  CallContext *context = (CallContext *)malloc(sizeof(CallContext));
+
+  if (!context)
+    return nullptr;
+
+  context->event = event;
+  context->latency = latency;
+  context->state = state;
+  context->delivery = DELIVERY_OBJECT;
+  context->reuse = nullptr;
+
+  retainLatencyRecorder(latency);
+
+  return context;
+}
+
+void freeCallContext(CallContext *context) {
+  releaseLatencyRecorder(context->latency);
+  free(context);
+}
@@ -0,0 +1,75 @@
+/*
+ * latency.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __LATENCY_H__
+#define __LATENCY_H__
+
+#include "napi_ctp.h"
+
+/* 16 linear sub-buckets per power of two, values above 2^40 ns are clamped. */
+#define LATENCY_SUB_BITS 4
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+#define LATENCY_MAX_EXPONENT 40
+#define LATENCY_BUCKETS ((LATENCY_MAX_EXPONENT - LATENCY_SUB_BITS + 2) * LATENCY_SUB_BUCKETS)
+
+/*
+ * queue:    CTP callback -> handed to the threadsafe function
+ * transfer: handed to the threadsafe function -> JS thread picks it up
+ * convert:  building the JS value
+ * callback: the JS listener itself
+ * total:    CTP callback -> JS listener returned
+ */
+enum { LATENCY_QUEUE = 0, LATENCY_TRANSFER, LATENCY_CONVERT, LATENCY_CALLBACK, LATENCY_TOTAL, LATENCY_STAGES };
+
+typedef struct LatencyHistogram {
+  uint64_t count;
+  uint64_t sum;
+  uint64_t min;
+  uint64_t max;
+  uint64_t buckets[LATENCY_BUCKETS];
+} LatencyHistogram;
+
+/*
+ * Log-linear latency histograms per event and stage of one MarketData or
+ * Trader, created on the first sample of an event. Only the JS thread
+ * records, reads and resets them. Every threadsafe function of the instance
+ * holds a reference since its callbacks may outlive the instance.
+ */
+typedef struct LatencyRecorder {
+  int refs;
+  int base;
+  int count;
+  LatencyHistogram **histograms;
+} LatencyRecorder;
+
+/* The context of a listener's threadsafe function. */
+typedef struct CallContext {
+  int event;
+  LatencyRecorder *latency;
+  void *state;
+  int delivery;
+  void *reuse;
+} CallContext;
+
+LatencyRecorder *createLatencyRecorder(int base, int count);
+void retainLatencyRecorder(LatencyRecorder *recorder);
+void releaseLatencyRecorder(LatencyRecorder *recorder);
+
+void recordLatency(LatencyRecorder *recorder, int event, int stage, uint64_t nanos);
+void recordDelivery(LatencyRecorder *recorder, const Message *messages, uint32_t count, uint64_t dispatched, uint64_t called, uint64_t converted, uint64_t returned);
+void resetLatency(LatencyRecorder *recorder);
+
+napi_status getLatencyValue(napi_env env, const LatencyRecorder *recorder, const char *(*eventName)(int event), napi_value *result);
+
+CallContext *createCallContext(int event, LatencyRecorder *latency, void *state);
+void freeCallContext(CallContext *context);
+
+#endif /* __LATENCY_H__ */
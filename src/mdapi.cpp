@@ -10,13 +10,24 @@
  */
 
 #include "mdapi.h"
+#include "ctpfields.h"
+#include "ctpmsg.h"
+#include "ctpreuse.h"
+#include "latency.h"
+#include "mdcolumns.h"
+#include "mdconflation.h"
+#include "mdjournal.h"
 #include "mdmsg.h"
+#include "mdreplay.h"
+#include "mdsnapshot.h"
 #include "mdspi.h"
 #include "guard.h"
+#include <stdio.h>
 #include <string.h>
-#include <map>
-#include <string>
+#include <atomic>
 #include <functional>
+#include <string>
+#include <vector>
 
 typedef struct MarketData {
   napi_env env;
@@ -24,7 +35,14 @@ typedef struct MarketData {
   uv_thread_t thread;
   MdSpi *spi;
   CThostFtdcMdApi *api;
-  std::map<std::string, napi_threadsafe_function> tsfns;
+  std::atomic<Listener *> listeners[EM_COUNT];
+  std::vector<Listener *> retired;
+  InstrumentDictionary instruments;
+  LatencyRecorder *latency;
+  TickJournal *journal;
+  SnapshotCache *snapshots;
+  BarAggregator *bars;
+  MdReplayApi *replay;
 } MarketData;
 
 static napi_value getApiVersion(napi_env env, napi_callback_info info) {
@@ -110,12 +128,14 @@ static napi_value unsubscribeForQuoteRsp(napi_env env, napi_callback_info info)
   });
 }
 
-static napi_value callRequestFunc(napi_env env, napi_callback_info info, const std::function<int(MarketData*, napi_value)> &func) {
+template <typename T> static napi_value callRequestFunc(napi_env env, napi_callback_info info, int (CThostFtdcMdApi::*method)(T *, int)) {
   size_t argc = 1;
   int result;
   napi_value object, jsthis, retval;
   MarketData *marketData;
+  const CtpField *mistyped;
   bool isObject;
+  T req;
 
   CHECK(napi_get_cb_info(env, info, &argc, &object, &jsthis, nullptr));
   CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
@@ -125,215 +145,1291 @@ static napi_value callRequestFunc(napi_env env, napi_callback_info info, const s
   if (!isObject)
     return nullptr;
 
-  result = func(marketData, object);
+  memset(&req, 0, sizeof(req));
+
+  CHECK(unmarshalCtpFields(env, object, ctpFields<T>(), &req, &mistyped));
+
+  if (mistyped) {
+    char message[128];
+
+    snprintf(message, sizeof(message), "The field %s should be a %s", mistyped->name, ctpFieldTypeName(mistyped));
+    napi_throw_type_error(env, nullptr, message);
+
+    return nullptr;
+  }
+
+  result = (marketData->api->*method)(&req, sequenceId());
   CHECK(napi_create_int32(env, result, &retval));
 
   return retval;
 }
 
 static napi_value reqUserLogin(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](MarketData *marketData, napi_value object) {
-    CThostFtdcReqUserLoginField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, InterfaceProductInfo));
-    CHECK(GetObjectString(env, object, req, ProtocolInfo));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, OneTimePassword));
-    CHECK(GetObjectString(env, object, req, LoginRemark));
-    CHECK(GetObjectInt32(env, object, req, ClientIPPort));
-    CHECK(GetObjectString(env, object, req, ClientIPAddress));
-
-    return marketData->api->ReqUserLogin(&req, sequenceId());
-  });
+  return callRequestFunc(env, info, &CThostFtdcMdApi::ReqUserLogin);
 }
 
 static napi_value reqUserLogout(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](MarketData *marketData, napi_value object) {
-    CThostFtdcUserLogoutField req;
+  return callRequestFunc(env, info, &CThostFtdcMdApi::ReqUserLogout);
+}
+
+static bool processColumns(MarketData *marketData, const Listener &listener, MessageBatch *batch) {
+  InstrumentDictionary *dictionary = &marketData->instruments;
 
-    memset(&req, 0, sizeof(req));
+  // A new listener starts with an empty instruments array, so start over.
+  if (dictionary->owner != &listener) {
+    dictionary->owner = &listener;
+    dictionary->indexes.clear();
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
+  DepthColumns *columns = packDepthColumns(dictionary, batch);
 
-    return marketData->api->ReqUserLogout(&req, sequenceId());
-  });
+  for (uint32_t i = 0; i < batch->count; ++i)
+    MdSpi::done(batch->messages[i]);
+
+  freeMessageBatch(batch);
+
+  if (!columns)
+    return true;
+
+  columns->dispatched = uv_hrtime();
+
+  if (napi_ok != napi_call_threadsafe_function(listener.tsfn, (void *)columns, napi_tsfn_blocking))
+    freeDepthColumns(columns);
+
+  return true;
+}
+
+static bool processBatch(MarketData *marketData, const Listener &listener, Message *message, bool *isPending) {
+  MessageBatch *batch = createMessageBatch(listener.batchSize);
+  uint64_t deadline = uv_hrtime() + (uint64_t)listener.batchWindow * 1000;
+  int event = message->event;
+
+  if (!batch) {
+    MdSpi::done(*message);
+    return EM_QUIT != event;
+  }
+
+  batch->messages[batch->count++] = *message;
+
+  while (batch->count < listener.batchSize) {
+    if (QUEUE_SUCCESS != marketData->spi->pollUntil(message, deadline))
+      break;
+
+    if (message->event != event) {
+      *isPending = true;
+      break;
+    }
+
+    batch->messages[batch->count++] = *message;
+  }
+
+  if (listener.columnar)
+    return processColumns(marketData, listener, batch);
+
+  batch->dispatched = uv_hrtime();
+
+  if (napi_ok != napi_call_threadsafe_function(listener.tsfn, (void *)batch, napi_tsfn_blocking)) {
+    for (uint32_t i = 0; i < batch->count; ++i)
+      MdSpi::done(batch->messages[i]);
+
+    freeMessageBatch(batch);
+  }
+
+  return EM_QUIT != event;
+}
+
+static bool processConflated(const Listener &listener, Message *message) {
+  Conflation *conflation = (Conflation *)listener.context;
+
+  // Only the first tick after a flush wakes JS, later ones just refresh their slot.
+  if (conflateMessage(conflation, message) && napi_ok != napi_call_threadsafe_function(listener.tsfn, nullptr, napi_tsfn_nonblocking))
+    cancelFlush(conflation);
+
+  return true;
 }
 
-static bool processMessage(MarketData *marketData, const Message &message) {
-  const char *eventName = MdSpi::eventName(message.event);
+static bool processMessage(MarketData *marketData, Message *message, bool *isPending) {
+  int index = message->event - EM_BASE;
+
+  *isPending = false;
 
-  if (!eventName) {
-    fprintf(stderr, "<Market Data> Unknown message event %d\n", message.event);
+  if (index < 0 || index >= EM_COUNT) {
+    fprintf(stderr, "<Market Data> Unknown message event %d\n", message->event);
+    MdSpi::done(*message);
     return true;
   }
 
-  auto iter = marketData->tsfns.find(eventName);
+  const Listener *slot = marketData->listeners[index].load(std::memory_order_acquire);
+
+  if (!slot) {
+    MdSpi::done(*message);
+    return EM_QUIT != message->event;
+  }
+
+  const Listener &listener = *slot;
+
+  if (listener.conflate)
+    return processConflated(listener, message);
+
+  if (listener.batchSize > 0)
+    return processBatch(marketData, listener, message, isPending);
+
+  // A batch of one carries the timestamps, the payload is owned by the JS
+  // thread from here on and released in callJs.
+  MessageBatch *envelope = createMessageBatch(1);
+
+  if (!envelope) {
+    MdSpi::done(*message);
+    return EM_QUIT != message->event;
+  }
+
+  envelope->messages[envelope->count++] = *message;
+  envelope->dispatched = uv_hrtime();
 
-  if (iter != marketData->tsfns.end()) {
-    napi_threadsafe_function tsfn = iter->second;
-    CHECK(napi_call_threadsafe_function(tsfn, (void *)&message, napi_tsfn_blocking));
+  if (napi_ok != napi_call_threadsafe_function(listener.tsfn, (void *)envelope, napi_tsfn_blocking)) {
+    MdSpi::done(*message);
+    freeMessageBatch(envelope);
   }
 
-  return EM_QUIT != message.event;
+  return EM_QUIT != message->event;
 }
 
 static void processThread(void *data) {
   MarketData *marketData = (MarketData *)data;
   Message message;
-  bool isRunning = true;
+  bool isRunning = true, isPending = false;
 
   while (isRunning) {
-    if (QUEUE_SUCCESS != marketData->spi->poll(&message))
+    if (!isPending && QUEUE_SUCCESS != marketData->spi->poll(&message))
       continue;
 
-    isRunning = processMessage(marketData, message);
-    marketData->spi->done(message);
+    isRunning = processMessage(marketData, &message, &isPending);
   }
 }
 
+// The events a listener may take in reuse mode, nullptr for any other.
+static const ReuseClass *getReuseClass(int event) {
+  static const ReuseClass depthMarketData = {ctpFields<CThostFtdcDepthMarketDataField>(), rtnDepthMarketData, sizeof(CThostFtdcDepthMarketDataField), objectFactoryId()};
+
+  return EM_RTNDEPTHMARKETDATA == event ? &depthMarketData : nullptr;
+}
+
+// A reusing listener gets its object of the instrument updated, any other a value as its delivery asks.
+static napi_status getListenerValue(napi_env env, const CallContext *context, const Message *message, napi_value *result) {
+  if (context->reuse)
+    return getReusedValue(env, (ReuseCache *)context->reuse, message, result);
+
+  return getMarketDataMessageValue(env, message, context->delivery, result);
+}
+
+// Without env the context may already be finalized, only the messages are freed.
 static void callJs(napi_env env, napi_value js_cb, void *context, void *data) {
-  // MarketData *marketData = (MarketData *)context;
-  Message *message = (Message *)data;
+  MessageBatch *envelope = (MessageBatch *)data;
+  napi_value undefined, argv;
+
+  if (env) {
+    uint64_t called = uv_hrtime(), converted;
+
+    CHECK(napi_get_undefined(env, &undefined));
+    CHECK(getListenerValue(env, (CallContext *)context, &envelope->messages[0], &argv));
+
+    converted = uv_hrtime();
+
+    CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+
+    recordDelivery(((CallContext *)context)->latency, envelope->messages, 1, envelope->dispatched, called, converted, uv_hrtime());
+  }
+
+  MdSpi::done(envelope->messages[0]);
+  freeMessageBatch(envelope);
+}
+
+static void callJsBatch(napi_env env, napi_value js_cb, void *context, void *data) {
+  MessageBatch *batch = (MessageBatch *)data;
+  napi_value undefined, argv, element;
+
+  if (env) {
+    uint64_t called = uv_hrtime(), converted;
+
+    CHECK(napi_get_undefined(env, &undefined));
+    CHECK(napi_create_array_with_length(env, batch->count, &argv));
+
+    for (uint32_t i = 0; i < batch->count; ++i) {
+      CHECK(getListenerValue(env, (CallContext *)context, &batch->messages[i], &element));
+      CHECK(napi_set_element(env, argv, i, element));
+    }
+
+    converted = uv_hrtime();
+
+    CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+
+    recordDelivery(((CallContext *)context)->latency, batch->messages, batch->count, batch->dispatched, called, converted, uv_hrtime());
+  }
+
+  for (uint32_t i = 0; i < batch->count; ++i)
+    MdSpi::done(batch->messages[i]);
+
+  freeMessageBatch(batch);
+}
+
+static void callJsColumns(napi_env env, napi_value js_cb, void *context, void *data) {
+  DepthColumns *columns = (DepthColumns *)data;
+  napi_value undefined, instruments, argv;
+
+  // The context is only valid while env is, it is released in finalizeColumns.
+  if (env) {
+    CallContext *callContext = (CallContext *)context;
+    Message message(EM_RTNDEPTHMARKETDATA);
+    uint64_t called = uv_hrtime(), converted;
+
+    CHECK(napi_get_undefined(env, &undefined));
+    CHECK(napi_get_reference_value(env, (napi_ref)callContext->state, &instruments));
+    CHECK(getDepthColumnsValue(env, columns, instruments, &argv));
+
+    converted = uv_hrtime();
+
+    CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+
+    message.timestamp = columns->timestamp;
+    recordDelivery(callContext->latency, &message, 1, columns->dispatched, called, converted, uv_hrtime());
+  }
+
+  freeDepthColumns(columns);
+}
+
+static void callJsConflated(napi_env env, napi_value js_cb, void *context, void *data) {
+  CallContext *callContext = (CallContext *)context;
+  std::vector<Message> messages;
   napi_value undefined, argv;
+  uint64_t dispatched;
+
+  // Without env the conflation may already be gone, pending slots are freed with it.
+  if (!env)
+    return;
+
+  takeConflated((Conflation *)callContext->state, &messages, &dispatched);
+
+  CHECK(napi_get_undefined(env, &undefined));
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    uint64_t called = uv_hrtime(), converted;
+
+    CHECK(getListenerValue(env, callContext, &messages[i], &argv));
+
+    converted = uv_hrtime();
+
+    CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+
+    recordDelivery(callContext->latency, &messages[i], 1, dispatched, called, converted, uv_hrtime());
+    MdSpi::done(messages[i]);
+  }
+}
+
+static void callJsConflatedBatch(napi_env env, napi_value js_cb, void *context, void *data) {
+  CallContext *callContext = (CallContext *)context;
+  std::vector<Message> messages;
+  napi_value undefined, argv, element;
+  uint64_t dispatched, called, converted;
+
+  if (!env)
+    return;
+
+  takeConflated((Conflation *)callContext->state, &messages, &dispatched);
+
+  called = uv_hrtime();
 
   CHECK(napi_get_undefined(env, &undefined));
-  CHECK(getMarketDataMessageValue(env, message, &argv));
+  CHECK(napi_create_array_with_length(env, messages.size(), &argv));
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    CHECK(getListenerValue(env, callContext, &messages[i], &element));
+    CHECK(napi_set_element(env, argv, (uint32_t)i, element));
+  }
+
+  converted = uv_hrtime();
+
   CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+
+  recordDelivery(callContext->latency, messages.data(), (uint32_t)messages.size(), dispatched, called, converted, uv_hrtime());
+
+  for (size_t i = 0; i < messages.size(); ++i)
+    MdSpi::done(messages[i]);
+}
+
+static void finalizeContext(napi_env env, void *data, void *hint) {
+  CallContext *context = (CallContext *)data;
+
+  if (context->reuse)
+    freeReuseCache(env, (ReuseCache *)context->reuse);
+
+  freeCallContext(context);
+}
+
+static void finalizeConflated(napi_env env, void *data, void *hint) {
+  CallContext *context = (CallContext *)data;
+
+  if (context->reuse)
+    freeReuseCache(env, (ReuseCache *)context->reuse);
+
+  releaseConflation((Conflation *)context->state);
+  freeCallContext(context);
+}
+
+static void finalizeColumns(napi_env env, void *data, void *hint) {
+  CallContext *context = (CallContext *)data;
+
+  CHECK(napi_delete_reference(env, (napi_ref)context->state));
+  freeCallContext(context);
+}
+
+static napi_status createCallFunction(napi_env env, napi_value func, napi_value name, int event, LatencyRecorder *latency, Listener *listener) {
+  CallContext *context = createCallContext(event, latency, nullptr);
+
+  if (!context)
+    return napi_generic_failure;
+
+  context->delivery = listener->delivery;
+
+  if (DELIVERY_REUSE == listener->delivery && !(context->reuse = createReuseCache(getReuseClass(event)))) {
+    freeCallContext(context);
+    return napi_generic_failure;
+  }
+
+  return napi_create_threadsafe_function(env, func, nullptr, name, listener->maxInflight, 1, context, finalizeContext, context, listener->batchSize > 0 ? callJsBatch : callJs, &listener->tsfn);
+}
+
+static napi_status createColumnsFunction(napi_env env, napi_value func, napi_value name, int event, LatencyRecorder *latency, Listener *listener) {
+  napi_value instruments;
+  napi_ref reference;
+
+  CHECK(napi_create_array(env, &instruments));
+  CHECK(napi_create_reference(env, instruments, 1, &reference));
+
+  CallContext *context = createCallContext(event, latency, reference);
+
+  if (!context)
+    return napi_generic_failure;
+
+  return napi_create_threadsafe_function(env, func, nullptr, name, listener->maxInflight, 1, context, finalizeColumns, context, callJsColumns, &listener->tsfn);
+}
+
+static napi_status createConflatedFunction(napi_env env, napi_value func, napi_value name, int event, LatencyRecorder *latency, Listener *listener) {
+  CallContext *context = createCallContext(event, latency, nullptr);
+
+  if (!context)
+    return napi_generic_failure;
+
+  if (DELIVERY_REUSE == listener->delivery && !(context->reuse = createReuseCache(getReuseClass(event)))) {
+    freeCallContext(context);
+    return napi_generic_failure;
+  }
+
+  Conflation *conflation = createConflation();
+
+  if (!conflation) {
+    if (context->reuse)
+      freeReuseCache(env, (ReuseCache *)context->reuse);
+
+    freeCallContext(context);
+    return napi_generic_failure;
+  }
+
+  context->state = conflation;
+  context->delivery = listener->delivery;
+  listener->context = conflation;
+
+  // At most one flush is ever queued, so the inflight window does not apply.
+  return napi_create_threadsafe_function(env, func, nullptr, name, 0, 1, context, finalizeConflated, context, listener->batchSize > 0 ? callJsConflatedBatch : callJsConflated, &listener->tsfn);
+}
+
+static void freeListener(Listener *listener) {
+  if (listener->conflate)
+    releaseConflation((Conflation *)listener->context);
+
+  delete listener;
 }
 
 static napi_value on(napi_env env, napi_callback_info info) {
   static const napi_valuetype types[2] = {napi_string, napi_function};
-  size_t argc = 2;
-  napi_value argv[2], jsthis;
-  napi_threadsafe_function tsfn;
+  size_t argc = 3;
+  napi_value argv[3], jsthis;
+  Listener listener;
   MarketData *marketData;
   char fname[64];
+  int event;
   bool isTypesOk;
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
   CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
 
-  CHECK(checkValueTypes(env, argc, argv, types, &isTypesOk));
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
 
   if (!isTypesOk)
     return nullptr;
 
-  CHECK(napi_create_threadsafe_function(env, argv[1], nullptr, argv[0], 0, 1, nullptr, nullptr, marketData, callJs, &tsfn));
-  CHECK(napi_ref_threadsafe_function(env, tsfn));
+  CHECK(getListenerOptions(env, argc, argv, &listener, &isTypesOk));
+
+  if (!isTypesOk)
+    return nullptr;
 
   CHECK(napi_get_value_string_utf8(env, argv[0], fname, sizeof(fname), nullptr));
 
-  if (marketData->tsfns.find(fname) != marketData->tsfns.end())
-    CHECK(napi_unref_threadsafe_function(env, marketData->tsfns[fname]));
+  event = MdSpi::eventId(fname);
+
+  if (event < 0) {
+    napi_throw_type_error(env, nullptr, "Unknown event name");
+    return nullptr;
+  }
+
+  if (DELIVERY_REUSE == listener.delivery) {
+    if (!getReuseClass(event)) {
+      napi_throw_type_error(env, nullptr, "Reuse mode only supports rtn-depth-market-data");
+      return nullptr;
+    }
+
+    // Two ticks of an instrument in one batch would be the same object, a conflated batch holds one per instrument.
+    if (listener.batchSize > 0 && !listener.conflate) {
+      napi_throw_type_error(env, nullptr, "Reuse mode can not be combined with batch mode unless conflated");
+      return nullptr;
+    }
+  }
+
+  if (listener.conflate) {
+    if (EM_RTNDEPTHMARKETDATA != event) {
+      napi_throw_type_error(env, nullptr, "Conflation only supports rtn-depth-market-data");
+      return nullptr;
+    }
+
+    if (listener.columnar) {
+      napi_throw_type_error(env, nullptr, "Conflation can not be combined with columnar mode");
+      return nullptr;
+    }
+
+    CHECK(createConflatedFunction(env, argv[1], argv[0], event, marketData->latency, &listener));
+  } else if (listener.columnar) {
+    if (EM_RTNDEPTHMARKETDATA != event) {
+      napi_throw_type_error(env, nullptr, "Columnar mode only supports rtn-depth-market-data");
+      return nullptr;
+    }
+
+    if (listener.delivery != DELIVERY_OBJECT) {
+      napi_throw_type_error(env, nullptr, "Columnar mode can not be combined with lazy, raw or reuse mode");
+      return nullptr;
+    }
+
+    if (listener.batchSize == 0)
+      listener.batchSize = DEPTH_COLUMNS_BATCH;
+
+    CHECK(createColumnsFunction(env, argv[1], argv[0], event, marketData->latency, &listener));
+  } else {
+    CHECK(createCallFunction(env, argv[1], argv[0], event, marketData->latency, &listener));
+  }
+
+  CHECK(napi_ref_threadsafe_function(env, listener.tsfn));
 
-  marketData->tsfns[fname] = tsfn;
+  // The dispatch thread may still hold the previous listener, keep it until the destructor.
+  Listener *previous = marketData->listeners[event - EM_BASE].exchange(new Listener(listener), std::memory_order_acq_rel);
+
+  if (previous) {
+    CHECK(napi_unref_threadsafe_function(env, previous->tsfn));
+    marketData->retired.push_back(previous);
+  }
 
   return jsthis;
 }
 
-static void marketDataDestructor(napi_env env, void *data, void *hint) {
-  MarketData *marketData = (MarketData *)data;
+static napi_value getConflationStats(napi_env env, napi_callback_info info) {
+  ConflationStats stats = {0, 0, 0, 0};
+  napi_value jsthis, object;
+  MarketData *marketData;
 
-  if (!marketData)
-    return;
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
 
-  if (marketData->spi) {
-    marketData->spi->quit();
-    uv_thread_join(&marketData->thread);
-  }
+  const Listener *listener = marketData->listeners[EM_RTNDEPTHMARKETDATA - EM_BASE].load(std::memory_order_acquire);
 
-  for (auto it = marketData->tsfns.begin(); it != marketData->tsfns.end(); ++it)
-    napi_unref_threadsafe_function(env, it->second);
+  if (listener && listener->conflate)
+    getConflationStats((Conflation *)listener->context, &stats);
 
-  marketData->tsfns.clear();
-  napi_delete_reference(marketData->env, marketData->wrapper);
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetInt64(env, object, "received", (int64_t)stats.received));
+  CHECK(objectSetInt64(env, object, "delivered", (int64_t)stats.delivered));
+  CHECK(objectSetInt64(env, object, "conflated", (int64_t)stats.conflated));
+  CHECK(objectSetUint32(env, object, "pending", stats.pending));
 
-  if (marketData->spi)
-    delete marketData->spi;
+  return object;
+}
 
-  if (marketData->api)
-    marketData->api->Release();
+static napi_value getQueueStats(napi_env env, napi_callback_info info) {
+  QueueStats stats;
+  napi_value jsthis, object;
+  MarketData *marketData;
 
-  delete marketData;
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  marketData->spi->getQueueStats(&stats);
+
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetUint32(env, object, "capacity", stats.capacity));
+  CHECK(objectSetUint32(env, object, "depth", stats.depth));
+  CHECK(objectSetUint32(env, object, "highWater", stats.highWater));
+  CHECK(objectSetInt64(env, object, "enqueued", (int64_t)stats.enqueued));
+  CHECK(objectSetInt64(env, object, "dequeued", (int64_t)stats.dequeued));
+  CHECK(objectSetInt64(env, object, "dropped", (int64_t)stats.dropped));
+
+  return object;
 }
 
-static napi_value marketDataNew(napi_env env, napi_callback_info info) {
-  static const napi_valuetype types[2] = {napi_string, napi_string};
-  size_t argc = 2;
-  napi_value target, argv[2], jsthis;
+static napi_value getJournalStats(napi_env env, napi_callback_info info) {
+  JournalStats stats = {0, 0, 0};
+  napi_value jsthis, object;
   MarketData *marketData;
-  char flowMdPath[260], frontMdAddr[64];
-  bool isTypesOk;
 
-  CHECK(napi_get_new_target(env, info, &target));
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
 
-  if (!target)
-    return nullptr;
+  if (marketData->journal)
+    getJournalStats(marketData->journal, &stats);
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetInt64(env, object, "records", (int64_t)stats.records));
+  CHECK(objectSetInt64(env, object, "failed", (int64_t)stats.failed));
+  CHECK(objectSetUint32(env, object, "files", stats.files));
 
-  CHECK(checkValueTypes(env, argc, argv, types, &isTypesOk));
+  return object;
+}
 
-  if (!isTypesOk)
-    return nullptr;
+static napi_status getSnapshotFields(napi_env env, size_t argc, napi_value *argv, std::vector<int> *fields, bool *result) {
+  napi_value element;
+  uint32_t length;
+  char name[64];
 
-  CHECK(napi_get_value_string_utf8(env, argv[0], flowMdPath, sizeof(flowMdPath), nullptr));
-  CHECK(napi_get_value_string_utf8(env, argv[1], frontMdAddr, sizeof(frontMdAddr), nullptr));
+  *result = true;
 
-  marketData = new MarketData();
+  if (argc < 2)
+    return napi_ok;
 
-  if (!marketData) {
-    napi_throw_error(env, nullptr, "Market data is out of memory");
-    return nullptr;
+  CHECK(checkIsStringArray(env, argv[1], result));
+
+  if (!*result)
+    return napi_ok;
+
+  CHECK(napi_get_array_length(env, argv[1], &length));
+
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, argv[1], i, &element));
+    CHECK(napi_get_value_string_utf8(env, element, name, sizeof(name), nullptr));
+
+    int field = snapshotFieldId(name);
+
+    if (field < 0) {
+      *result = false;
+      return napi_throw_type_error(env, nullptr, "Unknown depth market data field");
+    }
+
+    fields->push_back(field);
   }
 
-  marketData->env = env;
-  marketData->spi = new MdSpi();
+  return napi_ok;
+}
 
-  if (!marketData->spi) {
-    delete marketData;
-    napi_throw_error(env, nullptr, "Market data is out of memory");
+static napi_status getSnapshotValue(napi_env env, SnapshotCache *snapshots, const char *instrumentId, const std::vector<int> *fields, napi_value *result) {
+  CThostFtdcDepthMarketDataField depthMarketData;
+
+  if (!readSnapshot(snapshots, instrumentId, &depthMarketData))
+    return napi_get_undefined(env, result);
+
+  if (!fields) {
+    Message message(EM_RTNDEPTHMARKETDATA, (uintptr_t)&depthMarketData);
+    return getMarketDataMessageValue(env, &message, DELIVERY_OBJECT, result);
+  }
+
+  CHECK(napi_create_object(env, result));
+
+  for (auto it = fields->begin(); it != fields->end(); ++it)
+    CHECK(setSnapshotField(env, *result, &depthMarketData, *it));
+
+  return napi_ok;
+}
+
+static napi_value callSnapshotFunc(napi_env env, napi_callback_info info, bool isArray) {
+  static const napi_valuetype types[1] = {napi_string};
+  size_t argc = 2;
+  napi_value argv[2], jsthis, retval, element;
+  MarketData *marketData;
+  std::vector<int> fields;
+  char instrumentId[sizeof(TThostFtdcInstrumentIDType)];
+  bool isTypesOk;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  if (!marketData->snapshots) {
+    napi_throw_error(env, nullptr, "Market data snapshots are disabled, set the snapshotCapacity option");
     return nullptr;
   }
 
-  if (0 != uv_thread_create(&marketData->thread, processThread, marketData)) {
-    delete marketData->spi;
-    delete marketData;
-    napi_throw_error(env, nullptr, "Market data can not create thread");
+  if (argc < 1) {
+    napi_throw_type_error(env, nullptr, "Wrong number of arguments");
     return nullptr;
   }
 
-  marketData->api = CThostFtdcMdApi::CreateFtdcMdApi(flowMdPath);
+  if (isArray)
+    CHECK(checkIsStringArray(env, argv[0], &isTypesOk));
+  else
+    CHECK(checkValueTypes(env, 1, argv, types, &isTypesOk));
 
-  if (!marketData->api) {
-    marketData->spi->quit();
-    uv_thread_join(&marketData->thread);
-    delete marketData->spi;
-    delete marketData;
-    napi_throw_error(env, nullptr, "Market data is out of memory");
+  if (!isTypesOk)
+    return nullptr;
+
+  CHECK(getSnapshotFields(env, argc, argv, &fields, &isTypesOk));
+
+  if (!isTypesOk)
     return nullptr;
+
+  const std::vector<int> *projection = argc > 1 ? &fields : nullptr;
+
+  if (!isArray) {
+    CHECK(napi_get_value_string_utf8(env, argv[0], instrumentId, sizeof(instrumentId), nullptr));
+    CHECK(getSnapshotValue(env, marketData->snapshots, instrumentId, projection, &retval));
+    return retval;
   }
 
-  marketData->api->RegisterSpi(marketData->spi);
-  marketData->api->RegisterFront(frontMdAddr);
-  marketData->api->Init();
+  uint32_t length;
 
-  CHECK(napi_wrap(env, jsthis, (void *)marketData, marketDataDestructor, nullptr, &marketData->wrapper));
+  CHECK(napi_get_array_length(env, argv[0], &length));
+  CHECK(napi_create_array_with_length(env, length, &retval));
 
-  return jsthis;
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, argv[0], i, &element));
+    CHECK(napi_get_value_string_utf8(env, element, instrumentId, sizeof(instrumentId), nullptr));
+    CHECK(getSnapshotValue(env, marketData->snapshots, instrumentId, projection, &element));
+    CHECK(napi_set_element(env, retval, i, element));
+  }
+
+  return retval;
+}
+
+static napi_value getSnapshot(napi_env env, napi_callback_info info) {
+  return callSnapshotFunc(env, info, false);
+}
+
+static napi_value getSnapshots(napi_env env, napi_callback_info info) {
+  return callSnapshotFunc(env, info, true);
+}
+
+static napi_value getBar(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[2] = {napi_string, napi_number};
+  size_t argc = 2;
+  napi_value argv[2], jsthis, retval;
+  MarketData *marketData;
+  char instrumentId[sizeof(TThostFtdcInstrumentIDType)];
+  uint32_t interval;
+  BarField bar;
+  bool isTypesOk;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  if (!marketData->bars) {
+    napi_throw_error(env, nullptr, "Market data bars are disabled, set the barIntervals option");
+    return nullptr;
+  }
+
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
+
+  if (!isTypesOk)
+    return nullptr;
+
+  CHECK(napi_get_value_string_utf8(env, argv[0], instrumentId, sizeof(instrumentId), nullptr));
+  CHECK(napi_get_value_uint32(env, argv[1], &interval));
+
+  if (!getOpenBar(marketData->bars, instrumentId, interval, &bar)) {
+    CHECK(napi_get_undefined(env, &retval));
+    return retval;
+  }
+
+  CHECK(getBarValue(env, &bar, &retval));
+
+  return retval;
+}
+
+static napi_value getSnapshotStats(napi_env env, napi_callback_info info) {
+  SnapshotStats stats = {0, 0, 0, 0};
+  napi_value jsthis, object;
+  MarketData *marketData;
+
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  if (marketData->snapshots)
+    getSnapshotStats(marketData->snapshots, &stats);
+
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetUint32(env, object, "instruments", stats.instruments));
+  CHECK(objectSetUint32(env, object, "capacity", stats.capacity));
+  CHECK(objectSetInt64(env, object, "updates", (int64_t)stats.updates));
+  CHECK(objectSetInt64(env, object, "rejected", (int64_t)stats.rejected));
+
+  return object;
+}
+
+static napi_value getLatencyStats(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv, jsthis, stats;
+  MarketData *marketData;
+  bool reset = false;
+
+  CHECK(napi_get_cb_info(env, info, &argc, &argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  if (argc > 0) {
+    CHECK(napi_coerce_to_bool(env, argv, &argv));
+    CHECK(napi_get_value_bool(env, argv, &reset));
+  }
+
+  CHECK(getLatencyValue(env, marketData->latency, MdSpi::eventName, &stats));
+
+  if (reset)
+    resetLatency(marketData->latency);
+
+  return stats;
+}
+
+static void marketDataDestructor(napi_env env, void *data, void *hint) {
+  MarketData *marketData = (MarketData *)data;
+
+  if (!marketData)
+    return;
+
+  if (marketData->spi) {
+    marketData->spi->quit();
+    marketData->spi->close();
+    uv_thread_join(&marketData->thread);
+  }
+
+  for (int i = 0; i < EM_COUNT; ++i) {
+    Listener *listener = marketData->listeners[i].exchange(nullptr, std::memory_order_relaxed);
+
+    if (listener) {
+      napi_unref_threadsafe_function(env, listener->tsfn);
+      freeListener(listener);
+    }
+  }
+
+  for (auto it = marketData->retired.begin(); it != marketData->retired.end(); ++it)
+    freeListener(*it);
+
+  marketData->retired.clear();
+  napi_delete_reference(marketData->env, marketData->wrapper);
+
+  if (marketData->api) {
+    marketData->api->RegisterSpi(nullptr);
+    marketData->api->Release();
+  }
+
+  if (marketData->spi)
+    delete marketData->spi;
+
+  if (marketData->journal)
+    closeTickJournal(marketData->journal);
+
+  if (marketData->snapshots)
+    freeSnapshotCache(marketData->snapshots);
+
+  if (marketData->bars)
+    freeBarAggregator(marketData->bars);
+
+  releaseLatencyRecorder(marketData->latency);
+  delete marketData;
+}
+
+static napi_status getJournalOptions(napi_env env, napi_value options, char *path, size_t size, uint32_t *fileSize, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
+  size_t length;
+  bool hasProperty;
+
+  *result = true;
+
+  CHECK(napi_has_named_property(env, options, "journal", &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, options, "journal", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
+
+  if (valuetype == napi_undefined)
+    return napi_ok;
+
+  if (valuetype != napi_string) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The journal must be a directory path");
+  }
+
+  CHECK(napi_get_value_string_utf8(env, value, nullptr, 0, &length));
+
+  if (length == 0 || length >= size) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The journal directory path is empty or too long");
+  }
+
+  CHECK(napi_get_value_string_utf8(env, value, path, size, nullptr));
+  CHECK(objectGetUint32(env, options, "journalFileSize", fileSize));
+
+  if (*fileSize == 0) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The journalFileSize must be greater than 0");
+  }
+
+  return napi_ok;
+}
+
+typedef struct MarketDataSettings {
+  uint32_t queueCapacity;
+  uint32_t snapshotCapacity;
+  uint32_t barCount;
+  uint32_t barIntervals[BAR_INTERVALS_MAX];
+  uint32_t journalFileSize;
+  uint8_t policies[EM_COUNT];
+  char journalPath[JOURNAL_PATH_MAX];
+} MarketDataSettings;
+
+static napi_status getSnapshotCapacity(napi_env env, napi_value options, uint32_t *capacity, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
+  bool hasProperty;
+
+  *result = true;
+
+  CHECK(napi_has_named_property(env, options, "snapshotCapacity", &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, options, "snapshotCapacity", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
+
+  if (valuetype == napi_undefined)
+    return napi_ok;
+
+  if (valuetype == napi_number)
+    CHECK(napi_get_value_uint32(env, value, capacity));
+
+  if (valuetype != napi_number || *capacity > SNAPSHOT_CAPACITY_MAX) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The snapshotCapacity must be a number from 0 to 1048576");
+  }
+
+  return napi_ok;
+}
+
+static napi_status getBarIntervals(napi_env env, napi_value options, uint32_t *intervals, uint32_t *count, bool *result) {
+  napi_value value, element;
+  napi_valuetype valuetype;
+  uint32_t length, interval;
+  bool hasProperty, isArray;
+
+  *result = true;
+
+  CHECK(napi_has_named_property(env, options, "barIntervals", &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, options, "barIntervals", &value));
+  CHECK(napi_is_array(env, value, &isArray));
+
+  if (!isArray) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The barIntervals should be an array of seconds");
+  }
+
+  CHECK(napi_get_array_length(env, value, &length));
+
+  if (length > BAR_INTERVALS_MAX) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The barIntervals can have at most 8 intervals");
+  }
+
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, value, i, &element));
+    CHECK(napi_typeof(env, element, &valuetype));
+
+    if (valuetype == napi_number)
+      CHECK(napi_get_value_uint32(env, element, &interval));
+
+    if (valuetype != napi_number || !isBarInterval(interval)) {
+      *result = false;
+      return napi_throw_type_error(env, nullptr, "A bar interval must be a number of seconds that divides an hour");
+    }
+
+    bool isDuplicate = false;
+
+    for (uint32_t j = 0; j < *count; ++j)
+      isDuplicate = isDuplicate || intervals[j] == interval;
+
+    if (!isDuplicate)
+      intervals[(*count)++] = interval;
+  }
+
+  return napi_ok;
+}
+
+static napi_status getMarketDataSettings(napi_env env, napi_value options, MarketDataSettings *settings, bool *result) {
+  CHECK(getQueueCapacity(env, options, &settings->queueCapacity, result));
+
+  if (!*result)
+    return napi_ok;
+
+  CHECK(getSnapshotCapacity(env, options, &settings->snapshotCapacity, result));
+
+  if (!*result)
+    return napi_ok;
+
+  CHECK(getBarIntervals(env, options, settings->barIntervals, &settings->barCount, result));
+
+  if (!*result)
+    return napi_ok;
+
+  CHECK(getOverflowPolicies(env, options, MdSpi::eventId, MdSpi::isLossless, EM_BASE, settings->policies, result));
+
+  if (!*result)
+    return napi_ok;
+
+  return getJournalOptions(env, options, settings->journalPath, sizeof(settings->journalPath), &settings->journalFileSize, result);
+}
+
+static void initMarketDataSettings(MarketDataSettings *settings) {
+  settings->queueCapacity = MESSAGE_QUEUE_CAPACITY;
+  settings->snapshotCapacity = 0;
+  settings->barCount = 0;
+  settings->journalFileSize = JOURNAL_FILE_SIZE;
+  settings->journalPath[0] = 0;
+
+  for (int i = 0; i < EM_COUNT; ++i)
+    settings->policies[i] = OVERFLOW_BLOCK;
+}
+
+// Frees what a MarketData owns besides its threads, for constructors that fail half way.
+static void freeMarketData(MarketData *marketData) {
+  if (marketData->spi)
+    delete marketData->spi;
+
+  if (marketData->journal)
+    closeTickJournal(marketData->journal);
+
+  if (marketData->snapshots)
+    freeSnapshotCache(marketData->snapshots);
+
+  if (marketData->bars)
+    freeBarAggregator(marketData->bars);
+
+  if (marketData->latency)
+    releaseLatencyRecorder(marketData->latency);
+
+  delete marketData;
+}
+
+// Everything but the api is set up here, so a live front and a replay dispatch alike.
+static MarketData *newMarketData(napi_env env, napi_value jsthis, const MarketDataSettings *settings, const std::function<CThostFtdcMdApi *()> &createApi, char *frontMdAddr) {
+  MarketData *marketData = new MarketData();
+
+  if (!marketData) {
+    napi_throw_error(env, nullptr, "Market data is out of memory");
+    return nullptr;
+  }
+
+  marketData->env = env;
+
+  for (int i = 0; i < EM_COUNT; ++i)
+    marketData->listeners[i].store(nullptr, std::memory_order_relaxed);
+
+  marketData->instruments.owner = nullptr;
+  marketData->spi = nullptr;
+  marketData->journal = nullptr;
+  marketData->snapshots = nullptr;
+  marketData->bars = nullptr;
+  marketData->replay = nullptr;
+  marketData->latency = createLatencyRecorder(EM_BASE, EM_COUNT);
+
+  if (!marketData->latency) {
+    freeMarketData(marketData);
+    napi_throw_error(env, nullptr, "Market data is out of memory");
+    return nullptr;
+  }
+
+  if (settings->journalPath[0]) {
+    marketData->journal = createTickJournal(settings->journalPath, settings->journalFileSize);
+
+    if (!marketData->journal) {
+      freeMarketData(marketData);
+      napi_throw_error(env, nullptr, "Market data journal directory does not exist");
+      return nullptr;
+    }
+  }
+
+  if (settings->snapshotCapacity > 0) {
+    marketData->snapshots = createSnapshotCache(settings->snapshotCapacity);
+
+    if (!marketData->snapshots) {
+      freeMarketData(marketData);
+      napi_throw_error(env, nullptr, "Market data is out of memory");
+      return nullptr;
+    }
+  }
+
+  if (settings->barCount > 0) {
+    marketData->bars = createBarAggregator(settings->barIntervals, settings->barCount);
+
+    if (!marketData->bars) {
+      freeMarketData(marketData);
+      napi_throw_error(env, nullptr, "Market data is out of memory");
+      return nullptr;
+    }
+  }
+
+  marketData->spi = new MdSpi(settings->queueCapacity);
+
+  if (!marketData->spi) {
+    freeMarketData(marketData);
+    napi_throw_error(env, nullptr, "Market data is out of memory");
+    return nullptr;
+  }
+
+  for (int i = 0; i < EM_COUNT; ++i)
+    marketData->spi->setOverflowPolicy(EM_BASE + i, settings->policies[i]);
+
+  marketData->spi->setJournal(marketData->journal);
+  marketData->spi->setSnapshots(marketData->snapshots);
+  marketData->spi->setBars(marketData->bars);
+
+  if (0 != uv_thread_create(&marketData->thread, processThread, marketData)) {
+    freeMarketData(marketData);
+    napi_throw_error(env, nullptr, "Market data can not create thread");
+    return nullptr;
+  }
+
+  marketData->api = createApi();
+
+  if (!marketData->api) {
+    marketData->spi->quit();
+    uv_thread_join(&marketData->thread);
+    freeMarketData(marketData);
+    napi_throw_error(env, nullptr, "Market data is out of memory");
+    return nullptr;
+  }
+
+  marketData->api->RegisterSpi(marketData->spi);
+  marketData->api->RegisterFront(frontMdAddr);
+  marketData->api->Init();
+
+  CHECK(napi_wrap(env, jsthis, (void *)marketData, marketDataDestructor, nullptr, &marketData->wrapper));
+
+  return marketData;
+}
+
+static napi_value marketDataNew(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[2] = {napi_string, napi_string};
+  size_t argc = 3;
+  napi_value target, argv[3], jsthis;
+  MarketDataSettings settings;
+  char flowMdPath[260], frontMdAddr[64];
+  bool isTypesOk;
+
+  CHECK(napi_get_new_target(env, info, &target));
+
+  if (!target)
+    return nullptr;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
+
+  if (!isTypesOk)
+    return nullptr;
+
+  initMarketDataSettings(&settings);
+
+  if (argc > 2) {
+    CHECK(checkIsObject(env, argv[2], &isTypesOk));
+
+    if (!isTypesOk)
+      return nullptr;
+
+    CHECK(getMarketDataSettings(env, argv[2], &settings, &isTypesOk));
+
+    if (!isTypesOk)
+      return nullptr;
+  }
+
+  CHECK(napi_get_value_string_utf8(env, argv[0], flowMdPath, sizeof(flowMdPath), nullptr));
+  CHECK(napi_get_value_string_utf8(env, argv[1], frontMdAddr, sizeof(frontMdAddr), nullptr));
+
+  MarketData *marketData = newMarketData(env, jsthis, &settings, [&flowMdPath]() { return CThostFtdcMdApi::CreateFtdcMdApi(flowMdPath); }, frontMdAddr);
+
+  return marketData ? jsthis : nullptr;
+}
+
+static napi_status getReplayFiles(napi_env env, napi_value value, std::vector<std::string> *files, bool *result) {
+  napi_value element;
+  napi_valuetype valuetype;
+  uint32_t length = 1;
+  size_t size;
+  bool isArray;
+
+  *result = false;
+
+  CHECK(napi_is_array(env, value, &isArray));
+
+  if (isArray)
+    CHECK(napi_get_array_length(env, value, &length));
+
+  for (uint32_t i = 0; i < length; ++i) {
+    if (isArray)
+      CHECK(napi_get_element(env, value, i, &element));
+    else
+      element = value;
+
+    CHECK(napi_typeof(env, element, &valuetype));
+
+    if (valuetype != napi_string)
+      return napi_throw_type_error(env, nullptr, "The replay files should be a path or an array of paths");
+
+    CHECK(napi_get_value_string_utf8(env, element, nullptr, 0, &size));
+
+    std::string path(size, '\0');
+
+    CHECK(napi_get_value_string_utf8(env, element, &path[0], size + 1, nullptr));
+    files->push_back(path);
+  }
+
+  *result = true;
+  return napi_ok;
+}
+
+static napi_status getReplaySpeed(napi_env env, napi_value options, double *speed, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
+  bool hasProperty;
+
+  *result = true;
+
+  CHECK(napi_has_named_property(env, options, "speed", &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, options, "speed", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
+
+  if (valuetype == napi_undefined)
+    return napi_ok;
+
+  if (valuetype == napi_number)
+    CHECK(napi_get_value_double(env, value, speed));
+
+  if (valuetype != napi_number || !(*speed >= 0)) {
+    *result = false;
+    return napi_throw_type_error(env, nullptr, "The replay speed must be a number not less than 0");
+  }
+
+  return napi_ok;
+}
+
+static napi_value marketDataReplayNew(napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  napi_value target, argv[2], jsthis;
+  std::vector<std::string> files;
+  MarketDataSettings settings;
+  double speed = 0;
+  char frontMdAddr[] = "replay://", error[JOURNAL_PATH_MAX + 64];
+  bool isTypesOk;
+
+  CHECK(napi_get_new_target(env, info, &target));
+
+  if (!target)
+    return nullptr;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+
+  if (argc < 1) {
+    napi_throw_type_error(env, nullptr, "Wrong number of arguments");
+    return nullptr;
+  }
+
+  CHECK(getReplayFiles(env, argv[0], &files, &isTypesOk));
+
+  if (!isTypesOk)
+    return nullptr;
+
+  initMarketDataSettings(&settings);
+
+  if (argc > 1) {
+    CHECK(checkIsObject(env, argv[1], &isTypesOk));
+
+    if (!isTypesOk)
+      return nullptr;
+
+    CHECK(getMarketDataSettings(env, argv[1], &settings, &isTypesOk));
+
+    if (!isTypesOk)
+      return nullptr;
+
+    CHECK(getReplaySpeed(env, argv[1], &speed, &isTypesOk));
+
+    if (!isTypesOk)
+      return nullptr;
+  }
+
+  if (!MdReplayApi::checkFiles(files, error, sizeof(error))) {
+    napi_throw_error(env, nullptr, error);
+    return nullptr;
+  }
+
+  MdReplayApi *replay = nullptr;
+  MarketData *marketData = newMarketData(env, jsthis, &settings, [&files, speed, &replay]() { return replay = new MdReplayApi(files, speed); }, frontMdAddr);
+
+  if (!marketData)
+    return nullptr;
+
+  marketData->replay = replay;
+  return jsthis;
+}
+
+static napi_value getReplayStats(napi_env env, napi_callback_info info) {
+  ReplayStats stats = {0, 0, 0, false};
+  napi_value jsthis, object, finished;
+  MarketData *marketData;
+
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&marketData));
+
+  if (marketData->replay)
+    marketData->replay->getReplayStats(&stats);
+
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetInt64(env, object, "total", (int64_t)stats.total));
+  CHECK(objectSetInt64(env, object, "played", (int64_t)stats.played));
+  CHECK(objectSetInt64(env, object, "clock", (int64_t)stats.clock));
+  CHECK(napi_get_boolean(env, stats.finished, &finished));
+  CHECK(napi_set_named_property(env, object, "finished", finished));
+
+  return object;
 }
 
 napi_status defineMarketData(napi_env env, napi_ref *constructor) {
   napi_property_descriptor props[] = {
       DECLARE_NAPI_METHOD(getApiVersion),
+      DECLARE_NAPI_METHOD(getQueueStats),
+      DECLARE_NAPI_METHOD(getLatencyStats),
+      DECLARE_NAPI_METHOD(getJournalStats),
+      DECLARE_NAPI_METHOD(getSnapshotStats),
+      DECLARE_NAPI_METHOD(getSnapshot),
+      DECLARE_NAPI_METHOD(getSnapshots),
+      DECLARE_NAPI_METHOD(getBar),
       DECLARE_NAPI_METHOD(subscribeMarketData),
       DECLARE_NAPI_METHOD(unsubscribeMarketData),
       DECLARE_NAPI_METHOD(subscribeForQuoteRsp),
@@ -341,11 +1437,40 @@ napi_status defineMarketData(napi_env env, napi_ref *constructor) {
       DECLARE_NAPI_METHOD(reqUserLogin),
       DECLARE_NAPI_METHOD(reqUserLogout),
       DECLARE_NAPI_METHOD(on),
+      DECLARE_NAPI_METHOD(getConflationStats),
   };
   return defineClass(env, "MarketData", marketDataNew, arraysize(props), props, constructor);
 }
 
+napi_status defineMarketDataReplay(napi_env env, napi_ref *constructor) {
+  napi_property_descriptor props[] = {
+      DECLARE_NAPI_METHOD(getApiVersion),
+      DECLARE_NAPI_METHOD(getQueueStats),
+      DECLARE_NAPI_METHOD(getLatencyStats),
+      DECLARE_NAPI_METHOD(getJournalStats),
+      DECLARE_NAPI_METHOD(getSnapshotStats),
+      DECLARE_NAPI_METHOD(getSnapshot),
+      DECLARE_NAPI_METHOD(getSnapshots),
+      DECLARE_NAPI_METHOD(getBar),
+      DECLARE_NAPI_METHOD(getReplayStats),
+      DECLARE_NAPI_METHOD(subscribeMarketData),
+      DECLARE_NAPI_METHOD(unsubscribeMarketData),
+      DECLARE_NAPI_METHOD(subscribeForQuoteRsp),
+      DECLARE_NAPI_METHOD(unsubscribeForQuoteRsp),
+      DECLARE_NAPI_METHOD(reqUserLogin),
+      DECLARE_NAPI_METHOD(reqUserLogout),
+      DECLARE_NAPI_METHOD(on),
+      DECLARE_NAPI_METHOD(getConflationStats),
+  };
+  return defineClass(env, "MarketDataReplay", marketDataReplayNew, arraysize(props), props, constructor);
+}
+
 napi_value createMarketData(napi_env env, napi_callback_info info) {
   Constructors *constructors = getConstructors(env);
-  return constructors ? createInstance(env, info, constructors->marketData, 2) : nullptr;
+  return constructors ? createInstance(env, info, constructors->marketData, 3) : nullptr;
+}
+
+napi_value createMarketDataReplay(napi_env env, napi_callback_info info) {
+  Constructors *constructors = getConstructors(env);
+  return constructors ? createInstance(env, info, constructors->marketDataReplay, 2) : nullptr;
 }
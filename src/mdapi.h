@@ -17,4 +17,7 @@
 napi_status defineMarketData(napi_env env, napi_ref *constructor);
 napi_value createMarketData(napi_env env, napi_callback_info info);
 
+napi_status defineMarketDataReplay(napi_env env, napi_ref *constructor);
+napi_value createMarketDataReplay(napi_env env, napi_callback_info info);
+
 #endif /* __MDAPI_H__ */
@@ -0,0 +1,310 @@
+/*
+ * mdbars.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdbars.h"
+#include <float.h>
+#include <string.h>
+
+#define NIGHT_SESSION_START (18 * 3600)
+
+static int32_t parseDigits(const char *str, int count) {
+  int32_t value = 0;
+
+  for (int i = 0; i < count; ++i) {
+    if (str[i] < '0' || str[i] > '9')
+      return -1;
+
+    value = value * 10 + (str[i] - '0');
+  }
+
+  return value;
+}
+
+// "HH:MM:SS" as seconds since midnight, -1 when missing.
+static int32_t parseSeconds(const char *time) {
+  int32_t hour = parseDigits(time, 2), minute, second;
+
+  if (hour < 0 || hour > 23 || time[2] != ':' || (minute = parseDigits(time + 3, 2)) < 0 || time[5] != ':' || (second = parseDigits(time + 6, 2)) < 0)
+    return -1;
+
+  return (hour * 60 + minute) * 60 + second;
+}
+
+// Milliseconds into the trading day, which starts with the night session.
+static int64_t tradingTime(int32_t seconds, int32_t millisec) {
+  int64_t offset = seconds >= NIGHT_SESSION_START ? seconds - NIGHT_SESSION_START : seconds + (86400 - NIGHT_SESSION_START);
+  return offset * 1000 + millisec;
+}
+
+static void formatTime(char *time, int32_t seconds) {
+  int32_t parts[3] = {seconds / 3600, seconds / 60 % 60, seconds % 60};
+
+  for (int i = 0; i < 3; ++i) {
+    time[i * 3] = (char)('0' + parts[i] / 10);
+    time[i * 3 + 1] = (char)('0' + parts[i] % 10);
+    time[i * 3 + 2] = i < 2 ? ':' : '\0';
+  }
+}
+
+static inline bool isPrice(double price) {
+  return price > 0 && price < DBL_MAX;
+}
+
+bool isBarInterval(uint32_t interval) {
+  // Dividing an hour keeps every bar inside one side of midnight and of the night session start.
+  return interval > 0 && interval <= 3600 && 3600 % interval == 0;
+}
+
+BarAggregator *createBarAggregator(const uint32_t *intervals, uint32_t count) {
+  BarAggregator *aggregator = new BarAggregator();
+
+  if (!aggregator)
+    return nullptr;
+
+  aggregator->count = count < BAR_INTERVALS_MAX ? count : BAR_INTERVALS_MAX;
+  memcpy(aggregator->intervals, intervals, aggregator->count * sizeof(uint32_t));
+  memset(aggregator->clockDay, 0, sizeof(aggregator->clockDay));
+  aggregator->clock = 0;
+  aggregator->deadline = INT64_MAX;
+
+  uv_mutex_init(&aggregator->mutex);
+
+  return aggregator;
+}
+
+void freeBarAggregator(BarAggregator *aggregator) {
+  for (auto it = aggregator->instruments.begin(); it != aggregator->instruments.end(); ++it)
+    delete it->second;
+
+  uv_mutex_destroy(&aggregator->mutex);
+  delete aggregator;
+}
+
+static BarState *getBarState(BarAggregator *aggregator, const char *instrumentId) {
+  auto iter = aggregator->instruments.find(instrumentId);
+
+  if (iter != aggregator->instruments.end())
+    return iter->second;
+
+  BarState *state = new BarState();
+
+  if (!state)
+    return nullptr;
+
+  memset(state, 0, sizeof(BarState));
+
+  for (uint32_t i = 0; i < aggregator->count; ++i)
+    state->ends[i] = -1;
+
+  aggregator->instruments.emplace(instrumentId, state);
+  return state;
+}
+
+static void closeBars(BarAggregator *aggregator, BarState *state, int64_t clock, std::vector<BarField> *closed) {
+  for (uint32_t i = 0; i < aggregator->count; ++i) {
+    if (!state->open[i])
+      continue;
+
+    if (clock >= 0 && state->ends[i] + BAR_CLOSE_GRACE > clock) {
+      if (state->ends[i] + BAR_CLOSE_GRACE < aggregator->deadline)
+        aggregator->deadline = state->ends[i] + BAR_CLOSE_GRACE;
+
+      continue;
+    }
+
+    state->open[i] = false;
+    closed->push_back(state->bars[i]);
+  }
+}
+
+static void openBar(BarState *state, uint32_t index, const CThostFtdcDepthMarketDataField *pDepthMarketData, int32_t start, uint32_t interval, int32_t volume, double turnover) {
+  BarField *bar = &state->bars[index];
+
+  memcpy(bar->InstrumentID, pDepthMarketData->InstrumentID, sizeof(bar->InstrumentID));
+  memcpy(bar->ExchangeID, pDepthMarketData->ExchangeID, sizeof(bar->ExchangeID));
+  memcpy(bar->TradingDay, state->tradingDay, sizeof(bar->TradingDay));
+  memcpy(bar->ActionDay, pDepthMarketData->ActionDay, sizeof(bar->ActionDay));
+  formatTime(bar->BarTime, start);
+
+  bar->Interval = (int32_t)interval;
+  bar->OpenPrice = pDepthMarketData->LastPrice;
+  bar->HighestPrice = pDepthMarketData->LastPrice;
+  bar->LowestPrice = pDepthMarketData->LastPrice;
+  bar->ClosePrice = pDepthMarketData->LastPrice;
+  bar->Volume = volume + state->carryVolume[index];
+  bar->Turnover = turnover + state->carryTurnover[index];
+  bar->OpenInterest = pDepthMarketData->OpenInterest;
+
+  state->carryVolume[index] = 0;
+  state->carryTurnover[index] = 0;
+  state->open[index] = true;
+}
+
+static void updateBar(BarField *bar, const CThostFtdcDepthMarketDataField *pDepthMarketData, int32_t volume, double turnover) {
+  if (pDepthMarketData->LastPrice > bar->HighestPrice)
+    bar->HighestPrice = pDepthMarketData->LastPrice;
+
+  if (pDepthMarketData->LastPrice < bar->LowestPrice)
+    bar->LowestPrice = pDepthMarketData->LastPrice;
+
+  bar->ClosePrice = pDepthMarketData->LastPrice;
+  bar->Volume += volume;
+  bar->Turnover += turnover;
+  bar->OpenInterest = pDepthMarketData->OpenInterest;
+}
+
+static void advanceClock(BarAggregator *aggregator, const char *tradingDay, int64_t now, std::vector<BarField> *closed) {
+  int order = strncmp(tradingDay, aggregator->clockDay, sizeof(aggregator->clockDay));
+
+  if (order < 0 || (order == 0 && now <= aggregator->clock))
+    return;
+
+  if (order > 0)
+    memcpy(aggregator->clockDay, tradingDay, sizeof(aggregator->clockDay));
+
+  aggregator->clock = now;
+
+  if (order == 0 && now < aggregator->deadline)
+    return;
+
+  // Bars of an earlier trading day close outright, the rest once they are past the grace.
+  aggregator->deadline = INT64_MAX;
+
+  for (auto it = aggregator->instruments.begin(); it != aggregator->instruments.end(); ++it) {
+    bool sameDay = 0 == strncmp(it->second->tradingDay, aggregator->clockDay, sizeof(aggregator->clockDay));
+    closeBars(aggregator, it->second, sameDay ? now : -1, closed);
+  }
+}
+
+void aggregateTick(BarAggregator *aggregator, const CThostFtdcDepthMarketDataField *pDepthMarketData, std::vector<BarField> *closed) {
+  int32_t seconds = parseSeconds(pDepthMarketData->UpdateTime);
+
+  if (seconds < 0 || !pDepthMarketData->TradingDay[0])
+    return;
+
+  int64_t now = tradingTime(seconds, pDepthMarketData->UpdateMillisec);
+
+  uv_mutex_lock(&aggregator->mutex);
+
+  BarState *state = getBarState(aggregator, pDepthMarketData->InstrumentID);
+
+  if (!state) {
+    uv_mutex_unlock(&aggregator->mutex);
+    return;
+  }
+
+  if (0 != strncmp(state->tradingDay, pDepthMarketData->TradingDay, sizeof(state->tradingDay))) {
+    bool isFirst = !state->tradingDay[0];
+
+    closeBars(aggregator, state, -1, closed);
+
+    for (uint32_t i = 0; i < aggregator->count; ++i) {
+      state->ends[i] = -1;
+      state->carryVolume[i] = 0;
+      state->carryTurnover[i] = 0;
+    }
+
+    // Cumulative fields restart with the trading day, unless we joined it half way.
+    memcpy(state->tradingDay, pDepthMarketData->TradingDay, sizeof(state->tradingDay));
+    state->volume = isFirst ? pDepthMarketData->Volume : 0;
+    state->turnover = isFirst ? pDepthMarketData->Turnover : 0;
+  }
+
+  int32_t volume = pDepthMarketData->Volume - state->volume;
+  double turnover = pDepthMarketData->Turnover - state->turnover;
+
+  // Never negative, a feed restart or a bad tick must not take trades back.
+  if (volume < 0)
+    volume = 0;
+
+  if (turnover < 0)
+    turnover = 0;
+
+  state->volume = pDepthMarketData->Volume;
+  state->turnover = pDepthMarketData->Turnover;
+
+  if (isPrice(pDepthMarketData->LastPrice)) {
+    for (uint32_t i = 0; i < aggregator->count; ++i) {
+      int32_t start = seconds - seconds % (int32_t)aggregator->intervals[i];
+      int64_t end = tradingTime(start, 0) + (int64_t)aggregator->intervals[i] * 1000;
+
+      if (end > state->ends[i]) {
+        if (state->open[i])
+          closed->push_back(state->bars[i]);
+
+        openBar(state, i, pDepthMarketData, start, aggregator->intervals[i], volume, turnover);
+        state->ends[i] = end;
+
+        if (end + BAR_CLOSE_GRACE < aggregator->deadline && 0 == strncmp(state->tradingDay, aggregator->clockDay, sizeof(state->tradingDay)))
+          aggregator->deadline = end + BAR_CLOSE_GRACE;
+      } else if (end == state->ends[i] && state->open[i]) {
+        updateBar(&state->bars[i], pDepthMarketData, volume, turnover);
+      } else if (state->open[i]) {
+        // A late tick of an earlier bar, its trades still count.
+        state->bars[i].Volume += volume;
+        state->bars[i].Turnover += turnover;
+      } else {
+        state->carryVolume[i] += volume;
+        state->carryTurnover[i] += turnover;
+      }
+    }
+  }
+
+  advanceClock(aggregator, pDepthMarketData->TradingDay, now, closed);
+
+  uv_mutex_unlock(&aggregator->mutex);
+}
+
+bool getOpenBar(BarAggregator *aggregator, const char *instrumentId, uint32_t interval, BarField *bar) {
+  bool found = false;
+
+  uv_mutex_lock(&aggregator->mutex);
+
+  auto iter = aggregator->instruments.find(instrumentId);
+
+  if (iter != aggregator->instruments.end()) {
+    for (uint32_t i = 0; i < aggregator->count; ++i) {
+      if (aggregator->intervals[i] == interval && iter->second->open[i]) {
+        *bar = iter->second->bars[i];
+        found = true;
+        break;
+      }
+    }
+  }
+
+  uv_mutex_unlock(&aggregator->mutex);
+
+  return found;
+}
+
+napi_status getBarValue(napi_env env, const BarField *pBar, napi_value *result) {
+  DefineObject(object);
+
+  CHECK(SetObjectString(env, object, pBar, InstrumentID));
+  CHECK(SetObjectString(env, object, pBar, ExchangeID));
+  CHECK(SetObjectString(env, object, pBar, TradingDay));
+  CHECK(SetObjectString(env, object, pBar, ActionDay));
+  CHECK(SetObjectString(env, object, pBar, BarTime));
+  CHECK(SetObjectInt32(env, object, pBar, Interval));
+  CHECK(SetObjectDouble(env, object, pBar, OpenPrice));
+  CHECK(SetObjectDouble(env, object, pBar, HighestPrice));
+  CHECK(SetObjectDouble(env, object, pBar, LowestPrice));
+  CHECK(SetObjectDouble(env, object, pBar, ClosePrice));
+  CHECK(SetObjectInt32(env, object, pBar, Volume));
+  CHECK(SetObjectDouble(env, object, pBar, Turnover));
+  CHECK(SetObjectDouble(env, object, pBar, OpenInterest));
+
+  return createObject(env, object, result);
+}
+
+napi_status rtnBar(napi_env env, const Message *message, napi_value *result) {
+  return getBarValue(env, MessageData<BarField>(message), result);
+}
@@ -0,0 +1,90 @@
+/*
+ * mdbars.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDBARS_H__
+#define __MDBARS_H__
+
+#include "napi_ctp.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+#define BAR_INTERVALS_MAX 8
+#define BAR_CLOSE_GRACE 1000 /* ms of exchange time */
+
+/* One completed or in-progress bar, BarTime is the start of the interval. */
+typedef struct BarField {
+  TThostFtdcInstrumentIDType InstrumentID;
+  TThostFtdcExchangeIDType ExchangeID;
+  TThostFtdcDateType TradingDay;
+  TThostFtdcDateType ActionDay;
+  TThostFtdcTimeType BarTime;
+  int32_t Interval;
+  double OpenPrice;
+  double HighestPrice;
+  double LowestPrice;
+  double ClosePrice;
+  int32_t Volume;
+  double Turnover;
+  double OpenInterest;
+} BarField;
+
+/*
+ * ends is the end of the latest bar per interval, kept after it closed so a
+ * late tick is not mistaken for a new bar; its trades are carried over.
+ */
+typedef struct BarState {
+  BarField bars[BAR_INTERVALS_MAX];
+  int64_t ends[BAR_INTERVALS_MAX];
+  bool open[BAR_INTERVALS_MAX];
+  int32_t carryVolume[BAR_INTERVALS_MAX];
+  double carryTurnover[BAR_INTERVALS_MAX];
+  TThostFtdcDateType tradingDay;
+  int32_t volume;
+  double turnover;
+} BarState;
+
+/*
+ * OHLCV bars of every instrument for a few intervals, fed by the SPI thread.
+ *
+ * A bar covers [BarTime, BarTime + Interval) of exchange time and closes on
+ * the instrument's first tick past it, or once any instrument's tick of the
+ * same trading day is BAR_CLOSE_GRACE past its end, so quiet instruments
+ * still close on time. Times are ordered within the trading day, night
+ * session first, which keeps bars across midnight in order whatever the
+ * exchange puts in ActionDay. Volume and Turnover are the deltas of CTP's
+ * cumulative fields, counted from the first tick seen or from the start of
+ * a new trading day. The mutex only guards against in-progress queries.
+ */
+typedef struct BarAggregator {
+  uv_mutex_t mutex;
+  uint32_t count;
+  uint32_t intervals[BAR_INTERVALS_MAX];
+  std::unordered_map<std::string, BarState *> instruments;
+  TThostFtdcDateType clockDay;
+  int64_t clock;
+  int64_t deadline;
+} BarAggregator;
+
+BarAggregator *createBarAggregator(const uint32_t *intervals, uint32_t count);
+void freeBarAggregator(BarAggregator *aggregator);
+
+bool isBarInterval(uint32_t interval);
+
+/* Appends the bars the tick completed to closed. */
+void aggregateTick(BarAggregator *aggregator, const CThostFtdcDepthMarketDataField *pDepthMarketData, std::vector<BarField> *closed);
+bool getOpenBar(BarAggregator *aggregator, const char *instrumentId, uint32_t interval, BarField *bar);
+
+napi_status rtnBar(napi_env env, const Message *message, napi_value *result);
+napi_status getBarValue(napi_env env, const BarField *bar, napi_value *result);
+
+#endif /* __MDBARS_H__ */
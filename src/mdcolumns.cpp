@@ -0,0 +1,202 @@
+/*
+ * mdcolumns.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdcolumns.h"
+#include <stddef.h>
+#include <string.h>
+
+typedef struct DepthColumn {
+  const char *name;
+  size_t offset;
+} DepthColumn;
+
+#define DEPTH_COLUMN(name) {#name, offsetof(CThostFtdcDepthMarketDataField, name)}
+
+static const DepthColumn doubleColumns[] = {
+  DEPTH_COLUMN(LastPrice),
+  DEPTH_COLUMN(PreSettlementPrice),
+  DEPTH_COLUMN(PreClosePrice),
+  DEPTH_COLUMN(PreOpenInterest),
+  DEPTH_COLUMN(OpenPrice),
+  DEPTH_COLUMN(HighestPrice),
+  DEPTH_COLUMN(LowestPrice),
+  DEPTH_COLUMN(Turnover),
+  DEPTH_COLUMN(OpenInterest),
+  DEPTH_COLUMN(ClosePrice),
+  DEPTH_COLUMN(SettlementPrice),
+  DEPTH_COLUMN(UpperLimitPrice),
+  DEPTH_COLUMN(LowerLimitPrice),
+  DEPTH_COLUMN(PreDelta),
+  DEPTH_COLUMN(CurrDelta),
+  DEPTH_COLUMN(BidPrice1),
+  DEPTH_COLUMN(AskPrice1),
+  DEPTH_COLUMN(BidPrice2),
+  DEPTH_COLUMN(AskPrice2),
+  DEPTH_COLUMN(BidPrice3),
+  DEPTH_COLUMN(AskPrice3),
+  DEPTH_COLUMN(BidPrice4),
+  DEPTH_COLUMN(AskPrice4),
+  DEPTH_COLUMN(BidPrice5),
+  DEPTH_COLUMN(AskPrice5),
+  DEPTH_COLUMN(AveragePrice),
+  DEPTH_COLUMN(BandingUpperPrice),
+  DEPTH_COLUMN(BandingLowerPrice),
+};
+
+static const DepthColumn int32Columns[] = {
+  DEPTH_COLUMN(Volume),
+  DEPTH_COLUMN(BidVolume1),
+  DEPTH_COLUMN(AskVolume1),
+  DEPTH_COLUMN(BidVolume2),
+  DEPTH_COLUMN(AskVolume2),
+  DEPTH_COLUMN(BidVolume3),
+  DEPTH_COLUMN(AskVolume3),
+  DEPTH_COLUMN(BidVolume4),
+  DEPTH_COLUMN(AskVolume4),
+  DEPTH_COLUMN(BidVolume5),
+  DEPTH_COLUMN(AskVolume5),
+};
+
+/* Int32 columns computed from the record rather than copied from it. */
+static const char *derivedColumns[] = {"instrument", "ActionDay", "UpdateTime"};
+
+#define DOUBLE_COLUMNS arraysize(doubleColumns)
+#define INT32_COLUMNS (arraysize(derivedColumns) + arraysize(int32Columns))
+#define ROW_BYTES (DOUBLE_COLUMNS * sizeof(double) + INT32_COLUMNS * sizeof(int32_t))
+#define INSTRUMENT_BYTES sizeof(TThostFtdcInstrumentIDType)
+
+static int32_t parseDigits(const char *str, int count) {
+  int32_t value = 0;
+
+  for (int i = 0; i < count; ++i) {
+    if (str[i] < '0' || str[i] > '9')
+      return -1;
+
+    value = value * 10 + (str[i] - '0');
+  }
+
+  return value;
+}
+
+// "yyyymmdd" as a number, 0 when missing.
+static int32_t parseDate(const char *date) {
+  int32_t value = parseDigits(date, 8);
+  return value < 0 ? 0 : value;
+}
+
+// "HH:MM:SS" plus milliseconds as milliseconds since midnight, -1 when missing.
+static int32_t parseTime(const char *time, int millisec) {
+  int32_t hour = parseDigits(time, 2), minute, second;
+
+  if (hour < 0 || time[2] != ':' || (minute = parseDigits(time + 3, 2)) < 0 || time[5] != ':' || (second = parseDigits(time + 6, 2)) < 0)
+    return -1;
+
+  return ((hour * 60 + minute) * 60 + second) * 1000 + millisec;
+}
+
+DepthColumns *packDepthColumns(InstrumentDictionary *dictionary, const MessageBatch *batch) {
+  uint32_t count = batch->count, newInstruments = 0;
+  int32_t firstInstrument = (int32_t)dictionary->indexes.size();
+
+  dynarray(int32_t, instruments, count);
+
+  for (uint32_t i = 0; i < count; ++i) {
+    auto pDepthMarketData = MessageData<CThostFtdcDepthMarketDataField>(&batch->messages[i]);
+    auto iter = dictionary->indexes.emplace(pDepthMarketData->InstrumentID, (int32_t)dictionary->indexes.size());
+
+    instruments[i] = iter.first->second;
+
+    if (iter.second)
+      newInstruments += 1;
+  }
+
+  DepthColumns *columns = (DepthColumns *)allocPayload(sizeof(DepthColumns) + count * ROW_BYTES + newInstruments * INSTRUMENT_BYTES);
+
+  if (!columns)
+    return nullptr;
+
+  columns->count = count;
+  columns->instrumentCount = (uint32_t)dictionary->indexes.size();
+  columns->newInstruments = newInstruments;
+  columns->reserved = 0;
+  columns->timestamp = count > 0 ? batch->messages[0].timestamp : 0;
+  columns->dispatched = 0;
+
+  double *doubles = (double *)(columns + 1);
+  int32_t *int32s = (int32_t *)(doubles + DOUBLE_COLUMNS * count);
+  char *names = (char *)(int32s + INT32_COLUMNS * count);
+
+  for (uint32_t i = 0; i < count; ++i) {
+    auto pDepthMarketData = MessageData<CThostFtdcDepthMarketDataField>(&batch->messages[i]);
+    const char *record = (const char *)pDepthMarketData;
+    int32_t *int32Row = int32s + i;
+
+    for (int c = 0; c < DOUBLE_COLUMNS; ++c)
+      doubles[c * count + i] = *(const double *)(record + doubleColumns[c].offset);
+
+    int32Row[0] = instruments[i];
+    int32Row[count] = parseDate(pDepthMarketData->ActionDay);
+    int32Row[2 * count] = parseTime(pDepthMarketData->UpdateTime, pDepthMarketData->UpdateMillisec);
+
+    for (int c = 0; c < arraysize(int32Columns); ++c)
+      int32Row[(arraysize(derivedColumns) + c) * count] = *(const int32_t *)(record + int32Columns[c].offset);
+
+    if (instruments[i] >= firstInstrument)
+      memcpy(names + (instruments[i] - firstInstrument) * INSTRUMENT_BYTES, pDepthMarketData->InstrumentID, INSTRUMENT_BYTES);
+  }
+
+  return columns;
+}
+
+void freeDepthColumns(DepthColumns *columns) {
+  freePayload(columns);
+}
+
+napi_status getDepthColumnsValue(napi_env env, const DepthColumns *columns, napi_value instruments, napi_value *result) {
+  size_t count = columns->count, offset = 0, bytes = count * ROW_BYTES;
+  const char *names = (const char *)(columns + 1) + bytes;
+  uint32_t firstInstrument = columns->instrumentCount - columns->newInstruments;
+  napi_value buffer, value;
+  void *data;
+
+  CHECK(napi_create_arraybuffer(env, bytes, &data, &buffer));
+  memcpy(data, columns + 1, bytes);
+
+  // The listener's instruments array grows as the dictionary does.
+  for (uint32_t i = 0; i < columns->newInstruments; ++i) {
+    const char *name = names + i * INSTRUMENT_BYTES;
+
+    CHECK(napi_create_string_utf8(env, name, strnlen(name, INSTRUMENT_BYTES), &value));
+    CHECK(napi_set_element(env, instruments, firstInstrument + i, value));
+  }
+
+  DefineObject(object);
+
+  CHECK(objectSetUint32(env, object, "count", columns->count));
+  CHECK(objectSetValue(env, object, "instruments", instruments));
+
+  for (int c = 0; c < DOUBLE_COLUMNS; ++c, offset += count * sizeof(double)) {
+    CHECK(napi_create_typedarray(env, napi_float64_array, count, buffer, offset, &value));
+    CHECK(objectSetValue(env, object, doubleColumns[c].name, value));
+  }
+
+  for (int c = 0; c < arraysize(derivedColumns); ++c, offset += count * sizeof(int32_t)) {
+    CHECK(napi_create_typedarray(env, napi_int32_array, count, buffer, offset, &value));
+    CHECK(objectSetValue(env, object, derivedColumns[c], value));
+  }
+
+  for (int c = 0; c < arraysize(int32Columns); ++c, offset += count * sizeof(int32_t)) {
+    CHECK(napi_create_typedarray(env, napi_int32_array, count, buffer, offset, &value));
+    CHECK(objectSetValue(env, object, int32Columns[c].name, value));
+  }
+
+  return createObject(env, object, result);
+}
@@ -0,0 +1,47 @@
+/*
+ * mdcolumns.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDCOLUMNS_H__
+#define __MDCOLUMNS_H__
+
+#include "napi_ctp.h"
+#include <string>
+#include <unordered_map>
+
+#define DEPTH_COLUMNS_BATCH 256
+
+/* Stable instrument indexes handed out by the dispatch thread. */
+typedef struct InstrumentDictionary {
+  const Listener *owner;
+  std::unordered_map<std::string, int32_t> indexes;
+} InstrumentDictionary;
+
+/*
+ * A batch of depth market data in struct-of-arrays form. The header is
+ * followed by the Float64 columns, the Int32 columns and the instrument IDs
+ * first seen in this batch, each column holds count rows. The timestamp is
+ * the oldest row's, latency is tracked per batch.
+ */
+typedef struct DepthColumns {
+  uint32_t count;
+  uint32_t instrumentCount;
+  uint32_t newInstruments;
+  uint32_t reserved;
+  uint64_t timestamp;
+  uint64_t dispatched;
+} DepthColumns;
+
+DepthColumns *packDepthColumns(InstrumentDictionary *dictionary, const MessageBatch *batch);
+void freeDepthColumns(DepthColumns *columns);
+
+napi_status getDepthColumnsValue(napi_env env, const DepthColumns *columns, napi_value instruments, napi_value *result);
+
+#endif /* __MDCOLUMNS_H__ */
@@ -0,0 +1,118 @@
+/*
+ * mdconflation.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdconflation.h"
+#include "mdspi.h"
+
+Conflation *createConflation() {
+  Conflation *conflation = new Conflation();
+
+  if (!conflation)
+    return nullptr;
+
+  // One reference for the listener, one for its threadsafe function.
+  conflation->refs.store(2, std::memory_order_relaxed);
+  conflation->scheduled = false;
+  conflation->dispatched = 0;
+  conflation->received = 0;
+  conflation->delivered = 0;
+  conflation->conflated = 0;
+
+  uv_mutex_init(&conflation->mutex);
+
+  return conflation;
+}
+
+void releaseConflation(Conflation *conflation) {
+  if (1 != conflation->refs.fetch_sub(1, std::memory_order_acq_rel))
+    return;
+
+  for (auto it = conflation->slots.begin(); it != conflation->slots.end(); ++it)
+    if (it->data)
+      MdSpi::done(*it);
+
+  uv_mutex_destroy(&conflation->mutex);
+  delete conflation;
+}
+
+bool conflateMessage(Conflation *conflation, const Message *message) {
+  auto pDepthMarketData = MessageData<CThostFtdcDepthMarketDataField>(message);
+  Message replaced = {message->event, 0};
+  bool schedule = false;
+
+  uv_mutex_lock(&conflation->mutex);
+
+  auto iter = conflation->indexes.emplace(pDepthMarketData->InstrumentID, (uint32_t)conflation->slots.size());
+
+  if (iter.second)
+    conflation->slots.push_back(replaced);
+
+  Message &slot = conflation->slots[iter.first->second];
+
+  if (slot.data) {
+    replaced = slot;
+    conflation->conflated += 1;
+  } else {
+    conflation->dirty.push_back(iter.first->second);
+  }
+
+  slot = *message;
+  conflation->received += 1;
+
+  if (!conflation->scheduled) {
+    conflation->scheduled = true;
+    conflation->dispatched = uv_hrtime();
+    schedule = true;
+  }
+
+  uv_mutex_unlock(&conflation->mutex);
+
+  if (replaced.data)
+    MdSpi::done(replaced);
+
+  return schedule;
+}
+
+void cancelFlush(Conflation *conflation) {
+  uv_mutex_lock(&conflation->mutex);
+  conflation->scheduled = false;
+  uv_mutex_unlock(&conflation->mutex);
+}
+
+void takeConflated(Conflation *conflation, std::vector<Message> *messages, uint64_t *dispatched) {
+  uv_mutex_lock(&conflation->mutex);
+
+  *dispatched = conflation->dispatched;
+
+  for (auto it = conflation->dirty.begin(); it != conflation->dirty.end(); ++it) {
+    Message &slot = conflation->slots[*it];
+
+    messages->push_back(slot);
+    slot.data = 0;
+  }
+
+  conflation->delivered += conflation->dirty.size();
+  conflation->dirty.clear();
+  conflation->scheduled = false;
+
+  uv_mutex_unlock(&conflation->mutex);
+}
+
+void getConflationStats(Conflation *conflation, ConflationStats *stats) {
+  uv_mutex_lock(&conflation->mutex);
+
+  stats->received = conflation->received;
+  stats->delivered = conflation->delivered;
+  stats->conflated = conflation->conflated;
+  stats->pending = (uint32_t)conflation->dirty.size();
+
+  uv_mutex_unlock(&conflation->mutex);
+}
@@ -0,0 +1,60 @@
+/*
+ * mdconflation.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDCONFLATION_H__
+#define __MDCONFLATION_H__
+
+#include "napi_ctp.h"
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+typedef struct ConflationStats {
+  uint64_t received;
+  uint64_t delivered;
+  uint64_t conflated;
+  uint32_t pending;
+} ConflationStats;
+
+/*
+ * Latest pending tick per instrument.
+ *
+ * The dispatch thread overwrites the slot of an instrument that JS has not
+ * picked up yet and only asks for a flush when the dirty list goes from
+ * empty to non-empty; the JS thread takes the whole dirty list at once. It
+ * is shared by the listener and its threadsafe function, whichever lets go
+ * last frees it.
+ */
+typedef struct Conflation {
+  std::atomic<int> refs;
+  uv_mutex_t mutex;
+  std::unordered_map<std::string, uint32_t> indexes;
+  std::vector<Message> slots;
+  std::vector<uint32_t> dirty;
+  bool scheduled;
+  uint64_t dispatched;
+  uint64_t received;
+  uint64_t delivered;
+  uint64_t conflated;
+} Conflation;
+
+Conflation *createConflation();
+void releaseConflation(Conflation *conflation);
+
+bool conflateMessage(Conflation *conflation, const Message *message);
+void cancelFlush(Conflation *conflation);
+void takeConflated(Conflation *conflation, std::vector<Message> *messages, uint64_t *dispatched);
+
+void getConflationStats(Conflation *conflation, ConflationStats *stats);
+
+#endif /* __MDCONFLATION_H__ */
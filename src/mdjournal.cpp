@@ -0,0 +1,542 @@
+/*
+ * mdjournal.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdjournal.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <chrono>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+enum { HEADER_MISSING = 0, HEADER_INVALID, HEADER_VALID };
+
+static inline uint64_t wallClock() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+#ifdef _WIN32
+
+bool mapJournalFile(JournalFile *file, const char *path, uint64_t size, bool writable) {
+  LARGE_INTEGER length;
+
+  file->file = CreateFileA(path, writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, writable ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (file->file == INVALID_HANDLE_VALUE)
+    return false;
+
+  if (!GetFileSizeEx(file->file, &length) || (!writable && length.QuadPart == 0)) {
+    CloseHandle(file->file);
+    return false;
+  }
+
+  if (!writable || size < (uint64_t)length.QuadPart)
+    size = (uint64_t)length.QuadPart;
+
+  // Mapping a writable view larger than the file extends it.
+  file->mapping = CreateFileMappingA(file->file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, (DWORD)(size >> 32), (DWORD)size, nullptr);
+
+  if (!file->mapping) {
+    CloseHandle(file->file);
+    return false;
+  }
+
+  file->base = (char *)MapViewOfFile(file->mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, (SIZE_T)size);
+
+  if (!file->base) {
+    CloseHandle(file->mapping);
+    CloseHandle(file->file);
+    return false;
+  }
+
+  file->size = size;
+  return true;
+}
+
+void unmapJournalFile(JournalFile *file, uint64_t truncate) {
+  LARGE_INTEGER length;
+
+  UnmapViewOfFile(file->base);
+  CloseHandle(file->mapping);
+
+  if (truncate > 0) {
+    length.QuadPart = (LONGLONG)truncate;
+
+    if (SetFilePointerEx(file->file, length, nullptr, FILE_BEGIN))
+      SetEndOfFile(file->file);
+  }
+
+  CloseHandle(file->file);
+  file->base = nullptr;
+}
+
+#else
+
+bool mapJournalFile(JournalFile *file, const char *path, uint64_t size, bool writable) {
+  struct stat st;
+  int flags = MAP_SHARED;
+
+  file->fd = open(path, writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+
+  if (file->fd < 0)
+    return false;
+
+  if (0 != fstat(file->fd, &st) || (!writable && st.st_size == 0)) {
+    close(file->fd);
+    return false;
+  }
+
+  if (!writable || size < (uint64_t)st.st_size)
+    size = (uint64_t)st.st_size;
+
+  if (writable && size > (uint64_t)st.st_size) {
+#ifdef __linux__
+    // Reserve the blocks now, a full disk must not turn into SIGBUS mid-append.
+    int error = posix_fallocate(file->fd, 0, (off_t)size);
+#else
+    int error = ftruncate(file->fd, (off_t)size);
+#endif
+
+    if (0 != error) {
+      close(file->fd);
+      return false;
+    }
+  }
+
+#ifdef MAP_POPULATE
+  // Fault the pages in up front instead of on the SPI thread's first touch.
+  if (writable)
+    flags |= MAP_POPULATE;
+#endif
+
+  file->base = (char *)mmap(nullptr, (size_t)size, writable ? PROT_READ | PROT_WRITE : PROT_READ, flags, file->fd, 0);
+
+  if (file->base == (char *)MAP_FAILED) {
+    file->base = nullptr;
+    close(file->fd);
+    return false;
+  }
+
+  file->size = size;
+  return true;
+}
+
+void unmapJournalFile(JournalFile *file, uint64_t truncate) {
+  munmap(file->base, (size_t)file->size);
+
+  // Should this fail the file keeps its preallocated tail, readers go by the header's count.
+  if (truncate > 0 && 0 != ftruncate(file->fd, (off_t)truncate))
+    truncate = 0;
+
+  close(file->fd);
+  file->base = nullptr;
+}
+
+#endif
+
+bool isJournalHeader(const JournalHeader *header) {
+  if (0 != memcmp(header->magic, JOURNAL_MAGIC, sizeof(header->magic)) || header->version != JOURNAL_VERSION)
+    return false;
+
+  return header->headerSize == sizeof(JournalHeader) && header->recordSize == sizeof(JournalRecord);
+}
+
+static int readHeader(const char *path, JournalHeader *header) {
+  FILE *fp = fopen(path, "rb");
+  size_t length;
+
+  if (!fp)
+    return HEADER_MISSING;
+
+  length = fread(header, 1, sizeof(JournalHeader), fp);
+  fclose(fp);
+
+  if (length != sizeof(JournalHeader) || !isJournalHeader(header))
+    return HEADER_INVALID;
+
+  return HEADER_VALID;
+}
+
+static void closeFile(JournalFile *file) {
+  const JournalHeader *header = (const JournalHeader *)file->base;
+  uint64_t count = header->count.load(std::memory_order_relaxed);
+
+  unmapJournalFile(file, sizeof(JournalHeader) + count * sizeof(JournalRecord));
+}
+
+// A prepared file nobody wrote to is removed rather than left behind empty.
+static void discardFile(JournalFile *file, const char *path) {
+  const JournalHeader *header = (const JournalHeader *)file->base;
+  bool empty = 0 == header->count.load(std::memory_order_relaxed);
+
+  closeFile(file);
+
+  if (empty)
+    remove(path);
+}
+
+// Resumes the first file of the day that is ours and not full, or starts a new one.
+static bool openFile(const TickJournal *journal, const char *tradingDay, int *sequence, JournalFile *file, char *path, size_t size) {
+  JournalHeader existing;
+
+  for (;; ++*sequence) {
+    snprintf(path, size, "%s/%s.%d.ticks", journal->directory, tradingDay, *sequence);
+
+    int state = readHeader(path, &existing);
+
+    if (state == HEADER_INVALID)
+      continue;
+
+    if (state == HEADER_VALID && (0 != strcmp(existing.tradingDay, tradingDay) || existing.count.load(std::memory_order_relaxed) >= (journal->fileSize - sizeof(JournalHeader)) / sizeof(JournalRecord)))
+      continue;
+
+    if (!mapJournalFile(file, path, journal->fileSize, true))
+      return false;
+
+    JournalHeader *header = (JournalHeader *)file->base;
+
+    if (state == HEADER_MISSING) {
+      memcpy(header->magic, JOURNAL_MAGIC, sizeof(header->magic));
+      header->version = JOURNAL_VERSION;
+      header->headerSize = sizeof(JournalHeader);
+      header->recordSize = sizeof(JournalRecord);
+      header->reserved = 0;
+      strncpy(header->tradingDay, tradingDay, sizeof(header->tradingDay));
+      header->count.store(0, std::memory_order_relaxed);
+      header->created = wallClock();
+      header->padding = 0;
+    }
+
+    return true;
+  }
+}
+
+// Writes the held ticks into the prepared file, outside the lock so that the SPI thread can hold more meanwhile.
+static void flushPending(TickJournal *journal, JournalFile *file, const char *tradingDay) {
+  JournalHeader *header = (JournalHeader *)file->base;
+  JournalRecord *records = (JournalRecord *)(file->base + sizeof(JournalHeader));
+  uint64_t capacity = (file->size - sizeof(JournalHeader)) / sizeof(JournalRecord);
+
+  while (!journal->pending.empty() && 0 == strcmp(tradingDay, journal->requestedDay)) {
+    uint64_t count = header->count.load(std::memory_order_relaxed);
+    size_t length = journal->pending.size();
+
+    if (count >= capacity)
+      break;
+
+    if (length > capacity - count)
+      length = (size_t)(capacity - count);
+
+    journal->pending.swap(journal->flushing);
+
+    uv_mutex_unlock(&journal->mutex);
+
+    memcpy(&records[count], journal->flushing.data(), length * sizeof(JournalRecord));
+    header->count.store(count + length, std::memory_order_release);
+    journal->written.fetch_add(length, std::memory_order_relaxed);
+
+    uv_mutex_lock(&journal->mutex);
+
+    // What did not fit is older than anything held since, unless the day moved on.
+    if (0 == strcmp(tradingDay, journal->requestedDay))
+      journal->pending.insert(journal->pending.begin(), journal->flushing.begin() + length, journal->flushing.end());
+    else
+      journal->failed.fetch_add(journal->flushing.size() - length, std::memory_order_relaxed);
+
+    journal->flushing.clear();
+  }
+}
+
+// Keeps the next file of the requested day open and closes the retired ones.
+static void journalThread(void *data) {
+  TickJournal *journal = (TickJournal *)data;
+  char tradingDay[sizeof(journal->requestedDay)];
+  char path[sizeof(journal->nextPath)];
+  JournalFile file;
+  int sequence;
+
+  uv_mutex_lock(&journal->mutex);
+
+  for (;;) {
+    if (!journal->retired.empty()) {
+      file = journal->retired.back();
+      journal->retired.pop_back();
+
+      uv_mutex_unlock(&journal->mutex);
+      closeFile(&file);
+      uv_mutex_lock(&journal->mutex);
+      continue;
+    }
+
+    // Taking the file clears prepared too, so this one is of a day gone by.
+    if (journal->prepared && (journal->stopping || !journal->ready)) {
+      file = journal->next;
+      memcpy(path, journal->nextPath, sizeof(path));
+      journal->prepared = false;
+
+      uv_mutex_unlock(&journal->mutex);
+      discardFile(&file, path);
+      uv_mutex_lock(&journal->mutex);
+      continue;
+    }
+
+    if (journal->stopping)
+      break;
+
+    if (journal->requestedDay[0] && !journal->failing && !journal->ready) {
+      memcpy(tradingDay, journal->requestedDay, sizeof(tradingDay));
+      sequence = journal->sequence;
+
+      uv_mutex_unlock(&journal->mutex);
+      bool opened = openFile(journal, tradingDay, &sequence, &file, path, sizeof(path));
+      uv_mutex_lock(&journal->mutex);
+
+      if (opened)
+        flushPending(journal, &file, tradingDay);
+
+      // The SPI thread moved on to another day meanwhile.
+      if (0 != strcmp(tradingDay, journal->requestedDay)) {
+        if (opened) {
+          uv_mutex_unlock(&journal->mutex);
+          discardFile(&file, path);
+          uv_mutex_lock(&journal->mutex);
+        }
+        continue;
+      }
+
+      // Held ticks filled it, the rest go to the one after without waiting for another tick.
+      if (opened && !journal->pending.empty()) {
+        journal->sequence = sequence + 1;
+        journal->files.fetch_add(1, std::memory_order_relaxed);
+
+        uv_mutex_unlock(&journal->mutex);
+        closeFile(&file);
+        uv_mutex_lock(&journal->mutex);
+        continue;
+      }
+
+      if (opened) {
+        journal->next = file;
+        memcpy(journal->nextPath, path, sizeof(path));
+        journal->prepared = true;
+        journal->sequence = sequence + 1;
+      } else {
+        // A failed open is retried on the next trading day, not on every tick.
+        journal->failing = true;
+        journal->failed.fetch_add(journal->pending.size(), std::memory_order_relaxed);
+        journal->pending.clear();
+      }
+
+      journal->ready = true;
+      continue;
+    }
+
+    uv_cond_wait(&journal->cond, &journal->mutex);
+  }
+
+  uv_mutex_unlock(&journal->mutex);
+}
+
+// The caller holds the mutex, the writer thread unmaps and truncates it.
+static void retireFile(TickJournal *journal) {
+  if (!journal->header)
+    return;
+
+  journal->retired.push_back(journal->file);
+  journal->header = nullptr;
+  journal->records = nullptr;
+}
+
+// The caller holds the mutex, the writer then prepares the file after this one.
+static void takeNextFile(TickJournal *journal) {
+  retireFile(journal);
+
+  if (journal->prepared) {
+    journal->file = journal->next;
+    journal->prepared = false;
+    journal->header = (JournalHeader *)journal->file.base;
+    journal->records = (JournalRecord *)(journal->file.base + sizeof(JournalHeader));
+    journal->capacity = (journal->file.size - sizeof(JournalHeader)) / sizeof(JournalRecord);
+    journal->files.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    journal->exhausted = true;
+  }
+
+  journal->ready = false;
+  uv_cond_signal(&journal->cond);
+}
+
+static void startTradingDay(TickJournal *journal, const char *tradingDay, size_t length) {
+  strncpy(journal->tradingDay, tradingDay, length);
+  journal->tradingDay[length] = 0;
+  journal->exhausted = false;
+
+  uv_mutex_lock(&journal->mutex);
+
+  // Ticks of the previous day still waiting for a file get none.
+  journal->failed.fetch_add(journal->pending.size(), std::memory_order_relaxed);
+  journal->pending.clear();
+
+  retireFile(journal);
+  memcpy(journal->requestedDay, journal->tradingDay, sizeof(journal->requestedDay));
+  journal->sequence = 0;
+  journal->failing = false;
+  journal->ready = false;
+
+  uv_cond_signal(&journal->cond);
+  uv_mutex_unlock(&journal->mutex);
+}
+
+// The file is full or not there yet, swaps in the next one or holds the tick for it.
+static void appendSlow(TickJournal *journal, uint64_t timestamp, const CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  JournalRecord *record = nullptr;
+  uint64_t count = 0;
+  bool held = false;
+
+  uv_mutex_lock(&journal->mutex);
+
+  if (journal->ready)
+    takeNextFile(journal);
+
+  if (journal->header && journal->pending.empty())
+    count = journal->header->count.load(std::memory_order_relaxed);
+
+  if (journal->header && journal->pending.empty() && count < journal->capacity) {
+    record = &journal->records[count];
+  } else if (!journal->exhausted && journal->tradingDay[0] && journal->pending.size() < JOURNAL_PENDING_MAX) {
+    journal->pending.emplace_back();
+    record = &journal->pending.back();
+    held = true;
+  }
+
+  if (record) {
+    record->timestamp = timestamp;
+    memcpy(&record->data, pDepthMarketData, sizeof(CThostFtdcDepthMarketDataField));
+  } else {
+    journal->failed.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (record && !held) {
+    journal->header->count.store(count + 1, std::memory_order_release);
+    journal->written.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uv_mutex_unlock(&journal->mutex);
+}
+
+TickJournal *createTickJournal(const char *directory, uint32_t fileSizeMB) {
+  TickJournal *journal;
+  struct stat st;
+  size_t length = strlen(directory);
+
+  if (length == 0 || length >= JOURNAL_PATH_MAX || fileSizeMB == 0)
+    return nullptr;
+
+  if (0 != stat(directory, &st) || (st.st_mode & S_IFMT) != S_IFDIR)
+    return nullptr;
+
+  journal = new TickJournal();
+
+  if (!journal)
+    return nullptr;
+
+  memcpy(journal->directory, directory, length + 1);
+
+  while (length > 1 && (journal->directory[length - 1] == '/' || journal->directory[length - 1] == '\\'))
+    journal->directory[--length] = 0;
+
+  journal->tradingDay[0] = 0;
+  journal->fileSize = (uint64_t)fileSizeMB << 20;
+  journal->capacity = 0;
+  journal->exhausted = false;
+  journal->header = nullptr;
+  journal->records = nullptr;
+  journal->requestedDay[0] = 0;
+  journal->sequence = 0;
+  journal->prepared = false;
+  journal->failing = false;
+  journal->stopping = false;
+  journal->nextPath[0] = 0;
+  journal->ready = false;
+  journal->written.store(0, std::memory_order_relaxed);
+  journal->failed.store(0, std::memory_order_relaxed);
+  journal->files.store(0, std::memory_order_relaxed);
+
+  // Growing them would take the address space lock the writer's mmap holds.
+  journal->pending.reserve(JOURNAL_PENDING_MAX);
+  journal->flushing.reserve(JOURNAL_PENDING_MAX);
+
+  uv_mutex_init(&journal->mutex);
+  uv_cond_init(&journal->cond);
+
+  if (0 != uv_thread_create(&journal->thread, journalThread, journal)) {
+    uv_cond_destroy(&journal->cond);
+    uv_mutex_destroy(&journal->mutex);
+    delete journal;
+    return nullptr;
+  }
+
+  return journal;
+}
+
+void closeTickJournal(TickJournal *journal) {
+  uv_mutex_lock(&journal->mutex);
+
+  retireFile(journal);
+  journal->stopping = true;
+
+  uv_cond_signal(&journal->cond);
+  uv_mutex_unlock(&journal->mutex);
+
+  uv_thread_join(&journal->thread);
+
+  uv_cond_destroy(&journal->cond);
+  uv_mutex_destroy(&journal->mutex);
+
+  delete journal;
+}
+
+void appendTick(TickJournal *journal, const CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  uint64_t timestamp = wallClock();
+  const char *tradingDay = pDepthMarketData->TradingDay[0] ? pDepthMarketData->TradingDay : pDepthMarketData->ActionDay;
+
+  if (tradingDay[0] && 0 != strncmp(tradingDay, journal->tradingDay, sizeof(pDepthMarketData->TradingDay)))
+    startTradingDay(journal, tradingDay, sizeof(pDepthMarketData->TradingDay));
+
+  if (!journal->header || journal->header->count.load(std::memory_order_relaxed) >= journal->capacity) {
+    if (journal->exhausted)
+      journal->failed.fetch_add(1, std::memory_order_relaxed);
+    else
+      appendSlow(journal, timestamp, pDepthMarketData);
+    return;
+  }
+
+  uint64_t count = journal->header->count.load(std::memory_order_relaxed);
+  JournalRecord *record = &journal->records[count];
+
+  record->timestamp = timestamp;
+  memcpy(&record->data, pDepthMarketData, sizeof(CThostFtdcDepthMarketDataField));
+
+  journal->header->count.store(count + 1, std::memory_order_release);
+  journal->written.fetch_add(1, std::memory_order_relaxed);
+}
+
+void getJournalStats(TickJournal *journal, JournalStats *stats) {
+  stats->records = journal->written.load(std::memory_order_relaxed);
+  stats->failed = journal->failed.load(std::memory_order_relaxed);
+  stats->files = journal->files.load(std::memory_order_relaxed);
+}
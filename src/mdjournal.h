@@ -0,0 +1,115 @@
+/*
+ * mdjournal.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDJOURNAL_H__
+#define __MDJOURNAL_H__
+
+#include "napi_ctp.h"
+#include <atomic>
+#include <vector>
+#include <uv.h>
+
+#define JOURNAL_MAGIC "NCTPTICK"
+#define JOURNAL_VERSION 1
+#define JOURNAL_FILE_SIZE 256 /* MB */
+#define JOURNAL_PATH_MAX 260
+#define JOURNAL_PENDING_MAX 16384 /* ticks held while the first file of a day opens */
+
+/*
+ * One file per trading day, <TradingDay>.<n>.ticks, n counts up when a file
+ * fills. The header is followed by count records; count is published after
+ * the record is written, so a reader never sees a torn one.
+ */
+typedef struct JournalHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t headerSize;
+  uint32_t recordSize;
+  uint32_t reserved;
+  char tradingDay[16];
+  std::atomic<uint64_t> count;
+  uint64_t created;
+  uint64_t padding;
+} JournalHeader;
+
+/* The tick as CTP delivered it, stamped with the local receive time (ns since the Unix epoch). */
+typedef struct JournalRecord {
+  uint64_t timestamp;
+  CThostFtdcDepthMarketDataField data;
+} JournalRecord;
+
+static_assert(sizeof(JournalHeader) == 64, "JournalHeader must stay 64 bytes");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "The journal count must be lock free to live in a mapping");
+
+typedef struct JournalFile {
+#ifdef _WIN32
+  void *file;
+  void *mapping;
+#else
+  int fd;
+#endif
+  char *base;
+  uint64_t size;
+} JournalFile;
+
+typedef struct JournalStats {
+  uint64_t records;
+  uint64_t failed;
+  uint32_t files;
+} JournalStats;
+
+/*
+ * The recorder of a MarketData. Only the SPI thread appends, the writer
+ * thread opens each file before it is needed and closes the full ones, so
+ * a tick never waits on the disk; the two swap files under the mutex. Ticks
+ * that come before a file is ready are held in pending, the writer writes
+ * them into that file before it hands it over. The counters are read from
+ * the JS thread.
+ */
+typedef struct TickJournal {
+  char directory[JOURNAL_PATH_MAX];
+  char tradingDay[16];
+  uint64_t fileSize;
+  uint64_t capacity;
+  bool exhausted;
+  JournalFile file;
+  JournalHeader *header;
+  JournalRecord *records;
+  uv_thread_t thread;
+  uv_mutex_t mutex;
+  uv_cond_t cond;
+  char requestedDay[16];
+  int sequence;
+  bool prepared;
+  bool failing;
+  bool stopping;
+  JournalFile next;
+  char nextPath[JOURNAL_PATH_MAX + 32];
+  bool ready;
+  std::vector<JournalRecord> pending;
+  std::vector<JournalRecord> flushing;
+  std::vector<JournalFile> retired;
+  std::atomic<uint64_t> written;
+  std::atomic<uint64_t> failed;
+  std::atomic<uint32_t> files;
+} TickJournal;
+
+TickJournal *createTickJournal(const char *directory, uint32_t fileSizeMB);
+void closeTickJournal(TickJournal *journal);
+
+void appendTick(TickJournal *journal, const CThostFtdcDepthMarketDataField *pDepthMarketData);
+void getJournalStats(TickJournal *journal, JournalStats *stats);
+
+bool isJournalHeader(const JournalHeader *header);
+bool mapJournalFile(JournalFile *file, const char *path, uint64_t size, bool writable);
+void unmapJournalFile(JournalFile *file, uint64_t truncate);
+
+#endif /* __MDJOURNAL_H__ */
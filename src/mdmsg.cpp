@@ -10,26 +10,30 @@
  */
 
 #include "mdmsg.h"
+#include "mdbars.h"
 #include "mdspi.h"
 #include "ctpmsg.h"
 
-static const MessageFuncs messageFuncs = {
-    {EM_QUIT,                       msgQuit},
-    {EM_FRONTCONNECTED,             msgFrontConnected},
-    {EM_FRONTDISCONNECTED,          msgFrontDisconnected},
-    {EM_HEARTBEATWARNING,           msgHeartBeatWarning},
-    {EM_RSPUSERLOGIN,               rspUserLogin},
-    {EM_RSPUSERLOGOUT,              rspUserLogout},
-    {EM_RSPQRYMULTICASTINSTRUMENT,  rspQryMulticastInstrument},
-    {EM_RSPERROR,                   rspError},
-    {EM_RSPSUBMARKETDATA,           rspSubMarketData},
-    {EM_RSPUNSUBMARKETDATA,         rspUnSubMarketData},
-    {EM_RSPSUBFORQUOTERSP,          rspSubForQuote},
-    {EM_RSPUNSUBFORQUOTERSP,        rspUnSubForQuote},
-    {EM_RTNDEPTHMARKETDATA,         rtnDepthMarketData},
-    {EM_RTNFORQUOTERSP,             rtnForQuote},
+static constexpr MessageFunc messageFuncs[] = {
+    {EM_QUIT,                       msgQuit, nullptr, 0},
+    {EM_FRONTCONNECTED,             msgFrontConnected, nullptr, 0},
+    {EM_FRONTDISCONNECTED,          msgFrontDisconnected, nullptr, 0},
+    {EM_HEARTBEATWARNING,           msgHeartBeatWarning, nullptr, 0},
+    {EM_RSPUSERLOGIN,               CTP_MESSAGE(rspUserLogin)},
+    {EM_RSPUSERLOGOUT,              CTP_MESSAGE(rspUserLogout)},
+    {EM_RSPQRYMULTICASTINSTRUMENT,  CTP_MESSAGE(rspQryMulticastInstrument)},
+    {EM_RSPERROR,                   CTP_MESSAGE(rspError)},
+    {EM_RSPSUBMARKETDATA,           CTP_MESSAGE(rspSubMarketData)},
+    {EM_RSPUNSUBMARKETDATA,         CTP_MESSAGE(rspUnSubMarketData)},
+    {EM_RSPSUBFORQUOTERSP,          CTP_MESSAGE(rspSubForQuote)},
+    {EM_RSPUNSUBFORQUOTERSP,        CTP_MESSAGE(rspUnSubForQuote)},
+    {EM_RTNDEPTHMARKETDATA,         CTP_MESSAGE(rtnDepthMarketData)},
+    {EM_RTNFORQUOTERSP,             CTP_MESSAGE(rtnForQuote)},
+    {EM_RTNBAR,                     rtnBar, nullptr, 0},
 };
 
-napi_status getMarketDataMessageValue(napi_env env, const Message *message, napi_value *result) {
-  return getMessageValue(env, messageFuncs, message, result);
+static_assert(arraysize(messageFuncs) == EM_COUNT && isEventTable(messageFuncs, EM_BASE), "messageFuncs must follow the EM_* order");
+
+napi_status getMarketDataMessageValue(napi_env env, const Message *message, int delivery, napi_value *result) {
+  return getMessageValue(env, messageFuncs, EM_BASE, EM_COUNT, message, delivery, result);
 }
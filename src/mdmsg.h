@@ -14,6 +14,6 @@
 
 #include "napi_ctp.h"
 
-napi_status getMarketDataMessageValue(napi_env env, const Message *message, napi_value *result);
+napi_status getMarketDataMessageValue(napi_env env, const Message *message, int delivery, napi_value *result);
 
 #endif /* __MDMSG_H__ */
@@ -0,0 +1,401 @@
+/*
+ * mdreplay.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdreplay.h"
+#include <stdio.h>
+#include <string.h>
+
+enum { REPLAY_SUBSCRIBE = 0, REPLAY_UNSUBSCRIBE, REPLAY_SUBSCRIBE_QUOTE, REPLAY_UNSUBSCRIBE_QUOTE };
+
+#define REPLAY_ALL "*"
+#define REPLAY_CONNECT_DELAY 10 /* ms */
+
+static bool readHeader(const char *path, JournalHeader *header) {
+  FILE *fp = fopen(path, "rb");
+  size_t length;
+
+  if (!fp)
+    return false;
+
+  length = fread(header, 1, sizeof(JournalHeader), fp);
+  fclose(fp);
+
+  return length == sizeof(JournalHeader) && isJournalHeader(header);
+}
+
+bool MdReplayApi::checkFiles(const std::vector<std::string> &files, char *error, size_t size) {
+  JournalHeader header;
+
+  if (files.empty()) {
+    snprintf(error, size, "No tick journal to replay");
+    return false;
+  }
+
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    if (!readHeader(it->c_str(), &header)) {
+      snprintf(error, size, "%s is not a tick journal", it->c_str());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+MdReplayApi::MdReplayApi(const std::vector<std::string> &files, double speed)
+    : _files(files), _speed(speed), _spi(nullptr), _pending(0), _version(0), _initialized(false), _started(false), _stopping(false),
+      _playingVersion(0), _playingAll(false), _wallStart(0), _virtualStart(0), _total(0), _played(0), _clock(0), _finished(false) {
+  JournalHeader header;
+  uint64_t total = 0;
+
+  memset(_tradingDay, 0, sizeof(_tradingDay));
+
+  for (auto it = _files.begin(); it != _files.end(); ++it) {
+    if (!readHeader(it->c_str(), &header))
+      continue;
+
+    if (!_tradingDay[0])
+      memcpy(_tradingDay, header.tradingDay, sizeof(_tradingDay) - 1);
+
+    total += header.count.load(std::memory_order_relaxed);
+  }
+
+  _total.store(total, std::memory_order_relaxed);
+
+  uv_mutex_init(&_mutex);
+  uv_cond_init(&_cond);
+}
+
+MdReplayApi::~MdReplayApi() {
+  uv_cond_destroy(&_cond);
+  uv_mutex_destroy(&_mutex);
+}
+
+void MdReplayApi::getReplayStats(ReplayStats *stats) {
+  stats->total = _total.load(std::memory_order_relaxed);
+  stats->played = _played.load(std::memory_order_relaxed);
+  stats->clock = _clock.load(std::memory_order_relaxed);
+  stats->finished = _finished.load(std::memory_order_acquire);
+}
+
+void MdReplayApi::Release() {
+  uv_mutex_lock(&_mutex);
+  _stopping.store(true, std::memory_order_relaxed);
+  uv_cond_signal(&_cond);
+  uv_mutex_unlock(&_mutex);
+
+  if (_initialized)
+    uv_thread_join(&_thread);
+
+  delete this;
+}
+
+void MdReplayApi::Init() {
+  if (!_initialized)
+    _initialized = 0 == uv_thread_create(&_thread, replayThread, this);
+}
+
+int MdReplayApi::Join() {
+  if (_initialized)
+    uv_thread_join(&_thread);
+
+  _initialized = false;
+  return 0;
+}
+
+const char *MdReplayApi::GetTradingDay() {
+  return _tradingDay;
+}
+
+void MdReplayApi::RegisterFront(char *pszFrontAddress) {}
+
+void MdReplayApi::RegisterNameServer(char *pszNsAddress) {}
+
+void MdReplayApi::RegisterFensUserInfo(CThostFtdcFensUserInfoField *pFensUserInfo) {}
+
+void MdReplayApi::RegisterSpi(CThostFtdcMdSpi *pSpi) {
+  _spi.store(pSpi, std::memory_order_release);
+}
+
+int MdReplayApi::SubscribeMarketData(char *ppInstrumentID[], int nCount) {
+  return subscribe(ppInstrumentID, nCount, REPLAY_SUBSCRIBE);
+}
+
+int MdReplayApi::UnSubscribeMarketData(char *ppInstrumentID[], int nCount) {
+  return subscribe(ppInstrumentID, nCount, REPLAY_UNSUBSCRIBE);
+}
+
+int MdReplayApi::SubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+  return subscribe(ppInstrumentID, nCount, REPLAY_SUBSCRIBE_QUOTE);
+}
+
+int MdReplayApi::UnSubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+  return subscribe(ppInstrumentID, nCount, REPLAY_UNSUBSCRIBE_QUOTE);
+}
+
+int MdReplayApi::ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID) {
+  CThostFtdcRspUserLoginField rspUserLogin;
+
+  memset(&rspUserLogin, 0, sizeof(rspUserLogin));
+  memcpy(rspUserLogin.TradingDay, _tradingDay, sizeof(rspUserLogin.TradingDay) - 1);
+  snprintf(rspUserLogin.BrokerID, sizeof(rspUserLogin.BrokerID), "%s", pReqUserLoginField->BrokerID);
+  snprintf(rspUserLogin.UserID, sizeof(rspUserLogin.UserID), "%s", pReqUserLoginField->UserID);
+  snprintf(rspUserLogin.SystemName, sizeof(rspUserLogin.SystemName), "%s", "Replay");
+
+  post([rspUserLogin, nRequestID](CThostFtdcMdSpi *spi) mutable {
+    CThostFtdcRspInfoField rspInfo;
+
+    memset(&rspInfo, 0, sizeof(rspInfo));
+    spi->OnRspUserLogin(&rspUserLogin, &rspInfo, nRequestID, true);
+  });
+
+  return 0;
+}
+
+int MdReplayApi::ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID) {
+  CThostFtdcUserLogoutField userLogout = *pUserLogout;
+
+  post([userLogout, nRequestID](CThostFtdcMdSpi *spi) mutable {
+    CThostFtdcRspInfoField rspInfo;
+
+    memset(&rspInfo, 0, sizeof(rspInfo));
+    spi->OnRspUserLogout(&userLogout, &rspInfo, nRequestID, true);
+  });
+
+  return 0;
+}
+
+int MdReplayApi::ReqQryMulticastInstrument(CThostFtdcQryMulticastInstrumentField *pQryMulticastInstrument, int nRequestID) {
+  post([nRequestID](CThostFtdcMdSpi *spi) {
+    CThostFtdcRspInfoField rspInfo;
+
+    memset(&rspInfo, 0, sizeof(rspInfo));
+    spi->OnRspQryMulticastInstrument(nullptr, &rspInfo, nRequestID, true);
+  });
+
+  return 0;
+}
+
+void MdReplayApi::replayThread(void *data) {
+  ((MdReplayApi *)data)->run();
+}
+
+void MdReplayApi::run() {
+  uint64_t connected = uv_hrtime() + REPLAY_CONNECT_DELAY * 1000000ull;
+
+  // Like a live front, connect a moment later so the listeners are in place.
+  while (uv_hrtime() < connected)
+    if (!serve(connected))
+      return;
+
+  CThostFtdcMdSpi *spi = _spi.load(std::memory_order_acquire);
+
+  if (spi)
+    spi->OnFrontConnected();
+
+  // Nothing is played until the first subscription, as with a live front.
+  while (!_started.load(std::memory_order_acquire))
+    if (!serve(UINT64_MAX))
+      return;
+
+  for (auto it = _files.begin(); it != _files.end(); ++it)
+    if (!play(it->c_str()))
+      return;
+
+  _finished.store(true, std::memory_order_release);
+  spi = _spi.load(std::memory_order_acquire);
+
+  if (spi)
+    spi->OnFrontDisconnected(REPLAY_FINISHED);
+
+  while (serve(UINT64_MAX))
+    ;
+}
+
+bool MdReplayApi::play(const char *path) {
+  JournalFile file;
+  uint64_t count;
+
+  if (!mapJournalFile(&file, path, 0, false))
+    return true;
+
+  const JournalHeader *header = (const JournalHeader *)file.base;
+
+  if (file.size < sizeof(JournalHeader) || !isJournalHeader(header)) {
+    unmapJournalFile(&file, 0);
+    return true;
+  }
+
+  // A journal still being written is played up to where it was on open.
+  count = header->count.load(std::memory_order_acquire);
+
+  if (count > (file.size - sizeof(JournalHeader)) / sizeof(JournalRecord))
+    count = (file.size - sizeof(JournalHeader)) / sizeof(JournalRecord);
+
+  const JournalRecord *records = (const JournalRecord *)(file.base + sizeof(JournalHeader));
+
+  for (uint64_t i = 0; i < count; ++i) {
+    const JournalRecord *record = &records[i];
+
+    if (_pending.load(std::memory_order_relaxed) > 0 || _stopping.load(std::memory_order_relaxed)) {
+      if (!serve(0)) {
+        unmapJournalFile(&file, 0);
+        return false;
+      }
+    }
+
+    if (_playingVersion != _version.load(std::memory_order_acquire)) {
+      uv_mutex_lock(&_mutex);
+      _playing = _subscribed;
+      _playingVersion = _version.load(std::memory_order_relaxed);
+      uv_mutex_unlock(&_mutex);
+
+      _playingAll = _playing.count(REPLAY_ALL) > 0;
+    }
+
+    if (!_playingAll && _playing.count(record->data.InstrumentID) == 0)
+      continue;
+
+    if (_speed > 0) {
+      if (_wallStart == 0) {
+        _wallStart = uv_hrtime();
+        _virtualStart = record->timestamp;
+      }
+
+      uint64_t offset = record->timestamp > _virtualStart ? record->timestamp - _virtualStart : 0;
+      uint64_t due = _wallStart + (uint64_t)(offset / _speed);
+
+      while (uv_hrtime() < due) {
+        if (!serve(due)) {
+          unmapJournalFile(&file, 0);
+          return false;
+        }
+      }
+    }
+
+    CThostFtdcMdSpi *spi = _spi.load(std::memory_order_acquire);
+
+    _clock.store(record->timestamp, std::memory_order_relaxed);
+
+    // The spi only copies the tick, the read-only mapping is never written.
+    if (spi)
+      spi->OnRtnDepthMarketData((CThostFtdcDepthMarketDataField *)&record->data);
+
+    _played.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  unmapJournalFile(&file, 0);
+  return true;
+}
+
+// Answers the queued requests, then waits once for more until the deadline (uv_hrtime() ns).
+bool MdReplayApi::serve(uint64_t deadline) {
+  uv_mutex_lock(&_mutex);
+
+  for (int round = 0; round < 2; ++round) {
+    while (!_requests.empty()) {
+      Request request = std::move(_requests.front());
+
+      _requests.pop();
+      _pending.fetch_sub(1, std::memory_order_relaxed);
+
+      uv_mutex_unlock(&_mutex);
+
+      CThostFtdcMdSpi *spi = _spi.load(std::memory_order_acquire);
+
+      if (spi)
+        request(spi);
+
+      uv_mutex_lock(&_mutex);
+    }
+
+    if (_stopping.load(std::memory_order_relaxed) || round > 0)
+      break;
+
+    uint64_t now = uv_hrtime();
+
+    if (now >= deadline)
+      break;
+
+    if (deadline == UINT64_MAX)
+      uv_cond_wait(&_cond, &_mutex);
+    else
+      uv_cond_timedwait(&_cond, &_mutex, deadline - now);
+  }
+
+  bool running = !_stopping.load(std::memory_order_relaxed);
+
+  uv_mutex_unlock(&_mutex);
+  return running;
+}
+
+void MdReplayApi::post(Request request) {
+  uv_mutex_lock(&_mutex);
+
+  _requests.push(std::move(request));
+  _pending.fetch_add(1, std::memory_order_relaxed);
+
+  uv_cond_signal(&_cond);
+  uv_mutex_unlock(&_mutex);
+}
+
+int MdReplayApi::subscribe(char *ppInstrumentID[], int nCount, int kind) {
+  std::vector<std::string> instrumentIds(ppInstrumentID, ppInstrumentID + nCount);
+
+  if (kind == REPLAY_SUBSCRIBE || kind == REPLAY_UNSUBSCRIBE) {
+    uv_mutex_lock(&_mutex);
+
+    for (auto it = instrumentIds.begin(); it != instrumentIds.end(); ++it) {
+      if (kind == REPLAY_SUBSCRIBE)
+        _subscribed.insert(*it);
+      else
+        _subscribed.erase(*it);
+    }
+
+    _version.fetch_add(1, std::memory_order_release);
+    uv_mutex_unlock(&_mutex);
+  }
+
+  post([instrumentIds, kind](CThostFtdcMdSpi *spi) {
+    CThostFtdcSpecificInstrumentField specificInstrument;
+    CThostFtdcRspInfoField rspInfo;
+
+    memset(&rspInfo, 0, sizeof(rspInfo));
+
+    for (size_t i = 0; i < instrumentIds.size(); ++i) {
+      bool isLast = i + 1 == instrumentIds.size();
+
+      memset(&specificInstrument, 0, sizeof(specificInstrument));
+      snprintf(specificInstrument.InstrumentID, sizeof(specificInstrument.InstrumentID), "%s", instrumentIds[i].c_str());
+
+      switch (kind) {
+      case REPLAY_SUBSCRIBE:
+        spi->OnRspSubMarketData(&specificInstrument, &rspInfo, 0, isLast);
+        break;
+      case REPLAY_UNSUBSCRIBE:
+        spi->OnRspUnSubMarketData(&specificInstrument, &rspInfo, 0, isLast);
+        break;
+      case REPLAY_SUBSCRIBE_QUOTE:
+        spi->OnRspSubForQuoteRsp(&specificInstrument, &rspInfo, 0, isLast);
+        break;
+      default:
+        spi->OnRspUnSubForQuoteRsp(&specificInstrument, &rspInfo, 0, isLast);
+        break;
+      }
+    }
+  });
+
+  // Playing starts once the first subscription has been answered.
+  if (kind == REPLAY_SUBSCRIBE && nCount > 0 && !_started.load(std::memory_order_relaxed)) {
+    post([this](CThostFtdcMdSpi *spi) { _started.store(true, std::memory_order_release); });
+  }
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * mdreplay.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDREPLAY_H__
+#define __MDREPLAY_H__
+
+#include "mdjournal.h"
+#include <atomic>
+#include <functional>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <uv.h>
+
+/* The reason of the front-disconnected that ends a replay. */
+#define REPLAY_FINISHED 0
+
+typedef struct ReplayStats {
+  uint64_t total;
+  uint64_t played;
+  uint64_t clock;
+  bool finished;
+} ReplayStats;
+
+/*
+ * Plays tick journals back through the CThostFtdcMdApi interface, so a
+ * MarketData fed by it dispatches exactly as a live one does.
+ *
+ * Like CTP it answers on its own thread: front-connected on Init(), login
+ * and (un)subscribe responses in order, then the subscribed instruments'
+ * ticks from the first subscription on, and front-disconnected with
+ * REPLAY_FINISHED after the last file. The virtual clock is the recorded
+ * receive time of the latest tick played; a speed of 1 paces ticks as they
+ * were received, N plays N times faster and 0 as fast as the queue takes
+ * them. What is played never depends on the speed.
+ */
+class MdReplayApi : public CThostFtdcMdApi {
+public:
+  static bool checkFiles(const std::vector<std::string> &files, char *error, size_t size);
+
+  MdReplayApi(const std::vector<std::string> &files, double speed);
+
+  void getReplayStats(ReplayStats *stats);
+
+public:
+  virtual void Release();
+  virtual void Init();
+  virtual int Join();
+  virtual const char *GetTradingDay();
+
+  virtual void RegisterFront(char *pszFrontAddress);
+  virtual void RegisterNameServer(char *pszNsAddress);
+  virtual void RegisterFensUserInfo(CThostFtdcFensUserInfoField *pFensUserInfo);
+  virtual void RegisterSpi(CThostFtdcMdSpi *pSpi);
+
+  virtual int SubscribeMarketData(char *ppInstrumentID[], int nCount);
+  virtual int UnSubscribeMarketData(char *ppInstrumentID[], int nCount);
+  virtual int SubscribeForQuoteRsp(char *ppInstrumentID[], int nCount);
+  virtual int UnSubscribeForQuoteRsp(char *ppInstrumentID[], int nCount);
+
+  virtual int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField, int nRequestID);
+  virtual int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout, int nRequestID);
+  virtual int ReqQryMulticastInstrument(CThostFtdcQryMulticastInstrumentField *pQryMulticastInstrument, int nRequestID);
+
+private:
+  typedef std::function<void(CThostFtdcMdSpi *spi)> Request;
+
+  virtual ~MdReplayApi();
+
+  static void replayThread(void *data);
+
+  void run();
+  bool play(const char *path);
+  bool serve(uint64_t deadline);
+  void post(Request request);
+  int subscribe(char *ppInstrumentID[], int nCount, int kind);
+
+private:
+  std::vector<std::string> _files;
+  double _speed;
+  char _tradingDay[16];
+  std::atomic<CThostFtdcMdSpi *> _spi;
+
+  uv_thread_t _thread;
+  uv_mutex_t _mutex;
+  uv_cond_t _cond;
+  std::queue<Request> _requests;
+  std::atomic<int> _pending;
+  std::unordered_set<std::string> _subscribed;
+  std::atomic<uint32_t> _version;
+  bool _initialized;
+  std::atomic<bool> _started;
+  std::atomic<bool> _stopping;
+
+  // Owned by the replay thread.
+  std::unordered_set<std::string> _playing;
+  uint32_t _playingVersion;
+  bool _playingAll;
+  uint64_t _wallStart;
+  uint64_t _virtualStart;
+  std::atomic<uint64_t> _total;
+  std::atomic<uint64_t> _played;
+  std::atomic<uint64_t> _clock;
+  std::atomic<bool> _finished;
+};
+
+#endif /* __MDREPLAY_H__ */
@@ -0,0 +1,229 @@
+/*
+ * mdsnapshot.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "mdsnapshot.h"
+#include <stddef.h>
+#include <string.h>
+#include <thread>
+
+enum { FIELD_STRING = 0, FIELD_DOUBLE, FIELD_INT32 };
+
+typedef struct SnapshotField {
+  const char *name;
+  size_t offset;
+  int type;
+} SnapshotField;
+
+#define SNAPSHOT_FIELD(name, type) {#name, offsetof(CThostFtdcDepthMarketDataField, name), type}
+
+static const SnapshotField snapshotFields[] = {
+  SNAPSHOT_FIELD(TradingDay, FIELD_STRING),
+  SNAPSHOT_FIELD(ExchangeID, FIELD_STRING),
+  SNAPSHOT_FIELD(LastPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(PreSettlementPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(PreClosePrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(PreOpenInterest, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(OpenPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(HighestPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(LowestPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(Volume, FIELD_INT32),
+  SNAPSHOT_FIELD(Turnover, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(OpenInterest, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(ClosePrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(SettlementPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(UpperLimitPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(LowerLimitPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(PreDelta, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(CurrDelta, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(UpdateTime, FIELD_STRING),
+  SNAPSHOT_FIELD(UpdateMillisec, FIELD_INT32),
+  SNAPSHOT_FIELD(BidPrice1, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BidVolume1, FIELD_INT32),
+  SNAPSHOT_FIELD(AskPrice1, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(AskVolume1, FIELD_INT32),
+  SNAPSHOT_FIELD(BidPrice2, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BidVolume2, FIELD_INT32),
+  SNAPSHOT_FIELD(AskPrice2, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(AskVolume2, FIELD_INT32),
+  SNAPSHOT_FIELD(BidPrice3, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BidVolume3, FIELD_INT32),
+  SNAPSHOT_FIELD(AskPrice3, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(AskVolume3, FIELD_INT32),
+  SNAPSHOT_FIELD(BidPrice4, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BidVolume4, FIELD_INT32),
+  SNAPSHOT_FIELD(AskPrice4, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(AskVolume4, FIELD_INT32),
+  SNAPSHOT_FIELD(BidPrice5, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BidVolume5, FIELD_INT32),
+  SNAPSHOT_FIELD(AskPrice5, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(AskVolume5, FIELD_INT32),
+  SNAPSHOT_FIELD(AveragePrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(ActionDay, FIELD_STRING),
+  SNAPSHOT_FIELD(InstrumentID, FIELD_STRING),
+  SNAPSHOT_FIELD(ExchangeInstID, FIELD_STRING),
+  SNAPSHOT_FIELD(BandingUpperPrice, FIELD_DOUBLE),
+  SNAPSHOT_FIELD(BandingLowerPrice, FIELD_DOUBLE),
+};
+
+static uint32_t roundupPowerOfTwo(uint32_t n) {
+  uint32_t size = 1;
+
+  while (size < n)
+    size <<= 1;
+
+  return size;
+}
+
+// FNV-1a
+static uint32_t hashInstrument(const char *instrumentId) {
+  uint32_t hash = 2166136261u;
+
+  for (const unsigned char *p = (const unsigned char *)instrumentId; *p; ++p)
+    hash = (hash ^ *p) * 16777619u;
+
+  return hash;
+}
+
+SnapshotCache *createSnapshotCache(uint32_t capacity) {
+  SnapshotCache *cache = new SnapshotCache();
+
+  if (!cache)
+    return nullptr;
+
+  // At most half full, so a probe for a missing instrument ends early.
+  cache->capacity = capacity;
+  cache->mask = roundupPowerOfTwo(capacity * 2) - 1;
+  cache->slots = new SnapshotSlot[cache->mask + 1];
+
+  if (!cache->slots) {
+    delete cache;
+    return nullptr;
+  }
+
+  for (uint32_t i = 0; i <= cache->mask; ++i) {
+    cache->slots[i].sequence.store(0, std::memory_order_relaxed);
+    cache->slots[i].used.store(false, std::memory_order_relaxed);
+  }
+
+  cache->instruments.store(0, std::memory_order_relaxed);
+  cache->updates.store(0, std::memory_order_relaxed);
+  cache->rejected.store(0, std::memory_order_relaxed);
+
+  return cache;
+}
+
+void freeSnapshotCache(SnapshotCache *cache) {
+  delete[] cache->slots;
+  delete cache;
+}
+
+static SnapshotSlot *findSlot(SnapshotCache *cache, const char *instrumentId, bool *found) {
+  for (uint32_t i = hashInstrument(instrumentId);; ++i) {
+    SnapshotSlot *slot = &cache->slots[i & cache->mask];
+
+    if (!slot->used.load(std::memory_order_acquire)) {
+      *found = false;
+      return slot;
+    }
+
+    if (0 == strcmp(slot->instrumentId, instrumentId)) {
+      *found = true;
+      return slot;
+    }
+  }
+}
+
+static void writeSlot(SnapshotSlot *slot, const CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+
+  // Odd while the record is being written.
+  slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  memcpy(&slot->data, pDepthMarketData, sizeof(CThostFtdcDepthMarketDataField));
+
+  slot->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// Only the SPI thread writes, so claiming a slot needs no compare-and-swap.
+void updateSnapshot(SnapshotCache *cache, const CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  bool found;
+  SnapshotSlot *slot = findSlot(cache, pDepthMarketData->InstrumentID, &found);
+
+  if (!found) {
+    if (cache->instruments.load(std::memory_order_relaxed) >= cache->capacity) {
+      cache->rejected.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    memcpy(slot->instrumentId, pDepthMarketData->InstrumentID, sizeof(slot->instrumentId));
+    writeSlot(slot, pDepthMarketData);
+
+    slot->used.store(true, std::memory_order_release);
+    cache->instruments.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    writeSlot(slot, pDepthMarketData);
+  }
+
+  cache->updates.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool readSnapshot(SnapshotCache *cache, const char *instrumentId, CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  bool found;
+  SnapshotSlot *slot = findSlot(cache, instrumentId, &found);
+
+  if (!found)
+    return false;
+
+  for (;;) {
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+    if (sequence & 1) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    memcpy(pDepthMarketData, &slot->data, sizeof(CThostFtdcDepthMarketDataField));
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (sequence == slot->sequence.load(std::memory_order_relaxed))
+      return true;
+  }
+}
+
+void getSnapshotStats(SnapshotCache *cache, SnapshotStats *stats) {
+  stats->instruments = cache->instruments.load(std::memory_order_relaxed);
+  stats->capacity = cache->capacity;
+  stats->updates = cache->updates.load(std::memory_order_relaxed);
+  stats->rejected = cache->rejected.load(std::memory_order_relaxed);
+}
+
+int snapshotFieldId(const char *name) {
+  for (int i = 0; i < arraysize(snapshotFields); ++i)
+    if (0 == strcmp(name, snapshotFields[i].name))
+      return i;
+
+  return -1;
+}
+
+napi_status setSnapshotField(napi_env env, napi_value object, const CThostFtdcDepthMarketDataField *pDepthMarketData, int field) {
+  const SnapshotField *descriptor = &snapshotFields[field];
+  const char *value = (const char *)pDepthMarketData + descriptor->offset;
+
+  switch (descriptor->type) {
+  case FIELD_DOUBLE:
+    return objectSetDouble(env, object, descriptor->name, *(const double *)value);
+  case FIELD_INT32:
+    return objectSetInt32(env, object, descriptor->name, *(const int32_t *)value);
+  default:
+    return objectSetString(env, object, descriptor->name, value);
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * mdsnapshot.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MDSNAPSHOT_H__
+#define __MDSNAPSHOT_H__
+
+#include "napi_ctp.h"
+#include <atomic>
+
+#define SNAPSHOT_CAPACITY_MAX 1048576
+
+typedef struct SnapshotStats {
+  uint32_t instruments;
+  uint32_t capacity;
+  uint64_t updates;
+  uint64_t rejected;
+} SnapshotStats;
+
+/*
+ * The latest tick of every instrument, kept by the SPI thread for
+ * synchronous lookups from JS.
+ *
+ * The table is open addressed and never rehashed: a slot is claimed once
+ * and published by its used flag, so readers probe it without a lock. Each
+ * record sits behind a sequence lock, the writer never waits and a reader
+ * that raced an update copies it again. Instruments beyond the capacity
+ * are counted as rejected and not cached.
+ */
+typedef struct SnapshotSlot {
+  std::atomic<uint32_t> sequence;
+  std::atomic<bool> used;
+  TThostFtdcInstrumentIDType instrumentId;
+  CThostFtdcDepthMarketDataField data;
+} SnapshotSlot;
+
+typedef struct SnapshotCache {
+  uint32_t capacity;
+  uint32_t mask;
+  SnapshotSlot *slots;
+  std::atomic<uint32_t> instruments;
+  std::atomic<uint64_t> updates;
+  std::atomic<uint64_t> rejected;
+} SnapshotCache;
+
+SnapshotCache *createSnapshotCache(uint32_t capacity);
+void freeSnapshotCache(SnapshotCache *cache);
+
+void updateSnapshot(SnapshotCache *cache, const CThostFtdcDepthMarketDataField *pDepthMarketData);
+bool readSnapshot(SnapshotCache *cache, const char *instrumentId, CThostFtdcDepthMarketDataField *pDepthMarketData);
+void getSnapshotStats(SnapshotCache *cache, SnapshotStats *stats);
+
+/* Field ids of CThostFtdcDepthMarketDataField for projected reads, -1 when unknown. */
+int snapshotFieldId(const char *name);
+napi_status setSnapshotField(napi_env env, napi_value object, const CThostFtdcDepthMarketDataField *pDepthMarketData, int field);
+
+#endif /* __MDSNAPSHOT_H__ */
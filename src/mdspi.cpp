@@ -10,10 +10,9 @@
  */
 
 #include "mdspi.h"
-#include <map>
-#include <string>
+#include <string.h>
 
-static const std::map<int, std::string> eventNames = {
+static constexpr EventName eventNames[] = {
   {EM_QUIT,                       "quit"},
   {EM_FRONTCONNECTED,             "front-connected"},
   {EM_FRONTDISCONNECTED,          "front-disconnected"},
@@ -28,9 +27,12 @@ static const std::map<int, std::string> eventNames = {
   {EM_RSPUNSUBFORQUOTERSP,        "rsp-unsub-for-quote"},
   {EM_RTNDEPTHMARKETDATA,         "rtn-depth-market-data"},
   {EM_RTNFORQUOTERSP,             "rtn-for-quote"},
+  {EM_RTNBAR,                     "bar"},
 
 };
 
+static_assert(arraysize(eventNames) == EM_COUNT && isEventTable(eventNames, EM_BASE), "eventNames must follow the EM_* order");
+
 static bool isFreeable(int event) {
   switch(event) {
     case EM_QUIT:
@@ -43,7 +45,7 @@ static bool isFreeable(int event) {
   }
 }
 
-MdSpi::MdSpi() {}
+MdSpi::MdSpi(size_t capacity) : _msgq(capacity, EM_BASE, EM_COUNT, done), _journal(nullptr), _snapshots(nullptr), _bars(nullptr) {}
 
 MdSpi::~MdSpi() {
   Message msg;
@@ -56,25 +58,70 @@ int MdSpi::poll(Message *message, unsigned int millisec) {
   return _msgq.pop(message, millisec);
 }
 
+int MdSpi::pollUntil(Message *message, uint64_t deadline) {
+  return _msgq.popUntil(message, deadline);
+}
+
 void MdSpi::done(Message &message) {
   if (isFreeable(message.event))
-    free((void *)message.data);
+    freePayload((void *)message.data);
 
   message.data = 0;
 }
 
 void MdSpi::quit(int nCode) {
   Message msg = {EM_QUIT, (uintptr_t)nCode};
-  _msgq.push(msg);
+  _msgq.post(msg);
 }
 
-const char *MdSpi::eventName(int event) {
-  auto iter = eventNames.find(event);
+void MdSpi::close() {
+  _msgq.close();
+}
+
+void MdSpi::setOverflowPolicy(int event, int policy) {
+  _msgq.setPolicy(event, isLossless(event) ? OVERFLOW_BLOCK : policy);
+}
+
+void MdSpi::getQueueStats(QueueStats *stats) {
+  _msgq.getStats(stats);
+}
+
+void MdSpi::setJournal(TickJournal *journal) {
+  _journal = journal;
+}
+
+void MdSpi::setSnapshots(SnapshotCache *snapshots) {
+  _snapshots = snapshots;
+}
+
+void MdSpi::setBars(BarAggregator *bars) {
+  _bars = bars;
+}
+
+bool MdSpi::isLossless(int event) {
+  switch(event) {
+    case EM_QUIT:
+    case EM_FRONTCONNECTED:
+    case EM_FRONTDISCONNECTED:
+      return true;
+    default:
+      return false;
+  }
+}
 
-  if (iter == eventNames.end())
+const char *MdSpi::eventName(int event) {
+  if (event < EM_BASE || event >= EM_BASE + EM_COUNT)
     return nullptr;
 
-  return iter->second.c_str();
+  return eventNames[event - EM_BASE].name;
+}
+
+int MdSpi::eventId(const char *name) {
+  for (int i = 0; i < EM_COUNT; ++i)
+    if (0 == strcmp(eventNames[i].name, name))
+      return eventNames[i].event;
+
+  return -1;
 }
 
 void MdSpi::OnFrontConnected() {
@@ -96,7 +143,7 @@ void MdSpi::OnRspUserLogin(CThostFtdcRspUserLoginField *pRspUserLogin, CThostFtd
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPUSERLOGIN, copyData(pRspUserLogin)};
+  Message msg = {EM_RSPUSERLOGIN, copyData(pRspUserLogin), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -104,7 +151,7 @@ void MdSpi::OnRspUserLogout(CThostFtdcUserLogoutField *pUserLogout, CThostFtdcRs
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPUSERLOGOUT, copyData(pUserLogout)};
+  Message msg = {EM_RSPUSERLOGOUT, copyData(pUserLogout), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -112,12 +159,12 @@ void MdSpi::OnRspQryMulticastInstrument(CThostFtdcMulticastInstrumentField *pMul
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPQRYMULTICASTINSTRUMENT, copyData(pMulticastInstrument)};
+  Message msg = {EM_RSPQRYMULTICASTINSTRUMENT, copyData(pMulticastInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
 void MdSpi::OnRspError(CThostFtdcRspInfoField *pRspInfo, int nRequestID, bool bIsLast) {
-  Message msg = {EM_RSPERROR, copyData(pRspInfo)};
+  Message msg = {EM_RSPERROR, copyData(pRspInfo), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -125,7 +172,7 @@ void MdSpi::OnRspSubMarketData(CThostFtdcSpecificInstrumentField *pSpecificInstr
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPSUBMARKETDATA, copyData(pSpecificInstrument)};
+  Message msg = {EM_RSPSUBMARKETDATA, copyData(pSpecificInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -133,7 +180,7 @@ void MdSpi::OnRspUnSubMarketData(CThostFtdcSpecificInstrumentField *pSpecificIns
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPUNSUBMARKETDATA, copyData(pSpecificInstrument)};
+  Message msg = {EM_RSPUNSUBMARKETDATA, copyData(pSpecificInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -141,7 +188,7 @@ void MdSpi::OnRspSubForQuoteRsp(CThostFtdcSpecificInstrumentField *pSpecificInst
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPSUBFORQUOTERSP, copyData(pSpecificInstrument)};
+  Message msg = {EM_RSPSUBFORQUOTERSP, copyData(pSpecificInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -149,13 +196,32 @@ void MdSpi::OnRspUnSubForQuoteRsp(CThostFtdcSpecificInstrumentField *pSpecificIn
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {EM_RSPUNSUBFORQUOTERSP, copyData(pSpecificInstrument)};
+  Message msg = {EM_RSPUNSUBFORQUOTERSP, copyData(pSpecificInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
 void MdSpi::OnRtnDepthMarketData(CThostFtdcDepthMarketDataField *pDepthMarketData) {
+  // Updated first, so a lookup from the tick's own callback sees at least this tick.
+  if (_snapshots)
+    updateSnapshot(_snapshots, pDepthMarketData);
+
   Message msg = {EM_RTNDEPTHMARKETDATA, copyData(pDepthMarketData)};
   _msgq.push(msg);
+
+  // Recorded after the tick is on its way to JS, live dispatch never waits on it.
+  if (_journal)
+    appendTick(_journal, pDepthMarketData);
+
+  if (_bars) {
+    aggregateTick(_bars, pDepthMarketData, &_closedBars);
+
+    for (auto it = _closedBars.begin(); it != _closedBars.end(); ++it) {
+      Message bar = {EM_RTNBAR, copyData(&*it)};
+      _msgq.push(bar);
+    }
+
+    _closedBars.clear();
+  }
 }
 
 void MdSpi::OnRtnForQuoteRsp(CThostFtdcForQuoteRspField *pForQuoteRsp) {
@@ -12,6 +12,9 @@
 #ifndef __MDSPI_H__
 #define __MDSPI_H__
 
+#include "mdbars.h"
+#include "mdjournal.h"
+#include "mdsnapshot.h"
 #include "message_queue.h"
 #include "napi_ctp.h"
 
@@ -30,18 +33,30 @@
 #define EM_RSPUNSUBFORQUOTERSP        (EM_BASE + 11)
 #define EM_RTNDEPTHMARKETDATA         (EM_BASE + 12)
 #define EM_RTNFORQUOTERSP             (EM_BASE + 13)
+#define EM_RTNBAR                     (EM_BASE + 14)
+#define EM_COUNT                      15
 
 class MdSpi : public CThostFtdcMdSpi {
 public:
-  MdSpi();
+  MdSpi(size_t capacity = MESSAGE_QUEUE_CAPACITY);
   virtual ~MdSpi();
 
   int poll(Message *message, unsigned int millisec = UINT_MAX);
-  void done(Message &message);
+  int pollUntil(Message *message, uint64_t deadline);
   void quit(int nCode = 0);
+  void close();
+
+  void setOverflowPolicy(int event, int policy);
+  void getQueueStats(QueueStats *stats);
+  void setJournal(TickJournal *journal);
+  void setSnapshots(SnapshotCache *snapshots);
+  void setBars(BarAggregator *bars);
 
 public:
+  static void done(Message &message);
   static const char *eventName(int event);
+  static int eventId(const char *name);
+  static bool isLossless(int event);
 
 public:
   virtual void OnFrontConnected();
@@ -71,6 +86,10 @@ private:
 
 private:
   MessageQueue _msgq;
+  TickJournal *_journal;
+  SnapshotCache *_snapshots;
+  BarAggregator *_bars;
+  std::vector<BarField> _closedBars;
 };
 
 #endif /* __MDSPI_H__ */
@@ -0,0 +1,226 @@
+/*
+ * message_pool.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "message_pool.h"
+#include <atomic>
+#include <stdlib.h>
+#include <uv.h>
+
+#define CACHELINE_SIZE 64
+
+struct PayloadPool;
+
+typedef struct alignas(16) PayloadHeader {
+  PayloadPool *pool;
+  int sizeClass;
+} PayloadHeader;
+
+typedef struct PayloadBin {
+  PayloadHeader *local;
+  alignas(CACHELINE_SIZE) std::atomic<PayloadHeader *> returned;
+} PayloadBin;
+
+typedef struct PayloadPool {
+  PayloadBin bins[MESSAGE_POOL_CLASSES];
+  alignas(CACHELINE_SIZE) std::atomic<uint64_t> allocations;
+  std::atomic<uint64_t> mallocs;
+  std::atomic<bool> closed;
+  PayloadPool *next;
+} PayloadPool;
+
+class PoolOwner {
+public:
+  ~PoolOwner();
+  PayloadPool *pool = nullptr;
+};
+
+static uv_once_t poolOnce = UV_ONCE_INIT;
+static uv_mutex_t poolMutex;
+static PayloadPool *poolList = nullptr;
+static std::atomic<uint64_t> oversizeMallocs(0);
+
+static thread_local PoolOwner poolOwner;
+
+static inline PayloadHeader *&nextOf(PayloadHeader *header) {
+  return *(PayloadHeader **)(header + 1);
+}
+
+static inline void counterIncrement(std::atomic<uint64_t> &counter) {
+  // Only the owning thread writes, readers just need an untorn value.
+  counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+static int sizeClassOf(size_t size) {
+  size_t block = MESSAGE_POOL_MIN_BLOCK;
+
+  for (int i = 0; i < MESSAGE_POOL_CLASSES; ++i, block <<= 1)
+    if (size + sizeof(PayloadHeader) <= block)
+      return i;
+
+  return -1;
+}
+
+static void initPoolMutex() { uv_mutex_init(&poolMutex); }
+
+static void freeBlocks(PayloadHeader *header) {
+  while (header) {
+    PayloadHeader *next = nextOf(header);
+    free(header);
+    header = next;
+  }
+}
+
+static void drainReturned(PayloadPool *pool) {
+  for (int i = 0; i < MESSAGE_POOL_CLASSES; ++i)
+    freeBlocks(pool->bins[i].returned.exchange(nullptr, std::memory_order_acquire));
+}
+
+static PayloadPool *acquirePool() {
+  PayloadPool *pool;
+
+  uv_once(&poolOnce, initPoolMutex);
+  uv_mutex_lock(&poolMutex);
+
+  // Adopt a pool left behind by an exited thread before growing the list.
+  for (pool = poolList; pool; pool = pool->next)
+    if (pool->closed.load(std::memory_order_relaxed))
+      break;
+
+  if (!pool) {
+    pool = new PayloadPool();
+
+    for (int i = 0; i < MESSAGE_POOL_CLASSES; ++i) {
+      pool->bins[i].local = nullptr;
+      pool->bins[i].returned.store(nullptr, std::memory_order_relaxed);
+    }
+
+    pool->allocations.store(0, std::memory_order_relaxed);
+    pool->mallocs.store(0, std::memory_order_relaxed);
+
+    pool->next = poolList;
+    poolList = pool;
+  }
+
+  pool->closed.store(false, std::memory_order_seq_cst);
+  uv_mutex_unlock(&poolMutex);
+
+  return pool;
+}
+
+static void closePool(PayloadPool *pool) {
+  for (int i = 0; i < MESSAGE_POOL_CLASSES; ++i) {
+    freeBlocks(pool->bins[i].local);
+    pool->bins[i].local = nullptr;
+  }
+
+  uv_mutex_lock(&poolMutex);
+  pool->closed.store(true, std::memory_order_seq_cst);
+  uv_mutex_unlock(&poolMutex);
+
+  // Blocks still in flight are freed by whoever returns them last.
+  drainReturned(pool);
+}
+
+PoolOwner::~PoolOwner() {
+  if (pool)
+    closePool(pool);
+}
+
+void *allocPayload(size_t size) {
+  int sizeClass = sizeClassOf(size);
+  PayloadHeader *header;
+
+  if (sizeClass < 0) {
+    header = (PayloadHeader *)malloc(sizeof(PayloadHeader) + size);
+
+    if (!header)
+      return nullptr;
+
+    header->pool = nullptr;
+    header->sizeClass = -1;
+    oversizeMallocs.fetch_add(1, std::memory_order_relaxed);
+
+    return header + 1;
+  }
+
+  if (!poolOwner.pool)
+    poolOwner.pool = acquirePool();
+
+  PayloadPool *pool = poolOwner.pool;
+  PayloadBin *bin = &pool->bins[sizeClass];
+
+  header = bin->local;
+
+  if (!header)
+    header = bin->returned.exchange(nullptr, std::memory_order_acquire);
+
+  if (header) {
+    bin->local = nextOf(header);
+  } else {
+    header = (PayloadHeader *)malloc((size_t)MESSAGE_POOL_MIN_BLOCK << sizeClass);
+
+    if (!header)
+      return nullptr;
+
+    header->pool = pool;
+    header->sizeClass = sizeClass;
+    counterIncrement(pool->mallocs);
+  }
+
+  counterIncrement(pool->allocations);
+
+  return header + 1;
+}
+
+void freePayload(void *payload) {
+  if (!payload)
+    return;
+
+  PayloadHeader *header = (PayloadHeader *)payload - 1;
+  PayloadPool *pool = header->pool;
+
+  if (!pool) {
+    free(header);
+    return;
+  }
+
+  std::atomic<PayloadHeader *> &returned = pool->bins[header->sizeClass].returned;
+  PayloadHeader *head = returned.load(std::memory_order_relaxed);
+
+  // Push only, the owner takes the whole list at once, so there is no ABA.
+  do {
+    nextOf(header) = head;
+  } while (!returned.compare_exchange_weak(head, header, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+  if (pool->closed.load(std::memory_order_seq_cst))
+    drainReturned(pool);
+}
+
+void getMessagePoolStats(MessagePoolStats *stats) {
+  stats->allocations = 0;
+  stats->mallocs = oversizeMallocs.load(std::memory_order_relaxed);
+  stats->pools = 0;
+
+  uv_once(&poolOnce, initPoolMutex);
+  uv_mutex_lock(&poolMutex);
+
+  for (PayloadPool *pool = poolList; pool; pool = pool->next) {
+    stats->allocations += pool->allocations.load(std::memory_order_relaxed);
+    stats->mallocs += pool->mallocs.load(std::memory_order_relaxed);
+
+    if (!pool->closed.load(std::memory_order_relaxed))
+      stats->pools += 1;
+  }
+
+  uv_mutex_unlock(&poolMutex);
+
+  stats->allocations += oversizeMallocs.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,41 @@
+/*
+ * message_pool.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __MESSAGE_POOL_H__
+#define __MESSAGE_POOL_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MESSAGE_POOL_MIN_BLOCK 128
+#define MESSAGE_POOL_CLASSES 8
+
+typedef struct MessagePoolStats {
+  uint64_t allocations;
+  uint64_t mallocs;
+  uint32_t pools;
+} MessagePoolStats;
+
+/*
+ * Size-class payload allocator.
+ *
+ * Every allocating thread owns its own pool, so allocPayload() never takes
+ * a lock. freePayload() may be called from any thread, the block is pushed
+ * back onto its owner's return list and picked up in one swap the next time
+ * the owner runs dry. Blocks larger than the biggest class fall through to
+ * malloc/free.
+ */
+void *allocPayload(size_t size);
+void freePayload(void *payload);
+
+void getMessagePoolStats(MessagePoolStats *stats);
+
+#endif /* __MESSAGE_POOL_H__ */
@@ -10,8 +10,62 @@
  */
 
 #include "message_queue.h"
+#include <string.h>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define QUEUE_SPIN_COUNT 256
+#define QUEUE_SAMPLE_MASK 63
+
+// Relaxed, the head and tail order the slots, x86 and ARM load and store them as plain words.
+static inline void storeSlot(MessageSlot *slot, const Message &message) {
+  uint64_t words[MESSAGE_SLOT_WORDS];
+
+  memcpy(words, &message, sizeof(words));
+
+  for (int i = 0; i < MESSAGE_SLOT_WORDS; ++i)
+    slot->words[i].store(words[i], std::memory_order_relaxed);
+}
+
+static inline void loadSlot(const MessageSlot *slot, Message *message) {
+  uint64_t words[MESSAGE_SLOT_WORDS];
+
+  for (int i = 0; i < MESSAGE_SLOT_WORDS; ++i)
+    words[i] = slot->words[i].load(std::memory_order_relaxed);
+
+  memcpy((void *)message, words, sizeof(words));
+}
+
+// Whether membarrier can stand in for the fence of every push, registered once per process.
+static bool registerSleepBarrier() {
+#if defined(__linux__) && defined(__NR_membarrier)
+  static const bool registered = 0 == syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0);
+  return registered;
+#else
+  return false;
+#endif
+}
+
+static size_t roundupPowerOfTwo(size_t n) {
+  size_t size = 2;
+
+  while (size < n)
+    size <<= 1;
+
+  return size;
+}
+
+MessageQueue::MessageQueue(size_t capacity, int base, int count, ReleaseFunc release)
+    : _head(0), _cachedTail(0), _tail(0), _cachedHead(0), _highWater(0), _dropped(0), _evicted(0), _waiting(0), _posted(0), _closed(false),
+      _asymmetric(registerSleepBarrier()), _base(base), _evictable(false), _policies(count, OVERFLOW_BLOCK), _release(release) {
+  _mask = roundupPowerOfTwo(capacity) - 1;
+  _ring = new MessageSlot[_mask + 1];
 
-MessageQueue::MessageQueue() : _waiting(0) {
   uv_cond_init(&_cond);
   uv_mutex_init_recursive(&_mutex);
 }
@@ -19,42 +73,267 @@ MessageQueue::MessageQueue() : _waiting(0) {
 MessageQueue::~MessageQueue() {
   uv_cond_destroy(&_cond);
   uv_mutex_destroy(&_mutex);
+
+  delete[] _ring;
+}
+
+// Must be called before the producer and the consumer start.
+void MessageQueue::setPolicy(int event, int policy) {
+  if (event < _base || event - _base >= (int)_policies.size())
+    return;
+
+  _policies[event - _base] = (uint8_t)policy;
+
+  if (policy == OVERFLOW_DROP_OLDEST)
+    _evictable = true;
+}
+
+void MessageQueue::getStats(QueueStats *stats) {
+  size_t head = _head.load(std::memory_order_acquire);
+  size_t tail = _tail.load(std::memory_order_acquire);
+  uint64_t evicted = _evicted.load(std::memory_order_relaxed);
+
+  stats->enqueued = tail;
+  stats->dequeued = head - evicted;
+  stats->dropped = _dropped.load(std::memory_order_relaxed);
+  stats->depth = (uint32_t)(tail - head);
+  stats->highWater = (uint32_t)_highWater.load(std::memory_order_relaxed);
+  stats->capacity = (uint32_t)capacity();
+}
+
+void MessageQueue::close() {
+  _closed.store(true, std::memory_order_relaxed);
 }
 
 void MessageQueue::push(const Message &message) {
-  uv_mutex_lock(&_mutex);
+  int policy = policyOf(message.event);
+  Message stamped = message;
 
-  _queue.push(message);
+  // The latency of a message starts in the CTP callback, before any wait,
+  // a producer that already read the clock passes its own stamp.
+  if (!stamped.timestamp)
+    stamped.timestamp = uv_hrtime();
+
+  while (!tryPush(stamped)) {
+    if (policy == OVERFLOW_DROP_NEWEST || _closed.load(std::memory_order_relaxed)) {
+      drop(stamped);
+      return;
+    }
 
-  if (_waiting > 0)
-    uv_cond_signal(&_cond);
+    if (policy == OVERFLOW_DROP_OLDEST && tryEvict())
+      continue;
 
+    // The ring is full, the consumer is busy, so give it the CPU.
+    wakeup();
+    std::this_thread::yield();
+  }
+
+  wakeup();
+}
+
+void MessageQueue::post(const Message &message) {
+  uv_mutex_lock(&_mutex);
+
+  _postq.push(message);
+  _posted.fetch_add(1, std::memory_order_seq_cst);
+
+  uv_cond_signal(&_cond);
   uv_mutex_unlock(&_mutex);
 }
 
 int MessageQueue::pop(Message *message, unsigned int millisec) {
+  return popUntil(message, uv_hrtime() + (uint64_t)millisec * 1000 * 1000);
+}
+
+int MessageQueue::popUntil(Message *message, uint64_t deadline) {
+  uint64_t now;
   int ret;
 
   if (!message)
     return QUEUE_FAILED;
 
+  for (int i = 0; i < QUEUE_SPIN_COUNT; ++i)
+    if (popPosted(message) || tryPop(message))
+      return QUEUE_SUCCESS;
+
+  if (uv_hrtime() >= deadline)
+    return QUEUE_TIMEOUT;
+
   uv_mutex_lock(&_mutex);
 
-  while (_queue.empty()) {
-    _waiting += 1;
-    ret = uv_cond_timedwait(&_cond, &_mutex, (uint64_t)millisec * 1000 * 1000);
-    _waiting -= 1;
+  // Announced once, a push either sees it or is seen by isReadable() below.
+  // The producer clears it when it signals, it then pushed something.
+  _waiting.store(1, std::memory_order_seq_cst);
+  sleepBarrier();
+
+  for (;;) {
+    if (isReadable())
+      break;
+
+    now = uv_hrtime();
+
+    if (now >= deadline) {
+      _waiting.store(0, std::memory_order_relaxed);
+      uv_mutex_unlock(&_mutex);
+      return QUEUE_TIMEOUT;
+    }
+
+    ret = uv_cond_timedwait(&_cond, &_mutex, deadline - now);
 
-    if (ret != 0) {
+    if (ret != 0 && ret != UV_ETIMEDOUT) {
+      _waiting.store(0, std::memory_order_relaxed);
       uv_mutex_unlock(&_mutex);
-      return ret == UV_ETIMEDOUT ? QUEUE_TIMEOUT : QUEUE_FAILED;
+      return QUEUE_FAILED;
+    }
+  }
+
+  _waiting.store(0, std::memory_order_relaxed);
+  uv_mutex_unlock(&_mutex);
+
+  return (popPosted(message) || tryPop(message)) ? QUEUE_SUCCESS : QUEUE_FAILED;
+}
+
+int MessageQueue::policyOf(int event) const {
+  if (event < _base || event - _base >= (int)_policies.size())
+    return OVERFLOW_BLOCK;
+
+  return _policies[event - _base];
+}
+
+bool MessageQueue::tryPush(const Message &message) {
+  size_t tail = _tail.load(std::memory_order_relaxed);
+
+  // The exact depth is only sampled now and then so that the producer does
+  // not pull the consumer's cache line on every push.
+  if (tail - _cachedHead > _mask || (tail & QUEUE_SAMPLE_MASK) == 0) {
+    _cachedHead = _head.load(std::memory_order_acquire);
+
+    if (tail - _cachedHead > _mask) {
+      _highWater.store(_mask + 1, std::memory_order_relaxed);
+      return false;
     }
+
+    if (tail + 1 - _cachedHead > _highWater.load(std::memory_order_relaxed))
+      _highWater.store(tail + 1 - _cachedHead, std::memory_order_relaxed);
   }
 
-  *message = _queue.front();
-  _queue.pop();
+  storeSlot(&_ring[tail & _mask], message);
+  _tail.store(tail + 1, std::memory_order_release);
+
+  return true;
+}
+
+bool MessageQueue::tryEvict() {
+  size_t head = _head.load(std::memory_order_acquire);
+
+  // The consumer made room meanwhile, the head slot may already be consumed.
+  if (_tail.load(std::memory_order_relaxed) - head <= _mask)
+    return true;
+
+  // Only the producer writes slots and it is here, the head slot is intact.
+  // The consumer may be copying it too, and once this CAS wins the next push
+  // overwrites it under that copy; the consumer's own CAS then fails.
+  Message oldest;
+
+  loadSlot(&_ring[head & _mask], &oldest);
+
+  if (policyOf(oldest.event) == OVERFLOW_BLOCK)
+    return false;
+
+  // Lost the race, the consumer took it and there is room again.
+  if (!_head.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+    return true;
+
+  _cachedHead = head + 1;
+  _evicted.store(_evicted.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+  drop(oldest);
+
+  return true;
+}
+
+bool MessageQueue::tryPop(Message *message) {
+  size_t head = _head.load(std::memory_order_relaxed);
+
+  for (;;) {
+    // Evictions can move the head past a stale cached tail.
+    if ((intptr_t)(_cachedTail - head) <= 0) {
+      _cachedTail = _tail.load(std::memory_order_acquire);
+
+      if (_cachedTail == head)
+        return false;
+    }
+
+    loadSlot(&_ring[head & _mask], message);
+
+    if (!_evictable) {
+      _head.store(head + 1, std::memory_order_release);
+      return true;
+    }
+
+    // The producer may evict the head, a copy that lost the race is stale.
+    if (_head.compare_exchange_weak(head, head + 1, std::memory_order_release, std::memory_order_relaxed))
+      return true;
+  }
+}
+
+void MessageQueue::drop(Message &message) {
+  _dropped.store(_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+  if (_release)
+    _release(message);
+}
+
+bool MessageQueue::popPosted(Message *message) {
+  if (_posted.load(std::memory_order_acquire) == 0)
+    return false;
+
+  uv_mutex_lock(&_mutex);
+
+  if (_postq.empty()) {
+    uv_mutex_unlock(&_mutex);
+    return false;
+  }
+
+  *message = _postq.front();
+  _postq.pop();
+  _posted.fetch_sub(1, std::memory_order_relaxed);
 
   uv_mutex_unlock(&_mutex);
 
-  return QUEUE_SUCCESS;
+  return true;
+}
+
+bool MessageQueue::isReadable() {
+  return _posted.load(std::memory_order_seq_cst) > 0 ||
+         _head.load(std::memory_order_relaxed) != _tail.load(std::memory_order_seq_cst);
+}
+
+// Orders the store to _waiting before the consumer looks at the ring again.
+void MessageQueue::sleepBarrier() {
+#if defined(__linux__) && defined(__NR_membarrier)
+  // Every thread of the process passes a full barrier, the producer included.
+  if (_asymmetric)
+    syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0);
+#endif
+}
+
+void MessageQueue::wakeup() {
+  // Pairs with the store to _waiting in pop(), only a sleeping consumer costs
+  // a lock and it is signalled once no matter how many pushes follow. With
+  // the sleep barrier the compiler only has to keep the load after the push.
+  if (_asymmetric)
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+  else
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (_waiting.load(std::memory_order_relaxed) == 0)
+    return;
+
+  if (_waiting.exchange(0, std::memory_order_seq_cst) == 0)
+    return;
+
+  uv_mutex_lock(&_mutex);
+  uv_cond_signal(&_cond);
+  uv_mutex_unlock(&_mutex);
 }
@@ -13,24 +13,114 @@
 #define __MESSAGE_QUEUE_H__
 
 #include "napi_ctp.h"
+#include <stdint.h>
+#include <atomic>
 #include <queue>
+#include <vector>
 #include <uv.h>
 
+#define CACHELINE_SIZE 64
+#define MESSAGE_QUEUE_CAPACITY 65536
+#define MESSAGE_QUEUE_CAPACITY_MAX 4194304 /* 96 MB of messages */
+
+#define MESSAGE_SLOT_WORDS 3
+
 enum { QUEUE_FAILED = -1, QUEUE_TIMEOUT, QUEUE_SUCCESS };
 
+static_assert(sizeof(Message) == MESSAGE_SLOT_WORDS * sizeof(uint64_t), "A Message should fill its slot words");
+
+/*
+ * A ring slot holds its Message as atomic words. Under drop-oldest the
+ * producer may evict the head and overwrite its slot while the consumer is
+ * still copying it, the copy stays well defined and the consumer's failed
+ * CAS on the head throws it away.
+ */
+typedef struct MessageSlot {
+  std::atomic<uint64_t> words[MESSAGE_SLOT_WORDS];
+} MessageSlot;
+
+typedef struct QueueStats {
+  uint64_t enqueued;
+  uint64_t dequeued;
+  uint64_t dropped;
+  uint32_t depth;
+  uint32_t highWater;
+  uint32_t capacity;
+} QueueStats;
+
+/*
+ * Bounded single-producer/single-consumer ring.
+ *
+ * push() must only be called from the CTP callback thread and pop() only
+ * from the dispatch thread; neither takes a lock unless the consumer is
+ * asleep. post() is the slow path for any other thread (e.g. quit from the
+ * JS thread), posted messages are delivered ahead of the ring.
+ *
+ * The consumer announces that it is about to sleep and the producer checks
+ * that after every push. Where the OS can, the consumer pays the full
+ * barrier this needs on the way to sleep, so a push costs none.
+ *
+ * A full ring blocks the producer unless the event has an overflow policy:
+ * drop-newest discards the incoming message, drop-oldest evicts the head
+ * when it also belongs to a droppable event. Dropped payloads are handed to
+ * the release function. Once closed, a full ring drops instead of blocking,
+ * so a producer still in a callback can finish after the consumer is gone.
+ */
 class MessageQueue {
 public:
-  MessageQueue();
+  typedef void (*ReleaseFunc)(Message &message);
+
+  MessageQueue(size_t capacity = MESSAGE_QUEUE_CAPACITY, int base = 0, int count = 0, ReleaseFunc release = nullptr);
   ~MessageQueue();
 
+  void setPolicy(int event, int policy);
+  void getStats(QueueStats *stats);
+  void close();
+
   void push(const Message &message);
+  void post(const Message &message);
   int pop(Message *message, unsigned int millisec);
+  int popUntil(Message *message, uint64_t deadline);
+
+  size_t capacity() const { return _mask + 1; }
+
+private:
+  int policyOf(int event) const;
+  bool tryPush(const Message &message);
+  bool tryEvict();
+  bool tryPop(Message *message);
+  void drop(Message &message);
+  bool popPosted(Message *message);
+  bool isReadable();
+  void sleepBarrier();
+  void wakeup();
 
 private:
+  alignas(CACHELINE_SIZE) std::atomic<size_t> _head;
+  size_t _cachedTail;
+
+  alignas(CACHELINE_SIZE) std::atomic<size_t> _tail;
+  size_t _cachedHead;
+  std::atomic<size_t> _highWater;
+  std::atomic<uint64_t> _dropped;
+  std::atomic<uint64_t> _evicted;
+
+  alignas(CACHELINE_SIZE) std::atomic<int> _waiting;
+  std::atomic<int> _posted;
+  std::atomic<bool> _closed;
+  bool _asymmetric;
+
+  alignas(CACHELINE_SIZE) size_t _mask;
+  MessageSlot *_ring;
+
+  int _base;
+  bool _evictable;
+  std::vector<uint8_t> _policies;
+  ReleaseFunc _release;
+
   uv_cond_t _cond;
   uv_mutex_t _mutex;
-  int _waiting;
-  std::queue<Message> _queue;
+  std::queue<Message> _postq;
 };
 
 #endif /* __MESSAGE_QUEUE_H__ */
@@ -10,8 +10,12 @@
  */
 
 #include "napi_ctp.h"
+#include "message_queue.h"
 #include <string.h>
 #include <stdio.h>
+#include <uv.h>
+#include <atomic>
+#include <string>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -56,7 +60,10 @@ napi_value createInstance(napi_env env, napi_callback_info info, napi_ref constr
   dynarray(napi_value, argv, argc);
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
-  CHECK(napi_new_instance(env, cons, argc, argv, &instance));
+
+  // The constructor rejected its options, let its exception propagate.
+  if (napi_pending_exception == napi_new_instance(env, cons, argc, argv, &instance))
+    return nullptr;
 
   return instance;
 }
@@ -156,41 +163,431 @@ napi_status checkValueTypes(napi_env env, size_t argc, const napi_value *argv, c
   return napi_ok;
 }
 
-static char *toUTF8(const char *codepage, const char *mbstr, int len, char *utf8str) {
-#ifndef _WIN32
-  iconv_t cd;
-  size_t inlen = len, outlen = len * sizeof(int);
+// An option left out or undefined keeps its default, any other type throws.
+static napi_status getOptionValue(napi_env env, napi_value options, const char *name, napi_valuetype type, napi_value *value, bool *result) {
+  napi_valuetype valuetype;
+  char errors[96];
+
+  *value = nullptr;
+  *result = true;
+
+  CHECK(napi_get_named_property(env, options, name, value));
+  CHECK(napi_typeof(env, *value, &valuetype));
+
+  if (valuetype == napi_undefined) {
+    *value = nullptr;
+    return napi_ok;
+  }
+
+  if (valuetype != type) {
+    snprintf(errors, sizeof(errors), "The %s should be a %s", name, type == napi_number ? "non-negative integer" : getTypeString(type));
+    napi_throw_type_error(env, nullptr, errors);
+    *value = nullptr;
+    *result = false;
+  }
+
+  return napi_ok;
+}
+
+static napi_status getOptionUint32(napi_env env, napi_value options, const char *name, uint32_t *number, bool *result) {
+  napi_value value;
+  double real;
+  char errors[96];
+
+  CHECK(getOptionValue(env, options, name, napi_number, &value, result));
+
+  if (!value)
+    return napi_ok;
+
+  CHECK(napi_get_value_double(env, value, &real));
+
+  if (!(real >= 0 && real <= UINT32_MAX) || real != (double)(uint32_t)real) {
+    snprintf(errors, sizeof(errors), "The %s should be a non-negative integer", name);
+    napi_throw_type_error(env, nullptr, errors);
+    *result = false;
+    return napi_ok;
+  }
+
+  *number = (uint32_t)real;
+
+  return napi_ok;
+}
+
+static napi_status getOptionBoolean(napi_env env, napi_value options, const char *name, bool *boolean, bool *result) {
+  napi_value value;
+
+  CHECK(getOptionValue(env, options, name, napi_boolean, &value, result));
+
+  if (!value)
+    return napi_ok;
+
+  return napi_get_value_bool(env, value, boolean);
+}
+
+napi_status getListenerOptions(napi_env env, size_t argc, const napi_value *argv, Listener *listener, bool *result) {
+  bool lazy = false, raw = false, reuse = false;
+
+  listener->batchSize = 0;
+  listener->batchWindow = 0;
+  listener->maxInflight = MESSAGE_INFLIGHT_WINDOW;
+  listener->columnar = false;
+  listener->conflate = false;
+  listener->delivery = DELIVERY_OBJECT;
+  listener->context = nullptr;
+
+  if (argc < 3) {
+    *result = true;
+    return napi_ok;
+  }
+
+  CHECK(checkIsObject(env, argv[2], result));
+
+  if (!*result)
+    return napi_ok;
+
+  const struct {
+    const char *name;
+    uint32_t *number;
+  } numbers[] = {
+    {"batchSize", &listener->batchSize},
+    {"batchWindow", &listener->batchWindow},
+    {"maxInflight", &listener->maxInflight},
+  };
+  const struct {
+    const char *name;
+    bool *boolean;
+  } booleans[] = {
+    {"columnar", &listener->columnar},
+    {"conflate", &listener->conflate},
+    {"lazy", &lazy},
+    {"raw", &raw},
+    {"reuse", &reuse},
+  };
+
+  for (int i = 0; i < arraysize(numbers) && *result; ++i)
+    CHECK(getOptionUint32(env, argv[2], numbers[i].name, numbers[i].number, result));
+
+  for (int i = 0; i < arraysize(booleans) && *result; ++i)
+    CHECK(getOptionBoolean(env, argv[2], booleans[i].name, booleans[i].boolean, result));
+
+  if (!*result)
+    return napi_ok;
+
+  if ((int)lazy + (int)raw + (int)reuse > 1) {
+    napi_throw_type_error(env, nullptr, "Lazy, raw and reuse modes can not be combined");
+    *result = false;
+    return napi_ok;
+  }
 
-  cd = iconv_open("UTF-8//TRANSLIT", codepage);
+  listener->delivery = raw ? DELIVERY_RAW : lazy ? DELIVERY_LAZY : reuse ? DELIVERY_REUSE : DELIVERY_OBJECT;
+
+  return napi_ok;
+}
+
+napi_status getQueueCapacity(napi_env env, napi_value options, uint32_t *capacity, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
+  double number = 0;
+
+  *result = true;
+
+  CHECK(napi_get_named_property(env, options, "queueCapacity", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
+
+  if (valuetype == napi_undefined)
+    return napi_ok;
+
+  if (valuetype == napi_number)
+    CHECK(napi_get_value_double(env, value, &number));
+
+  // Rounded up to a power of two, the ring of the largest one is allocated up front.
+  if (valuetype != napi_number || !(number >= 1 && number <= MESSAGE_QUEUE_CAPACITY_MAX) || number != (double)(uint32_t)number) {
+    napi_throw_type_error(env, nullptr, "The queueCapacity must be an integer from 1 to 4194304");
+    *result = false;
+    return napi_ok;
+  }
+
+  *capacity = (uint32_t)number;
+
+  return napi_ok;
+}
+
+static int getOverflowPolicy(const char *name) {
+  static const char *policies[] = {"block", "drop-oldest", "drop-newest"};
+
+  for (int i = 0; i < arraysize(policies); ++i)
+    if (0 == strcmp(name, policies[i]))
+      return i;
+
+  return -1;
+}
+
+napi_status getOverflowPolicies(napi_env env, napi_value options, int (*eventId)(const char *name), bool (*isLossless)(int event), int base, uint8_t *policies, bool *result) {
+  napi_value overflow, names, key, value;
+  napi_valuetype valuetype;
+  char name[64], policyName[16], errors[128];
+  uint32_t length;
+  bool hasProperty;
+  int event, policy;
+
+  *result = true;
+
+  CHECK(napi_has_named_property(env, options, "overflow", &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, options, "overflow", &overflow));
+  CHECK(checkIsObject(env, overflow, result));
+
+  if (!*result)
+    return napi_ok;
+
+  CHECK(napi_get_property_names(env, overflow, &names));
+  CHECK(napi_get_array_length(env, names, &length));
+
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, names, i, &key));
+    CHECK(napi_get_value_string_utf8(env, key, name, sizeof(name), nullptr));
+    CHECK(napi_get_property(env, overflow, key, &value));
+    CHECK(napi_typeof(env, value, &valuetype));
+
+    if (valuetype == napi_string) {
+      CHECK(napi_get_value_string_utf8(env, value, policyName, sizeof(policyName), nullptr));
+    } else {
+      strcpy(policyName, getTypeString(valuetype));
+    }
+
+    event = eventId(name);
+    policy = getOverflowPolicy(policyName);
+
+    if (event < 0) {
+      snprintf(errors, sizeof(errors), "Unsupported event %s", name);
+      napi_throw_type_error(env, nullptr, errors);
+      *result = false;
+      return napi_ok;
+    }
+
+    if (policy < 0) {
+      snprintf(errors, sizeof(errors), "Unsupported overflow policy %s", policyName);
+      napi_throw_type_error(env, nullptr, errors);
+      *result = false;
+      return napi_ok;
+    }
+
+    if (policy != OVERFLOW_BLOCK && isLossless(event)) {
+      snprintf(errors, sizeof(errors), "The event %s can not be dropped", name);
+      napi_throw_type_error(env, nullptr, errors);
+      *result = false;
+      return napi_ok;
+    }
+
+    policies[event - base] = (uint8_t)policy;
+  }
+
+  return napi_ok;
+}
+
+MessageBatch *createMessageBatch(uint32_t size) {
+  MessageBatch *batch = (MessageBatch *)allocPayload(sizeof(MessageBatch) + sizeof(Message) * (size > 0 ? size - 1 : 0));
+
+  if (batch) {
+    batch->count = 0;
+    batch->dispatched = 0;
+  }
+
+  return batch;
+}
+
+void freeMessageBatch(MessageBatch *batch) {
+  freePayload(batch);
+}
+
+#define GBK_LEAD_MIN 0x81
+#define GBK_LEAD_MAX 0xFE
+#define GBK_TRAIL_MIN 0x40
+#define GBK_TRAIL_MAX 0xFE
+#define GBK_TRAIL_COUNT (GBK_TRAIL_MAX - GBK_TRAIL_MIN + 1)
+
+static uv_once_t gbkOnce = UV_ONCE_INIT;
+static uint16_t gbkTable[(GBK_LEAD_MAX - GBK_LEAD_MIN + 1) * GBK_TRAIL_COUNT];
+
+// Built once from the platform converter, unmapped pairs stay 0.
+static void initGBKTable() {
+#ifndef _WIN32
+  iconv_t cd = iconv_open("UTF-16LE", "GBK");
 
   if (((iconv_t)(-1)) == cd)
-    return 0;
+    return;
+#endif
 
-  iconv(cd, (char **)&mbstr, &inlen, &utf8str, &outlen);
-  iconv_close(cd);
+  for (int lead = GBK_LEAD_MIN; lead <= GBK_LEAD_MAX; ++lead) {
+    for (int trail = GBK_TRAIL_MIN; trail <= GBK_TRAIL_MAX; ++trail) {
+      char mbstr[2] = {(char)lead, (char)trail};
+      uint16_t *code = &gbkTable[(lead - GBK_LEAD_MIN) * GBK_TRAIL_COUNT + (trail - GBK_TRAIL_MIN)];
 
-  return utf8str;
+#ifndef _WIN32
+      unsigned char wcstr[4];
+      char *inbuf = mbstr, *outbuf = (char *)wcstr;
+      size_t inlen = sizeof(mbstr), outlen = sizeof(wcstr);
+
+      if (((size_t)(-1)) != iconv(cd, &inbuf, &inlen, &outbuf, &outlen) && outlen == 2)
+        *code = (uint16_t)(wcstr[0] | (wcstr[1] << 8));
+      else
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
 #else
-  int wlen;
+      wchar_t wc;
 
-  dynarray(wchar_t, wcstr, len + 1);
-  memset(wcstr, 0, (len + 1) * sizeof(wchar_t));
-
-  wlen = MultiByteToWideChar(CP_ACP, 0, mbstr, len, wcstr, len + 1);
-  WideCharToMultiByte(CP_UTF8, 0, wcstr, wlen, utf8str, len * sizeof(wchar_t), NULL, NULL);
+      if (1 == MultiByteToWideChar(936, MB_ERR_INVALID_CHARS, mbstr, sizeof(mbstr), &wc, 1))
+        *code = (uint16_t)wc;
+#endif
+    }
+  }
 
-  return utf8str;
+#ifndef _WIN32
+  iconv_close(cd);
 #endif
 }
 
+static size_t gbkToUTF8(const unsigned char *mbstr, size_t len, char *utf8str) {
+  char *p = utf8str;
+  size_t i = 0;
+
+  uv_once(&gbkOnce, initGBKTable);
+
+  while (i < len) {
+    unsigned int ch = mbstr[i], code = 0xFFFD;
+
+    if (ch < 0x80) {
+      *p++ = (char)ch;
+      i += 1;
+      continue;
+    }
+
+    if (ch >= GBK_LEAD_MIN && ch <= GBK_LEAD_MAX && i + 1 < len && mbstr[i + 1] >= GBK_TRAIL_MIN && mbstr[i + 1] <= GBK_TRAIL_MAX) {
+      unsigned int wc = gbkTable[(ch - GBK_LEAD_MIN) * GBK_TRAIL_COUNT + (mbstr[i + 1] - GBK_TRAIL_MIN)];
+
+      if (wc)
+        code = wc;
+
+      i += 2;
+    } else {
+      i += 1;
+    }
+
+    if (code < 0x800) {
+      *p++ = (char)(0xC0 | (code >> 6));
+      *p++ = (char)(0x80 | (code & 0x3F));
+    } else {
+      *p++ = (char)(0xE0 | (code >> 12));
+      *p++ = (char)(0x80 | ((code >> 6) & 0x3F));
+      *p++ = (char)(0x80 | (code & 0x3F));
+    }
+  }
+
+  return p - utf8str;
+}
+
+napi_status createString(napi_env env, const char *string, napi_value *result) {
+  const unsigned char *mbstr = (const unsigned char *)string;
+  unsigned char bits = 0;
+  size_t len;
+
+  for (len = 0; mbstr[len]; ++len)
+    bits |= mbstr[len];
+
+  // Codes, dates and times are plain ASCII, which is also valid latin1.
+  if (bits < 0x80)
+    return napi_create_string_latin1(env, string, len, result);
+
+  dynarray(char, utf8str, len * 3 + 1);
+  return napi_create_string_utf8(env, utf8str, gbkToUTF8(mbstr, len, utf8str), result);
+}
+
+static std::atomic<int> objectFactoryLastId(0);
+
+int objectFactoryId() {
+  int id = objectFactoryLastId.fetch_add(1, std::memory_order_relaxed);
+
+  assert(id < OBJECT_FACTORY_MAX);
+  return id;
+}
+
+// (function (v0, v1, ...) { return { Name0: v0, Name1: v1, ... }; })
+static napi_status compileObjectFactory(napi_env env, const ObjectBuilder &object, napi_ref *result) {
+  std::string params, fields;
+  napi_value source, factory;
+
+  for (uint32_t i = 0; i < object.count; ++i) {
+    std::string arg = "v" + std::to_string(i);
+
+    params += (i > 0 ? ", " : "") + arg;
+    fields += (i > 0 ? ", " : "") + std::string(object.names[i]) + ": " + arg;
+  }
+
+  std::string code = "(function (" + params + ") { return { " + fields + " }; })";
+
+  CHECK(napi_create_string_utf8(env, code.c_str(), code.length(), &source));
+  CHECK(napi_run_script(env, source, &factory));
+
+  return napi_create_reference(env, factory, 1, result);
+}
+
+napi_status createObject(napi_env env, ObjectBuilder &object, napi_value *result) {
+  napi_ref *factory = &getConstructors(env)->objectFactories[object.factory];
+  napi_value func, undefined;
+
+  // Same keys in the same order every time, so V8 keeps a single hidden class.
+  if (!*factory)
+    CHECK(compileObjectFactory(env, object, factory));
+
+  CHECK(napi_get_reference_value(env, *factory, &func));
+  CHECK(napi_get_undefined(env, &undefined));
+
+  return napi_call_function(env, undefined, func, object.count, object.values, result);
+}
+
+static napi_value *objectField(ObjectBuilder &object, const char *name) {
+  assert(object.count < OBJECT_FIELDS_MAX);
+
+  object.names[object.count] = name;
+  return &object.values[object.count++];
+}
+
+napi_status objectSetString(napi_env env, ObjectBuilder &object, const char *name, const char *string) {
+  return createString(env, string, objectField(object, name));
+}
+
+napi_status objectSetInt32(napi_env env, ObjectBuilder &object, const char *name, int32_t number) {
+  return napi_create_int32(env, number, objectField(object, name));
+}
+
+napi_status objectSetUint32(napi_env env, ObjectBuilder &object, const char *name, uint32_t number) {
+  return napi_create_uint32(env, number, objectField(object, name));
+}
+
+napi_status objectSetInt64(napi_env env, ObjectBuilder &object, const char *name, int64_t number) {
+  return napi_create_int64(env, number, objectField(object, name));
+}
+
+napi_status objectSetDouble(napi_env env, ObjectBuilder &object, const char *name, double number) {
+  return napi_create_double(env, number, objectField(object, name));
+}
+
+napi_status objectSetChar(napi_env env, ObjectBuilder &object, const char *name, char ch) {
+  const char str[2] = {ch, 0};
+  return objectSetString(env, object, name, str);
+}
+
+napi_status objectSetValue(napi_env env, ObjectBuilder &object, const char *name, napi_value value) {
+  *objectField(object, name) = value;
+  return napi_ok;
+}
+
 napi_status objectSetString(napi_env env, napi_value object, const char *name, const char *string) {
   napi_value value;
-  int len = (int)strlen(string);
-
-  dynarray(char, utf8str, len * 6 + 1);
-  memset(utf8str, 0, len * 6 + 1);
 
-  CHECK(napi_create_string_utf8(env, toUTF8("GBK", string, len, utf8str), NAPI_AUTO_LENGTH, &value));
+  CHECK(createString(env, string, &value));
   return napi_set_named_property(env, object, name, value);
 }
 
@@ -303,3 +700,16 @@ napi_status objectGetChar(napi_env env, napi_value object, const char *name, cha
 
   return napi_ok;
 }
+
+napi_status objectGetBoolean(napi_env env, napi_value object, const char *name, bool *value) {
+  napi_value property;
+  bool hasProperty;
+
+  CHECK(napi_has_named_property(env, object, name, &hasProperty));
+
+  if (!hasProperty)
+    return napi_ok;
+
+  CHECK(napi_get_named_property(env, object, name, &property));
+  return napi_get_value_bool(env, property, value);
+}
@@ -14,6 +14,7 @@
 
 #include "ThostFtdcMdApi.h"
 #include "ThostFtdcTraderApi.h"
+#include "message_pool.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <node_api.h>
@@ -26,18 +27,103 @@
 #define dynarray(type, name, size) type name[size]
 #endif
 
+#define OBJECT_FACTORY_MAX 512
+#define OBJECT_FIELDS_MAX 128
+
+/* The ArrayBuffer lazy objects are currently carved from, and the view factory of a new one. */
+typedef struct LazySlab {
+  napi_ref buffer;
+  napi_ref view;
+  napi_ref factory;
+  size_t used;
+} LazySlab;
+
 typedef struct Constructors {
   napi_ref marketData;
+  napi_ref marketDataReplay;
   napi_ref trader;
+  napi_ref instrumentCatalog;
+  napi_ref preparedRequest;
+  napi_ref objectFactories[OBJECT_FACTORY_MAX];
+  LazySlab lazySlab;
 } Constructors;
 
+/*
+ * requestId and isLast are the nRequestID and bIsLast of an OnRsp callback,
+ * packed next to event so a message stays 24 bytes; notices carry 0 and true.
+ */
 typedef struct Message {
+  Message(int event = 0, uintptr_t data = 0, int requestId = 0, bool isLast = true) : event(event), requestId((uint32_t)requestId & 0x7fffffff), isLast(isLast ? 1 : 0), data(data), timestamp(0) {}
+
   int event;
+  uint32_t requestId : 31;
+  uint32_t isLast : 1;
   uintptr_t data;
+  uint64_t timestamp;
 } Message;
 
+static_assert(sizeof(Message) <= 24, "Message should stay 24 bytes");
+
+typedef struct EventName {
+  int event;
+  const char *name;
+} EventName;
+
+typedef struct MessageBatch {
+  uint32_t count;
+  uint64_t dispatched;
+  Message messages[1];
+} MessageBatch;
+
+#define MESSAGE_INFLIGHT_WINDOW 4096
+
+enum { OVERFLOW_BLOCK = 0, OVERFLOW_DROP_OLDEST, OVERFLOW_DROP_NEWEST };
+
+/*
+ * How an event of a CTP struct reaches JS: a plain object, a lazy object, a
+ * Uint8Array of the struct or the listener's object of the instrument.
+ */
+enum { DELIVERY_OBJECT = 0, DELIVERY_LAZY, DELIVERY_RAW, DELIVERY_REUSE };
+
+typedef struct Listener {
+  napi_threadsafe_function tsfn;
+  uint32_t batchSize;
+  uint32_t batchWindow;
+  uint32_t maxInflight;
+  bool columnar;
+  bool conflate;
+  int delivery;
+  void *context;
+} Listener;
+
+/*
+ * Collects the fields of one CTP struct so the JS object is created by a
+ * single call into a compiled object literal, see createObject().
+ */
+typedef struct ObjectBuilder {
+  ObjectBuilder(int factory) : factory(factory), count(0) {}
+
+  int factory;
+  uint32_t count;
+  const char *names[OBJECT_FIELDS_MAX];
+  napi_value values[OBJECT_FIELDS_MAX];
+} ObjectBuilder;
+
+#define DefineObject(object)                                                   \
+  static const int object##Factory = objectFactoryId();                        \
+  ObjectBuilder object(object##Factory)
+
 #define arraysize(a) ((int)(sizeof(a) / sizeof(*a)))
 
+// Event tables are indexed by (event - base), so entry i must hold base + i.
+template <typename T, int N> static constexpr bool isEventTable(const T (&table)[N], int base) {
+  for (int i = 0; i < N; ++i)
+    if (table[i].event != base + i)
+      return false;
+
+  return true;
+}
+
 #define CHECK_RESULT(__expression__, __result__) assert(__expression__ == __result__)
 #define CHECK(__expression__) CHECK_RESULT(__expression__, napi_ok)
 
@@ -55,6 +141,27 @@ napi_status checkIsStringArray(napi_env env, napi_value value, bool *result);
 napi_status checkIsObject(napi_env env, napi_value value, bool *result);
 napi_status checkValueTypes(napi_env env, size_t argc, const napi_value *argv, const napi_valuetype *types, bool *result);
 
+napi_status getQueueCapacity(napi_env env, napi_value options, uint32_t *capacity, bool *result);
+napi_status getOverflowPolicies(napi_env env, napi_value options, int (*eventId)(const char *name), bool (*isLossless)(int event), int base, uint8_t *policies, bool *result);
+napi_status getListenerOptions(napi_env env, size_t argc, const napi_value *argv, Listener *listener, bool *result);
+
+MessageBatch *createMessageBatch(uint32_t size);
+void freeMessageBatch(MessageBatch *batch);
+
+/* A CTP string, GBK unless it is plain ASCII. */
+napi_status createString(napi_env env, const char *string, napi_value *result);
+
+int objectFactoryId();
+napi_status createObject(napi_env env, ObjectBuilder &object, napi_value *result);
+
+napi_status objectSetString(napi_env env, ObjectBuilder &object, const char *name, const char *string);
+napi_status objectSetInt32(napi_env env, ObjectBuilder &object, const char *name, int32_t number);
+napi_status objectSetUint32(napi_env env, ObjectBuilder &object, const char *name, uint32_t number);
+napi_status objectSetInt64(napi_env env, ObjectBuilder &object, const char *name, int64_t number);
+napi_status objectSetDouble(napi_env env, ObjectBuilder &object, const char *name, double number);
+napi_status objectSetChar(napi_env env, ObjectBuilder &object, const char *name, char ch);
+napi_status objectSetValue(napi_env env, ObjectBuilder &object, const char *name, napi_value value);
+
 napi_status objectSetString(napi_env env, napi_value object, const char *name, const char *string);
 napi_status objectSetInt32(napi_env env, napi_value object, const char *name, int32_t number);
 napi_status objectSetUint32(napi_env env, napi_value object, const char *name, uint32_t number);
@@ -68,6 +175,7 @@ napi_status objectGetUint32(napi_env env, napi_value object, const char *name, u
 napi_status objectGetInt64(napi_env env, napi_value object, const char *name, int64_t *number);
 napi_status objectGetDouble(napi_env env, napi_value object, const char *name, double *number);
 napi_status objectGetChar(napi_env env, napi_value object, const char *name, char *ch);
+napi_status objectGetBoolean(napi_env env, napi_value object, const char *name, bool *value);
 
 #define SetObjectString(env, object, record, name)                             \
   objectSetString(env, object, #name, (const char *)record->name)
@@ -87,26 +195,13 @@ napi_status objectGetChar(napi_env env, napi_value object, const char *name, cha
 #define SetObjectChar(env, object, record, name)                               \
   objectSetChar(env, object, #name, record->name)
 
-#define GetObjectString(env, object, record, name)                             \
-  objectGetString(env, object, #name, record.name, sizeof(record.name), nullptr)
-
-#define GetObjectInt32(env, object, record, name)                              \
-  objectGetInt32(env, object, #name, &record.name)
-
-#define GetObjectUint32(env, object, record, name)                             \
-  objectGetUint32(env, object, #name, &record.name)
-
-#define GetObjectInt64(env, object, record, name)                              \
-  objectGetInt64(env, object, #name, &record.name)
-
-#define GetObjectDouble(env, object, record, name)                             \
-  objectGetDouble(env, object, #name, &record.name)
+template <typename T> static inline uintptr_t copyData(T *data) {
+  T *p;
 
-#define GetObjectChar(env, object, record, name)                               \
-  objectGetChar(env, object, #name, &record.name)
+  if (!data)
+    return 0;
 
-template <typename T> static inline uintptr_t copyData(T *data) {
-  T *p = (T *)malloc(sizeof(T));
+  p = (T *)allocPayload(sizeof(T));
 
   if (!p)
     return 0;
@@ -10,12 +10,30 @@
  */
 
 #include "traderapi.h"
+#include "ctpfields.h"
+#include "ctpmsg.h"
+#include "ctpreuse.h"
+#include "latency.h"
+#include "tradercatalog.h"
 #include "tradermsg.h"
+#include "traderprepare.h"
+#include "traderquery.h"
 #include "traderspi.h"
+#include <stdio.h>
 #include <string.h>
-#include <map>
-#include <string>
+#include <atomic>
 #include <functional>
+#include <string>
+#include <vector>
+
+#define QUERY_TIMEOUT 30000 /* ms */
+#define QUERY_SWEEP_INTERVAL 100 /* ms */
+
+// Outlives the trader, settled queries may still be queued when it is released.
+typedef struct QuerySettler {
+  napi_threadsafe_function tsfn;
+  uint32_t pending;
+} QuerySettler;
 
 typedef struct Trader {
   napi_env env;
@@ -23,9 +41,17 @@ typedef struct Trader {
   uv_thread_t thread;
   TraderSpi *spi;
   CThostFtdcTraderApi *api;
-  std::map<std::string, napi_threadsafe_function> tsfns;
+  std::atomic<Listener *> listeners[ET_COUNT];
+  std::vector<Listener *> retired;
+  LatencyRecorder *latency;
+  QueryScheduler *scheduler;
+  QuerySettler *settler;
+  char flowPath[260];
+  char brokerId[16];
 } Trader;
 
+static const char *queryPriorityNames[QUERY_PRIORITY_COUNT] = {"high", "normal", "low"};
+
 static napi_value getApiVersion(napi_env env, napi_callback_info info) {
   napi_value jsthis, version;
   Trader *trader;
@@ -37,1787 +63,1329 @@ static napi_value getApiVersion(napi_env env, napi_callback_info info) {
   return version;
 }
 
-static napi_value callRequestFunc(napi_env env, napi_callback_info info, const std::function<int(Trader*, napi_value)> &func) {
-  size_t argc = 1;
-  int result;
-  napi_value object, jsthis, retval;
-  Trader *trader;
-  bool isObject;
+template <typename T, int (CThostFtdcTraderApi::*method)(T *, int)> static int sendRequest(CThostFtdcTraderApi *api, void *req, int requestId) {
+  return (api->*method)((T *)req, requestId);
+}
 
-  CHECK(napi_get_cb_info(env, info, &argc, &object, &jsthis, nullptr));
-  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
+// The broker of the session keys the instrument cache of loadInstruments.
+template <typename T> static void rememberBrokerId(Trader *trader, const void *req) {
+  snprintf(trader->brokerId, sizeof(trader->brokerId), "%s", ((const T *)req)->BrokerID);
+}
 
-  CHECK(checkIsObject(env, object, &isObject));
+static napi_status getOptionalNumber(napi_env env, napi_value value, int64_t *number, bool *result) {
+  napi_valuetype valuetype;
 
-  if (!isObject)
-    return nullptr;
+  *result = true;
 
-  result = func(trader, object);
-  CHECK(napi_create_int32(env, result, &retval));
+  napi_status status = napi_typeof(env, value, &valuetype);
 
-  return retval;
-}
+  if (status != napi_ok || valuetype == napi_undefined)
+    return status;
 
-static napi_value reqAuthenticate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqAuthenticateField req;
+  if (valuetype != napi_number) {
+    *result = false;
+    return napi_ok;
+  }
 
-    memset(&req, 0, sizeof(req));
+  return napi_get_value_int64(env, value, number);
+}
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, AuthCode));
-    CHECK(GetObjectString(env, object, req, AppID));
+// A timeout in milliseconds, or an object with timeout and priority.
+static napi_status getQueryOptions(napi_env env, napi_value options, int64_t *timeout, int *priority, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
+  char name[16];
 
-    return trader->api->ReqAuthenticate(&req, sequenceId());
-  });
-}
+  CHECK(napi_typeof(env, options, &valuetype));
 
-static napi_value reqUserLogin(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqUserLoginField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, InterfaceProductInfo));
-    CHECK(GetObjectString(env, object, req, ProtocolInfo));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, OneTimePassword));
-    CHECK(GetObjectString(env, object, req, LoginRemark));
-    CHECK(GetObjectInt32(env, object, req, ClientIPPort));
-    CHECK(GetObjectString(env, object, req, ClientIPAddress));
-
-    return trader->api->ReqUserLogin(&req, sequenceId());
-  });
-}
+  if (valuetype != napi_object)
+    return getOptionalNumber(env, options, timeout, result);
 
-static napi_value reqUserLogout(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcUserLogoutField req;
+  CHECK(napi_get_named_property(env, options, "timeout", &value));
+  CHECK(getOptionalNumber(env, value, timeout, result));
 
-    memset(&req, 0, sizeof(req));
+  if (!*result)
+    return napi_ok;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
+  CHECK(napi_get_named_property(env, options, "priority", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
 
-    return trader->api->ReqUserLogout(&req, sequenceId());
-  });
-}
+  if (valuetype == napi_undefined)
+    return napi_ok;
 
-static napi_value reqUserPasswordUpdate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcUserPasswordUpdateField req;
+  *result = false;
 
-    memset(&req, 0, sizeof(req));
+  if (valuetype != napi_string)
+    return napi_ok;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, OldPassword));
-    CHECK(GetObjectString(env, object, req, NewPassword));
+  CHECK(napi_get_value_string_utf8(env, value, name, sizeof(name), nullptr));
 
-    return trader->api->ReqUserPasswordUpdate(&req, sequenceId());
-  });
-}
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i) {
+    if (0 == strcmp(name, queryPriorityNames[i])) {
+      *priority = i;
+      *result = true;
+      break;
+    }
+  }
 
-static napi_value reqTradingAccountPasswordUpdate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcTradingAccountPasswordUpdateField req;
+  return napi_ok;
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_value createQueryError(napi_env env, napi_value message, int requestId) {
+  napi_value error, value;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, OldPassword));
-    CHECK(GetObjectString(env, object, req, NewPassword));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+  CHECK(napi_create_error(env, nullptr, message, &error));
+  CHECK(napi_create_int32(env, requestId, &value));
+  CHECK(napi_set_named_property(env, error, "requestId", value));
 
-    return trader->api->ReqTradingAccountPasswordUpdate(&req, sequenceId());
-  });
+  return error;
 }
 
-static napi_value reqUserAuthMethod(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqUserAuthMethodField req;
-
-    memset(&req, 0, sizeof(req));
+static napi_value createQueryError(napi_env env, const char *message, int requestId) {
+  napi_value string;
 
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
+  CHECK(napi_create_string_utf8(env, message, NAPI_AUTO_LENGTH, &string));
 
-    return trader->api->ReqUserAuthMethod(&req, sequenceId());
-  });
+  return createQueryError(env, string, requestId);
 }
 
-static napi_value reqGenUserCaptcha(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqGenUserCaptchaField req;
+static void settleQueries(Trader *trader, std::vector<Query *> &settled, napi_threadsafe_function_call_mode mode = napi_tsfn_blocking) {
+  for (auto it = settled.begin(); it != settled.end(); ++it)
+    if (napi_ok != napi_call_threadsafe_function(trader->settler->tsfn, (void *)*it, mode))
+      freeQuery(*it);
 
-    memset(&req, 0, sizeof(req));
+  settled.clear();
+}
 
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
+static napi_value startQuery(napi_env env, Trader *trader, int priority, int64_t timeout, QuerySender &&sender, QueryConverter &&convert) {
+  napi_value promise;
+  Query *query = createQuery(nextQueryId(), priority, timeout, std::move(sender));
 
-    return trader->api->ReqGenUserCaptcha(&req, sequenceId());
-  });
-}
+  if (!query) {
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-static napi_value reqGenUserText(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqGenUserTextField req;
+  query->convert = std::move(convert);
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_create_promise(env, &query->deferred, &promise));
 
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
+  // Pending queries keep the event loop alive, as a listener does.
+  if (trader->settler->pending++ == 0)
+    CHECK(napi_ref_threadsafe_function(env, trader->settler->tsfn));
 
-    return trader->api->ReqGenUserText(&req, sequenceId());
-  });
-}
+  std::vector<Query *> settled;
 
-static napi_value reqUserLoginWithCaptcha(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqUserLoginWithCaptchaField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, InterfaceProductInfo));
-    CHECK(GetObjectString(env, object, req, ProtocolInfo));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, LoginRemark));
-    CHECK(GetObjectString(env, object, req, Captcha));
-    CHECK(GetObjectInt32(env, object, req, ClientIPPort));
-    CHECK(GetObjectString(env, object, req, ClientIPAddress));
-
-    return trader->api->ReqUserLoginWithCaptcha(&req, sequenceId());
-  });
-}
+  scheduleQuery(trader->scheduler, query, &settled);
+  settleQueries(trader, settled);
 
-static napi_value reqUserLoginWithText(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqUserLoginWithTextField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, InterfaceProductInfo));
-    CHECK(GetObjectString(env, object, req, ProtocolInfo));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, LoginRemark));
-    CHECK(GetObjectString(env, object, req, Text));
-    CHECK(GetObjectInt32(env, object, req, ClientIPPort));
-    CHECK(GetObjectString(env, object, req, ClientIPAddress));
-
-    return trader->api->ReqUserLoginWithText(&req, sequenceId());
-  });
+  return promise;
 }
 
-static napi_value reqUserLoginWithOTP(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqUserLoginWithOTPField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectString(env, object, req, UserProductInfo));
-    CHECK(GetObjectString(env, object, req, InterfaceProductInfo));
-    CHECK(GetObjectString(env, object, req, ProtocolInfo));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, LoginRemark));
-    CHECK(GetObjectString(env, object, req, OTPPassword));
-    CHECK(GetObjectInt32(env, object, req, ClientIPPort));
-    CHECK(GetObjectString(env, object, req, ClientIPAddress));
-
-    return trader->api->ReqUserLoginWithOTP(&req, sequenceId());
-  });
-}
+// The query may be sent long after, it takes a copy of the request.
+static napi_value queueRequest(napi_env env, Trader *trader, int priority, int64_t timeout, const void *req, size_t size, RequestSender send) {
+  std::vector<uint64_t> copy((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
 
-static napi_value reqOrderInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputOrderField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, OrderRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, OrderPriceType));
-    CHECK(GetObjectChar(env, object, req, Direction));
-    CHECK(GetObjectString(env, object, req, CombOffsetFlag));
-    CHECK(GetObjectString(env, object, req, CombHedgeFlag));
-    CHECK(GetObjectDouble(env, object, req, LimitPrice));
-    CHECK(GetObjectInt32(env, object, req, VolumeTotalOriginal));
-    CHECK(GetObjectChar(env, object, req, TimeCondition));
-    CHECK(GetObjectString(env, object, req, GTDDate));
-    CHECK(GetObjectChar(env, object, req, VolumeCondition));
-    CHECK(GetObjectInt32(env, object, req, MinVolume));
-    CHECK(GetObjectChar(env, object, req, ContingentCondition));
-    CHECK(GetObjectDouble(env, object, req, StopPrice));
-    CHECK(GetObjectChar(env, object, req, ForceCloseReason));
-    CHECK(GetObjectInt32(env, object, req, IsAutoSuspend));
-    CHECK(GetObjectString(env, object, req, BusinessUnit));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, UserForceClose));
-    CHECK(GetObjectInt32(env, object, req, IsSwapOrder));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqOrderInsert(&req, sequenceId());
-  });
-}
+  memcpy(copy.data(), req, size);
 
-static napi_value reqParkedOrderInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcParkedOrderField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, OrderRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, OrderPriceType));
-    CHECK(GetObjectChar(env, object, req, Direction));
-    CHECK(GetObjectString(env, object, req, CombOffsetFlag));
-    CHECK(GetObjectString(env, object, req, CombHedgeFlag));
-    CHECK(GetObjectDouble(env, object, req, LimitPrice));
-    CHECK(GetObjectInt32(env, object, req, VolumeTotalOriginal));
-    CHECK(GetObjectChar(env, object, req, TimeCondition));
-    CHECK(GetObjectString(env, object, req, GTDDate));
-    CHECK(GetObjectChar(env, object, req, VolumeCondition));
-    CHECK(GetObjectInt32(env, object, req, MinVolume));
-    CHECK(GetObjectChar(env, object, req, ContingentCondition));
-    CHECK(GetObjectDouble(env, object, req, StopPrice));
-    CHECK(GetObjectChar(env, object, req, ForceCloseReason));
-    CHECK(GetObjectInt32(env, object, req, IsAutoSuspend));
-    CHECK(GetObjectString(env, object, req, BusinessUnit));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, UserForceClose));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ParkedOrderID));
-    CHECK(GetObjectChar(env, object, req, UserType));
-    CHECK(GetObjectChar(env, object, req, Status));
-    CHECK(GetObjectInt32(env, object, req, ErrorID));
-    CHECK(GetObjectString(env, object, req, ErrorMsg));
-    CHECK(GetObjectInt32(env, object, req, IsSwapOrder));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqParkedOrderInsert(&req, sequenceId());
-  });
-}
+  QuerySender sender = [copy, send](CThostFtdcTraderApi *api, int requestId) mutable {
+    return send(api, copy.data(), requestId);
+  };
 
-static napi_value reqParkedOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcParkedOrderActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, OrderActionRef));
-    CHECK(GetObjectString(env, object, req, OrderRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, OrderSysID));
-    CHECK(GetObjectChar(env, object, req, ActionFlag));
-    CHECK(GetObjectDouble(env, object, req, LimitPrice));
-    CHECK(GetObjectInt32(env, object, req, VolumeChange));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, ParkedOrderActionID));
-    CHECK(GetObjectChar(env, object, req, UserType));
-    CHECK(GetObjectChar(env, object, req, Status));
-    CHECK(GetObjectInt32(env, object, req, ErrorID));
-    CHECK(GetObjectString(env, object, req, ErrorMsg));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqParkedOrderAction(&req, sequenceId());
-  });
+  return startQuery(env, trader, priority, timeout, std::move(sender), nullptr);
 }
 
-static napi_value reqOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputOrderActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, OrderActionRef));
-    CHECK(GetObjectString(env, object, req, OrderRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, OrderSysID));
-    CHECK(GetObjectChar(env, object, req, ActionFlag));
-    CHECK(GetObjectDouble(env, object, req, LimitPrice));
-    CHECK(GetObjectInt32(env, object, req, VolumeChange));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqOrderAction(&req, sequenceId());
-  });
-}
+// The request is read in one pass over the properties the object has.
+static bool unmarshalRequest(napi_env env, napi_value object, const RequestMethod *method, void *req) {
+  const CtpField *mistyped;
+  bool isTypesOk;
 
-static napi_value reqQryMaxOrderVolume(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryMaxOrderVolumeField req;
+  CHECK(checkIsObject(env, object, &isTypesOk));
 
-    memset(&req, 0, sizeof(req));
+  if (!isTypesOk)
+    return false;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectChar(env, object, req, Direction));
-    CHECK(GetObjectChar(env, object, req, OffsetFlag));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectInt32(env, object, req, MaxVolume));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  memset(req, 0, method->size);
 
-    return trader->api->ReqQryMaxOrderVolume(&req, sequenceId());
-  });
-}
+  CHECK(unmarshalCtpFields(env, object, method->table, req, &mistyped));
 
-static napi_value reqSettlementInfoConfirm(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcSettlementInfoConfirmField req;
+  if (mistyped) {
+    char message[128];
 
-    memset(&req, 0, sizeof(req));
+    snprintf(message, sizeof(message), "The field %s should be a %s", mistyped->name, ctpFieldTypeName(mistyped));
+    napi_throw_type_error(env, nullptr, message);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ConfirmDate));
-    CHECK(GetObjectString(env, object, req, ConfirmTime));
-    CHECK(GetObjectInt32(env, object, req, SettlementID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+    return false;
+  }
 
-    return trader->api->ReqSettlementInfoConfirm(&req, sequenceId());
-  });
+  return true;
 }
 
-static napi_value reqRemoveParkedOrder(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcRemoveParkedOrderField req;
+// Every req and query method, told apart by its data. A req method sends the request, a query method queues it.
+static napi_value callRequest(napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  int result;
+  int64_t option = 0;
+  napi_value argv[2], jsthis, retval;
+  alignas(8) uint8_t req[PREPARED_REQUEST_SIZE];
+  const RequestMethod *method;
+  Trader *trader;
+  bool isTypesOk = true;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, (void **)&method));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ParkedOrderID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+  if (!unmarshalRequest(env, argv[0], method, req))
+    return nullptr;
 
-    return trader->api->ReqRemoveParkedOrder(&req, sequenceId());
-  });
-}
+  if (method->priority < 0) {
+    if (argc > 1)
+      CHECK(getOptionalNumber(env, argv[1], &option, &isTypesOk));
 
-static napi_value reqRemoveParkedOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcRemoveParkedOrderActionField req;
+    if (!isTypesOk || option < 0 || option > REQUEST_ID_MAX) {
+      napi_throw_type_error(env, nullptr, "The requestId should be a number from 1 to 1073741823");
+      return nullptr;
+    }
 
-    memset(&req, 0, sizeof(req));
+    if (method->hook)
+      method->hook(trader, req);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ParkedOrderActionID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+    result = method->send(trader->api, req, option > 0 ? (int)option : nextRequestId());
+    CHECK(napi_create_int32(env, result, &retval));
 
-    return trader->api->ReqRemoveParkedOrderAction(&req, sequenceId());
-  });
-}
+    return retval;
+  }
 
-static napi_value reqExecOrderInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputExecOrderField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExecOrderRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectInt32(env, object, req, Volume));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectString(env, object, req, BusinessUnit));
-    CHECK(GetObjectChar(env, object, req, OffsetFlag));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectChar(env, object, req, ActionType));
-    CHECK(GetObjectChar(env, object, req, PosiDirection));
-    CHECK(GetObjectChar(env, object, req, ReservePositionFlag));
-    CHECK(GetObjectChar(env, object, req, CloseFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqExecOrderInsert(&req, sequenceId());
-  });
-}
+  int priority = method->priority;
 
-static napi_value reqExecOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputExecOrderActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, ExecOrderActionRef));
-    CHECK(GetObjectString(env, object, req, ExecOrderRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ExecOrderSysID));
-    CHECK(GetObjectChar(env, object, req, ActionFlag));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqExecOrderAction(&req, sequenceId());
-  });
-}
+  option = QUERY_TIMEOUT;
 
-static napi_value reqForQuoteInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputForQuoteField req;
+  if (argc > 1)
+    CHECK(getQueryOptions(env, argv[1], &option, &priority, &isTypesOk));
 
-    memset(&req, 0, sizeof(req));
+  if (!isTypesOk || option < 0) {
+    napi_throw_type_error(env, nullptr, "The query options should be a timeout in milliseconds or an object of timeout and priority");
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ForQuoteRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
+  return queueRequest(env, trader, priority, option, req, method->size, method->send);
+}
+
+// The req methods by their CTP name, with the struct they take and the hook run before sending.
+#define TRADER_REQUESTS(X)                                                                                                   \
+  X(Authenticate, CThostFtdcReqAuthenticateField, nullptr)                                                                   \
+  X(UserLogin, CThostFtdcReqUserLoginField, rememberBrokerId<CThostFtdcReqUserLoginField>)                                   \
+  X(UserLogout, CThostFtdcUserLogoutField, nullptr)                                                                          \
+  X(UserPasswordUpdate, CThostFtdcUserPasswordUpdateField, nullptr)                                                          \
+  X(TradingAccountPasswordUpdate, CThostFtdcTradingAccountPasswordUpdateField, nullptr)                                      \
+  X(UserAuthMethod, CThostFtdcReqUserAuthMethodField, nullptr)                                                               \
+  X(GenUserCaptcha, CThostFtdcReqGenUserCaptchaField, nullptr)                                                               \
+  X(GenUserText, CThostFtdcReqGenUserTextField, nullptr)                                                                     \
+  X(UserLoginWithCaptcha, CThostFtdcReqUserLoginWithCaptchaField, rememberBrokerId<CThostFtdcReqUserLoginWithCaptchaField>)  \
+  X(UserLoginWithText, CThostFtdcReqUserLoginWithTextField, rememberBrokerId<CThostFtdcReqUserLoginWithTextField>)           \
+  X(UserLoginWithOTP, CThostFtdcReqUserLoginWithOTPField, rememberBrokerId<CThostFtdcReqUserLoginWithOTPField>)              \
+  X(OrderInsert, CThostFtdcInputOrderField, nullptr)                                                                         \
+  X(ParkedOrderInsert, CThostFtdcParkedOrderField, nullptr)                                                                  \
+  X(ParkedOrderAction, CThostFtdcParkedOrderActionField, nullptr)                                                            \
+  X(OrderAction, CThostFtdcInputOrderActionField, nullptr)                                                                   \
+  X(SettlementInfoConfirm, CThostFtdcSettlementInfoConfirmField, nullptr)                                                    \
+  X(RemoveParkedOrder, CThostFtdcRemoveParkedOrderField, nullptr)                                                            \
+  X(RemoveParkedOrderAction, CThostFtdcRemoveParkedOrderActionField, nullptr)                                                \
+  X(ExecOrderInsert, CThostFtdcInputExecOrderField, nullptr)                                                                 \
+  X(ExecOrderAction, CThostFtdcInputExecOrderActionField, nullptr)                                                           \
+  X(ForQuoteInsert, CThostFtdcInputForQuoteField, nullptr)                                                                   \
+  X(QuoteInsert, CThostFtdcInputQuoteField, nullptr)                                                                         \
+  X(QuoteAction, CThostFtdcInputQuoteActionField, nullptr)                                                                   \
+  X(BatchOrderAction, CThostFtdcInputBatchOrderActionField, nullptr)                                                         \
+  X(OptionSelfCloseInsert, CThostFtdcInputOptionSelfCloseField, nullptr)                                                     \
+  X(OptionSelfCloseAction, CThostFtdcInputOptionSelfCloseActionField, nullptr)                                               \
+  X(CombActionInsert, CThostFtdcInputCombActionField, nullptr)                                                               \
+  X(QueryCFMMCTradingAccountToken, CThostFtdcQueryCFMMCTradingAccountTokenField, nullptr)                                    \
+  X(FromBankToFutureByFuture, CThostFtdcReqTransferField, nullptr)                                                           \
+  X(FromFutureToBankByFuture, CThostFtdcReqTransferField, nullptr)                                                           \
+  X(QueryBankAccountMoneyByFuture, CThostFtdcReqQueryAccountField, nullptr)
 
-    return trader->api->ReqForQuoteInsert(&req, sequenceId());
-  });
-}
+/*
+ * The ReqQry methods, each also comes as a query method of this default
+ * priority: the session's own orders, trades, positions and funds first,
+ * reference data last.
+ */
+#define TRADER_QUERIES(X)                                                                  \
+  X(MaxOrderVolume, CThostFtdcQryMaxOrderVolumeField, HIGH)                                \
+  X(Order, CThostFtdcQryOrderField, HIGH)                                                  \
+  X(Trade, CThostFtdcQryTradeField, HIGH)                                                  \
+  X(InvestorPosition, CThostFtdcQryInvestorPositionField, HIGH)                            \
+  X(TradingAccount, CThostFtdcQryTradingAccountField, HIGH)                                \
+  X(Investor, CThostFtdcQryInvestorField, NORMAL)                                          \
+  X(TradingCode, CThostFtdcQryTradingCodeField, NORMAL)                                    \
+  X(InstrumentMarginRate, CThostFtdcQryInstrumentMarginRateField, LOW)                     \
+  X(InstrumentCommissionRate, CThostFtdcQryInstrumentCommissionRateField, LOW)             \
+  X(Exchange, CThostFtdcQryExchangeField, LOW)                                             \
+  X(Product, CThostFtdcQryProductField, LOW)                                               \
+  X(Instrument, CThostFtdcQryInstrumentField, LOW)                                         \
+  X(DepthMarketData, CThostFtdcQryDepthMarketDataField, LOW)                               \
+  X(TraderOffer, CThostFtdcQryTraderOfferField, NORMAL)                                    \
+  X(SettlementInfo, CThostFtdcQrySettlementInfoField, LOW)                                 \
+  X(TransferBank, CThostFtdcQryTransferBankField, LOW)                                     \
+  X(InvestorPositionDetail, CThostFtdcQryInvestorPositionDetailField, HIGH)                \
+  X(Notice, CThostFtdcQryNoticeField, LOW)                                                 \
+  X(SettlementInfoConfirm, CThostFtdcQrySettlementInfoConfirmField, NORMAL)                \
+  X(InvestorPositionCombineDetail, CThostFtdcQryInvestorPositionCombineDetailField, HIGH)  \
+  X(CFMMCTradingAccountKey, CThostFtdcQryCFMMCTradingAccountKeyField, NORMAL)              \
+  X(EWarrantOffset, CThostFtdcQryEWarrantOffsetField, NORMAL)                              \
+  X(InvestorProductGroupMargin, CThostFtdcQryInvestorProductGroupMarginField, NORMAL)      \
+  X(ExchangeMarginRate, CThostFtdcQryExchangeMarginRateField, LOW)                         \
+  X(ExchangeMarginRateAdjust, CThostFtdcQryExchangeMarginRateAdjustField, LOW)             \
+  X(ExchangeRate, CThostFtdcQryExchangeRateField, LOW)                                     \
+  X(SecAgentACIDMap, CThostFtdcQrySecAgentACIDMapField, NORMAL)                            \
+  X(ProductExchRate, CThostFtdcQryProductExchRateField, LOW)                               \
+  X(ProductGroup, CThostFtdcQryProductGroupField, LOW)                                     \
+  X(MMInstrumentCommissionRate, CThostFtdcQryMMInstrumentCommissionRateField, LOW)         \
+  X(MMOptionInstrCommRate, CThostFtdcQryMMOptionInstrCommRateField, LOW)                   \
+  X(InstrumentOrderCommRate, CThostFtdcQryInstrumentOrderCommRateField, LOW)               \
+  X(SecAgentTradingAccount, CThostFtdcQryTradingAccountField, NORMAL)                      \
+  X(SecAgentCheckMode, CThostFtdcQrySecAgentCheckModeField, NORMAL)                        \
+  X(SecAgentTradeInfo, CThostFtdcQrySecAgentTradeInfoField, NORMAL)                        \
+  X(OptionInstrTradeCost, CThostFtdcQryOptionInstrTradeCostField, LOW)                     \
+  X(OptionInstrCommRate, CThostFtdcQryOptionInstrCommRateField, LOW)                       \
+  X(ExecOrder, CThostFtdcQryExecOrderField, HIGH)                                          \
+  X(ForQuote, CThostFtdcQryForQuoteField, HIGH)                                            \
+  X(Quote, CThostFtdcQryQuoteField, HIGH)                                                  \
+  X(OptionSelfClose, CThostFtdcQryOptionSelfCloseField, HIGH)                              \
+  X(InvestUnit, CThostFtdcQryInvestUnitField, NORMAL)                                      \
+  X(CombInstrumentGuard, CThostFtdcQryCombInstrumentGuardField, LOW)                       \
+  X(CombAction, CThostFtdcQryCombActionField, HIGH)                                        \
+  X(TransferSerial, CThostFtdcQryTransferSerialField, NORMAL)                              \
+  X(Accountregister, CThostFtdcQryAccountregisterField, NORMAL)                            \
+  X(ContractBank, CThostFtdcQryContractBankField, LOW)                                     \
+  X(ParkedOrder, CThostFtdcQryParkedOrderField, HIGH)                                      \
+  X(ParkedOrderAction, CThostFtdcQryParkedOrderActionField, HIGH)                          \
+  X(TradingNotice, CThostFtdcQryTradingNoticeField, LOW)                                   \
+  X(BrokerTradingParams, CThostFtdcQryBrokerTradingParamsField, LOW)                       \
+  X(BrokerTradingAlgos, CThostFtdcQryBrokerTradingAlgosField, LOW)                         \
+  X(ClassifiedInstrument, CThostFtdcQryClassifiedInstrumentField, LOW)                     \
+  X(CombPromotionParam, CThostFtdcQryCombPromotionParamField, LOW)                         \
+  X(RiskSettleInvstPosition, CThostFtdcQryRiskSettleInvstPositionField, NORMAL)            \
+  X(RiskSettleProductStatus, CThostFtdcQryRiskSettleProductStatusField, NORMAL)
+
+#define REQUEST_METHOD(name, type, hook) {"req" #name, ctpFields<type>(), sizeof(type), sendRequest<type, &CThostFtdcTraderApi::Req##name>, hook, -1},
+
+#define QUERY_METHODS(name, type, priority)                                                                                            \
+  {"reqQry" #name, ctpFields<type>(), sizeof(type), sendRequest<type, &CThostFtdcTraderApi::ReqQry##name>, nullptr, -1},              \
+  {"query" #name, ctpFields<type>(), sizeof(type), sendRequest<type, &CThostFtdcTraderApi::ReqQry##name>, nullptr, QUERY_PRIORITY_##priority},
+
+#define CHECK_REQUEST_SIZE(name, type, unused) static_assert(sizeof(type) <= PREPARED_REQUEST_SIZE, "PREPARED_REQUEST_SIZE is too small");
+
+TRADER_REQUESTS(CHECK_REQUEST_SIZE)
+TRADER_QUERIES(CHECK_REQUEST_SIZE)
+
+// Both the methods of the class and the names prepare knows, it never looks a method up on the object.
+static const RequestMethod requestMethods[] = {TRADER_REQUESTS(REQUEST_METHOD) TRADER_QUERIES(QUERY_METHODS)};
+
+static const RequestMethod *findRequestMethod(const char *name) {
+  for (int i = 0; i < arraysize(requestMethods); ++i)
+    if (0 == strcmp(name, requestMethods[i].name))
+      return &requestMethods[i];
+
+  return nullptr;
+}
+
+static bool processBatch(Trader *trader, const Listener &listener, Message *message, bool *isPending) {
+  MessageBatch *batch = createMessageBatch(listener.batchSize);
+  uint64_t deadline = uv_hrtime() + (uint64_t)listener.batchWindow * 1000;
+  int event = message->event;
+
+  if (!batch) {
+    TraderSpi::done(*message);
+    return ET_QUIT != event;
+  }
 
-static napi_value reqQuoteInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputQuoteField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, QuoteRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectDouble(env, object, req, AskPrice));
-    CHECK(GetObjectDouble(env, object, req, BidPrice));
-    CHECK(GetObjectInt32(env, object, req, AskVolume));
-    CHECK(GetObjectInt32(env, object, req, BidVolume));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectString(env, object, req, BusinessUnit));
-    CHECK(GetObjectChar(env, object, req, AskOffsetFlag));
-    CHECK(GetObjectChar(env, object, req, BidOffsetFlag));
-    CHECK(GetObjectChar(env, object, req, AskHedgeFlag));
-    CHECK(GetObjectChar(env, object, req, BidHedgeFlag));
-    CHECK(GetObjectString(env, object, req, AskOrderRef));
-    CHECK(GetObjectString(env, object, req, BidOrderRef));
-    CHECK(GetObjectString(env, object, req, ForQuoteSysID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-    CHECK(GetObjectString(env, object, req, ReplaceSysID));
-
-    return trader->api->ReqQuoteInsert(&req, sequenceId());
-  });
-}
+  batch->messages[batch->count++] = *message;
 
-static napi_value reqQuoteAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputQuoteActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, QuoteActionRef));
-    CHECK(GetObjectString(env, object, req, QuoteRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, QuoteSysID));
-    CHECK(GetObjectChar(env, object, req, ActionFlag));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqQuoteAction(&req, sequenceId());
-  });
-}
+  while (batch->count < listener.batchSize) {
+    if (QUEUE_SUCCESS != trader->spi->pollUntil(message, deadline))
+      break;
 
-static napi_value reqBatchOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputBatchOrderActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, OrderActionRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqBatchOrderAction(&req, sequenceId());
-  });
-}
+    // A response to a query, pending or not, goes back through processMessage.
+    if (message->event != event || isQueryRequestId(message->requestId)) {
+      *isPending = true;
+      break;
+    }
 
-static napi_value reqOptionSelfCloseInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputOptionSelfCloseField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, OptionSelfCloseRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectInt32(env, object, req, Volume));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectString(env, object, req, BusinessUnit));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectChar(env, object, req, OptSelfCloseFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqOptionSelfCloseInsert(&req, sequenceId());
-  });
-}
+    batch->messages[batch->count++] = *message;
+  }
 
-static napi_value reqOptionSelfCloseAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputOptionSelfCloseActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectInt32(env, object, req, OptionSelfCloseActionRef));
-    CHECK(GetObjectString(env, object, req, OptionSelfCloseRef));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, OptionSelfCloseSysID));
-    CHECK(GetObjectChar(env, object, req, ActionFlag));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqOptionSelfCloseAction(&req, sequenceId());
-  });
-}
+  batch->dispatched = uv_hrtime();
 
-static napi_value reqCombActionInsert(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcInputCombActionField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, CombActionRef));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, Direction));
-    CHECK(GetObjectInt32(env, object, req, Volume));
-    CHECK(GetObjectChar(env, object, req, CombDirection));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, MacAddress));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectInt32(env, object, req, FrontID));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, IPAddress));
-
-    return trader->api->ReqCombActionInsert(&req, sequenceId());
-  });
-}
+  if (napi_ok != napi_call_threadsafe_function(listener.tsfn, (void *)batch, napi_tsfn_blocking)) {
+    for (uint32_t i = 0; i < batch->count; ++i)
+      TraderSpi::done(batch->messages[i]);
 
-static napi_value reqQryOrder(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryOrderField req;
+    freeMessageBatch(batch);
+  }
 
-    memset(&req, 0, sizeof(req));
+  return ET_QUIT != event;
+}
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, OrderSysID));
-    CHECK(GetObjectString(env, object, req, InsertTimeStart));
-    CHECK(GetObjectString(env, object, req, InsertTimeEnd));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+static bool processMessage(Trader *trader, Message *message, bool *isPending) {
+  int index = message->event - ET_BASE;
 
-    return trader->api->ReqQryOrder(&req, sequenceId());
-  });
-}
+  *isPending = false;
 
-static napi_value reqQryTrade(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTradeField req;
+  if (isQueryRequestId(message->requestId)) {
+    std::vector<Query *> settled;
 
-    memset(&req, 0, sizeof(req));
+    if (collectQuery(trader->scheduler, message, &settled)) {
+      settleQueries(trader, settled);
+      return true;
+    }
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, TradeID));
-    CHECK(GetObjectString(env, object, req, TradeTimeStart));
-    CHECK(GetObjectString(env, object, req, TradeTimeEnd));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (index < 0 || index >= ET_COUNT) {
+    fprintf(stderr, "<Trader> Unknown message event %d\n", message->event);
+    TraderSpi::done(*message);
+    return true;
+  }
 
-    return trader->api->ReqQryTrade(&req, sequenceId());
-  });
-}
+  const Listener *slot = trader->listeners[index].load(std::memory_order_acquire);
 
-static napi_value reqQryInvestorPosition(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestorPositionField req;
+  if (!slot) {
+    TraderSpi::done(*message);
+    return ET_QUIT != message->event;
+  }
 
-    memset(&req, 0, sizeof(req));
+  const Listener &listener = *slot;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (listener.batchSize > 0)
+    return processBatch(trader, listener, message, isPending);
 
-    return trader->api->ReqQryInvestorPosition(&req, sequenceId());
-  });
-}
+  // A batch of one carries the timestamps, the payload is owned by the JS
+  // thread from here on and released in callJs.
+  MessageBatch *envelope = createMessageBatch(1);
 
-static napi_value reqQryTradingAccount(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTradingAccountField req;
+  if (!envelope) {
+    TraderSpi::done(*message);
+    return ET_QUIT != message->event;
+  }
 
-    memset(&req, 0, sizeof(req));
+  envelope->messages[envelope->count++] = *message;
+  envelope->dispatched = uv_hrtime();
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectChar(env, object, req, BizType));
-    CHECK(GetObjectString(env, object, req, AccountID));
+  if (napi_ok != napi_call_threadsafe_function(listener.tsfn, (void *)envelope, napi_tsfn_blocking)) {
+    TraderSpi::done(*message);
+    freeMessageBatch(envelope);
+  }
 
-    return trader->api->ReqQryTradingAccount(&req, sequenceId());
-  });
+  return ET_QUIT != message->event;
 }
 
-static napi_value reqQryInvestor(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestorField req;
-
-    memset(&req, 0, sizeof(req));
+static void processThread(void *data) {
+  Trader *trader = (Trader *)data;
+  Message message;
+  bool isRunning = true, isPending = false;
+  std::vector<Query *> settled;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
+  // Sleeps until the next query is due or times out, and wakes up now and
+  // then for a query queued while it was asleep.
+  while (isRunning) {
+    uint64_t deadline = uv_hrtime() + (uint64_t)QUERY_SWEEP_INTERVAL * 1000 * 1000;
 
-    return trader->api->ReqQryInvestor(&req, sequenceId());
-  });
-}
+    if (hasQueries(trader->scheduler)) {
+      runQueries(trader->scheduler, &settled);
+      settleQueries(trader, settled);
 
-static napi_value reqQryTradingCode(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTradingCodeField req;
+      uint64_t wakeup = trader->scheduler->wakeup.load(std::memory_order_relaxed);
 
-    memset(&req, 0, sizeof(req));
+      if (wakeup < deadline)
+        deadline = wakeup;
+    }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ClientID));
-    CHECK(GetObjectChar(env, object, req, ClientIDType));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+    if (!isPending && QUEUE_SUCCESS != trader->spi->pollUntil(&message, deadline))
+      continue;
 
-    return trader->api->ReqQryTradingCode(&req, sequenceId());
-  });
+    isRunning = processMessage(trader, &message, &isPending);
+  }
 }
 
-static napi_value reqQryInstrumentMarginRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInstrumentMarginRateField req;
+// The events a listener may take in reuse mode, nullptr for any other.
+static const ReuseClass *getReuseClass(int event) {
+  static const ReuseClass order = {ctpFields<CThostFtdcOrderField>(), rtnOrder, sizeof(CThostFtdcOrderField), objectFactoryId()};
+  static const ReuseClass trade = {ctpFields<CThostFtdcTradeField>(), rtnTrade, sizeof(CThostFtdcTradeField), objectFactoryId()};
 
-    memset(&req, 0, sizeof(req));
+  switch (event) {
+  case ET_RTNORDER:
+    return &order;
+  case ET_RTNTRADE:
+    return &trade;
+  default:
+    return nullptr;
+  }
+}
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+// A reusing listener gets its object of the instrument updated, any other a value as its delivery asks.
+static napi_status getListenerValue(napi_env env, const CallContext *context, const Message *message, napi_value *result) {
+  if (context->reuse)
+    return getReusedValue(env, (ReuseCache *)context->reuse, message, result);
 
-    return trader->api->ReqQryInstrumentMarginRate(&req, sequenceId());
-  });
+  return getTraderMessageValue(env, message, context->delivery, result);
 }
 
-static napi_value reqQryInstrumentCommissionRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInstrumentCommissionRateField req;
+// Without env the context may already be finalized, only the messages are freed.
+static void callJs(napi_env env, napi_value js_cb, void *context, void *data) {
+  MessageBatch *envelope = (MessageBatch *)data;
+  const Message *message = &envelope->messages[0];
+  napi_value undefined, argv[3];
 
-    memset(&req, 0, sizeof(req));
+  if (env) {
+    uint64_t called = uv_hrtime(), converted;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    CHECK(napi_get_undefined(env, &undefined));
+    CHECK(getListenerValue(env, (CallContext *)context, message, &argv[0]));
+    CHECK(napi_create_uint32(env, message->requestId, &argv[1]));
+    CHECK(napi_get_boolean(env, message->isLast, &argv[2]));
 
-    return trader->api->ReqQryInstrumentCommissionRate(&req, sequenceId());
-  });
-}
-
-static napi_value reqQryExchange(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryExchangeField req;
+    converted = uv_hrtime();
 
-    memset(&req, 0, sizeof(req));
+    CHECK(napi_call_function(env, undefined, js_cb, 3, argv, nullptr));
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
+    recordDelivery(((CallContext *)context)->latency, envelope->messages, 1, envelope->dispatched, called, converted, uv_hrtime());
+  }
 
-    return trader->api->ReqQryExchange(&req, sequenceId());
-  });
+  TraderSpi::done(envelope->messages[0]);
+  freeMessageBatch(envelope);
 }
 
-static napi_value reqQryProduct(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryProductField req;
+static void callJsBatch(napi_env env, napi_value js_cb, void *context, void *data) {
+  MessageBatch *batch = (MessageBatch *)data;
+  napi_value undefined, argv, element;
 
-    memset(&req, 0, sizeof(req));
+  if (env) {
+    uint64_t called = uv_hrtime(), converted;
 
-    CHECK(GetObjectChar(env, object, req, ProductClass));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ProductID));
+    CHECK(napi_get_undefined(env, &undefined));
+    CHECK(napi_create_array_with_length(env, batch->count, &argv));
 
-    return trader->api->ReqQryProduct(&req, sequenceId());
-  });
-}
+    for (uint32_t i = 0; i < batch->count; ++i) {
+      CHECK(getListenerValue(env, (CallContext *)context, &batch->messages[i], &element));
+      CHECK(napi_set_element(env, argv, i, element));
+    }
 
-static napi_value reqQryInstrument(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInstrumentField req;
+    converted = uv_hrtime();
 
-    memset(&req, 0, sizeof(req));
+    CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, ExchangeInstID));
-    CHECK(GetObjectString(env, object, req, ProductID));
+    recordDelivery(((CallContext *)context)->latency, batch->messages, batch->count, batch->dispatched, called, converted, uv_hrtime());
+  }
 
-    return trader->api->ReqQryInstrument(&req, sequenceId());
-  });
+  for (uint32_t i = 0; i < batch->count; ++i)
+    TraderSpi::done(batch->messages[i]);
+
+  freeMessageBatch(batch);
 }
 
-static napi_value reqQryDepthMarketData(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryDepthMarketDataField req;
+// Settles the promise of a finished query, rows are converted in one pass.
+static void callJsSettle(napi_env env, napi_value js_cb, void *context, void *data) {
+  QuerySettler *settler = (QuerySettler *)context;
+  Query *query = (Query *)data;
 
-    memset(&req, 0, sizeof(req));
+  if (env) {
+    napi_value result, value;
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    if (query->reason) {
+      CHECK(napi_reject_deferred(env, query->deferred, createQueryError(env, query->reason, query->requestId)));
+    } else if (query->result != 0) {
+      char message[64];
 
-    return trader->api->ReqQryDepthMarketData(&req, sequenceId());
-  });
-}
+      snprintf(message, sizeof(message), "The query request failed with %d", query->result);
+      result = createQueryError(env, message, query->requestId);
 
-static napi_value reqQryTraderOffer(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTraderOfferField req;
+      CHECK(napi_create_int32(env, query->result, &value));
+      CHECK(napi_set_named_property(env, result, "ErrorID", value));
+      CHECK(napi_reject_deferred(env, query->deferred, result));
+    } else if (ET_RSPERROR == query->error.event) {
+      if (query->error.data) {
+        CThostFtdcRspInfoField *pRspInfo = MessageData<CThostFtdcRspInfoField>(&query->error);
 
-    memset(&req, 0, sizeof(req));
+        CHECK(getTraderMessageValue(env, &query->error, DELIVERY_OBJECT, &value));
+        CHECK(napi_get_named_property(env, value, "ErrorMsg", &value));
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ParticipantID));
-    CHECK(GetObjectString(env, object, req, TraderID));
+        result = createQueryError(env, value, query->requestId);
 
-    return trader->api->ReqQryTraderOffer(&req, sequenceId());
-  });
-}
+        CHECK(napi_create_int32(env, pRspInfo->ErrorID, &value));
+        CHECK(napi_set_named_property(env, result, "ErrorID", value));
+      } else {
+        result = createQueryError(env, "The query failed", query->requestId);
+      }
 
-static napi_value reqQrySettlementInfo(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQrySettlementInfoField req;
+      CHECK(napi_reject_deferred(env, query->deferred, result));
+    } else if (query->convert) {
+      CHECK(query->convert(env, query, &result));
+      CHECK(napi_resolve_deferred(env, query->deferred, result));
+    } else {
+      CHECK(napi_create_array_with_length(env, query->rows.size(), &result));
 
-    memset(&req, 0, sizeof(req));
+      for (uint32_t i = 0; i < (uint32_t)query->rows.size(); ++i) {
+        CHECK(getTraderMessageValue(env, &query->rows[i], DELIVERY_OBJECT, &value));
+        CHECK(napi_set_element(env, result, i, value));
+      }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+      CHECK(napi_resolve_deferred(env, query->deferred, result));
+    }
 
-    return trader->api->ReqQrySettlementInfo(&req, sequenceId());
-  });
+    if (--settler->pending == 0)
+      CHECK(napi_unref_threadsafe_function(env, settler->tsfn));
+  }
+
+  freeQuery(query);
 }
 
-static napi_value reqQryTransferBank(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTransferBankField req;
+static void finalizeSettler(napi_env env, void *data, void *hint) {
+  delete (QuerySettler *)data;
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_status createQuerySettler(napi_env env, QuerySettler **result) {
+  QuerySettler *settler = new QuerySettler();
+  napi_value name;
+  napi_status status;
 
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBrchID));
+  if (!settler)
+    return napi_generic_failure;
 
-    return trader->api->ReqQryTransferBank(&req, sequenceId());
-  });
-}
+  settler->pending = 0;
 
-static napi_value reqQryInvestorPositionDetail(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestorPositionDetailField req;
+  CHECK(napi_create_string_utf8(env, "query", NAPI_AUTO_LENGTH, &name));
 
-    memset(&req, 0, sizeof(req));
+  status = napi_create_threadsafe_function(env, nullptr, nullptr, name, 0, 1, settler, finalizeSettler, settler, callJsSettle, &settler->tsfn);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (status != napi_ok) {
+    delete settler;
+    return status;
+  }
 
-    return trader->api->ReqQryInvestorPositionDetail(&req, sequenceId());
-  });
+  *result = settler;
+  return napi_unref_threadsafe_function(env, settler->tsfn);
 }
 
-static napi_value reqQryNotice(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryNoticeField req;
+static void finalizeContext(napi_env env, void *data, void *hint) {
+  CallContext *context = (CallContext *)data;
 
-    memset(&req, 0, sizeof(req));
+  if (context->reuse)
+    freeReuseCache(env, (ReuseCache *)context->reuse);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-
-    return trader->api->ReqQryNotice(&req, sequenceId());
-  });
+  freeCallContext(context);
 }
 
-static napi_value reqQrySettlementInfoConfirm(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQrySettlementInfoConfirmField req;
+static napi_status createCallFunction(napi_env env, napi_value func, napi_value name, int event, LatencyRecorder *latency, Listener *listener) {
+  CallContext *context = createCallContext(event, latency, nullptr);
 
-    memset(&req, 0, sizeof(req));
+  if (!context)
+    return napi_generic_failure;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+  context->delivery = listener->delivery;
 
-    return trader->api->ReqQrySettlementInfoConfirm(&req, sequenceId());
-  });
-}
+  if (DELIVERY_REUSE == listener->delivery && !(context->reuse = createReuseCache(getReuseClass(event)))) {
+    freeCallContext(context);
+    return napi_generic_failure;
+  }
 
-static napi_value reqQryInvestorPositionCombineDetail(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestorPositionCombineDetailField req;
+  return napi_create_threadsafe_function(env, func, nullptr, name, listener->maxInflight, 1, context, finalizeContext, context, listener->batchSize > 0 ? callJsBatch : callJs, &listener->tsfn);
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_value on(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[2] = {napi_string, napi_function};
+  size_t argc = 3;
+  napi_value argv[3], jsthis;
+  Listener listener;
+  Trader *trader;
+  char fname[64];
+  int event;
+  bool isTypesOk;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, CombInstrumentID));
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    return trader->api->ReqQryInvestorPositionCombineDetail(&req, sequenceId());
-  });
-}
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
 
-static napi_value reqQryCFMMCTradingAccountKey(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryCFMMCTradingAccountKeyField req;
+  if (!isTypesOk)
+    return nullptr;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(getListenerOptions(env, argc, argv, &listener, &isTypesOk));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
+  if (!isTypesOk)
+    return nullptr;
 
-    return trader->api->ReqQryCFMMCTradingAccountKey(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_value_string_utf8(env, argv[0], fname, sizeof(fname), nullptr));
 
-static napi_value reqQryEWarrantOffset(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryEWarrantOffsetField req;
+  event = TraderSpi::eventId(fname);
 
-    memset(&req, 0, sizeof(req));
+  if (event < 0) {
+    napi_throw_type_error(env, nullptr, "Unknown event name");
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (listener.columnar) {
+    napi_throw_type_error(env, nullptr, "Columnar mode only supports rtn-depth-market-data");
+    return nullptr;
+  }
 
-    return trader->api->ReqQryEWarrantOffset(&req, sequenceId());
-  });
-}
+  if (DELIVERY_REUSE == listener.delivery) {
+    if (!getReuseClass(event)) {
+      napi_throw_type_error(env, nullptr, "Reuse mode only supports rtn-order and rtn-trade");
+      return nullptr;
+    }
+
+    // Two updates of an instrument in one batch would be the same object.
+    if (listener.batchSize > 0) {
+      napi_throw_type_error(env, nullptr, "Reuse mode can not be combined with batch mode");
+      return nullptr;
+    }
+  }
 
-static napi_value reqQryInvestorProductGroupMargin(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestorProductGroupMarginField req;
+  // The event id is the context, callJs rebuilds the message from it and the payload.
+  CHECK(createCallFunction(env, argv[1], argv[0], event, trader->latency, &listener));
+  CHECK(napi_ref_threadsafe_function(env, listener.tsfn));
 
-    memset(&req, 0, sizeof(req));
+  // The dispatch thread may still hold the previous listener, keep it until the destructor.
+  Listener *previous = trader->listeners[event - ET_BASE].exchange(new Listener(listener), std::memory_order_acq_rel);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, ProductGroupID));
+  if (previous) {
+    CHECK(napi_unref_threadsafe_function(env, previous->tsfn));
+    trader->retired.push_back(previous);
+  }
 
-    return trader->api->ReqQryInvestorProductGroupMargin(&req, sequenceId());
-  });
+  return jsthis;
 }
 
-static napi_value reqQryExchangeMarginRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryExchangeMarginRateField req;
+static napi_value getQueueStats(napi_env env, napi_callback_info info) {
+  QueueStats stats;
+  napi_value jsthis, object;
+  Trader *trader;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  trader->spi->getQueueStats(&stats);
 
-    return trader->api->ReqQryExchangeMarginRate(&req, sequenceId());
-  });
-}
-
-static napi_value reqQryExchangeMarginRateAdjust(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryExchangeMarginRateAdjustField req;
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetUint32(env, object, "capacity", stats.capacity));
+  CHECK(objectSetUint32(env, object, "depth", stats.depth));
+  CHECK(objectSetUint32(env, object, "highWater", stats.highWater));
+  CHECK(objectSetInt64(env, object, "enqueued", (int64_t)stats.enqueued));
+  CHECK(objectSetInt64(env, object, "dequeued", (int64_t)stats.dequeued));
+  CHECK(objectSetInt64(env, object, "dropped", (int64_t)stats.dropped));
 
-    memset(&req, 0, sizeof(req));
+  return object;
+}
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+static napi_value getLatencyStats(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv, jsthis, stats;
+  Trader *trader;
+  bool reset = false;
 
-    return trader->api->ReqQryExchangeMarginRateAdjust(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_cb_info(env, info, &argc, &argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-static napi_value reqQryExchangeRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryExchangeRateField req;
+  if (argc > 0) {
+    CHECK(napi_coerce_to_bool(env, argv, &argv));
+    CHECK(napi_get_value_bool(env, argv, &reset));
+  }
 
-    memset(&req, 0, sizeof(req));
+  CHECK(getLatencyValue(env, trader->latency, TraderSpi::eventName, &stats));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, FromCurrencyID));
-    CHECK(GetObjectString(env, object, req, ToCurrencyID));
+  if (reset)
+    resetLatency(trader->latency);
 
-    return trader->api->ReqQryExchangeRate(&req, sequenceId());
-  });
+  return stats;
 }
 
-static napi_value reqQrySecAgentACIDMap(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQrySecAgentACIDMapField req;
+static void traderDestructor(napi_env env, void *data, void *hint) {
+  Trader *trader = (Trader *)data;
+
+  if (!trader)
+    return;
 
-    memset(&req, 0, sizeof(req));
+  if (trader->spi) {
+    trader->spi->quit();
+    trader->spi->close();
+    uv_thread_join(&trader->thread);
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+  for (int i = 0; i < ET_COUNT; ++i) {
+    Listener *listener = trader->listeners[i].exchange(nullptr, std::memory_order_relaxed);
 
-    return trader->api->ReqQrySecAgentACIDMap(&req, sequenceId());
-  });
-}
+    if (listener) {
+      napi_unref_threadsafe_function(env, listener->tsfn);
+      delete listener;
+    }
+  }
 
-static napi_value reqQryProductExchRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryProductExchRateField req;
+  for (auto it = trader->retired.begin(); it != trader->retired.end(); ++it)
+    delete *it;
 
-    memset(&req, 0, sizeof(req));
+  trader->retired.clear();
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ProductID));
+  // No more responses will come, the queries still queued or pending are rejected.
+  std::vector<Query *> settled;
 
-    return trader->api->ReqQryProductExchRate(&req, sequenceId());
-  });
-}
+  cancelQueries(trader->scheduler, "The trader was released", &settled);
+  settleQueries(trader, settled, napi_tsfn_nonblocking);
+  freeQueryScheduler(trader->scheduler);
 
-static napi_value reqQryProductGroup(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryProductGroupField req;
+  napi_delete_reference(trader->env, trader->wrapper);
 
-    memset(&req, 0, sizeof(req));
+  if (trader->api) {
+    trader->api->RegisterSpi(nullptr);
+    trader->api->Release();
+  }
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ProductID));
+  if (trader->spi)
+    delete trader->spi;
 
-    return trader->api->ReqQryProductGroup(&req, sequenceId());
-  });
+  releaseLatencyRecorder(trader->latency);
+  delete trader;
 }
 
-static napi_value reqQryMMInstrumentCommissionRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryMMInstrumentCommissionRateField req;
-
-    memset(&req, 0, sizeof(req));
+static napi_status getQueryRate(napi_env env, napi_value options, double *rate, bool *result) {
+  napi_value value;
+  napi_valuetype valuetype;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  *result = true;
 
-    return trader->api->ReqQryMMInstrumentCommissionRate(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_named_property(env, options, "queryRate", &value));
+  CHECK(napi_typeof(env, value, &valuetype));
 
-static napi_value reqQryMMOptionInstrCommRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryMMOptionInstrCommRateField req;
+  if (valuetype == napi_undefined)
+    return napi_ok;
 
-    memset(&req, 0, sizeof(req));
+  if (valuetype == napi_number)
+    CHECK(napi_get_value_double(env, value, rate));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (valuetype != napi_number || !(*rate >= 0)) {
+    napi_throw_type_error(env, nullptr, "The queryRate must be a number of queries per second, 0 for unlimited");
+    *result = false;
+  }
 
-    return trader->api->ReqQryMMOptionInstrCommRate(&req, sequenceId());
-  });
+  return napi_ok;
 }
 
-static napi_value reqQryInstrumentOrderCommRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInstrumentOrderCommRateField req;
+static napi_value getQueryStats(napi_env env, napi_callback_info info) {
+  QueryStats stats;
+  napi_value jsthis, object;
+  Trader *trader;
+
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    memset(&req, 0, sizeof(req));
+  getQueryStats(trader->scheduler, &stats);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetUint32(env, object, "queued", stats.queued));
+  CHECK(objectSetUint32(env, object, "pending", stats.pending));
+  CHECK(objectSetInt64(env, object, "sent", (int64_t)stats.sent));
+  CHECK(objectSetInt64(env, object, "retries", (int64_t)stats.retries));
+  CHECK(objectSetInt64(env, object, "failed", (int64_t)stats.failed));
+  CHECK(objectSetInt64(env, object, "timeouts", (int64_t)stats.timeouts));
 
-    return trader->api->ReqQryInstrumentOrderCommRate(&req, sequenceId());
-  });
+  return object;
 }
 
-static napi_value reqQrySecAgentTradingAccount(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTradingAccountField req;
+static void instrumentCatalogDestructor(napi_env env, void *data, void *hint) {
+  freeInstrumentCatalog((InstrumentCatalog *)data);
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_status newInstrumentCatalog(napi_env env, InstrumentCatalog *catalog, napi_value *result) {
+  Constructors *constructors = getConstructors(env);
+  napi_value cons, external;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectChar(env, object, req, BizType));
-    CHECK(GetObjectString(env, object, req, AccountID));
+  CHECK(napi_get_reference_value(env, constructors->instrumentCatalog, &cons));
+  CHECK(napi_create_external(env, (void *)catalog, nullptr, nullptr, &external));
 
-    return trader->api->ReqQrySecAgentTradingAccount(&req, sequenceId());
-  });
+  return napi_new_instance(env, cons, 1, &external, result);
 }
 
-static napi_value reqQrySecAgentCheckMode(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQrySecAgentCheckModeField req;
+static napi_value loadInstruments(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv[1], jsthis, promise, value;
+  int64_t timeout = QUERY_TIMEOUT;
+  int priority = QUERY_PRIORITY_LOW;
+  char cachePath[260], brokerId[16];
+  Trader *trader;
+  bool refresh = false, isTypesOk;
+
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    memset(&req, 0, sizeof(req));
+  snprintf(cachePath, sizeof(cachePath), "%s", trader->flowPath);
+  snprintf(brokerId, sizeof(brokerId), "%s", trader->brokerId);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
+  if (argc > 0) {
+    CHECK(checkIsObject(env, argv[0], &isTypesOk));
 
-    return trader->api->ReqQrySecAgentCheckMode(&req, sequenceId());
-  });
-}
+    if (!isTypesOk)
+      return nullptr;
 
-static napi_value reqQrySecAgentTradeInfo(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQrySecAgentTradeInfoField req;
+    CHECK(objectGetString(env, argv[0], "BrokerID", brokerId, sizeof(brokerId), nullptr));
+    CHECK(objectGetString(env, argv[0], "cachePath", cachePath, sizeof(cachePath), nullptr));
+    CHECK(objectGetBoolean(env, argv[0], "refresh", &refresh));
+    CHECK(getQueryOptions(env, argv[0], &timeout, &priority, &isTypesOk));
 
-    memset(&req, 0, sizeof(req));
+    if (!isTypesOk || timeout < 0) {
+      napi_throw_type_error(env, nullptr, "The query options should be a timeout in milliseconds or an object of timeout and priority");
+      return nullptr;
+    }
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, BrokerSecAgentID));
+  const char *tradingDay = trader->api->GetTradingDay();
 
-    return trader->api->ReqQrySecAgentTradeInfo(&req, sequenceId());
-  });
-}
+  if (!tradingDay || !tradingDay[0]) {
+    napi_throw_error(env, nullptr, "The trading day is unknown until the trader has logged in");
+    return nullptr;
+  }
 
-static napi_value reqQryOptionInstrTradeCost(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryOptionInstrTradeCostField req;
+  std::string day = tradingDay, broker = brokerId;
+  std::string path = std::string(cachePath) + "instruments." + broker + "." + day + ".cache";
 
-    memset(&req, 0, sizeof(req));
+  if (!refresh) {
+    InstrumentCatalog *catalog = openInstrumentCatalog(path.c_str(), day.c_str(), broker.c_str());
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectChar(env, object, req, HedgeFlag));
-    CHECK(GetObjectDouble(env, object, req, InputPrice));
-    CHECK(GetObjectDouble(env, object, req, UnderlyingPrice));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    if (catalog) {
+      napi_deferred deferred;
 
-    return trader->api->ReqQryOptionInstrTradeCost(&req, sequenceId());
-  });
-}
+      CHECK(napi_create_promise(env, &deferred, &promise));
+      CHECK(newInstrumentCatalog(env, catalog, &value));
+      CHECK(napi_resolve_deferred(env, deferred, value));
 
-static napi_value reqQryOptionInstrCommRate(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryOptionInstrCommRateField req;
+      return promise;
+    }
+  }
 
-    memset(&req, 0, sizeof(req));
+  CThostFtdcQryInstrumentField req;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  memset(&req, 0, sizeof(req));
 
-    return trader->api->ReqQryOptionInstrCommRate(&req, sequenceId());
-  });
-}
+  QuerySender sender = [req](CThostFtdcTraderApi *api, int requestId) mutable {
+    return api->ReqQryInstrument(&req, requestId);
+  };
 
-static napi_value reqQryExecOrder(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryExecOrderField req;
+  return startQuery(env, trader, priority, timeout, std::move(sender), [path, day, broker](napi_env env, const Query *query, napi_value *result) {
+    InstrumentCatalog *catalog = createInstrumentCatalog(query->rows, day.c_str(), broker.c_str());
 
-    memset(&req, 0, sizeof(req));
+    if (!catalog)
+      return napi_generic_failure;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ExecOrderSysID));
-    CHECK(GetObjectString(env, object, req, InsertTimeStart));
-    CHECK(GetObjectString(env, object, req, InsertTimeEnd));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    // An unwritable cache only costs the next start a query.
+    if (!saveInstrumentCatalog(catalog, path.c_str()))
+      fprintf(stderr, "<Trader> Can not write the instrument cache %s\n", path.c_str());
 
-    return trader->api->ReqQryExecOrder(&req, sequenceId());
+    return newInstrumentCatalog(env, catalog, result);
   });
 }
 
-static napi_value reqQryForQuote(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryForQuoteField req;
-
-    memset(&req, 0, sizeof(req));
+static void preparedRequestDestructor(napi_env env, void *data, void *hint) {
+  PreparedRequest *prepared = (PreparedRequest *)data;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InsertTimeStart));
-    CHECK(GetObjectString(env, object, req, InsertTimeEnd));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-
-    return trader->api->ReqQryForQuote(&req, sequenceId());
-  });
+  napi_delete_reference(env, prepared->owner);
+  freePreparedRequest(prepared);
 }
 
-static napi_value reqQryQuote(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryQuoteField req;
+// Marshals the template once, through the native method table rather than the object.
+static napi_value prepare(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[2] = {napi_string, napi_object};
+  size_t argc = 3;
+  napi_value argv[3], jsthis, element, external, cons, result;
+  uint32_t length = 0;
+  char name[64], field[64], message[192];
+  Trader *trader;
+  bool isTypesOk;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, QuoteSysID));
-    CHECK(GetObjectString(env, object, req, InsertTimeStart));
-    CHECK(GetObjectString(env, object, req, InsertTimeEnd));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
 
-    return trader->api->ReqQryQuote(&req, sequenceId());
-  });
-}
+  if (!isTypesOk)
+    return nullptr;
 
-static napi_value reqQryOptionSelfClose(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryOptionSelfCloseField req;
+  if (argc > 2) {
+    CHECK(checkIsStringArray(env, argv[2], &isTypesOk));
 
-    memset(&req, 0, sizeof(req));
+    if (!isTypesOk)
+      return nullptr;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, OptionSelfCloseSysID));
-    CHECK(GetObjectString(env, object, req, InsertTimeStart));
-    CHECK(GetObjectString(env, object, req, InsertTimeEnd));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    CHECK(napi_get_array_length(env, argv[2], &length));
 
-    return trader->api->ReqQryOptionSelfClose(&req, sequenceId());
-  });
-}
+    if (length > PREPARED_FIELDS_MAX) {
+      napi_throw_type_error(env, nullptr, "A prepared request can vary at most 16 fields");
+      return nullptr;
+    }
+  }
 
-static napi_value reqQryInvestUnit(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryInvestUnitField req;
+  CHECK(napi_get_value_string_utf8(env, argv[0], name, sizeof(name), nullptr));
 
-    memset(&req, 0, sizeof(req));
+  const RequestMethod *method = findRequestMethod(name);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+  if (!method) {
+    snprintf(message, sizeof(message), "The method %s can not be prepared", name);
+    napi_throw_type_error(env, nullptr, message);
+    return nullptr;
+  }
 
-    return trader->api->ReqQryInvestUnit(&req, sequenceId());
-  });
-}
+  PreparedRequest *prepared = createPreparedRequest(method);
 
-static napi_value reqQryCombInstrumentGuard(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryCombInstrumentGuardField req;
+  if (!prepared) {
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    memset(&req, 0, sizeof(req));
+  if (!unmarshalRequest(env, argv[1], method, prepared->req)) {
+    freePreparedRequest(prepared);
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(napi_get_element(env, argv[2], i, &element));
+    CHECK(napi_get_value_string_utf8(env, element, field, sizeof(field), nullptr));
 
-    return trader->api->ReqQryCombInstrumentGuard(&req, sequenceId());
-  });
-}
+    const CtpField *ctpField = findCtpField(method->table, field);
 
-static napi_value reqQryCombAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryCombActionField req;
+    if (!ctpField) {
+      freePreparedRequest(prepared);
+      snprintf(message, sizeof(message), "The field %s can not vary in %s", field, name);
+      napi_throw_type_error(env, nullptr, message);
+      return nullptr;
+    }
 
-    memset(&req, 0, sizeof(req));
+    prepared->fields.push_back(ctpField);
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  // The handle keeps its trader alive.
+  prepared->trader = trader;
+  CHECK(napi_create_reference(env, jsthis, 1, &prepared->owner));
 
-    return trader->api->ReqQryCombAction(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_reference_value(env, getConstructors(env)->preparedRequest, &cons));
+  CHECK(napi_create_external(env, (void *)prepared, nullptr, nullptr, &external));
+  CHECK(napi_new_instance(env, cons, 1, &external, &result));
 
-static napi_value reqQryTransferSerial(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTransferSerialField req;
+  return result;
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_value traderNew(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[2] = {napi_string, napi_string};
+  size_t argc = 3;
+  napi_value target, argv[3], jsthis;
+  uint32_t queueCapacity = MESSAGE_QUEUE_CAPACITY;
+  uint8_t policies[ET_COUNT] = {OVERFLOW_BLOCK};
+  double queryRate = QUERY_RATE;
+  Trader *trader;
+  char flowPath[260], frontAddr[64];
+  bool isTypesOk;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+  CHECK(napi_get_new_target(env, info, &target));
 
-    return trader->api->ReqQryTransferSerial(&req, sequenceId());
-  });
-}
+  if (!target)
+    return nullptr;
 
-static napi_value reqQryAccountregister(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryAccountregisterField req;
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
 
-    memset(&req, 0, sizeof(req));
+  CHECK(checkValueTypes(env, 2, argv, types, &isTypesOk));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBranchID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
+  if (!isTypesOk)
+    return nullptr;
 
-    return trader->api->ReqQryAccountregister(&req, sequenceId());
-  });
-}
+  if (argc > 2) {
+    CHECK(checkIsObject(env, argv[2], &isTypesOk));
 
-static napi_value reqQryContractBank(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryContractBankField req;
+    if (!isTypesOk)
+      return nullptr;
 
-    memset(&req, 0, sizeof(req));
+    CHECK(getQueueCapacity(env, argv[2], &queueCapacity, &isTypesOk));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBrchID));
+    if (!isTypesOk)
+      return nullptr;
 
-    return trader->api->ReqQryContractBank(&req, sequenceId());
-  });
-}
+    CHECK(getOverflowPolicies(env, argv[2], TraderSpi::eventId, TraderSpi::isLossless, ET_BASE, policies, &isTypesOk));
 
-static napi_value reqQryParkedOrder(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryParkedOrderField req;
+    if (!isTypesOk)
+      return nullptr;
 
-    memset(&req, 0, sizeof(req));
+    CHECK(getQueryRate(env, argv[2], &queryRate, &isTypesOk));
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+    if (!isTypesOk)
+      return nullptr;
+  }
 
-    return trader->api->ReqQryParkedOrder(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_value_string_utf8(env, argv[0], flowPath, sizeof(flowPath), nullptr));
+  CHECK(napi_get_value_string_utf8(env, argv[1], frontAddr, sizeof(frontAddr), nullptr));
 
-static napi_value reqQryParkedOrderAction(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryParkedOrderActionField req;
+  trader = new Trader();
 
-    memset(&req, 0, sizeof(req));
+  if (!trader) {
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  trader->env = env;
 
-    return trader->api->ReqQryParkedOrderAction(&req, sequenceId());
-  });
-}
+  for (int i = 0; i < ET_COUNT; ++i)
+    trader->listeners[i].store(nullptr, std::memory_order_relaxed);
 
-static napi_value reqQryTradingNotice(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryTradingNoticeField req;
+  trader->latency = createLatencyRecorder(ET_BASE, ET_COUNT);
 
-    memset(&req, 0, sizeof(req));
+  if (!trader->latency) {
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+  trader->scheduler = createQueryScheduler(queryRate);
 
-    return trader->api->ReqQryTradingNotice(&req, sequenceId());
-  });
-}
+  if (!trader->scheduler) {
+    releaseLatencyRecorder(trader->latency);
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-static napi_value reqQryBrokerTradingParams(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryBrokerTradingParamsField req;
+  if (napi_ok != createQuerySettler(env, &trader->settler)) {
+    freeQueryScheduler(trader->scheduler);
+    releaseLatencyRecorder(trader->latency);
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    memset(&req, 0, sizeof(req));
+  trader->brokerId[0] = 0;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, AccountID));
+  snprintf(trader->flowPath, sizeof(trader->flowPath), "%s", flowPath);
 
-    return trader->api->ReqQryBrokerTradingParams(&req, sequenceId());
-  });
-}
+  trader->spi = new TraderSpi(queueCapacity);
 
-static napi_value reqQryBrokerTradingAlgos(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryBrokerTradingAlgosField req;
+  if (!trader->spi) {
+    freeQueryScheduler(trader->scheduler);
+    releaseLatencyRecorder(trader->latency);
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    memset(&req, 0, sizeof(req));
+  for (int i = 0; i < ET_COUNT; ++i)
+    trader->spi->setOverflowPolicy(ET_BASE + i, policies[i]);
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  if (0 != uv_thread_create(&trader->thread, processThread, trader)) {
+    delete trader->spi;
+    freeQueryScheduler(trader->scheduler);
+    releaseLatencyRecorder(trader->latency);
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader can not create thread");
+    return nullptr;
+  }
 
-    return trader->api->ReqQryBrokerTradingAlgos(&req, sequenceId());
-  });
-}
+  trader->api = CThostFtdcTraderApi::CreateFtdcTraderApi(flowPath);
 
-static napi_value reqQueryCFMMCTradingAccountToken(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQueryCFMMCTradingAccountTokenField req;
+  if (!trader->api) {
+    trader->spi->quit();
+    uv_thread_join(&trader->thread);
+    delete trader->spi;
+    freeQueryScheduler(trader->scheduler);
+    releaseLatencyRecorder(trader->latency);
+    delete trader;
+    napi_throw_error(env, nullptr, "Trader is out of memory");
+    return nullptr;
+  }
 
-    memset(&req, 0, sizeof(req));
+  trader->scheduler->api = trader->api;
+  trader->api->RegisterSpi(trader->spi);
+  trader->api->SubscribePublicTopic(THOST_TERT_QUICK);
+  trader->api->SubscribePrivateTopic(THOST_TERT_QUICK);
+  trader->api->RegisterFront(frontAddr);
+  trader->api->Init();
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InvestUnitID));
+  CHECK(napi_wrap(env, jsthis, (void *)trader, traderDestructor, nullptr, &trader->wrapper));
 
-    return trader->api->ReqQueryCFMMCTradingAccountToken(&req, sequenceId());
-  });
+  return jsthis;
 }
 
-static napi_value reqFromBankToFutureByFuture(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqTransferField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradeCode));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBranchID));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, BrokerBranchID));
-    CHECK(GetObjectString(env, object, req, TradeDate));
-    CHECK(GetObjectString(env, object, req, TradeTime));
-    CHECK(GetObjectString(env, object, req, BankSerial));
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectInt32(env, object, req, PlateSerial));
-    CHECK(GetObjectChar(env, object, req, LastFragment));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, CustomerName));
-    CHECK(GetObjectChar(env, object, req, IdCardType));
-    CHECK(GetObjectString(env, object, req, IdentifiedCardNo));
-    CHECK(GetObjectChar(env, object, req, CustType));
-    CHECK(GetObjectString(env, object, req, BankAccount));
-    CHECK(GetObjectString(env, object, req, BankPassWord));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectInt32(env, object, req, InstallID));
-    CHECK(GetObjectInt32(env, object, req, FutureSerial));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, VerifyCertNoFlag));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectDouble(env, object, req, TradeAmount));
-    CHECK(GetObjectDouble(env, object, req, FutureFetchAmount));
-    CHECK(GetObjectChar(env, object, req, FeePayFlag));
-    CHECK(GetObjectDouble(env, object, req, CustFee));
-    CHECK(GetObjectDouble(env, object, req, BrokerFee));
-    CHECK(GetObjectString(env, object, req, Message));
-    CHECK(GetObjectString(env, object, req, Digest));
-    CHECK(GetObjectChar(env, object, req, BankAccType));
-    CHECK(GetObjectString(env, object, req, DeviceID));
-    CHECK(GetObjectChar(env, object, req, BankSecuAccType));
-    CHECK(GetObjectString(env, object, req, BrokerIDByBank));
-    CHECK(GetObjectString(env, object, req, BankSecuAcc));
-    CHECK(GetObjectChar(env, object, req, BankPwdFlag));
-    CHECK(GetObjectChar(env, object, req, SecuPwdFlag));
-    CHECK(GetObjectString(env, object, req, OperNo));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, TID));
-    CHECK(GetObjectChar(env, object, req, TransferStatus));
-    CHECK(GetObjectString(env, object, req, LongCustomerName));
-
-    return trader->api->ReqFromBankToFutureByFuture(&req, sequenceId());
-  });
-}
+napi_status defineTrader(napi_env env, napi_ref *constructor) {
+  std::vector<napi_property_descriptor> props = {
+      DECLARE_NAPI_METHOD(getApiVersion),
+      DECLARE_NAPI_METHOD(getQueueStats),
+      DECLARE_NAPI_METHOD(getLatencyStats),
+      DECLARE_NAPI_METHOD(getQueryStats),
+      DECLARE_NAPI_METHOD(loadInstruments),
+      DECLARE_NAPI_METHOD(prepare),
+      DECLARE_NAPI_METHOD(on),
+  };
 
-static napi_value reqFromFutureToBankByFuture(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqTransferField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradeCode));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBranchID));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, BrokerBranchID));
-    CHECK(GetObjectString(env, object, req, TradeDate));
-    CHECK(GetObjectString(env, object, req, TradeTime));
-    CHECK(GetObjectString(env, object, req, BankSerial));
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectInt32(env, object, req, PlateSerial));
-    CHECK(GetObjectChar(env, object, req, LastFragment));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, CustomerName));
-    CHECK(GetObjectChar(env, object, req, IdCardType));
-    CHECK(GetObjectString(env, object, req, IdentifiedCardNo));
-    CHECK(GetObjectChar(env, object, req, CustType));
-    CHECK(GetObjectString(env, object, req, BankAccount));
-    CHECK(GetObjectString(env, object, req, BankPassWord));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectInt32(env, object, req, InstallID));
-    CHECK(GetObjectInt32(env, object, req, FutureSerial));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, VerifyCertNoFlag));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectDouble(env, object, req, TradeAmount));
-    CHECK(GetObjectDouble(env, object, req, FutureFetchAmount));
-    CHECK(GetObjectChar(env, object, req, FeePayFlag));
-    CHECK(GetObjectDouble(env, object, req, CustFee));
-    CHECK(GetObjectDouble(env, object, req, BrokerFee));
-    CHECK(GetObjectString(env, object, req, Message));
-    CHECK(GetObjectString(env, object, req, Digest));
-    CHECK(GetObjectChar(env, object, req, BankAccType));
-    CHECK(GetObjectString(env, object, req, DeviceID));
-    CHECK(GetObjectChar(env, object, req, BankSecuAccType));
-    CHECK(GetObjectString(env, object, req, BrokerIDByBank));
-    CHECK(GetObjectString(env, object, req, BankSecuAcc));
-    CHECK(GetObjectChar(env, object, req, BankPwdFlag));
-    CHECK(GetObjectChar(env, object, req, SecuPwdFlag));
-    CHECK(GetObjectString(env, object, req, OperNo));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, TID));
-    CHECK(GetObjectChar(env, object, req, TransferStatus));
-    CHECK(GetObjectString(env, object, req, LongCustomerName));
-
-    return trader->api->ReqFromFutureToBankByFuture(&req, sequenceId());
-  });
-}
+  for (int i = 0; i < arraysize(requestMethods); ++i)
+    props.push_back({requestMethods[i].name, 0, callRequest, 0, 0, 0, napi_default, (void *)&requestMethods[i]});
 
-static napi_value reqQueryBankAccountMoneyByFuture(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcReqQueryAccountField req;
-
-    memset(&req, 0, sizeof(req));
-
-    CHECK(GetObjectString(env, object, req, TradeCode));
-    CHECK(GetObjectString(env, object, req, BankID));
-    CHECK(GetObjectString(env, object, req, BankBranchID));
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, BrokerBranchID));
-    CHECK(GetObjectString(env, object, req, TradeDate));
-    CHECK(GetObjectString(env, object, req, TradeTime));
-    CHECK(GetObjectString(env, object, req, BankSerial));
-    CHECK(GetObjectString(env, object, req, TradingDay));
-    CHECK(GetObjectInt32(env, object, req, PlateSerial));
-    CHECK(GetObjectChar(env, object, req, LastFragment));
-    CHECK(GetObjectInt32(env, object, req, SessionID));
-    CHECK(GetObjectString(env, object, req, CustomerName));
-    CHECK(GetObjectChar(env, object, req, IdCardType));
-    CHECK(GetObjectString(env, object, req, IdentifiedCardNo));
-    CHECK(GetObjectChar(env, object, req, CustType));
-    CHECK(GetObjectString(env, object, req, BankAccount));
-    CHECK(GetObjectString(env, object, req, BankPassWord));
-    CHECK(GetObjectString(env, object, req, AccountID));
-    CHECK(GetObjectString(env, object, req, Password));
-    CHECK(GetObjectInt32(env, object, req, FutureSerial));
-    CHECK(GetObjectInt32(env, object, req, InstallID));
-    CHECK(GetObjectString(env, object, req, UserID));
-    CHECK(GetObjectChar(env, object, req, VerifyCertNoFlag));
-    CHECK(GetObjectString(env, object, req, CurrencyID));
-    CHECK(GetObjectString(env, object, req, Digest));
-    CHECK(GetObjectChar(env, object, req, BankAccType));
-    CHECK(GetObjectString(env, object, req, DeviceID));
-    CHECK(GetObjectChar(env, object, req, BankSecuAccType));
-    CHECK(GetObjectString(env, object, req, BrokerIDByBank));
-    CHECK(GetObjectString(env, object, req, BankSecuAcc));
-    CHECK(GetObjectChar(env, object, req, BankPwdFlag));
-    CHECK(GetObjectChar(env, object, req, SecuPwdFlag));
-    CHECK(GetObjectString(env, object, req, OperNo));
-    CHECK(GetObjectInt32(env, object, req, RequestID));
-    CHECK(GetObjectInt32(env, object, req, TID));
-    CHECK(GetObjectString(env, object, req, LongCustomerName));
-
-    return trader->api->ReqQueryBankAccountMoneyByFuture(&req, sequenceId());
-  });
+  return defineClass(env, "Trader", traderNew, props.size(), props.data(), constructor);
 }
 
-static napi_value reqQryClassifiedInstrument(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryClassifiedInstrumentField req;
+static napi_value instrumentCatalogNew(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value target, argv[1], jsthis;
+  napi_valuetype valuetype = napi_undefined;
+  void *catalog;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_get_new_target(env, info, &target));
 
-    CHECK(GetObjectString(env, object, req, InstrumentID));
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, ExchangeInstID));
-    CHECK(GetObjectString(env, object, req, ProductID));
-    CHECK(GetObjectChar(env, object, req, TradingType));
-    CHECK(GetObjectChar(env, object, req, ClassType));
+  if (!target)
+    return nullptr;
 
-    return trader->api->ReqQryClassifiedInstrument(&req, sequenceId());
-  });
-}
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
 
-static napi_value reqQryCombPromotionParam(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryCombPromotionParamField req;
+  if (argc > 0)
+    CHECK(napi_typeof(env, argv[0], &valuetype));
 
-    memset(&req, 0, sizeof(req));
+  if (valuetype != napi_external) {
+    napi_throw_type_error(env, nullptr, "The InstrumentCatalog is created by Trader.loadInstruments");
+    return nullptr;
+  }
 
-    CHECK(GetObjectString(env, object, req, ExchangeID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  CHECK(napi_get_value_external(env, argv[0], &catalog));
+  CHECK(napi_wrap(env, jsthis, catalog, instrumentCatalogDestructor, nullptr, nullptr));
 
-    return trader->api->ReqQryCombPromotionParam(&req, sequenceId());
-  });
+  return jsthis;
 }
 
-static napi_value reqQryRiskSettleInvstPosition(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryRiskSettleInvstPositionField req;
+static napi_status getInstrumentValue(napi_env env, const CThostFtdcInstrumentField *instrument, napi_value *result) {
+  Message message(ET_RSPQRYINSTRUMENT, (uintptr_t)instrument);
+  return getTraderMessageValue(env, &message, DELIVERY_OBJECT, result);
+}
 
-    memset(&req, 0, sizeof(req));
+static napi_value getInstrument(napi_env env, napi_callback_info info) {
+  static const napi_valuetype types[1] = {napi_string};
+  size_t argc = 1;
+  napi_value argv[1], jsthis, result;
+  InstrumentCatalog *catalog;
+  char instrumentId[sizeof(CThostFtdcInstrumentField::InstrumentID)];
+  bool isTypesOk;
 
-    CHECK(GetObjectString(env, object, req, BrokerID));
-    CHECK(GetObjectString(env, object, req, InvestorID));
-    CHECK(GetObjectString(env, object, req, InstrumentID));
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&catalog));
 
-    return trader->api->ReqQryRiskSettleInvstPosition(&req, sequenceId());
-  });
-}
+  CHECK(checkValueTypes(env, 1, argv, types, &isTypesOk));
 
-static napi_value reqQryRiskSettleProductStatus(napi_env env, napi_callback_info info) {
-  return callRequestFunc(env, info, [&env](Trader *trader, napi_value object) {
-    CThostFtdcQryRiskSettleProductStatusField req;
+  if (!isTypesOk)
+    return nullptr;
 
-    memset(&req, 0, sizeof(req));
+  CHECK(napi_get_value_string_utf8(env, argv[0], instrumentId, sizeof(instrumentId), nullptr));
 
-    CHECK(GetObjectString(env, object, req, ProductID));
+  const CThostFtdcInstrumentField *instrument = findInstrument(catalog, instrumentId);
 
-    return trader->api->ReqQryRiskSettleProductStatus(&req, sequenceId());
-  });
-}
+  if (!instrument) {
+    CHECK(napi_get_undefined(env, &result));
+    return result;
+  }
 
-static bool processMessage(Trader *trader, const Message &message) {
-  const char *eventName = TraderSpi::eventName(message.event);
+  CHECK(getInstrumentValue(env, instrument, &result));
 
-  if (!eventName) {
-    fprintf(stderr, "<Trader> Unknown message event %d\n", message.event);
-    return true;
-  }
+  return result;
+}
 
-  auto iter = trader->tsfns.find(eventName);
+// The indexes of the instruments an optional {ProductID, ExchangeID} filter selects.
+static napi_status getFilteredInstruments(napi_env env, napi_callback_info info, InstrumentCatalog **catalog, std::vector<uint32_t> *indexes, bool *result) {
+  size_t argc = 1;
+  napi_value argv[1], jsthis;
+  char productId[sizeof(CThostFtdcInstrumentField::ProductID)] = {0};
+  char exchangeId[sizeof(CThostFtdcInstrumentField::ExchangeID)] = {0};
 
-  if (iter != trader->tsfns.end()) {
-    napi_threadsafe_function tsfn = iter->second;
-    CHECK(napi_call_threadsafe_function(tsfn, (void *)&message, napi_tsfn_blocking));
-  }
+  *result = true;
 
-  return ET_QUIT != message.event;
-}
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)catalog));
 
-static void processThread(void *data) {
-  Trader *trader = (Trader *)data;
-  Message message;
-  bool isRunning = true;
+  if (argc > 0) {
+    CHECK(checkIsObject(env, argv[0], result));
 
-  while (isRunning) {
-    if (QUEUE_SUCCESS != trader->spi->poll(&message))
-      continue;
+    if (!*result)
+      return napi_ok;
 
-    isRunning = processMessage(trader, message);
-    trader->spi->done(message);
+    CHECK(objectGetString(env, argv[0], "ProductID", productId, sizeof(productId), nullptr));
+    CHECK(objectGetString(env, argv[0], "ExchangeID", exchangeId, sizeof(exchangeId), nullptr));
   }
-}
 
-static void callJs(napi_env env, napi_value js_cb, void *context, void *data) {
-  // Trader *trader = (Trader *)context;
-  Message *message = (Message *)data;
-  napi_value undefined, argv;
+  filterInstruments(*catalog, productId, exchangeId, indexes);
 
-  CHECK(napi_get_undefined(env, &undefined));
-  CHECK(getTraderMessageValue(env, message, &argv));
-  CHECK(napi_call_function(env, undefined, js_cb, 1, &argv, nullptr));
+  return napi_ok;
 }
 
-static napi_value on(napi_env env, napi_callback_info info) {
-  static const napi_valuetype types[2] = {napi_string, napi_function};
-  size_t argc = 2;
-  napi_value argv[2], jsthis;
-  napi_threadsafe_function tsfn;
-  Trader *trader;
-  char fname[64];
+static napi_value getInstruments(napi_env env, napi_callback_info info) {
+  std::vector<uint32_t> indexes;
+  InstrumentCatalog *catalog;
+  napi_value result, value;
   bool isTypesOk;
 
-  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
-  CHECK(napi_unwrap(env, jsthis, (void **)&trader));
-
-  CHECK(checkValueTypes(env, argc, argv, types, &isTypesOk));
+  CHECK(getFilteredInstruments(env, info, &catalog, &indexes, &isTypesOk));
 
   if (!isTypesOk)
     return nullptr;
 
-  CHECK(napi_create_threadsafe_function(env, argv[1], nullptr, argv[0], 0, 1, nullptr, nullptr, trader, callJs, &tsfn));
-  CHECK(napi_ref_threadsafe_function(env, tsfn));
+  CHECK(napi_create_array_with_length(env, indexes.size(), &result));
 
-  CHECK(napi_get_value_string_utf8(env, argv[0], fname, sizeof(fname), nullptr));
+  for (uint32_t i = 0; i < (uint32_t)indexes.size(); ++i) {
+    CHECK(getInstrumentValue(env, &catalog->records[indexes[i]], &value));
+    CHECK(napi_set_element(env, result, i, value));
+  }
 
-  if (trader->tsfns.find(fname) != trader->tsfns.end())
-    CHECK(napi_unref_threadsafe_function(env, trader->tsfns[fname]));
+  return result;
+}
 
-  trader->tsfns[fname] = tsfn;
+static napi_value getInstrumentIds(napi_env env, napi_callback_info info) {
+  std::vector<uint32_t> indexes;
+  InstrumentCatalog *catalog;
+  napi_value result, value;
+  bool isTypesOk;
 
-  return jsthis;
-}
+  CHECK(getFilteredInstruments(env, info, &catalog, &indexes, &isTypesOk));
 
-static void traderDestructor(napi_env env, void *data, void *hint) {
-  Trader *trader = (Trader *)data;
+  if (!isTypesOk)
+    return nullptr;
 
-  if (!trader)
-    return;
+  CHECK(napi_create_array_with_length(env, indexes.size(), &result));
 
-  if (trader->spi) {
-    trader->spi->quit();
-    uv_thread_join(&trader->thread);
+  for (uint32_t i = 0; i < (uint32_t)indexes.size(); ++i) {
+    CHECK(napi_create_string_utf8(env, catalog->records[indexes[i]].InstrumentID, NAPI_AUTO_LENGTH, &value));
+    CHECK(napi_set_element(env, result, i, value));
   }
 
-  for (auto it = trader->tsfns.begin(); it != trader->tsfns.end(); ++it)
-    napi_unref_threadsafe_function(env, it->second);
+  return result;
+}
 
-  trader->tsfns.clear();
-  napi_delete_reference(trader->env, trader->wrapper);
+static napi_value getCatalogInfo(napi_env env, napi_callback_info info) {
+  napi_value jsthis, object, value;
+  InstrumentCatalog *catalog;
 
-  if (trader->spi)
-    delete trader->spi;
+  CHECK(napi_get_cb_info(env, info, nullptr, nullptr, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&catalog));
 
-  if (trader->api)
-    trader->api->Release();
+  CHECK(napi_create_object(env, &object));
+  CHECK(objectSetString(env, object, "tradingDay", catalog->tradingDay));
+  CHECK(objectSetString(env, object, "brokerId", catalog->brokerId));
+  CHECK(objectSetUint32(env, object, "count", catalog->count));
+  CHECK(napi_get_boolean(env, catalog->cached, &value));
+  CHECK(napi_set_named_property(env, object, "cached", value));
 
-  delete trader;
+  return object;
 }
 
-static napi_value traderNew(napi_env env, napi_callback_info info) {
-  static const napi_valuetype types[2] = {napi_string, napi_string};
-  size_t argc = 2;
-  napi_value target, argv[2], jsthis;
-  Trader *trader;
-  char flowPath[260], frontAddr[64];
-  bool isTypesOk;
+napi_status defineInstrumentCatalog(napi_env env, napi_ref *constructor) {
+  napi_property_descriptor props[] = {
+      DECLARE_NAPI_METHOD(getInstrument),
+      DECLARE_NAPI_METHOD(getInstruments),
+      DECLARE_NAPI_METHOD(getInstrumentIds),
+      DECLARE_NAPI_METHOD(getCatalogInfo),
+  };
+  return defineClass(env, "InstrumentCatalog", instrumentCatalogNew, arraysize(props), props, constructor);
+}
+
+static napi_value preparedRequestNew(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value target, argv[1], jsthis;
+  napi_valuetype valuetype = napi_undefined;
+  void *prepared;
 
   CHECK(napi_get_new_target(env, info, &target));
 
@@ -1826,155 +1394,94 @@ static napi_value traderNew(napi_env env, napi_callback_info info) {
 
   CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
 
-  CHECK(checkValueTypes(env, argc, argv, types, &isTypesOk));
+  if (argc > 0)
+    CHECK(napi_typeof(env, argv[0], &valuetype));
 
-  if (!isTypesOk)
+  if (valuetype != napi_external) {
+    napi_throw_type_error(env, nullptr, "The PreparedRequest is created by Trader.prepare");
     return nullptr;
+  }
 
-  CHECK(napi_get_value_string_utf8(env, argv[0], flowPath, sizeof(flowPath), nullptr));
-  CHECK(napi_get_value_string_utf8(env, argv[1], frontAddr, sizeof(frontAddr), nullptr));
+  CHECK(napi_get_value_external(env, argv[0], &prepared));
+  CHECK(napi_wrap(env, jsthis, prepared, preparedRequestDestructor, nullptr, nullptr));
 
-  trader = new Trader();
+  return jsthis;
+}
 
-  if (!trader) {
-    napi_throw_error(env, nullptr, "Trader is out of memory");
-    return nullptr;
-  }
+// The varying fields in order, then the requestId of a request or the options of a query.
+static napi_value send(napi_env env, napi_callback_info info) {
+  size_t argc = PREPARED_FIELDS_MAX + 1;
+  napi_value argv[PREPARED_FIELDS_MAX + 1], jsthis, retval;
+  PreparedRequest *prepared;
+  int64_t option = 0;
+  char message[128];
+  bool isTypesOk = true;
 
-  trader->env = env;
-  trader->spi = new TraderSpi();
+  CHECK(napi_get_cb_info(env, info, &argc, argv, &jsthis, nullptr));
+  CHECK(napi_unwrap(env, jsthis, (void **)&prepared));
 
-  if (!trader->spi) {
-    delete trader;
-    napi_throw_error(env, nullptr, "Trader is out of memory");
+  size_t count = prepared->fields.size();
+
+  if (argc < count) {
+    napi_throw_type_error(env, nullptr, "Wrong number of arguments");
     return nullptr;
   }
 
-  if (0 != uv_thread_create(&trader->thread, processThread, trader)) {
-    delete trader->spi;
-    delete trader;
-    napi_throw_error(env, nullptr, "Trader can not create thread");
-    return nullptr;
+  for (size_t i = 0; i < count; ++i) {
+    const CtpField *field = prepared->fields[i];
+
+    if (napi_ok != setCtpField(env, prepared->req, field, argv[i])) {
+      snprintf(message, sizeof(message), "The field %s should be a %s", field->name, ctpFieldTypeName(field));
+      napi_throw_type_error(env, nullptr, message);
+      return nullptr;
+    }
   }
 
-  trader->api = CThostFtdcTraderApi::CreateFtdcTraderApi(flowPath);
+  Trader *trader = prepared->trader;
 
-  if (!trader->api) {
-    trader->spi->quit();
-    uv_thread_join(&trader->thread);
-    delete trader->spi;
-    delete trader;
-    napi_throw_error(env, nullptr, "Trader is out of memory");
-    return nullptr;
+  const RequestMethod *method = prepared->method;
+
+  if (method->priority < 0) {
+    if (argc > count)
+      CHECK(getOptionalNumber(env, argv[count], &option, &isTypesOk));
+
+    if (!isTypesOk || option < 0 || option > REQUEST_ID_MAX) {
+      napi_throw_type_error(env, nullptr, "The requestId should be a number from 1 to 1073741823");
+      return nullptr;
+    }
+
+    if (method->hook)
+      method->hook(trader, prepared->req);
+
+    int result = method->send(trader->api, prepared->req, option > 0 ? (int)option : nextRequestId());
+    CHECK(napi_create_int32(env, result, &retval));
+
+    return retval;
   }
 
-  trader->api->RegisterSpi(trader->spi);
-  trader->api->SubscribePublicTopic(THOST_TERT_QUICK);
-  trader->api->SubscribePrivateTopic(THOST_TERT_QUICK);
-  trader->api->RegisterFront(frontAddr);
-  trader->api->Init();
+  int priority = method->priority;
 
-  CHECK(napi_wrap(env, jsthis, (void *)trader, traderDestructor, nullptr, &trader->wrapper));
+  option = QUERY_TIMEOUT;
 
-  return jsthis;
+  if (argc > count)
+    CHECK(getQueryOptions(env, argv[count], &option, &priority, &isTypesOk));
+
+  if (!isTypesOk || option < 0) {
+    napi_throw_type_error(env, nullptr, "The query options should be a timeout in milliseconds or an object of timeout and priority");
+    return nullptr;
+  }
+
+  return queueRequest(env, trader, priority, option, prepared->req, method->size, method->send);
 }
 
-napi_status defineTrader(napi_env env, napi_ref *constructor) {
+napi_status definePreparedRequest(napi_env env, napi_ref *constructor) {
   napi_property_descriptor props[] = {
-      DECLARE_NAPI_METHOD(getApiVersion),
-      DECLARE_NAPI_METHOD(reqAuthenticate),
-      DECLARE_NAPI_METHOD(reqUserLogin),
-      DECLARE_NAPI_METHOD(reqUserLogout),
-      DECLARE_NAPI_METHOD(reqUserPasswordUpdate),
-      DECLARE_NAPI_METHOD(reqTradingAccountPasswordUpdate),
-      DECLARE_NAPI_METHOD(reqUserAuthMethod),
-      DECLARE_NAPI_METHOD(reqGenUserCaptcha),
-      DECLARE_NAPI_METHOD(reqGenUserText),
-      DECLARE_NAPI_METHOD(reqUserLoginWithCaptcha),
-      DECLARE_NAPI_METHOD(reqUserLoginWithText),
-      DECLARE_NAPI_METHOD(reqUserLoginWithOTP),
-      DECLARE_NAPI_METHOD(reqOrderInsert),
-      DECLARE_NAPI_METHOD(reqParkedOrderInsert),
-      DECLARE_NAPI_METHOD(reqParkedOrderAction),
-      DECLARE_NAPI_METHOD(reqOrderAction),
-      DECLARE_NAPI_METHOD(reqQryMaxOrderVolume),
-      DECLARE_NAPI_METHOD(reqSettlementInfoConfirm),
-      DECLARE_NAPI_METHOD(reqRemoveParkedOrder),
-      DECLARE_NAPI_METHOD(reqRemoveParkedOrderAction),
-      DECLARE_NAPI_METHOD(reqExecOrderInsert),
-      DECLARE_NAPI_METHOD(reqExecOrderAction),
-      DECLARE_NAPI_METHOD(reqForQuoteInsert),
-      DECLARE_NAPI_METHOD(reqQuoteInsert),
-      DECLARE_NAPI_METHOD(reqQuoteAction),
-      DECLARE_NAPI_METHOD(reqBatchOrderAction),
-      DECLARE_NAPI_METHOD(reqOptionSelfCloseInsert),
-      DECLARE_NAPI_METHOD(reqOptionSelfCloseAction),
-      DECLARE_NAPI_METHOD(reqCombActionInsert),
-      DECLARE_NAPI_METHOD(reqQryOrder),
-      DECLARE_NAPI_METHOD(reqQryTrade),
-      DECLARE_NAPI_METHOD(reqQryInvestorPosition),
-      DECLARE_NAPI_METHOD(reqQryTradingAccount),
-      DECLARE_NAPI_METHOD(reqQryInvestor),
-      DECLARE_NAPI_METHOD(reqQryTradingCode),
-      DECLARE_NAPI_METHOD(reqQryInstrumentMarginRate),
-      DECLARE_NAPI_METHOD(reqQryInstrumentCommissionRate),
-      DECLARE_NAPI_METHOD(reqQryExchange),
-      DECLARE_NAPI_METHOD(reqQryProduct),
-      DECLARE_NAPI_METHOD(reqQryInstrument),
-      DECLARE_NAPI_METHOD(reqQryDepthMarketData),
-      DECLARE_NAPI_METHOD(reqQryTraderOffer),
-      DECLARE_NAPI_METHOD(reqQrySettlementInfo),
-      DECLARE_NAPI_METHOD(reqQryTransferBank),
-      DECLARE_NAPI_METHOD(reqQryInvestorPositionDetail),
-      DECLARE_NAPI_METHOD(reqQryNotice),
-      DECLARE_NAPI_METHOD(reqQrySettlementInfoConfirm),
-      DECLARE_NAPI_METHOD(reqQryInvestorPositionCombineDetail),
-      DECLARE_NAPI_METHOD(reqQryCFMMCTradingAccountKey),
-      DECLARE_NAPI_METHOD(reqQryEWarrantOffset),
-      DECLARE_NAPI_METHOD(reqQryInvestorProductGroupMargin),
-      DECLARE_NAPI_METHOD(reqQryExchangeMarginRate),
-      DECLARE_NAPI_METHOD(reqQryExchangeMarginRateAdjust),
-      DECLARE_NAPI_METHOD(reqQryExchangeRate),
-      DECLARE_NAPI_METHOD(reqQrySecAgentACIDMap),
-      DECLARE_NAPI_METHOD(reqQryProductExchRate),
-      DECLARE_NAPI_METHOD(reqQryProductGroup),
-      DECLARE_NAPI_METHOD(reqQryMMInstrumentCommissionRate),
-      DECLARE_NAPI_METHOD(reqQryMMOptionInstrCommRate),
-      DECLARE_NAPI_METHOD(reqQryInstrumentOrderCommRate),
-      DECLARE_NAPI_METHOD(reqQrySecAgentTradingAccount),
-      DECLARE_NAPI_METHOD(reqQrySecAgentCheckMode),
-      DECLARE_NAPI_METHOD(reqQrySecAgentTradeInfo),
-      DECLARE_NAPI_METHOD(reqQryOptionInstrTradeCost),
-      DECLARE_NAPI_METHOD(reqQryOptionInstrCommRate),
-      DECLARE_NAPI_METHOD(reqQryExecOrder),
-      DECLARE_NAPI_METHOD(reqQryForQuote),
-      DECLARE_NAPI_METHOD(reqQryQuote),
-      DECLARE_NAPI_METHOD(reqQryOptionSelfClose),
-      DECLARE_NAPI_METHOD(reqQryInvestUnit),
-      DECLARE_NAPI_METHOD(reqQryCombInstrumentGuard),
-      DECLARE_NAPI_METHOD(reqQryCombAction),
-      DECLARE_NAPI_METHOD(reqQryTransferSerial),
-      DECLARE_NAPI_METHOD(reqQryAccountregister),
-      DECLARE_NAPI_METHOD(reqQryContractBank),
-      DECLARE_NAPI_METHOD(reqQryParkedOrder),
-      DECLARE_NAPI_METHOD(reqQryParkedOrderAction),
-      DECLARE_NAPI_METHOD(reqQryTradingNotice),
-      DECLARE_NAPI_METHOD(reqQryBrokerTradingParams),
-      DECLARE_NAPI_METHOD(reqQryBrokerTradingAlgos),
-      DECLARE_NAPI_METHOD(reqQueryCFMMCTradingAccountToken),
-      DECLARE_NAPI_METHOD(reqFromBankToFutureByFuture),
-      DECLARE_NAPI_METHOD(reqFromFutureToBankByFuture),
-      DECLARE_NAPI_METHOD(reqQueryBankAccountMoneyByFuture),
-      DECLARE_NAPI_METHOD(reqQryClassifiedInstrument),
-      DECLARE_NAPI_METHOD(reqQryCombPromotionParam),
-      DECLARE_NAPI_METHOD(reqQryRiskSettleInvstPosition),
-      DECLARE_NAPI_METHOD(reqQryRiskSettleProductStatus),
-      DECLARE_NAPI_METHOD(on),
+      DECLARE_NAPI_METHOD(send),
   };
-  return defineClass(env, "Trader", traderNew, arraysize(props), props, constructor);
+  return defineClass(env, "PreparedRequest", preparedRequestNew, arraysize(props), props, constructor);
 }
 
 napi_value createTrader(napi_env env, napi_callback_info info) {
   Constructors *constructors = getConstructors(env);
-  return constructors ? createInstance(env, info, constructors->trader, 2) : nullptr;
+  return constructors ? createInstance(env, info, constructors->trader, 3) : nullptr;
 }
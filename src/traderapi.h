@@ -15,6 +15,8 @@
 #include "napi_ctp.h"
 
 napi_status defineTrader(napi_env env, napi_ref *constructor);
+napi_status defineInstrumentCatalog(napi_env env, napi_ref *constructor);
+napi_status definePreparedRequest(napi_env env, napi_ref *constructor);
 napi_value createTrader(napi_env env, napi_callback_info info);
 
 #endif /* __TRADERAPI_H__ */
@@ -0,0 +1,176 @@
+/*
+ * tradercatalog.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "tradercatalog.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+static inline uint64_t wallClock() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static void indexCatalog(InstrumentCatalog *catalog) {
+  catalog->instruments.reserve(catalog->count);
+
+  for (uint32_t i = 0; i < catalog->count; ++i) {
+    const CThostFtdcInstrumentField *instrument = &catalog->records[i];
+
+    catalog->instruments.emplace(instrument->InstrumentID, i);
+    catalog->products[instrument->ProductID].push_back(i);
+    catalog->exchanges[instrument->ExchangeID].push_back(i);
+  }
+}
+
+static InstrumentCatalog *newCatalog(const char *tradingDay, const char *brokerId) {
+  InstrumentCatalog *catalog = new InstrumentCatalog();
+
+  if (!catalog)
+    return nullptr;
+
+  memset(&catalog->file, 0, sizeof(catalog->file));
+  catalog->records = nullptr;
+  catalog->count = 0;
+  catalog->cached = false;
+
+  snprintf(catalog->tradingDay, sizeof(catalog->tradingDay), "%s", tradingDay);
+  snprintf(catalog->brokerId, sizeof(catalog->brokerId), "%s", brokerId);
+
+  return catalog;
+}
+
+InstrumentCatalog *openInstrumentCatalog(const char *path, const char *tradingDay, const char *brokerId) {
+  InstrumentCatalog *catalog = newCatalog(tradingDay, brokerId);
+
+  if (!catalog)
+    return nullptr;
+
+  if (!mapJournalFile(&catalog->file, path, 0, false)) {
+    delete catalog;
+    return nullptr;
+  }
+
+  const CatalogHeader *header = (const CatalogHeader *)catalog->file.base;
+  bool isValid = catalog->file.size >= sizeof(CatalogHeader);
+
+  isValid = isValid && 0 == memcmp(header->magic, CATALOG_MAGIC, sizeof(header->magic)) && header->version == CATALOG_VERSION;
+  isValid = isValid && header->headerSize == sizeof(CatalogHeader) && header->recordSize == sizeof(CThostFtdcInstrumentField);
+  isValid = isValid && 0 == strncmp(header->tradingDay, catalog->tradingDay, sizeof(header->tradingDay));
+  isValid = isValid && 0 == strncmp(header->brokerId, catalog->brokerId, sizeof(header->brokerId));
+  isValid = isValid && catalog->file.size >= sizeof(CatalogHeader) + (uint64_t)header->count * sizeof(CThostFtdcInstrumentField);
+
+  if (!isValid) {
+    unmapJournalFile(&catalog->file, 0);
+    delete catalog;
+    return nullptr;
+  }
+
+  catalog->records = (const CThostFtdcInstrumentField *)(catalog->file.base + sizeof(CatalogHeader));
+  catalog->count = header->count;
+  catalog->cached = true;
+
+  indexCatalog(catalog);
+
+  return catalog;
+}
+
+InstrumentCatalog *createInstrumentCatalog(const std::vector<Message> &rows, const char *tradingDay, const char *brokerId) {
+  InstrumentCatalog *catalog = newCatalog(tradingDay, brokerId);
+
+  if (!catalog)
+    return nullptr;
+
+  catalog->owned.reserve(rows.size());
+
+  for (auto it = rows.begin(); it != rows.end(); ++it)
+    catalog->owned.push_back(*MessageData<CThostFtdcInstrumentField>(&*it));
+
+  catalog->records = catalog->owned.data();
+  catalog->count = (uint32_t)catalog->owned.size();
+
+  indexCatalog(catalog);
+
+  return catalog;
+}
+
+// Written aside and renamed over the cache, a reader never maps a half written file.
+bool saveInstrumentCatalog(const InstrumentCatalog *catalog, const char *path) {
+  std::string temp = std::string(path) + ".tmp";
+  CatalogHeader header;
+  FILE *fp = fopen(temp.c_str(), "wb");
+
+  if (!fp)
+    return false;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, CATALOG_MAGIC, sizeof(header.magic));
+  memcpy(header.tradingDay, catalog->tradingDay, sizeof(header.tradingDay));
+  memcpy(header.brokerId, catalog->brokerId, sizeof(header.brokerId));
+
+  header.version = CATALOG_VERSION;
+  header.headerSize = sizeof(CatalogHeader);
+  header.recordSize = sizeof(CThostFtdcInstrumentField);
+  header.count = catalog->count;
+  header.created = wallClock();
+
+  bool isWritten = 1 == fwrite(&header, sizeof(header), 1, fp);
+
+  if (isWritten && catalog->count > 0)
+    isWritten = catalog->count == fwrite(catalog->records, sizeof(CThostFtdcInstrumentField), catalog->count, fp);
+
+  if (0 != fclose(fp) || !isWritten) {
+    remove(temp.c_str());
+    return false;
+  }
+
+  // Windows does not rename over an existing file.
+  remove(path);
+
+  if (0 != rename(temp.c_str(), path)) {
+    remove(temp.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void freeInstrumentCatalog(InstrumentCatalog *catalog) {
+  if (catalog->file.base)
+    unmapJournalFile(&catalog->file, 0);
+
+  delete catalog;
+}
+
+const CThostFtdcInstrumentField *findInstrument(const InstrumentCatalog *catalog, const char *instrumentId) {
+  auto iter = catalog->instruments.find(instrumentId);
+  return iter != catalog->instruments.end() ? &catalog->records[iter->second] : nullptr;
+}
+
+void filterInstruments(const InstrumentCatalog *catalog, const char *productId, const char *exchangeId, std::vector<uint32_t> *result) {
+  if (!productId[0] && !exchangeId[0]) {
+    result->reserve(catalog->count);
+
+    for (uint32_t i = 0; i < catalog->count; ++i)
+      result->push_back(i);
+
+    return;
+  }
+
+  auto &index = productId[0] ? catalog->products : catalog->exchanges;
+  auto iter = index.find(productId[0] ? productId : exchangeId);
+
+  if (iter == index.end())
+    return;
+
+  for (auto it = iter->second.begin(); it != iter->second.end(); ++it)
+    if (!productId[0] || !exchangeId[0] || 0 == strcmp(catalog->records[*it].ExchangeID, exchangeId))
+      result->push_back(*it);
+}
@@ -0,0 +1,71 @@
+/*
+ * tradercatalog.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __TRADERCATALOG_H__
+#define __TRADERCATALOG_H__
+
+#include "mdjournal.h"
+#include "napi_ctp.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define CATALOG_MAGIC "NCTPINST"
+#define CATALOG_VERSION 1
+
+/*
+ * <path>/instruments.<BrokerID>.<TradingDay>.cache holds the header and
+ * then count instruments as CTP delivered them. A file of another broker,
+ * trading day or layout is never used, it is replaced on the next query.
+ */
+typedef struct CatalogHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t headerSize;
+  uint32_t recordSize;
+  uint32_t count;
+  char tradingDay[16];
+  char brokerId[16];
+  uint64_t created;
+} CatalogHeader;
+
+static_assert(sizeof(CatalogHeader) == 64, "CatalogHeader must stay 64 bytes");
+
+/*
+ * The instruments of one trading day, either read from a query or mapped
+ * from the cache file, with indexes by InstrumentID, ProductID and
+ * ExchangeID. It is immutable once built, so JS reads it without locks.
+ */
+typedef struct InstrumentCatalog {
+  JournalFile file;
+  const CThostFtdcInstrumentField *records;
+  std::vector<CThostFtdcInstrumentField> owned;
+  uint32_t count;
+  bool cached;
+  char tradingDay[16];
+  char brokerId[16];
+  std::unordered_map<std::string, uint32_t> instruments;
+  std::unordered_map<std::string, std::vector<uint32_t>> products;
+  std::unordered_map<std::string, std::vector<uint32_t>> exchanges;
+} InstrumentCatalog;
+
+/* Returns nullptr when the cache is missing, damaged or not of this broker and trading day. */
+InstrumentCatalog *openInstrumentCatalog(const char *path, const char *tradingDay, const char *brokerId);
+InstrumentCatalog *createInstrumentCatalog(const std::vector<Message> &rows, const char *tradingDay, const char *brokerId);
+bool saveInstrumentCatalog(const InstrumentCatalog *catalog, const char *path);
+void freeInstrumentCatalog(InstrumentCatalog *catalog);
+
+const CThostFtdcInstrumentField *findInstrument(const InstrumentCatalog *catalog, const char *instrumentId);
+
+/* Indexes of the instruments of a product and/or an exchange, any when both are empty. */
+void filterInstruments(const InstrumentCatalog *catalog, const char *productId, const char *exchangeId, std::vector<uint32_t> *result);
+
+#endif /* __TRADERCATALOG_H__ */
@@ -13,140 +13,142 @@
 #include "traderspi.h"
 #include "ctpmsg.h"
 
-static const MessageFuncs messageFuncs = {
-  {ET_QUIT,                                     msgQuit},
-  {ET_FRONTCONNECTED,                           msgFrontConnected},
-  {ET_FRONTDISCONNECTED,                        msgFrontDisconnected},
-  {ET_HEARTBEATWARNING,                         msgHeartBeatWarning},
-  {ET_RSPAUTHENTICATE,                          rspAuthenticate},
-  {ET_RSPUSERLOGIN,                             rspUserLogin},
-  {ET_RSPUSERLOGOUT,                            rspUserLogout},
-  {ET_RSPUSERPASSWORDUPDATE,                    rspUserPasswordUpdate},
-  {ET_RSPTRADINGACCOUNTPASSWORDUPDATE,          rspTradingAccountPasswordUpdate},
-  {ET_RSPUSERAUTHMETHOD,                        rspUserAuthMethod},
-  {ET_RSPGENUSERCAPTCHA,                        rspGenUserCaptcha},
-  {ET_RSPGENUSERTEXT,                           rspGenUserText},
-  {ET_RSPORDERINSERT,                           rspOrderInsert},
-  {ET_RSPPARKEDORDERINSERT,                     rspParkedOrderInsert},
-  {ET_RSPPARKEDORDERACTION,                     rspParkedOrderAction},
-  {ET_RSPORDERACTION,                           rspOrderAction},
-  {ET_RSPQRYMAXORDERVOLUME,                     rspQryMaxOrderVolume},
-  {ET_RSPSETTLEMENTINFOCONFIRM,                 rspSettlementInfoConfirm},
-  {ET_RSPREMOVEPARKEDORDER,                     rspRemoveParkedOrder},
-  {ET_RSPREMOVEPARKEDORDERACTION,               rspRemoveParkedOrderAction},
-  {ET_RSPEXECORDERINSERT,                       rspExecOrderInsert},
-  {ET_RSPEXECORDERACTION,                       rspExecOrderAction},
-  {ET_RSPFORQUOTEINSERT,                        rspForQuoteInsert},
-  {ET_RSPQUOTEINSERT,                           rspQuoteInsert},
-  {ET_RSPQUOTEACTION,                           rspQuoteAction},
-  {ET_RSPBATCHORDERACTION,                      rspBatchOrderAction},
-  {ET_RSPOPTIONSELFCLOSEINSERT,                 rspOptionSelfCloseInsert},
-  {ET_RSPOPTIONSELFCLOSEACTION,                 rspOptionSelfCloseAction},
-  {ET_RSPCOMBACTIONINSERT,                      rspCombActionInsert},
-  {ET_RSPQRYORDER,                              rspQryOrder},
-  {ET_RSPQRYTRADE,                              rspQryTrade},
-  {ET_RSPQRYINVESTORPOSITION,                   rspQryInvestorPosition},
-  {ET_RSPQRYTRADINGACCOUNT,                     rspQryTradingAccount},
-  {ET_RSPQRYINVESTOR,                           rspQryInvestor},
-  {ET_RSPQRYTRADINGCODE,                        rspQryTradingCode},
-  {ET_RSPQRYINSTRUMENTMARGINRATE,               rspQryInstrumentMarginRate},
-  {ET_RSPQRYINSTRUMENTCOMMISSIONRATE,           rspQryInstrumentCommissionRate},
-  {ET_RSPQRYEXCHANGE,                           rspQryExchange},
-  {ET_RSPQRYPRODUCT,                            rspQryProduct},
-  {ET_RSPQRYINSTRUMENT,                         rspQryInstrument},
-  {ET_RSPQRYDEPTHMARKETDATA,                    rspQryDepthMarketData},
-  {ET_RSPQRYTRADEROFFER,                        rspQryTraderOffer},
-  {ET_RSPQRYSETTLEMENTINFO,                     rspQrySettlementInfo},
-  {ET_RSPQRYTRANSFERBANK,                       rspQryTransferBank},
-  {ET_RSPQRYINVESTORPOSITIONDETAIL,             rspQryInvestorPositionDetail},
-  {ET_RSPQRYNOTICE,                             rspQryNotice},
-  {ET_RSPQRYSETTLEMENTINFOCONFIRM,              rspQrySettlementInfoConfirm},
-  {ET_RSPQRYINVESTORPOSITIONCOMBINEDETAIL,      rspQryInvestorPositionCombineDetail},
-  {ET_RSPQRYCFMMCTRADINGACCOUNTKEY,             rspQryCFMMCTradingAccountKey},
-  {ET_RSPQRYEWARRANTOFFSET,                     rspQryEWarrantOffset},
-  {ET_RSPQRYINVESTORPRODUCTGROUPMARGIN,         rspQryInvestorProductGroupMargin},
-  {ET_RSPQRYEXCHANGEMARGINRATE,                 rspQryExchangeMarginRate},
-  {ET_RSPQRYEXCHANGEMARGINRATEADJUST,           rspQryExchangeMarginRateAdjust},
-  {ET_RSPQRYEXCHANGERATE,                       rspQryExchangeRate},
-  {ET_RSPQRYSECAGENTACIDMAP,                    rspQrySecAgentACIDMap},
-  {ET_RSPQRYPRODUCTEXCHRATE,                    rspQryProductExchRate},
-  {ET_RSPQRYPRODUCTGROUP,                       rspQryProductGroup},
-  {ET_RSPQRYMMINSTRUMENTCOMMISSIONRATE,         rspQryMMInstrumentCommissionRate},
-  {ET_RSPQRYMMOPTIONINSTRCOMMRATE,              rspQryMMOptionInstrCommRate},
-  {ET_RSPQRYINSTRUMENTORDERCOMMRATE,            rspQryInstrumentOrderCommRate},
-  {ET_RSPQRYSECAGENTTRADINGACCOUNT,             rspQrySecAgentTradingAccount},
-  {ET_RSPQRYSECAGENTCHECKMODE,                  rspQrySecAgentCheckMode},
-  {ET_RSPQRYSECAGENTTRADEINFO,                  rspQrySecAgentTradeInfo},
-  {ET_RSPQRYOPTIONINSTRTRADECOST,               rspQryOptionInstrTradeCost},
-  {ET_RSPQRYOPTIONINSTRCOMMRATE,                rspQryOptionInstrCommRate},
-  {ET_RSPQRYEXECORDER,                          rspQryExecOrder},
-  {ET_RSPQRYFORQUOTE,                           rspQryForQuote},
-  {ET_RSPQRYQUOTE,                              rspQryQuote},
-  {ET_RSPQRYOPTIONSELFCLOSE,                    rspQryOptionSelfClose},
-  {ET_RSPQRYINVESTUNIT,                         rspQryInvestUnit},
-  {ET_RSPQRYCOMBINSTRUMENTGUARD,                rspQryCombInstrumentGuard},
-  {ET_RSPQRYCOMBACTION,                         rspQryCombAction},
-  {ET_RSPQRYTRANSFERSERIAL,                     rspQryTransferSerial},
-  {ET_RSPQRYACCOUNTREGISTER,                    rspQryAccountRegister},
-  {ET_RSPERROR,                                 rspError},
-  {ET_RTNORDER,                                 rtnOrder},
-  {ET_RTNTRADE,                                 rtnTrade},
-  {ET_ERRRTNORDERINSERT,                        errRtnOrderInsert},
-  {ET_ERRRTNORDERACTION,                        errRtnOrderAction},
-  {ET_RTNINSTRUMENTSTATUS,                      rtnInstrumentStatus},
-  {ET_RTNBULLETIN,                              rtnBulletin},
-  {ET_RTNTRADINGNOTICE,                         rtnTradingNotice},
-  {ET_RTNERRORCONDITIONALORDER,                 rtnErrorConditionalOrder},
-  {ET_RTNEXECORDER,                             rtnExecOrder},
-  {ET_ERRRTNEXECORDERINSERT,                    errRtnExecOrderInsert},
-  {ET_ERRRTNEXECORDERACTION,                    errRtnExecOrderAction},
-  {ET_ERRRTNFORQUOTEINSERT,                     errRtnForQuoteInsert},
-  {ET_RTNQUOTE,                                 rtnQuote},
-  {ET_ERRRTNQUOTEINSERT,                        errRtnQuoteInsert},
-  {ET_ERRRTNQUOTEACTION,                        errRtnQuoteAction},
-  {ET_RTNFORQUOTERSP,                           rtnForQuote},
-  {ET_RTNCFMMCTRADINGACCOUNTTOKEN,              rtnCFMMCTradingAccountToken},
-  {ET_ERRRTNBATCHORDERACTION,                   errRtnBatchOrderAction},
-  {ET_RTNOPTIONSELFCLOSE,                       rtnOptionSelfClose},
-  {ET_ERRRTNOPTIONSELFCLOSEINSERT,              errRtnOptionSelfCloseInsert},
-  {ET_ERRRTNOPTIONSELFCLOSEACTION,              errRtnOptionSelfCloseAction},
-  {ET_RTNCOMBACTION,                            rtnCombAction},
-  {ET_ERRRTNCOMBACTIONINSERT,                   errRtnCombActionInsert},
-  {ET_RSPQRYCONTRACTBANK,                       rspQryContractBank},
-  {ET_RSPQRYPARKEDORDER,                        rspQryParkedOrder},
-  {ET_RSPQRYPARKEDORDERACTION,                  rspQryParkedOrderAction},
-  {ET_RSPQRYTRADINGNOTICE,                      rspQryTradingNotice},
-  {ET_RSPQRYBROKERTRADINGPARAMS,                rspQryBrokerTradingParams},
-  {ET_RSPQRYBROKERTRADINGALGOS,                 rspQryBrokerTradingAlgos},
-  {ET_RSPQUERYCFMMCTRADINGACCOUNTTOKEN,         rspQueryCFMMCTradingAccountToken},
-  {ET_RTNFROMBANKTOFUTUREBYBANK,                rtnFromBankToFutureByBank},
-  {ET_RTNFROMFUTURETOBANKBYBANK,                rtnFromFutureToBankByBank},
-  {ET_RTNREPEALFROMBANKTOFUTUREBYBANK,          rtnRepealFromBankToFutureByBank},
-  {ET_RTNREPEALFROMFUTURETOBANKBYBANK,          rtnRepealFromFutureToBankByBank},
-  {ET_RTNFROMBANKTOFUTUREBYFUTURE,              rtnFromBankToFutureByFuture},
-  {ET_RTNFROMFUTURETOBANKBYFUTURE,              rtnFromFutureToBankByFuture},
-  {ET_RTNREPEALFROMBANKTOFUTUREBYFUTUREMANUAL,  rtnRepealFromBankToFutureByFutureManual},
-  {ET_RTNREPEALFROMFUTURETOBANKBYFUTUREMANUAL,  rtnRepealFromFutureToBankByFutureManual},
-  {ET_RTNQUERYBANKBALANCEBYFUTURE,              rtnQueryBankBalanceByFuture},
-  {ET_ERRRTNBANKTOFUTUREBYFUTURE,               errRtnBankToFutureByFuture},
-  {ET_ERRRTNFUTURETOBANKBYFUTURE,               errRtnFutureToBankByFuture},
-  {ET_ERRRTNREPEALBANKTOFUTUREBYFUTUREMANUAL,   errRtnRepealBankToFutureByFutureManual},
-  {ET_ERRRTNREPEALFUTURETOBANKBYFUTUREMANUAL,   errRtnRepealFutureToBankByFutureManual},
-  {ET_ERRRTNQUERYBANKBALANCEBYFUTURE,           errRtnQueryBankBalanceByFuture},
-  {ET_RTNREPEALFROMBANKTOFUTUREBYFUTURE,        rtnRepealFromBankToFutureByFuture},
-  {ET_RTNREPEALFROMFUTURETOBANKBYFUTURE,        rtnRepealFromFutureToBankByFuture},
-  {ET_RSPFROMBANKTOFUTUREBYFUTURE,              rspFromBankToFutureByFuture},
-  {ET_RSPFROMFUTURETOBANKBYFUTURE,              rspFromFutureToBankByFuture},
-  {ET_RSPQUERYBANKACCOUNTMONEYBYFUTURE,         rspQueryBankAccountMoneyByFuture},
-  {ET_RTNOPENACCOUNTBYBANK,                     rtnOpenAccountByBank},
-  {ET_RTNCANCELACCOUNTBYBANK,                   rtnCancelAccountByBank},
-  {ET_RTNCHANGEACCOUNTBYBANK,                   rtnChangeAccountByBank},
-  {ET_RSPQRYCLASSIFIEDINSTRUMENT,               rspQryClassifiedInstrument},
-  {ET_RSPQRYCOMBPROMOTIONPARAM,                 rspQryCombPromotionParam},
-  {ET_RSPQRYRISKSETTLEINVSTPOSITION,            rspQryRiskSettleInvstPosition},
-  {ET_RSPQRYRISKSETTLEPRODUCTSTATUS,            rspQryRiskSettleProductStatus},
+static constexpr MessageFunc messageFuncs[] = {
+  {ET_QUIT,                                     msgQuit, nullptr, 0},
+  {ET_FRONTCONNECTED,                           msgFrontConnected, nullptr, 0},
+  {ET_FRONTDISCONNECTED,                        msgFrontDisconnected, nullptr, 0},
+  {ET_HEARTBEATWARNING,                         msgHeartBeatWarning, nullptr, 0},
+  {ET_RSPAUTHENTICATE,                          CTP_MESSAGE(rspAuthenticate)},
+  {ET_RSPUSERLOGIN,                             CTP_MESSAGE(rspUserLogin)},
+  {ET_RSPUSERLOGOUT,                            CTP_MESSAGE(rspUserLogout)},
+  {ET_RSPUSERPASSWORDUPDATE,                    CTP_MESSAGE(rspUserPasswordUpdate)},
+  {ET_RSPTRADINGACCOUNTPASSWORDUPDATE,          CTP_MESSAGE(rspTradingAccountPasswordUpdate)},
+  {ET_RSPUSERAUTHMETHOD,                        CTP_MESSAGE(rspUserAuthMethod)},
+  {ET_RSPGENUSERCAPTCHA,                        CTP_MESSAGE(rspGenUserCaptcha)},
+  {ET_RSPGENUSERTEXT,                           CTP_MESSAGE(rspGenUserText)},
+  {ET_RSPORDERINSERT,                           CTP_MESSAGE(rspOrderInsert)},
+  {ET_RSPPARKEDORDERINSERT,                     CTP_MESSAGE(rspParkedOrderInsert)},
+  {ET_RSPPARKEDORDERACTION,                     CTP_MESSAGE(rspParkedOrderAction)},
+  {ET_RSPORDERACTION,                           CTP_MESSAGE(rspOrderAction)},
+  {ET_RSPQRYMAXORDERVOLUME,                     CTP_MESSAGE(rspQryMaxOrderVolume)},
+  {ET_RSPSETTLEMENTINFOCONFIRM,                 CTP_MESSAGE(rspSettlementInfoConfirm)},
+  {ET_RSPREMOVEPARKEDORDER,                     CTP_MESSAGE(rspRemoveParkedOrder)},
+  {ET_RSPREMOVEPARKEDORDERACTION,               CTP_MESSAGE(rspRemoveParkedOrderAction)},
+  {ET_RSPEXECORDERINSERT,                       CTP_MESSAGE(rspExecOrderInsert)},
+  {ET_RSPEXECORDERACTION,                       CTP_MESSAGE(rspExecOrderAction)},
+  {ET_RSPFORQUOTEINSERT,                        CTP_MESSAGE(rspForQuoteInsert)},
+  {ET_RSPQUOTEINSERT,                           CTP_MESSAGE(rspQuoteInsert)},
+  {ET_RSPQUOTEACTION,                           CTP_MESSAGE(rspQuoteAction)},
+  {ET_RSPBATCHORDERACTION,                      CTP_MESSAGE(rspBatchOrderAction)},
+  {ET_RSPOPTIONSELFCLOSEINSERT,                 CTP_MESSAGE(rspOptionSelfCloseInsert)},
+  {ET_RSPOPTIONSELFCLOSEACTION,                 CTP_MESSAGE(rspOptionSelfCloseAction)},
+  {ET_RSPCOMBACTIONINSERT,                      CTP_MESSAGE(rspCombActionInsert)},
+  {ET_RSPQRYORDER,                              CTP_MESSAGE(rspQryOrder)},
+  {ET_RSPQRYTRADE,                              CTP_MESSAGE(rspQryTrade)},
+  {ET_RSPQRYINVESTORPOSITION,                   CTP_MESSAGE(rspQryInvestorPosition)},
+  {ET_RSPQRYTRADINGACCOUNT,                     CTP_MESSAGE(rspQryTradingAccount)},
+  {ET_RSPQRYINVESTOR,                           CTP_MESSAGE(rspQryInvestor)},
+  {ET_RSPQRYTRADINGCODE,                        CTP_MESSAGE(rspQryTradingCode)},
+  {ET_RSPQRYINSTRUMENTMARGINRATE,               CTP_MESSAGE(rspQryInstrumentMarginRate)},
+  {ET_RSPQRYINSTRUMENTCOMMISSIONRATE,           CTP_MESSAGE(rspQryInstrumentCommissionRate)},
+  {ET_RSPQRYEXCHANGE,                           CTP_MESSAGE(rspQryExchange)},
+  {ET_RSPQRYPRODUCT,                            CTP_MESSAGE(rspQryProduct)},
+  {ET_RSPQRYINSTRUMENT,                         CTP_MESSAGE(rspQryInstrument)},
+  {ET_RSPQRYDEPTHMARKETDATA,                    CTP_MESSAGE(rspQryDepthMarketData)},
+  {ET_RSPQRYTRADEROFFER,                        CTP_MESSAGE(rspQryTraderOffer)},
+  {ET_RSPQRYSETTLEMENTINFO,                     CTP_MESSAGE(rspQrySettlementInfo)},
+  {ET_RSPQRYTRANSFERBANK,                       CTP_MESSAGE(rspQryTransferBank)},
+  {ET_RSPQRYINVESTORPOSITIONDETAIL,             CTP_MESSAGE(rspQryInvestorPositionDetail)},
+  {ET_RSPQRYNOTICE,                             CTP_MESSAGE(rspQryNotice)},
+  {ET_RSPQRYSETTLEMENTINFOCONFIRM,              CTP_MESSAGE(rspQrySettlementInfoConfirm)},
+  {ET_RSPQRYINVESTORPOSITIONCOMBINEDETAIL,      CTP_MESSAGE(rspQryInvestorPositionCombineDetail)},
+  {ET_RSPQRYCFMMCTRADINGACCOUNTKEY,             CTP_MESSAGE(rspQryCFMMCTradingAccountKey)},
+  {ET_RSPQRYEWARRANTOFFSET,                     CTP_MESSAGE(rspQryEWarrantOffset)},
+  {ET_RSPQRYINVESTORPRODUCTGROUPMARGIN,         CTP_MESSAGE(rspQryInvestorProductGroupMargin)},
+  {ET_RSPQRYEXCHANGEMARGINRATE,                 CTP_MESSAGE(rspQryExchangeMarginRate)},
+  {ET_RSPQRYEXCHANGEMARGINRATEADJUST,           CTP_MESSAGE(rspQryExchangeMarginRateAdjust)},
+  {ET_RSPQRYEXCHANGERATE,                       CTP_MESSAGE(rspQryExchangeRate)},
+  {ET_RSPQRYSECAGENTACIDMAP,                    CTP_MESSAGE(rspQrySecAgentACIDMap)},
+  {ET_RSPQRYPRODUCTEXCHRATE,                    CTP_MESSAGE(rspQryProductExchRate)},
+  {ET_RSPQRYPRODUCTGROUP,                       CTP_MESSAGE(rspQryProductGroup)},
+  {ET_RSPQRYMMINSTRUMENTCOMMISSIONRATE,         CTP_MESSAGE(rspQryMMInstrumentCommissionRate)},
+  {ET_RSPQRYMMOPTIONINSTRCOMMRATE,              CTP_MESSAGE(rspQryMMOptionInstrCommRate)},
+  {ET_RSPQRYINSTRUMENTORDERCOMMRATE,            CTP_MESSAGE(rspQryInstrumentOrderCommRate)},
+  {ET_RSPQRYSECAGENTTRADINGACCOUNT,             CTP_MESSAGE(rspQrySecAgentTradingAccount)},
+  {ET_RSPQRYSECAGENTCHECKMODE,                  CTP_MESSAGE(rspQrySecAgentCheckMode)},
+  {ET_RSPQRYSECAGENTTRADEINFO,                  CTP_MESSAGE(rspQrySecAgentTradeInfo)},
+  {ET_RSPQRYOPTIONINSTRTRADECOST,               CTP_MESSAGE(rspQryOptionInstrTradeCost)},
+  {ET_RSPQRYOPTIONINSTRCOMMRATE,                CTP_MESSAGE(rspQryOptionInstrCommRate)},
+  {ET_RSPQRYEXECORDER,                          CTP_MESSAGE(rspQryExecOrder)},
+  {ET_RSPQRYFORQUOTE,                           CTP_MESSAGE(rspQryForQuote)},
+  {ET_RSPQRYQUOTE,                              CTP_MESSAGE(rspQryQuote)},
+  {ET_RSPQRYOPTIONSELFCLOSE,                    CTP_MESSAGE(rspQryOptionSelfClose)},
+  {ET_RSPQRYINVESTUNIT,                         CTP_MESSAGE(rspQryInvestUnit)},
+  {ET_RSPQRYCOMBINSTRUMENTGUARD,                CTP_MESSAGE(rspQryCombInstrumentGuard)},
+  {ET_RSPQRYCOMBACTION,                         CTP_MESSAGE(rspQryCombAction)},
+  {ET_RSPQRYTRANSFERSERIAL,                     CTP_MESSAGE(rspQryTransferSerial)},
+  {ET_RSPQRYACCOUNTREGISTER,                    CTP_MESSAGE(rspQryAccountRegister)},
+  {ET_RSPERROR,                                 CTP_MESSAGE(rspError)},
+  {ET_RTNORDER,                                 CTP_MESSAGE(rtnOrder)},
+  {ET_RTNTRADE,                                 CTP_MESSAGE(rtnTrade)},
+  {ET_ERRRTNORDERINSERT,                        CTP_MESSAGE(errRtnOrderInsert)},
+  {ET_ERRRTNORDERACTION,                        CTP_MESSAGE(errRtnOrderAction)},
+  {ET_RTNINSTRUMENTSTATUS,                      CTP_MESSAGE(rtnInstrumentStatus)},
+  {ET_RTNBULLETIN,                              CTP_MESSAGE(rtnBulletin)},
+  {ET_RTNTRADINGNOTICE,                         CTP_MESSAGE(rtnTradingNotice)},
+  {ET_RTNERRORCONDITIONALORDER,                 CTP_MESSAGE(rtnErrorConditionalOrder)},
+  {ET_RTNEXECORDER,                             CTP_MESSAGE(rtnExecOrder)},
+  {ET_ERRRTNEXECORDERINSERT,                    CTP_MESSAGE(errRtnExecOrderInsert)},
+  {ET_ERRRTNEXECORDERACTION,                    CTP_MESSAGE(errRtnExecOrderAction)},
+  {ET_ERRRTNFORQUOTEINSERT,                     CTP_MESSAGE(errRtnForQuoteInsert)},
+  {ET_RTNQUOTE,                                 CTP_MESSAGE(rtnQuote)},
+  {ET_ERRRTNQUOTEINSERT,                        CTP_MESSAGE(errRtnQuoteInsert)},
+  {ET_ERRRTNQUOTEACTION,                        CTP_MESSAGE(errRtnQuoteAction)},
+  {ET_RTNFORQUOTERSP,                           CTP_MESSAGE(rtnForQuote)},
+  {ET_RTNCFMMCTRADINGACCOUNTTOKEN,              CTP_MESSAGE(rtnCFMMCTradingAccountToken)},
+  {ET_ERRRTNBATCHORDERACTION,                   CTP_MESSAGE(errRtnBatchOrderAction)},
+  {ET_RTNOPTIONSELFCLOSE,                       CTP_MESSAGE(rtnOptionSelfClose)},
+  {ET_ERRRTNOPTIONSELFCLOSEINSERT,              CTP_MESSAGE(errRtnOptionSelfCloseInsert)},
+  {ET_ERRRTNOPTIONSELFCLOSEACTION,              CTP_MESSAGE(errRtnOptionSelfCloseAction)},
+  {ET_RTNCOMBACTION,                            CTP_MESSAGE(rtnCombAction)},
+  {ET_ERRRTNCOMBACTIONINSERT,                   CTP_MESSAGE(errRtnCombActionInsert)},
+  {ET_RSPQRYCONTRACTBANK,                       CTP_MESSAGE(rspQryContractBank)},
+  {ET_RSPQRYPARKEDORDER,                        CTP_MESSAGE(rspQryParkedOrder)},
+  {ET_RSPQRYPARKEDORDERACTION,                  CTP_MESSAGE(rspQryParkedOrderAction)},
+  {ET_RSPQRYTRADINGNOTICE,                      CTP_MESSAGE(rspQryTradingNotice)},
+  {ET_RSPQRYBROKERTRADINGPARAMS,                CTP_MESSAGE(rspQryBrokerTradingParams)},
+  {ET_RSPQRYBROKERTRADINGALGOS,                 CTP_MESSAGE(rspQryBrokerTradingAlgos)},
+  {ET_RSPQUERYCFMMCTRADINGACCOUNTTOKEN,         CTP_MESSAGE(rspQueryCFMMCTradingAccountToken)},
+  {ET_RTNFROMBANKTOFUTUREBYBANK,                CTP_MESSAGE(rtnFromBankToFutureByBank)},
+  {ET_RTNFROMFUTURETOBANKBYBANK,                CTP_MESSAGE(rtnFromFutureToBankByBank)},
+  {ET_RTNREPEALFROMBANKTOFUTUREBYBANK,          CTP_MESSAGE(rtnRepealFromBankToFutureByBank)},
+  {ET_RTNREPEALFROMFUTURETOBANKBYBANK,          CTP_MESSAGE(rtnRepealFromFutureToBankByBank)},
+  {ET_RTNFROMBANKTOFUTUREBYFUTURE,              CTP_MESSAGE(rtnFromBankToFutureByFuture)},
+  {ET_RTNFROMFUTURETOBANKBYFUTURE,              CTP_MESSAGE(rtnFromFutureToBankByFuture)},
+  {ET_RTNREPEALFROMBANKTOFUTUREBYFUTUREMANUAL,  CTP_MESSAGE(rtnRepealFromBankToFutureByFutureManual)},
+  {ET_RTNREPEALFROMFUTURETOBANKBYFUTUREMANUAL,  CTP_MESSAGE(rtnRepealFromFutureToBankByFutureManual)},
+  {ET_RTNQUERYBANKBALANCEBYFUTURE,              CTP_MESSAGE(rtnQueryBankBalanceByFuture)},
+  {ET_ERRRTNBANKTOFUTUREBYFUTURE,               CTP_MESSAGE(errRtnBankToFutureByFuture)},
+  {ET_ERRRTNFUTURETOBANKBYFUTURE,               CTP_MESSAGE(errRtnFutureToBankByFuture)},
+  {ET_ERRRTNREPEALBANKTOFUTUREBYFUTUREMANUAL,   CTP_MESSAGE(errRtnRepealBankToFutureByFutureManual)},
+  {ET_ERRRTNREPEALFUTURETOBANKBYFUTUREMANUAL,   CTP_MESSAGE(errRtnRepealFutureToBankByFutureManual)},
+  {ET_ERRRTNQUERYBANKBALANCEBYFUTURE,           CTP_MESSAGE(errRtnQueryBankBalanceByFuture)},
+  {ET_RTNREPEALFROMBANKTOFUTUREBYFUTURE,        CTP_MESSAGE(rtnRepealFromBankToFutureByFuture)},
+  {ET_RTNREPEALFROMFUTURETOBANKBYFUTURE,        CTP_MESSAGE(rtnRepealFromFutureToBankByFuture)},
+  {ET_RSPFROMBANKTOFUTUREBYFUTURE,              CTP_MESSAGE(rspFromBankToFutureByFuture)},
+  {ET_RSPFROMFUTURETOBANKBYFUTURE,              CTP_MESSAGE(rspFromFutureToBankByFuture)},
+  {ET_RSPQUERYBANKACCOUNTMONEYBYFUTURE,         CTP_MESSAGE(rspQueryBankAccountMoneyByFuture)},
+  {ET_RTNOPENACCOUNTBYBANK,                     CTP_MESSAGE(rtnOpenAccountByBank)},
+  {ET_RTNCANCELACCOUNTBYBANK,                   CTP_MESSAGE(rtnCancelAccountByBank)},
+  {ET_RTNCHANGEACCOUNTBYBANK,                   CTP_MESSAGE(rtnChangeAccountByBank)},
+  {ET_RSPQRYCLASSIFIEDINSTRUMENT,               CTP_MESSAGE(rspQryClassifiedInstrument)},
+  {ET_RSPQRYCOMBPROMOTIONPARAM,                 CTP_MESSAGE(rspQryCombPromotionParam)},
+  {ET_RSPQRYRISKSETTLEINVSTPOSITION,            CTP_MESSAGE(rspQryRiskSettleInvstPosition)},
+  {ET_RSPQRYRISKSETTLEPRODUCTSTATUS,            CTP_MESSAGE(rspQryRiskSettleProductStatus)},
 };
 
-napi_status getTraderMessageValue(napi_env env, const Message *message, napi_value *result) {
-  return getMessageValue(env, messageFuncs, message, result);
+static_assert(arraysize(messageFuncs) == ET_COUNT && isEventTable(messageFuncs, ET_BASE), "messageFuncs must follow the ET_* order");
+
+napi_status getTraderMessageValue(napi_env env, const Message *message, int delivery, napi_value *result) {
+  return getMessageValue(env, messageFuncs, ET_BASE, ET_COUNT, message, delivery, result);
 }
@@ -0,0 +1,32 @@
+/*
+ * traderprepare.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "traderprepare.h"
+#include <string.h>
+
+PreparedRequest *createPreparedRequest(const RequestMethod *method) {
+  PreparedRequest *prepared = new PreparedRequest();
+
+  if (!prepared)
+    return nullptr;
+
+  memset(prepared->req, 0, sizeof(prepared->req));
+
+  prepared->method = method;
+  prepared->trader = nullptr;
+  prepared->owner = nullptr;
+
+  return prepared;
+}
+
+void freePreparedRequest(PreparedRequest *prepared) {
+  delete prepared;
+}
@@ -0,0 +1,53 @@
+/*
+ * traderprepare.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __TRADERPREPARE_H__
+#define __TRADERPREPARE_H__
+
+#include "ctpfields.h"
+#include "napi_ctp.h"
+#include <vector>
+
+#define PREPARED_REQUEST_SIZE 1024 /* bytes, larger than any request struct */
+#define PREPARED_FIELDS_MAX 16
+
+typedef int (*RequestSender)(CThostFtdcTraderApi *api, void *req, int requestId);
+typedef void (*RequestHook)(struct Trader *trader, const void *req);
+
+/*
+ * A req or query method of the trader, priority is the default one of a
+ * query method, -1 for a plain request.
+ */
+typedef struct RequestMethod {
+  const char *name;
+  const CtpFields *table;
+  size_t size;
+  RequestSender send;
+  RequestHook hook;
+  int priority;
+} RequestMethod;
+
+/*
+ * A request marshalled once from its template. send only writes the
+ * varying fields into req before every call.
+ */
+typedef struct PreparedRequest {
+  alignas(8) uint8_t req[PREPARED_REQUEST_SIZE];
+  const RequestMethod *method;
+  std::vector<const CtpField *> fields;
+  struct Trader *trader;
+  napi_ref owner;
+} PreparedRequest;
+
+PreparedRequest *createPreparedRequest(const RequestMethod *method);
+void freePreparedRequest(PreparedRequest *prepared);
+
+#endif /* __TRADERPREPARE_H__ */
@@ -0,0 +1,281 @@
+/*
+ * traderquery.cpp
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#include "traderquery.h"
+#include "traderspi.h"
+#include <string.h>
+
+#define MILLISEC 1000000ull /* ns */
+
+QueryScheduler *createQueryScheduler(double rate) {
+  QueryScheduler *scheduler = new QueryScheduler();
+
+  if (!scheduler)
+    return nullptr;
+
+  scheduler->api = nullptr;
+  scheduler->interval = rate > 0 ? (uint64_t)(1e9 / rate) : 0;
+  scheduler->nextSend = 0;
+  scheduler->backoff = 0;
+  scheduler->count.store(0, std::memory_order_relaxed);
+  scheduler->wakeup.store(UINT64_MAX, std::memory_order_relaxed);
+
+  memset(&scheduler->stats, 0, sizeof(scheduler->stats));
+  uv_mutex_init(&scheduler->mutex);
+
+  return scheduler;
+}
+
+void freeQueryScheduler(QueryScheduler *scheduler) {
+  uv_mutex_destroy(&scheduler->mutex);
+  delete scheduler;
+}
+
+int nextRequestId() {
+  return (int)((uint32_t)sequenceId() % REQUEST_ID_MAX) + 1;
+}
+
+int nextQueryId() {
+  static std::atomic<uint32_t> queryLastId(0);
+
+  return QUERY_ID_BASE | (int)(queryLastId.fetch_add(1, std::memory_order_relaxed) & REQUEST_ID_MAX);
+}
+
+Query *createQuery(int requestId, int priority, int64_t timeout, QuerySender &&send) {
+  Query *query = new Query();
+
+  if (!query)
+    return nullptr;
+
+  query->deferred = nullptr;
+  query->requestId = requestId;
+  query->priority = priority;
+  query->result = 0;
+  query->deadline = timeout > 0 ? uv_hrtime() + (uint64_t)timeout * MILLISEC : UINT64_MAX;
+  query->reason = nullptr;
+  query->send = std::move(send);
+
+  return query;
+}
+
+void freeQuery(Query *query) {
+  for (auto it = query->rows.begin(); it != query->rows.end(); ++it)
+    TraderSpi::done(*it);
+
+  if (query->error.data)
+    TraderSpi::done(query->error);
+
+  delete query;
+}
+
+static void finishQuery(QueryScheduler *scheduler, Query *query, std::vector<Query *> *settled) {
+  scheduler->count.fetch_sub(1, std::memory_order_relaxed);
+  settled->push_back(query);
+}
+
+static Query *nextQuery(QueryScheduler *scheduler) {
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i)
+    if (!scheduler->queued[i].empty())
+      return scheduler->queued[i].front();
+
+  return nullptr;
+}
+
+static void sendQueries(QueryScheduler *scheduler, uint64_t now, std::vector<Query *> *settled) {
+  Query *query;
+
+  while (now >= scheduler->nextSend && (query = nextQuery(scheduler))) {
+    // Pending before it is sent, the first row may come back before ReqQry returns.
+    scheduler->pending.emplace(query->requestId, query);
+
+    int result = query->send(scheduler->api, query->requestId);
+
+    if (result == 0) {
+      scheduler->queued[query->priority].pop_front();
+      scheduler->nextSend = now + scheduler->interval;
+      scheduler->backoff = 0;
+      scheduler->stats.sent += 1;
+      continue;
+    }
+
+    scheduler->pending.erase(query->requestId);
+
+    // Over the flow limit, the query keeps its place and the session waits,
+    // the retry goes out under an id of its own.
+    if (result == -2 || result == -3) {
+      query->requestId = nextQueryId();
+
+      uint64_t delay = scheduler->interval > QUERY_RETRY_DELAY * MILLISEC ? scheduler->interval : QUERY_RETRY_DELAY * MILLISEC;
+
+      scheduler->nextSend = now + (delay << scheduler->backoff);
+      scheduler->stats.retries += 1;
+
+      if (scheduler->backoff < QUERY_BACKOFF_MAX)
+        scheduler->backoff += 1;
+
+      break;
+    }
+
+    scheduler->queued[query->priority].pop_front();
+    scheduler->stats.failed += 1;
+
+    query->result = result;
+    finishQuery(scheduler, query, settled);
+  }
+}
+
+static void expireQueries(QueryScheduler *scheduler, uint64_t now, std::vector<Query *> *settled) {
+  for (auto it = scheduler->pending.begin(); it != scheduler->pending.end();) {
+    if (it->second->deadline > now) {
+      ++it;
+      continue;
+    }
+
+    it->second->reason = "The query timed out";
+    scheduler->stats.timeouts += 1;
+
+    finishQuery(scheduler, it->second, settled);
+    it = scheduler->pending.erase(it);
+  }
+
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i) {
+    std::deque<Query *> &queue = scheduler->queued[i];
+
+    for (auto it = queue.begin(); it != queue.end();) {
+      if ((*it)->deadline > now) {
+        ++it;
+        continue;
+      }
+
+      (*it)->reason = "The query timed out";
+      scheduler->stats.timeouts += 1;
+
+      finishQuery(scheduler, *it, settled);
+      it = queue.erase(it);
+    }
+  }
+}
+
+static void updateWakeup(QueryScheduler *scheduler) {
+  uint64_t wakeup = nextQuery(scheduler) ? scheduler->nextSend : UINT64_MAX;
+
+  for (auto it = scheduler->pending.begin(); it != scheduler->pending.end(); ++it)
+    if (it->second->deadline < wakeup)
+      wakeup = it->second->deadline;
+
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i)
+    for (auto it = scheduler->queued[i].begin(); it != scheduler->queued[i].end(); ++it)
+      if ((*it)->deadline < wakeup)
+        wakeup = (*it)->deadline;
+
+  scheduler->wakeup.store(wakeup, std::memory_order_relaxed);
+}
+
+void scheduleQuery(QueryScheduler *scheduler, Query *query, std::vector<Query *> *settled) {
+  uv_mutex_lock(&scheduler->mutex);
+
+  scheduler->queued[query->priority].push_back(query);
+  scheduler->count.fetch_add(1, std::memory_order_release);
+
+  sendQueries(scheduler, uv_hrtime(), settled);
+  updateWakeup(scheduler);
+
+  uv_mutex_unlock(&scheduler->mutex);
+}
+
+void runQueries(QueryScheduler *scheduler, std::vector<Query *> *settled) {
+  uint64_t now = uv_hrtime();
+
+  if (now < scheduler->wakeup.load(std::memory_order_relaxed))
+    return;
+
+  uv_mutex_lock(&scheduler->mutex);
+
+  expireQueries(scheduler, now, settled);
+  sendQueries(scheduler, now, settled);
+  updateWakeup(scheduler);
+
+  uv_mutex_unlock(&scheduler->mutex);
+}
+
+bool collectQuery(QueryScheduler *scheduler, Message *message, std::vector<Query *> *settled) {
+  if (!isQueryRequestId(message->requestId))
+    return false;
+
+  // Late rows of a query that timed out or was cancelled, nobody asked for them.
+  if (!hasQueries(scheduler)) {
+    TraderSpi::done(*message);
+    return true;
+  }
+
+  uv_mutex_lock(&scheduler->mutex);
+
+  auto iter = scheduler->pending.find((int)message->requestId);
+
+  if (iter == scheduler->pending.end()) {
+    uv_mutex_unlock(&scheduler->mutex);
+    TraderSpi::done(*message);
+    return true;
+  }
+
+  Query *query = iter->second;
+  bool isError = ET_RSPERROR == message->event;
+
+  if (isError)
+    query->error = *message;
+  else if (message->data)
+    query->rows.push_back(*message);
+
+  if (isError || message->isLast) {
+    scheduler->pending.erase(iter);
+    finishQuery(scheduler, query, settled);
+  }
+
+  uv_mutex_unlock(&scheduler->mutex);
+
+  return true;
+}
+
+void cancelQueries(QueryScheduler *scheduler, const char *reason, std::vector<Query *> *settled) {
+  uv_mutex_lock(&scheduler->mutex);
+
+  for (auto it = scheduler->pending.begin(); it != scheduler->pending.end(); ++it) {
+    it->second->reason = reason;
+    finishQuery(scheduler, it->second, settled);
+  }
+
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i) {
+    for (auto it = scheduler->queued[i].begin(); it != scheduler->queued[i].end(); ++it) {
+      (*it)->reason = reason;
+      finishQuery(scheduler, *it, settled);
+    }
+
+    scheduler->queued[i].clear();
+  }
+
+  scheduler->pending.clear();
+  scheduler->wakeup.store(UINT64_MAX, std::memory_order_relaxed);
+
+  uv_mutex_unlock(&scheduler->mutex);
+}
+
+void getQueryStats(QueryScheduler *scheduler, QueryStats *stats) {
+  uv_mutex_lock(&scheduler->mutex);
+
+  *stats = scheduler->stats;
+  stats->pending = (uint32_t)scheduler->pending.size();
+  stats->queued = 0;
+
+  for (int i = 0; i < QUERY_PRIORITY_COUNT; ++i)
+    stats->queued += (uint32_t)scheduler->queued[i].size();
+
+  uv_mutex_unlock(&scheduler->mutex);
+}
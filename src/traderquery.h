@@ -0,0 +1,121 @@
+/*
+ * traderquery.h
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+#ifndef __TRADERQUERY_H__
+#define __TRADERQUERY_H__
+
+#include "napi_ctp.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <uv.h>
+
+#define QUERY_RATE 1 /* queries per second */
+#define QUERY_RETRY_DELAY 100 /* ms, least backoff when the rate is unlimited */
+#define QUERY_BACKOFF_MAX 4 /* the backoff doubles at most this many times */
+
+/*
+ * req* calls number their requests from 1 to REQUEST_ID_MAX, caller ids
+ * included, queries take the ids above. A response then only ever matches
+ * the query it answers, whatever ids the caller picks.
+ */
+#define REQUEST_ID_MAX 0x3fffffff
+#define QUERY_ID_BASE (REQUEST_ID_MAX + 1)
+
+static inline bool isQueryRequestId(uint32_t requestId) {
+  return requestId >= QUERY_ID_BASE;
+}
+
+enum { QUERY_PRIORITY_HIGH = 0, QUERY_PRIORITY_NORMAL, QUERY_PRIORITY_LOW, QUERY_PRIORITY_COUNT };
+
+typedef struct Query Query;
+
+typedef std::function<int(CThostFtdcTraderApi *api, int requestId)> QuerySender;
+typedef std::function<napi_status(napi_env env, const Query *query, napi_value *result)> QueryConverter;
+
+/*
+ * A query* call: queued until the scheduler sends it, then pending until
+ * the dispatch thread has diverted its last row or an error into it.
+ * result is the failed ReqQry return value, reason is set when it was
+ * never answered. convert, when set, resolves the rows to something other
+ * than an array of objects.
+ */
+typedef struct Query {
+  napi_deferred deferred;
+  int requestId;
+  int priority;
+  int result;
+  uint64_t deadline;
+  const char *reason;
+  QuerySender send;
+  QueryConverter convert;
+  Message error;
+  std::vector<Message> rows;
+} Query;
+
+typedef struct QueryStats {
+  uint32_t queued;
+  uint32_t pending;
+  uint64_t sent;
+  uint64_t retries;
+  uint64_t failed;
+  uint64_t timeouts;
+} QueryStats;
+
+/*
+ * Paces the query* requests of one trader, CTP refuses queries beyond the
+ * broker's rate with -2 or -3. The queues are served highest priority
+ * first at most one query per interval; a refused query goes back to the
+ * head of its queue and the whole session backs off, doubling the delay
+ * on every refusal in a row. Both the JS thread, when a query is due at
+ * once, and the dispatch thread send. wakeup is the earliest time a
+ * queued query is due or a deadline expires, so the dispatch thread only
+ * takes the mutex when there is work.
+ */
+typedef struct QueryScheduler {
+  uv_mutex_t mutex;
+  CThostFtdcTraderApi *api;
+  uint64_t interval;
+  uint64_t nextSend;
+  uint32_t backoff;
+  std::deque<Query *> queued[QUERY_PRIORITY_COUNT];
+  std::unordered_map<int, Query *> pending;
+  std::atomic<uint32_t> count;
+  std::atomic<uint64_t> wakeup;
+  QueryStats stats;
+} QueryScheduler;
+
+QueryScheduler *createQueryScheduler(double rate);
+void freeQueryScheduler(QueryScheduler *scheduler);
+
+/* The next request id of a req* call and of a query. */
+int nextRequestId();
+int nextQueryId();
+
+Query *createQuery(int requestId, int priority, int64_t timeout, QuerySender &&send);
+void freeQuery(Query *query);
+
+/* Each appends the queries it finished to settled. */
+void scheduleQuery(QueryScheduler *scheduler, Query *query, std::vector<Query *> *settled);
+void runQueries(QueryScheduler *scheduler, std::vector<Query *> *settled);
+/* Takes every response in the query id range, one no query waits for any more is freed. */
+bool collectQuery(QueryScheduler *scheduler, Message *message, std::vector<Query *> *settled);
+void cancelQueries(QueryScheduler *scheduler, const char *reason, std::vector<Query *> *settled);
+
+static inline bool hasQueries(QueryScheduler *scheduler) {
+  return scheduler->count.load(std::memory_order_acquire) > 0;
+}
+
+void getQueryStats(QueryScheduler *scheduler, QueryStats *stats);
+
+#endif /* __TRADERQUERY_H__ */
@@ -10,10 +10,9 @@
  */
 
 #include "traderspi.h"
-#include <map>
-#include <string>
+#include <string.h>
 
-static const std::map<int, std::string> eventNames = {
+static constexpr EventName eventNames[] = {
   {ET_QUIT,                                     "quit"},
   {ET_FRONTCONNECTED,                           "front-connected"},
   {ET_FRONTDISCONNECTED,                        "front-disconnected"},
@@ -147,6 +146,8 @@ static const std::map<int, std::string> eventNames = {
   {ET_RSPQRYRISKSETTLEPRODUCTSTATUS,            "rsp-qry-risk-settle-product-status"},
 };
 
+static_assert(arraysize(eventNames) == ET_COUNT && isEventTable(eventNames, ET_BASE), "eventNames must follow the ET_* order");
+
 static bool isFreeable(int event) {
   switch(event) {
     case ET_QUIT:
@@ -159,7 +160,7 @@ static bool isFreeable(int event) {
   }
 }
 
-TraderSpi::TraderSpi() {}
+TraderSpi::TraderSpi(size_t capacity) : _msgq(capacity, ET_BASE, ET_COUNT, done) {}
 
 TraderSpi::~TraderSpi() {
   Message msg;
@@ -172,25 +173,79 @@ int TraderSpi::poll(Message *message, unsigned int millisec) {
   return _msgq.pop(message, millisec);
 }
 
+int TraderSpi::pollUntil(Message *message, uint64_t deadline) {
+  return _msgq.popUntil(message, deadline);
+}
+
 void TraderSpi::done(Message &message) {
   if (isFreeable(message.event))
-    free((void *)message.data);
+    freePayload((void *)message.data);
 
   message.data = 0;
 }
 
 void TraderSpi::quit(int nCode) {
   Message msg = {ET_QUIT, (uintptr_t)nCode};
-  _msgq.push(msg);
+  _msgq.post(msg);
 }
 
-const char *TraderSpi::eventName(int event) {
-  auto iter = eventNames.find(event);
+void TraderSpi::close() {
+  _msgq.close();
+}
+
+void TraderSpi::setOverflowPolicy(int event, int policy) {
+  _msgq.setPolicy(event, isLossless(event) ? OVERFLOW_BLOCK : policy);
+}
+
+void TraderSpi::getQueueStats(QueueStats *stats) {
+  _msgq.getStats(stats);
+}
+
+bool TraderSpi::isLossless(int event) {
+  switch(event) {
+    case ET_QUIT:
+    case ET_FRONTCONNECTED:
+    case ET_FRONTDISCONNECTED:
+    case ET_RSPORDERINSERT:
+    case ET_RSPPARKEDORDERINSERT:
+    case ET_RSPPARKEDORDERACTION:
+    case ET_RSPORDERACTION:
+    case ET_RSPEXECORDERINSERT:
+    case ET_RSPEXECORDERACTION:
+    case ET_RSPQUOTEINSERT:
+    case ET_RSPQUOTEACTION:
+    case ET_RSPBATCHORDERACTION:
+    case ET_RTNORDER:
+    case ET_RTNTRADE:
+    case ET_ERRRTNORDERINSERT:
+    case ET_ERRRTNORDERACTION:
+    case ET_RTNERRORCONDITIONALORDER:
+    case ET_RTNEXECORDER:
+    case ET_ERRRTNEXECORDERINSERT:
+    case ET_ERRRTNEXECORDERACTION:
+    case ET_RTNQUOTE:
+    case ET_ERRRTNQUOTEINSERT:
+    case ET_ERRRTNQUOTEACTION:
+    case ET_ERRRTNBATCHORDERACTION:
+      return true;
+    default:
+      return false;
+  }
+}
 
-  if (iter == eventNames.end())
+const char *TraderSpi::eventName(int event) {
+  if (event < ET_BASE || event >= ET_BASE + ET_COUNT)
     return nullptr;
 
-  return iter->second.c_str();
+  return eventNames[event - ET_BASE].name;
+}
+
+int TraderSpi::eventId(const char *name) {
+  for (int i = 0; i < ET_COUNT; ++i)
+    if (0 == strcmp(eventNames[i].name, name))
+      return eventNames[i].event;
+
+  return -1;
 }
 
 void TraderSpi::OnFrontConnected() {
@@ -212,7 +267,7 @@ void TraderSpi::OnRspAuthenticate(CThostFtdcRspAuthenticateField *pRspAuthentica
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPAUTHENTICATE, copyData(pRspAuthenticateField)};
+  Message msg = {ET_RSPAUTHENTICATE, copyData(pRspAuthenticateField), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -220,7 +275,7 @@ void TraderSpi::OnRspUserLogin(CThostFtdcRspUserLoginField *pRspUserLogin, CThos
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPUSERLOGIN, copyData(pRspUserLogin)};
+  Message msg = {ET_RSPUSERLOGIN, copyData(pRspUserLogin), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -228,7 +283,7 @@ void TraderSpi::OnRspUserLogout(CThostFtdcUserLogoutField *pUserLogout, CThostFt
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPUSERLOGOUT, copyData(pUserLogout)};
+  Message msg = {ET_RSPUSERLOGOUT, copyData(pUserLogout), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -236,7 +291,7 @@ void TraderSpi::OnRspUserPasswordUpdate(CThostFtdcUserPasswordUpdateField *pUser
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPUSERPASSWORDUPDATE, copyData(pUserPasswordUpdate)};
+  Message msg = {ET_RSPUSERPASSWORDUPDATE, copyData(pUserPasswordUpdate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -244,7 +299,7 @@ void TraderSpi::OnRspTradingAccountPasswordUpdate(CThostFtdcTradingAccountPasswo
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPTRADINGACCOUNTPASSWORDUPDATE, copyData(pTradingAccountPasswordUpdate)};
+  Message msg = {ET_RSPTRADINGACCOUNTPASSWORDUPDATE, copyData(pTradingAccountPasswordUpdate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -252,7 +307,7 @@ void TraderSpi::OnRspUserAuthMethod(CThostFtdcRspUserAuthMethodField *pRspUserAu
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPUSERAUTHMETHOD, copyData(pRspUserAuthMethod)};
+  Message msg = {ET_RSPUSERAUTHMETHOD, copyData(pRspUserAuthMethod), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -260,7 +315,7 @@ void TraderSpi::OnRspGenUserCaptcha(CThostFtdcRspGenUserCaptchaField *pRspGenUse
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPGENUSERCAPTCHA, copyData(pRspGenUserCaptcha)};
+  Message msg = {ET_RSPGENUSERCAPTCHA, copyData(pRspGenUserCaptcha), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -268,7 +323,7 @@ void TraderSpi::OnRspGenUserText(CThostFtdcRspGenUserTextField *pRspGenUserText,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPGENUSERTEXT, copyData(pRspGenUserText)};
+  Message msg = {ET_RSPGENUSERTEXT, copyData(pRspGenUserText), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -276,7 +331,7 @@ void TraderSpi::OnRspOrderInsert(CThostFtdcInputOrderField *pInputOrder, CThostF
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPORDERINSERT, copyData(pInputOrder)};
+  Message msg = {ET_RSPORDERINSERT, copyData(pInputOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -284,7 +339,7 @@ void TraderSpi::OnRspParkedOrderInsert(CThostFtdcParkedOrderField *pParkedOrder,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPPARKEDORDERINSERT, copyData(pParkedOrder)};
+  Message msg = {ET_RSPPARKEDORDERINSERT, copyData(pParkedOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -292,7 +347,7 @@ void TraderSpi::OnRspParkedOrderAction(CThostFtdcParkedOrderActionField *pParked
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPPARKEDORDERACTION, copyData(pParkedOrderAction)};
+  Message msg = {ET_RSPPARKEDORDERACTION, copyData(pParkedOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -300,7 +355,7 @@ void TraderSpi::OnRspOrderAction(CThostFtdcInputOrderActionField *pInputOrderAct
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPORDERACTION, copyData(pInputOrderAction)};
+  Message msg = {ET_RSPORDERACTION, copyData(pInputOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -308,7 +363,7 @@ void TraderSpi::OnRspQryMaxOrderVolume(CThostFtdcQryMaxOrderVolumeField *pQryMax
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYMAXORDERVOLUME, copyData(pQryMaxOrderVolume)};
+  Message msg = {ET_RSPQRYMAXORDERVOLUME, copyData(pQryMaxOrderVolume), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -316,7 +371,7 @@ void TraderSpi::OnRspSettlementInfoConfirm(CThostFtdcSettlementInfoConfirmField
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPSETTLEMENTINFOCONFIRM, copyData(pSettlementInfoConfirm)};
+  Message msg = {ET_RSPSETTLEMENTINFOCONFIRM, copyData(pSettlementInfoConfirm), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -324,7 +379,7 @@ void TraderSpi::OnRspRemoveParkedOrder(CThostFtdcRemoveParkedOrderField *pRemove
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPREMOVEPARKEDORDER, copyData(pRemoveParkedOrder)};
+  Message msg = {ET_RSPREMOVEPARKEDORDER, copyData(pRemoveParkedOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -332,7 +387,7 @@ void TraderSpi::OnRspRemoveParkedOrderAction(CThostFtdcRemoveParkedOrderActionFi
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPREMOVEPARKEDORDERACTION, copyData(pRemoveParkedOrderAction)};
+  Message msg = {ET_RSPREMOVEPARKEDORDERACTION, copyData(pRemoveParkedOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -340,7 +395,7 @@ void TraderSpi::OnRspExecOrderInsert(CThostFtdcInputExecOrderField *pInputExecOr
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPEXECORDERINSERT, copyData(pInputExecOrder)};
+  Message msg = {ET_RSPEXECORDERINSERT, copyData(pInputExecOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -348,7 +403,7 @@ void TraderSpi::OnRspExecOrderAction(CThostFtdcInputExecOrderActionField *pInput
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPEXECORDERACTION, copyData(pInputExecOrderAction)};
+  Message msg = {ET_RSPEXECORDERACTION, copyData(pInputExecOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -356,7 +411,7 @@ void TraderSpi::OnRspForQuoteInsert(CThostFtdcInputForQuoteField *pInputForQuote
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPFORQUOTEINSERT, copyData(pInputForQuote)};
+  Message msg = {ET_RSPFORQUOTEINSERT, copyData(pInputForQuote), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -364,7 +419,7 @@ void TraderSpi::OnRspQuoteInsert(CThostFtdcInputQuoteField *pInputQuote, CThostF
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQUOTEINSERT, copyData(pInputQuote)};
+  Message msg = {ET_RSPQUOTEINSERT, copyData(pInputQuote), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -372,7 +427,7 @@ void TraderSpi::OnRspQuoteAction(CThostFtdcInputQuoteActionField *pInputQuoteAct
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQUOTEACTION, copyData(pInputQuoteAction)};
+  Message msg = {ET_RSPQUOTEACTION, copyData(pInputQuoteAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -380,7 +435,7 @@ void TraderSpi::OnRspBatchOrderAction(CThostFtdcInputBatchOrderActionField *pInp
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPBATCHORDERACTION, copyData(pInputBatchOrderAction)};
+  Message msg = {ET_RSPBATCHORDERACTION, copyData(pInputBatchOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -388,7 +443,7 @@ void TraderSpi::OnRspOptionSelfCloseInsert(CThostFtdcInputOptionSelfCloseField *
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPOPTIONSELFCLOSEINSERT, copyData(pInputOptionSelfClose)};
+  Message msg = {ET_RSPOPTIONSELFCLOSEINSERT, copyData(pInputOptionSelfClose), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -396,7 +451,7 @@ void TraderSpi::OnRspOptionSelfCloseAction(CThostFtdcInputOptionSelfCloseActionF
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPOPTIONSELFCLOSEACTION, copyData(pInputOptionSelfCloseAction)};
+  Message msg = {ET_RSPOPTIONSELFCLOSEACTION, copyData(pInputOptionSelfCloseAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -404,7 +459,7 @@ void TraderSpi::OnRspCombActionInsert(CThostFtdcInputCombActionField *pInputComb
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPCOMBACTIONINSERT, copyData(pInputCombAction)};
+  Message msg = {ET_RSPCOMBACTIONINSERT, copyData(pInputCombAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -412,7 +467,7 @@ void TraderSpi::OnRspQryOrder(CThostFtdcOrderField *pOrder, CThostFtdcRspInfoFie
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYORDER, copyData(pOrder)};
+  Message msg = {ET_RSPQRYORDER, copyData(pOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -420,7 +475,7 @@ void TraderSpi::OnRspQryTrade(CThostFtdcTradeField *pTrade, CThostFtdcRspInfoFie
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRADE, copyData(pTrade)};
+  Message msg = {ET_RSPQRYTRADE, copyData(pTrade), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -428,7 +483,7 @@ void TraderSpi::OnRspQryInvestorPosition(CThostFtdcInvestorPositionField *pInves
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTORPOSITION, copyData(pInvestorPosition)};
+  Message msg = {ET_RSPQRYINVESTORPOSITION, copyData(pInvestorPosition), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -436,7 +491,7 @@ void TraderSpi::OnRspQryTradingAccount(CThostFtdcTradingAccountField *pTradingAc
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRADINGACCOUNT, copyData(pTradingAccount)};
+  Message msg = {ET_RSPQRYTRADINGACCOUNT, copyData(pTradingAccount), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -444,7 +499,7 @@ void TraderSpi::OnRspQryInvestor(CThostFtdcInvestorField *pInvestor, CThostFtdcR
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTOR, copyData(pInvestor)};
+  Message msg = {ET_RSPQRYINVESTOR, copyData(pInvestor), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -452,7 +507,7 @@ void TraderSpi::OnRspQryTradingCode(CThostFtdcTradingCodeField *pTradingCode, CT
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRADINGCODE, copyData(pTradingCode)};
+  Message msg = {ET_RSPQRYTRADINGCODE, copyData(pTradingCode), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -460,7 +515,7 @@ void TraderSpi::OnRspQryInstrumentMarginRate(CThostFtdcInstrumentMarginRateField
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINSTRUMENTMARGINRATE, copyData(pInstrumentMarginRate)};
+  Message msg = {ET_RSPQRYINSTRUMENTMARGINRATE, copyData(pInstrumentMarginRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -468,7 +523,7 @@ void TraderSpi::OnRspQryInstrumentCommissionRate(CThostFtdcInstrumentCommissionR
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINSTRUMENTCOMMISSIONRATE, copyData(pInstrumentCommissionRate)};
+  Message msg = {ET_RSPQRYINSTRUMENTCOMMISSIONRATE, copyData(pInstrumentCommissionRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -476,7 +531,7 @@ void TraderSpi::OnRspQryExchange(CThostFtdcExchangeField *pExchange, CThostFtdcR
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEXCHANGE, copyData(pExchange)};
+  Message msg = {ET_RSPQRYEXCHANGE, copyData(pExchange), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -484,7 +539,7 @@ void TraderSpi::OnRspQryProduct(CThostFtdcProductField *pProduct, CThostFtdcRspI
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYPRODUCT, copyData(pProduct)};
+  Message msg = {ET_RSPQRYPRODUCT, copyData(pProduct), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -492,7 +547,7 @@ void TraderSpi::OnRspQryInstrument(CThostFtdcInstrumentField *pInstrument, CThos
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINSTRUMENT, copyData(pInstrument)};
+  Message msg = {ET_RSPQRYINSTRUMENT, copyData(pInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -500,7 +555,7 @@ void TraderSpi::OnRspQryDepthMarketData(CThostFtdcDepthMarketDataField *pDepthMa
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYDEPTHMARKETDATA, copyData(pDepthMarketData)};
+  Message msg = {ET_RSPQRYDEPTHMARKETDATA, copyData(pDepthMarketData), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -508,7 +563,7 @@ void TraderSpi::OnRspQryTraderOffer(CThostFtdcTraderOfferField *pTraderOffer, CT
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRADEROFFER, copyData(pTraderOffer)};
+  Message msg = {ET_RSPQRYTRADEROFFER, copyData(pTraderOffer), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -516,7 +571,7 @@ void TraderSpi::OnRspQrySettlementInfo(CThostFtdcSettlementInfoField *pSettlemen
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSETTLEMENTINFO, copyData(pSettlementInfo)};
+  Message msg = {ET_RSPQRYSETTLEMENTINFO, copyData(pSettlementInfo), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -524,7 +579,7 @@ void TraderSpi::OnRspQryTransferBank(CThostFtdcTransferBankField *pTransferBank,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRANSFERBANK, copyData(pTransferBank)};
+  Message msg = {ET_RSPQRYTRANSFERBANK, copyData(pTransferBank), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -532,7 +587,7 @@ void TraderSpi::OnRspQryInvestorPositionDetail(CThostFtdcInvestorPositionDetailF
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTORPOSITIONDETAIL, copyData(pInvestorPositionDetail)};
+  Message msg = {ET_RSPQRYINVESTORPOSITIONDETAIL, copyData(pInvestorPositionDetail), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -540,7 +595,7 @@ void TraderSpi::OnRspQryNotice(CThostFtdcNoticeField *pNotice, CThostFtdcRspInfo
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYNOTICE, copyData(pNotice)};
+  Message msg = {ET_RSPQRYNOTICE, copyData(pNotice), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -548,7 +603,7 @@ void TraderSpi::OnRspQrySettlementInfoConfirm(CThostFtdcSettlementInfoConfirmFie
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSETTLEMENTINFOCONFIRM, copyData(pSettlementInfoConfirm)};
+  Message msg = {ET_RSPQRYSETTLEMENTINFOCONFIRM, copyData(pSettlementInfoConfirm), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -556,7 +611,7 @@ void TraderSpi::OnRspQryInvestorPositionCombineDetail(CThostFtdcInvestorPosition
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTORPOSITIONCOMBINEDETAIL, copyData(pInvestorPositionCombineDetail)};
+  Message msg = {ET_RSPQRYINVESTORPOSITIONCOMBINEDETAIL, copyData(pInvestorPositionCombineDetail), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -564,7 +619,7 @@ void TraderSpi::OnRspQryCFMMCTradingAccountKey(CThostFtdcCFMMCTradingAccountKeyF
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCFMMCTRADINGACCOUNTKEY, copyData(pCFMMCTradingAccountKey)};
+  Message msg = {ET_RSPQRYCFMMCTRADINGACCOUNTKEY, copyData(pCFMMCTradingAccountKey), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -572,7 +627,7 @@ void TraderSpi::OnRspQryEWarrantOffset(CThostFtdcEWarrantOffsetField *pEWarrantO
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEWARRANTOFFSET, copyData(pEWarrantOffset)};
+  Message msg = {ET_RSPQRYEWARRANTOFFSET, copyData(pEWarrantOffset), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -580,7 +635,7 @@ void TraderSpi::OnRspQryInvestorProductGroupMargin(CThostFtdcInvestorProductGrou
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTORPRODUCTGROUPMARGIN, copyData(pInvestorProductGroupMargin)};
+  Message msg = {ET_RSPQRYINVESTORPRODUCTGROUPMARGIN, copyData(pInvestorProductGroupMargin), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -588,7 +643,7 @@ void TraderSpi::OnRspQryExchangeMarginRate(CThostFtdcExchangeMarginRateField *pE
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEXCHANGEMARGINRATE, copyData(pExchangeMarginRate)};
+  Message msg = {ET_RSPQRYEXCHANGEMARGINRATE, copyData(pExchangeMarginRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -596,7 +651,7 @@ void TraderSpi::OnRspQryExchangeMarginRateAdjust(CThostFtdcExchangeMarginRateAdj
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEXCHANGEMARGINRATEADJUST, copyData(pExchangeMarginRateAdjust)};
+  Message msg = {ET_RSPQRYEXCHANGEMARGINRATEADJUST, copyData(pExchangeMarginRateAdjust), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -604,7 +659,7 @@ void TraderSpi::OnRspQryExchangeRate(CThostFtdcExchangeRateField *pExchangeRate,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEXCHANGERATE, copyData(pExchangeRate)};
+  Message msg = {ET_RSPQRYEXCHANGERATE, copyData(pExchangeRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -612,7 +667,7 @@ void TraderSpi::OnRspQrySecAgentACIDMap(CThostFtdcSecAgentACIDMapField *pSecAgen
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSECAGENTACIDMAP, copyData(pSecAgentACIDMap)};
+  Message msg = {ET_RSPQRYSECAGENTACIDMAP, copyData(pSecAgentACIDMap), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -620,7 +675,7 @@ void TraderSpi::OnRspQryProductExchRate(CThostFtdcProductExchRateField *pProduct
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYPRODUCTEXCHRATE, copyData(pProductExchRate)};
+  Message msg = {ET_RSPQRYPRODUCTEXCHRATE, copyData(pProductExchRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -628,7 +683,7 @@ void TraderSpi::OnRspQryProductGroup(CThostFtdcProductGroupField *pProductGroup,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYPRODUCTGROUP, copyData(pProductGroup)};
+  Message msg = {ET_RSPQRYPRODUCTGROUP, copyData(pProductGroup), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -636,7 +691,7 @@ void TraderSpi::OnRspQryMMInstrumentCommissionRate(CThostFtdcMMInstrumentCommiss
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYMMINSTRUMENTCOMMISSIONRATE, copyData(pMMInstrumentCommissionRate)};
+  Message msg = {ET_RSPQRYMMINSTRUMENTCOMMISSIONRATE, copyData(pMMInstrumentCommissionRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -644,7 +699,7 @@ void TraderSpi::OnRspQryMMOptionInstrCommRate(CThostFtdcMMOptionInstrCommRateFie
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYMMOPTIONINSTRCOMMRATE, copyData(pMMOptionInstrCommRate)};
+  Message msg = {ET_RSPQRYMMOPTIONINSTRCOMMRATE, copyData(pMMOptionInstrCommRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -652,7 +707,7 @@ void TraderSpi::OnRspQryInstrumentOrderCommRate(CThostFtdcInstrumentOrderCommRat
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINSTRUMENTORDERCOMMRATE, copyData(pInstrumentOrderCommRate)};
+  Message msg = {ET_RSPQRYINSTRUMENTORDERCOMMRATE, copyData(pInstrumentOrderCommRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -660,7 +715,7 @@ void TraderSpi::OnRspQrySecAgentTradingAccount(CThostFtdcTradingAccountField *pT
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSECAGENTTRADINGACCOUNT, copyData(pTradingAccount)};
+  Message msg = {ET_RSPQRYSECAGENTTRADINGACCOUNT, copyData(pTradingAccount), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -668,7 +723,7 @@ void TraderSpi::OnRspQrySecAgentCheckMode(CThostFtdcSecAgentCheckModeField *pSec
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSECAGENTCHECKMODE, copyData(pSecAgentCheckMode)};
+  Message msg = {ET_RSPQRYSECAGENTCHECKMODE, copyData(pSecAgentCheckMode), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -676,7 +731,7 @@ void TraderSpi::OnRspQrySecAgentTradeInfo(CThostFtdcSecAgentTradeInfoField *pSec
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYSECAGENTTRADEINFO, copyData(pSecAgentTradeInfo)};
+  Message msg = {ET_RSPQRYSECAGENTTRADEINFO, copyData(pSecAgentTradeInfo), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -684,7 +739,7 @@ void TraderSpi::OnRspQryOptionInstrTradeCost(CThostFtdcOptionInstrTradeCostField
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYOPTIONINSTRTRADECOST, copyData(pOptionInstrTradeCost)};
+  Message msg = {ET_RSPQRYOPTIONINSTRTRADECOST, copyData(pOptionInstrTradeCost), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -692,7 +747,7 @@ void TraderSpi::OnRspQryOptionInstrCommRate(CThostFtdcOptionInstrCommRateField *
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYOPTIONINSTRCOMMRATE, copyData(pOptionInstrCommRate)};
+  Message msg = {ET_RSPQRYOPTIONINSTRCOMMRATE, copyData(pOptionInstrCommRate), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -700,7 +755,7 @@ void TraderSpi::OnRspQryExecOrder(CThostFtdcExecOrderField *pExecOrder, CThostFt
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYEXECORDER, copyData(pExecOrder)};
+  Message msg = {ET_RSPQRYEXECORDER, copyData(pExecOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -708,7 +763,7 @@ void TraderSpi::OnRspQryForQuote(CThostFtdcForQuoteField *pForQuote, CThostFtdcR
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYFORQUOTE, copyData(pForQuote)};
+  Message msg = {ET_RSPQRYFORQUOTE, copyData(pForQuote), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -716,7 +771,7 @@ void TraderSpi::OnRspQryQuote(CThostFtdcQuoteField *pQuote, CThostFtdcRspInfoFie
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYQUOTE, copyData(pQuote)};
+  Message msg = {ET_RSPQRYQUOTE, copyData(pQuote), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -724,7 +779,7 @@ void TraderSpi::OnRspQryOptionSelfClose(CThostFtdcOptionSelfCloseField *pOptionS
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYOPTIONSELFCLOSE, copyData(pOptionSelfClose)};
+  Message msg = {ET_RSPQRYOPTIONSELFCLOSE, copyData(pOptionSelfClose), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -732,7 +787,7 @@ void TraderSpi::OnRspQryInvestUnit(CThostFtdcInvestUnitField *pInvestUnit, CThos
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYINVESTUNIT, copyData(pInvestUnit)};
+  Message msg = {ET_RSPQRYINVESTUNIT, copyData(pInvestUnit), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -740,7 +795,7 @@ void TraderSpi::OnRspQryCombInstrumentGuard(CThostFtdcCombInstrumentGuardField *
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCOMBINSTRUMENTGUARD, copyData(pCombInstrumentGuard)};
+  Message msg = {ET_RSPQRYCOMBINSTRUMENTGUARD, copyData(pCombInstrumentGuard), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -748,7 +803,7 @@ void TraderSpi::OnRspQryCombAction(CThostFtdcCombActionField *pCombAction, CThos
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCOMBACTION, copyData(pCombAction)};
+  Message msg = {ET_RSPQRYCOMBACTION, copyData(pCombAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -756,7 +811,7 @@ void TraderSpi::OnRspQryTransferSerial(CThostFtdcTransferSerialField *pTransferS
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRANSFERSERIAL, copyData(pTransferSerial)};
+  Message msg = {ET_RSPQRYTRANSFERSERIAL, copyData(pTransferSerial), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -764,13 +819,13 @@ void TraderSpi::OnRspQryAccountregister(CThostFtdcAccountregisterField *pAccount
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYACCOUNTREGISTER, copyData(pAccountregister)};
+  Message msg = {ET_RSPQRYACCOUNTREGISTER, copyData(pAccountregister), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
 
 void TraderSpi::OnRspError(CThostFtdcRspInfoField *pRspInfo, int nRequestID, bool bIsLast) {
-  Message msg = {ET_RSPERROR, copyData(pRspInfo)};
+  Message msg = {ET_RSPERROR, copyData(pRspInfo), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -926,7 +981,7 @@ void TraderSpi::OnRspQryContractBank(CThostFtdcContractBankField *pContractBank,
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCONTRACTBANK, copyData(pContractBank)};
+  Message msg = {ET_RSPQRYCONTRACTBANK, copyData(pContractBank), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -934,7 +989,7 @@ void TraderSpi::OnRspQryParkedOrder(CThostFtdcParkedOrderField *pParkedOrder, CT
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYPARKEDORDER, copyData(pParkedOrder)};
+  Message msg = {ET_RSPQRYPARKEDORDER, copyData(pParkedOrder), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -942,7 +997,7 @@ void TraderSpi::OnRspQryParkedOrderAction(CThostFtdcParkedOrderActionField *pPar
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYPARKEDORDERACTION, copyData(pParkedOrderAction)};
+  Message msg = {ET_RSPQRYPARKEDORDERACTION, copyData(pParkedOrderAction), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -950,7 +1005,7 @@ void TraderSpi::OnRspQryTradingNotice(CThostFtdcTradingNoticeField *pTradingNoti
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYTRADINGNOTICE, copyData(pTradingNotice)};
+  Message msg = {ET_RSPQRYTRADINGNOTICE, copyData(pTradingNotice), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -958,7 +1013,7 @@ void TraderSpi::OnRspQryBrokerTradingParams(CThostFtdcBrokerTradingParamsField *
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYBROKERTRADINGPARAMS, copyData(pBrokerTradingParams)};
+  Message msg = {ET_RSPQRYBROKERTRADINGPARAMS, copyData(pBrokerTradingParams), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -966,7 +1021,7 @@ void TraderSpi::OnRspQryBrokerTradingAlgos(CThostFtdcBrokerTradingAlgosField *pB
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYBROKERTRADINGALGOS, copyData(pBrokerTradingAlgos)};
+  Message msg = {ET_RSPQRYBROKERTRADINGALGOS, copyData(pBrokerTradingAlgos), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -974,7 +1029,7 @@ void TraderSpi::OnRspQueryCFMMCTradingAccountToken(CThostFtdcQueryCFMMCTradingAc
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQUERYCFMMCTRADINGACCOUNTTOKEN, copyData(pQueryCFMMCTradingAccountToken)};
+  Message msg = {ET_RSPQUERYCFMMCTRADINGACCOUNTTOKEN, copyData(pQueryCFMMCTradingAccountToken), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1077,7 +1132,7 @@ void TraderSpi::OnRspFromBankToFutureByFuture(CThostFtdcReqTransferField *pReqTr
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPFROMBANKTOFUTUREBYFUTURE, copyData(pReqTransfer)};
+  Message msg = {ET_RSPFROMBANKTOFUTUREBYFUTURE, copyData(pReqTransfer), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1085,7 +1140,7 @@ void TraderSpi::OnRspFromFutureToBankByFuture(CThostFtdcReqTransferField *pReqTr
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPFROMFUTURETOBANKBYFUTURE, copyData(pReqTransfer)};
+  Message msg = {ET_RSPFROMFUTURETOBANKBYFUTURE, copyData(pReqTransfer), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1093,7 +1148,7 @@ void TraderSpi::OnRspQueryBankAccountMoneyByFuture(CThostFtdcReqQueryAccountFiel
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQUERYBANKACCOUNTMONEYBYFUTURE, copyData(pReqQueryAccount)};
+  Message msg = {ET_RSPQUERYBANKACCOUNTMONEYBYFUTURE, copyData(pReqQueryAccount), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1116,7 +1171,7 @@ void TraderSpi::OnRspQryClassifiedInstrument(CThostFtdcInstrumentField *pInstrum
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCLASSIFIEDINSTRUMENT, copyData(pInstrument)};
+  Message msg = {ET_RSPQRYCLASSIFIEDINSTRUMENT, copyData(pInstrument), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1124,7 +1179,7 @@ void TraderSpi::OnRspQryCombPromotionParam(CThostFtdcCombPromotionParamField *pC
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYCOMBPROMOTIONPARAM, copyData(pCombPromotionParam)};
+  Message msg = {ET_RSPQRYCOMBPROMOTIONPARAM, copyData(pCombPromotionParam), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1132,7 +1187,7 @@ void TraderSpi::OnRspQryRiskSettleInvstPosition(CThostFtdcRiskSettleInvstPositio
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYRISKSETTLEINVSTPOSITION, copyData(pRiskSettleInvstPosition)};
+  Message msg = {ET_RSPQRYRISKSETTLEINVSTPOSITION, copyData(pRiskSettleInvstPosition), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
@@ -1140,7 +1195,7 @@ void TraderSpi::OnRspQryRiskSettleProductStatus(CThostFtdcRiskSettleProductStatu
   if (checkErrorRspInfo(pRspInfo, nRequestID, bIsLast))
     return;
 
-  Message msg = {ET_RSPQRYRISKSETTLEPRODUCTSTATUS, copyData(pRiskSettleProductStatus)};
+  Message msg = {ET_RSPQRYRISKSETTLEPRODUCTSTATUS, copyData(pRiskSettleProductStatus), nRequestID, bIsLast};
   _msgq.push(msg);
 }
 
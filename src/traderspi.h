@@ -147,18 +147,26 @@
 #define ET_RSPQRYCOMBPROMOTIONPARAM                 (ET_BASE + 128)
 #define ET_RSPQRYRISKSETTLEINVSTPOSITION            (ET_BASE + 129)
 #define ET_RSPQRYRISKSETTLEPRODUCTSTATUS            (ET_BASE + 130)
+#define ET_COUNT                                    131
 
 class TraderSpi : public CThostFtdcTraderSpi {
 public:
-  TraderSpi();
+  TraderSpi(size_t capacity = MESSAGE_QUEUE_CAPACITY);
   virtual ~TraderSpi();
 
   int poll(Message *message, unsigned int millisec = UINT_MAX);
-  void done(Message &message);
+  int pollUntil(Message *message, uint64_t deadline);
   void quit(int nCode = 0);
+  void close();
+
+  void setOverflowPolicy(int event, int policy);
+  void getQueueStats(QueueStats *stats);
 
 public:
+  static void done(Message &message);
   static const char *eventName(int event);
+  static int eventId(const char *name);
+  static bool isLossless(int event);
 
 public:
   virtual void OnFrontConnected();
@@ -0,0 +1,298 @@
+/*
+ * ctpstructs.js
+ *
+ * Copyright (c) 2022, 2023 Xiongfei Shi
+ *
+ * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>
+ * License: Apache-2.0
+ *
+ * https://github.com/shixiongfei/napi-ctp
+ */
+
+// Generates src/ctpstructs.h, the field descriptors of every CTP struct,
+// from the headers in tradeapi/, and ctpstructs.js with its typings in
+// ctpstructs.d.ts, the layouts of the structs events deliver as raw buffers.
+// The build never runs it, run `npm run generate` after upgrading the CTP
+// API or changing the message tables and commit what it writes.
+
+const fs = require("fs");
+const path = require("path");
+
+const root = path.join(__dirname, "..");
+const dataTypeFile = path.join(root, "tradeapi", "ThostFtdcUserApiDataType.h");
+const structFile = path.join(root, "tradeapi", "ThostFtdcUserApiStruct.h");
+const outputFile = path.join(root, "src", "ctpstructs.h");
+const layoutFile = path.join(root, "ctpstructs.js");
+const typingFile = path.join(root, "ctpstructs.d.ts");
+
+// The structs of events, the dispatch table of events and their names, per API.
+const messageFile = path.join(root, "src", "ctpmsg.h");
+const apis = [
+  { key: "marketData", table: path.join(root, "src", "mdmsg.cpp"), names: path.join(root, "src", "mdspi.cpp") },
+  { key: "trader", table: path.join(root, "src", "tradermsg.cpp"), names: path.join(root, "src", "traderspi.cpp") },
+];
+
+const fieldTypes = {
+  char: "CTP_FIELD_CHAR",
+  short: "CTP_FIELD_INT16",
+  int: "CTP_FIELD_INT32",
+  double: "CTP_FIELD_DOUBLE",
+};
+
+// CTP declares no packing, every type sits on its natural alignment.
+const layoutTypes = {
+  CTP_FIELD_STRING: { type: "string", align: 1 },
+  CTP_FIELD_CHAR: { type: "char", size: 1, align: 1 },
+  CTP_FIELD_INT16: { type: "int16", size: 2, align: 2 },
+  CTP_FIELD_INT32: { type: "int32", size: 4, align: 4 },
+  CTP_FIELD_DOUBLE: { type: "double", size: 8, align: 8 },
+};
+
+// The comments are GBK, only the ASCII declarations matter.
+const readHeader = (file) => fs.readFileSync(file, "latin1");
+
+const parseDataTypes = (source) => {
+  const types = new Map();
+  const pattern = /^typedef\s+(\w+)\s+(TThostFtdc\w+Type)(\[\d+\])?;/gm;
+
+  for (const [, base, name, array] of source.matchAll(pattern)) {
+    if (!(base in fieldTypes)) {
+      throw new Error(`Unknown base type ${base} of ${name}`);
+    }
+
+    const length = array ? parseInt(array.slice(1, -1), 10) : 1;
+    types.set(name, { kind: array && base === "char" ? "CTP_FIELD_STRING" : fieldTypes[base], length });
+  }
+
+  return types;
+};
+
+const alignTo = (offset, align) => Math.ceil(offset / align) * align;
+
+const parseStructs = (source, types) => {
+  const structs = [];
+  const pattern = /^struct\s+(CThostFtdc\w+Field)\s*\{([^}]*)\};/gm;
+
+  for (const [, name, body] of source.matchAll(pattern)) {
+    const fields = [];
+    let size = 0, align = 1;
+
+    for (const line of body.split(/\r?\n/)) {
+      const declaration = line.trim();
+
+      if (!declaration || declaration.startsWith("//")) {
+        continue;
+      }
+
+      const match = /^(TThostFtdc\w+Type)\s+(\w+);$/.exec(declaration);
+
+      if (!match || !types.has(match[1])) {
+        throw new Error(`Unknown field "${declaration}" in ${name}`);
+      }
+
+      const { kind, length } = types.get(match[1]);
+      const layout = layoutTypes[kind];
+      const offset = alignTo(size, layout.align);
+      const fieldSize = layout.size || length;
+
+      fields.push({ name: match[2], type: kind, layout: layout.type, offset, size: fieldSize });
+      size = offset + fieldSize;
+      align = Math.max(align, layout.align);
+    }
+
+    structs.push({ name, size: alignTo(size, align), fields });
+  }
+
+  return structs;
+};
+
+const continued = (line) => line.padEnd(79) + "\\";
+
+const generate = (structs) => {
+  const lines = [
+    "/*",
+    " * ctpstructs.h",
+    " *",
+    " * Copyright (c) 2022, 2023 Xiongfei Shi",
+    " *",
+    " * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>",
+    " * License: Apache-2.0",
+    " *",
+    " * https://github.com/shixiongfei/napi-ctp",
+    " */",
+    "",
+    "/*",
+    " * Generated by tools/ctpstructs.js from tradeapi/ThostFtdcUserApiStruct.h,",
+    " * do not edit. CTP_STRUCTS lists every struct as X(struct, size),",
+    " * CTP_FIELDS_<struct> its fields in declaration order as",
+    " * F(struct, field, type).",
+    " */",
+    "",
+    "#ifndef __CTPSTRUCTS_H__",
+    "#define __CTPSTRUCTS_H__",
+    "",
+    continued("#define CTP_STRUCTS(X)"),
+  ];
+
+  structs.forEach(({ name, size }, i) => {
+    const line = `  X(${name}, ${size})`;
+    lines.push(i < structs.length - 1 ? continued(line) : line);
+  });
+
+  for (const { name, fields } of structs) {
+    lines.push("", continued(`#define CTP_FIELDS_${name}(F)`));
+
+    fields.forEach((field, i) => {
+      const line = `  F(${name}, ${field.name}, ${field.type})`;
+      lines.push(i < fields.length - 1 ? continued(line) : line);
+    });
+  }
+
+  lines.push("", "#endif /* __CTPSTRUCTS_H__ */", "");
+
+  return lines.join("\n");
+};
+
+// event name -> struct, for the events whose message converter takes a CTP struct.
+const parseEvents = (structs) => {
+  const converters = new Map();
+  const events = {};
+
+  for (const [, func, type] of fs.readFileSync(messageFile, "utf8").matchAll(/^\s*X\((\w+), (CThostFtdc\w+Field)\)/gm)) {
+    converters.set(func, type);
+  }
+
+  for (const { key, table, names } of apis) {
+    const eventNames = new Map();
+
+    for (const [, event, name] of fs.readFileSync(names, "utf8").matchAll(/\{(E[MT]_\w+),\s*"([^"]+)"\}/g)) {
+      eventNames.set(event, name);
+    }
+
+    events[key] = {};
+
+    for (const [, event, func] of fs.readFileSync(table, "utf8").matchAll(/\{(E[MT]_\w+),\s*CTP_MESSAGE\((\w+)\)\}/g)) {
+      if (!eventNames.has(event) || !converters.has(func) || !structs.has(converters.get(func))) {
+        throw new Error(`Unknown event ${event} of ${func}`);
+      }
+
+      events[key][eventNames.get(event)] = converters.get(func);
+    }
+  }
+
+  return events;
+};
+
+const usedStructs = (structs, events) => {
+  const names = new Set();
+
+  for (const api of Object.values(events)) {
+    Object.values(api).forEach((name) => names.add(name));
+  }
+
+  return [...structs.values()].filter(({ name }) => names.has(name));
+};
+
+const fileHeader = (file) => [
+  "/*",
+  ` * ${file}`,
+  " *",
+  " * Copyright (c) 2022, 2023 Xiongfei Shi",
+  " *",
+  " * Author: Xiongfei Shi <xiongfei.shi(a)icloud.com>",
+  " * License: Apache-2.0",
+  " *",
+  " * https://github.com/shixiongfei/napi-ctp",
+  " */",
+  "",
+  "// Generated by tools/ctpstructs.js, do not edit. The layouts of the CTP",
+  "// structs raw events deliver, and the struct of every such event.",
+  "",
+];
+
+const generateLayouts = (structs, events) => {
+  const lines = [...fileHeader("ctpstructs.js"), "exports.structs = {"];
+
+  for (const { name, size, fields } of structs) {
+    lines.push(`  ${name}: {`, `    size: ${size},`, "    fields: {");
+
+    for (const field of fields) {
+      lines.push(`      ${field.name}: { offset: ${field.offset}, type: "${field.layout}", size: ${field.size} },`);
+    }
+
+    lines.push("    },", "  },");
+  }
+
+  lines.push("};", "", "exports.events = {");
+
+  for (const [key, api] of Object.entries(events)) {
+    lines.push(`  ${key}: {`);
+
+    for (const [event, name] of Object.entries(api)) {
+      lines.push(`    "${event}": "${name}",`);
+    }
+
+    lines.push("  },");
+  }
+
+  lines.push("};", "");
+
+  return lines.join("\n");
+};
+
+const generateTypings = (structs, events) => {
+  const interfaces = { marketData: "MarketDataEventStructs", trader: "TraderEventStructs" };
+  const lines = [...fileHeader("ctpstructs.d.ts"), "/** 原始投递的结构体布局, 偏移及长度以字节计 */", "export interface StructLayouts {"];
+
+  for (const { name, size, fields } of structs) {
+    lines.push(`  ${name}: {`, `    size: ${size};`, "    fields: {");
+
+    for (const field of fields) {
+      lines.push(`      ${field.name}: { offset: ${field.offset}; type: "${field.layout}"; size: ${field.size} };`);
+    }
+
+    lines.push("    };", "  };");
+  }
+
+  lines.push("}");
+
+  for (const [key, api] of Object.entries(events)) {
+    lines.push("", `/** ${key === "trader" ? "交易" : "行情"}事件投递的结构体 */`, `export interface ${interfaces[key]} {`);
+
+    for (const [event, name] of Object.entries(api)) {
+      lines.push(`  "${event}": "${name}";`);
+    }
+
+    lines.push("}");
+  }
+
+  lines.push(
+    "",
+    "export declare const structs: StructLayouts;",
+    "",
+    "export declare const events: {",
+    ...Object.entries(interfaces).map(([key, name]) => `  ${key}: ${name};`),
+    "};",
+    ""
+  );
+
+  return lines.join("\n");
+};
+
+const writeIfChanged = (file, output) => {
+  if (!fs.existsSync(file) || fs.readFileSync(file, "utf8") !== output) {
+    fs.writeFileSync(file, output);
+  }
+};
+
+const types = parseDataTypes(readHeader(dataTypeFile));
+const structs = parseStructs(readHeader(structFile), types);
+const structsByName = new Map(structs.map((struct) => [struct.name, struct]));
+const events = parseEvents(structsByName);
+const layouts = usedStructs(structsByName, events);
+
+writeIfChanged(outputFile, generate(structs));
+writeIfChanged(layoutFile, generateLayouts(layouts, events));
+writeIfChanged(typingFile, generateTypings(layouts, events));
+
+console.log(`${structs.length} structs, ${structs.reduce((n, s) => n + s.fields.length, 0)} fields, ${layouts.length} raw layouts`);